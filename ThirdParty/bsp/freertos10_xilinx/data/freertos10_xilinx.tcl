@@ -424,7 +424,11 @@ proc generate {os_handle} {
 	file copy -force [file join src Source list.c] ./src
 	file copy -force [file join src Source timers.c] ./src
 	file copy -force [file join src Source event_groups.c] ./src
-	file copy -force [file join src Source portable MemMang heap_4.c] ./src
+	set heap_type [common::get_property CONFIG.heap_type $os_handle]
+	if {$heap_type == ""} {
+		set heap_type "heap_4"
+	}
+	file copy -force [file join src Source portable MemMang $heap_type.c] ./src
         set stream_buffer_enabled [common::get_property CONFIG.stream_buffer $os_handle]
         set message_buffer_enabled [common::get_property CONFIG.message_buffer $os_handle]
         if {$stream_buffer_enabled == "true" || $message_buffer_enabled == "true"} {
@@ -0,0 +1,710 @@
+/*
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Host replay harness for the FreeRTOS heap implementations.
+ *
+ * The same allocation trace is replayed through heap_4.c and heap_tlsf.c,
+ * which the Makefile builds with configTOTAL_HEAP_SIZE and portBYTE_ALIGNMENT
+ * of the target.  For each heap the harness reports the average, 99th
+ * percentile and worst case host time of pvPortMalloc() and vPortFree(), the
+ * number of failed allocations, the minimum ever free space and the
+ * fragmentation of the free space, sampled during the replay as the share of
+ * the free space outside the largest free block.  For heap_tlsf.c it also
+ * cross checks the statistics returned by vPortGetTlsfHeapStats().  The times
+ * are corrected by the cost of reading the clock, the worst case also
+ * includes preemption of the harness by the host and is best compared over
+ * several runs.
+ *
+ * Every allocated block is filled with a pattern derived from its id, which
+ * is checked when the block is freed, so blocks that overlap or are corrupted
+ * by the heap are reported as errors.
+ *
+ * Usage: heap_replay [-n iterations] [-o ops] [-s seed] [-w] [trace]
+ *
+ *  -n  Number of times the trace is replayed, times are taken over all runs.
+ *  -o  Number of operations of the generated trace, default 200000.
+ *  -s  Seed of the generated trace, default 1.
+ *  -w  Writes the trace to stdout instead of replaying it.
+ *
+ * A trace has one operation per line, "m <id> <size>" allocates size bytes
+ * as block id and "f <id>" frees block id.  Lines starting with '#' are
+ * ignored.  Blocks that are still allocated at the end of the trace are
+ * freed, so every run starts from an empty heap.  Without a trace file a
+ * trace is generated that mixes short lived small blocks, network buffers of
+ * about 1.5KB and long lived task stacks and file system buffers, keeping the
+ * heap about two thirds full.
+ *
+ * The exit status is non zero if a block was corrupted or the statistics of
+ * heap_tlsf.c do not match the replay.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <getopt.h>
+
+#include "FreeRTOS.h"
+
+#define replayDEFAULT_OPS             200000U
+#define replayDEFAULT_SEED            1U
+#define replayFILL_PERCENT            66U    /* Live bytes the generated trace aims for. */
+#define replaySAMPLE_INTERVAL         256U   /* Operations between fragmentation samples. */
+#define replayLATENCY_BUCKETS         65536U /* Latency histogram, one ns per bucket. */
+
+typedef enum
+{
+    eReplayMalloc,
+    eReplayFree
+} ReplayOpType_t;
+
+typedef struct
+{
+    ReplayOpType_t eType;
+    uint32_t ulId;
+    size_t xSize;
+} ReplayOp_t;
+
+typedef struct
+{
+    uint64_t ullCount;
+    uint64_t ullTotalNs;
+    uint64_t ullMaxNs;
+    uint64_t * pullHistogram;
+} ReplayLatency_t;
+
+typedef struct
+{
+    const char * pcName;
+    void * ( *pvMalloc )( size_t xWantedSize );
+    void ( *vFree )( void * pv );
+    void ( *vGetHeapStats )( HeapStats_t * pxHeapStats );
+    void ( *vGetTlsfHeapStats )( TlsfHeapStats_t * pxTlsfHeapStats );
+} ReplayHeap_t;
+
+/* The heaps are built with their API renamed, see the Makefile. */
+void * pvHeap4Malloc( size_t xWantedSize );
+void vHeap4Free( void * pv );
+void vHeap4GetHeapStats( HeapStats_t * pxHeapStats );
+void * pvTlsfMalloc( size_t xWantedSize );
+void vTlsfFree( void * pv );
+void vTlsfGetHeapStats( HeapStats_t * pxHeapStats );
+void vTlsfGetTlsfHeapStats( TlsfHeapStats_t * pxTlsfHeapStats );
+
+static const ReplayHeap_t xHeaps[] =
+{
+    { "heap_4",    pvHeap4Malloc, vHeap4Free, vHeap4GetHeapStats, NULL                  },
+    { "heap_tlsf", pvTlsfMalloc,  vTlsfFree,  vTlsfGetHeapStats,  vTlsfGetTlsfHeapStats },
+};
+
+static ReplayOp_t * pxOps;
+static size_t xOpCount;
+static size_t xOpCapacity;
+static uint32_t ulMaxId;
+static uint64_t ullClockOverhead;
+
+/*-----------------------------------------------------------*/
+
+static void prvAddOp( ReplayOpType_t eType,
+                      uint32_t ulId,
+                      size_t xSize )
+{
+    if( xOpCount == xOpCapacity )
+    {
+        xOpCapacity = ( xOpCapacity == 0U ) ? 4096U : ( xOpCapacity * 2U );
+        pxOps = realloc( pxOps, xOpCapacity * sizeof( ReplayOp_t ) );
+
+        if( pxOps == NULL )
+        {
+            fprintf( stderr, "Out of memory\n" );
+            exit( 1 );
+        }
+    }
+
+    pxOps[ xOpCount ].eType = eType;
+    pxOps[ xOpCount ].ulId = ulId;
+    pxOps[ xOpCount ].xSize = xSize;
+    xOpCount++;
+
+    if( ulId > ulMaxId )
+    {
+        ulMaxId = ulId;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static int prvLoadTrace( const char * pcFileName )
+{
+    FILE * pxFile;
+    char cLine[ 128 ];
+    unsigned long ulId;
+    unsigned long ulSize;
+    unsigned long ulLine = 0;
+
+    pxFile = fopen( pcFileName, "r" );
+
+    if( pxFile == NULL )
+    {
+        perror( pcFileName );
+        return -1;
+    }
+
+    while( fgets( cLine, sizeof( cLine ), pxFile ) != NULL )
+    {
+        ulLine++;
+
+        if( ( cLine[ 0 ] == '#' ) || ( cLine[ 0 ] == '\n' ) )
+        {
+            continue;
+        }
+
+        if( sscanf( cLine, "m %lu %lu", &ulId, &ulSize ) == 2 )
+        {
+            prvAddOp( eReplayMalloc, ( uint32_t ) ulId, ( size_t ) ulSize );
+        }
+        else if( sscanf( cLine, "f %lu", &ulId ) == 1 )
+        {
+            prvAddOp( eReplayFree, ( uint32_t ) ulId, 0 );
+        }
+        else
+        {
+            fprintf( stderr, "%s:%lu: invalid operation\n", pcFileName, ulLine );
+            fclose( pxFile );
+            return -1;
+        }
+    }
+
+    fclose( pxFile );
+
+    return 0;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRand( uint32_t * pulState )
+{
+    /* xorshift32, so the generated trace is the same on every host. */
+    uint32_t ulX = *pulState;
+
+    ulX ^= ulX << 13;
+    ulX ^= ulX >> 17;
+    ulX ^= ulX << 5;
+    *pulState = ulX;
+
+    return ulX;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvRandSize( uint32_t * pulState,
+                           BaseType_t * pxLongLived )
+{
+    uint32_t ulClass = prvRand( pulState ) % 100U;
+
+    *pxLongLived = pdFALSE;
+
+    if( ulClass < 50U )
+    {
+        /* Timers, queue items, pbuf headers. */
+        return 16U + ( prvRand( pulState ) % 112U );
+    }
+    else if( ulClass < 80U )
+    {
+        /* Protocol control blocks, small messages. */
+        return 128U + ( prvRand( pulState ) % 512U );
+    }
+    else if( ulClass < 95U )
+    {
+        /* Ethernet frame buffers. */
+        return 1514U + ( prvRand( pulState ) % 192U );
+    }
+
+    /* Task stacks and file system buffers. */
+    *pxLongLived = pdTRUE;
+
+    return 2048U + ( prvRand( pulState ) % 14336U );
+}
+/*-----------------------------------------------------------*/
+
+static void prvGenerateTrace( size_t xOps,
+                              uint32_t ulSeed )
+{
+    uint32_t ulState = ( ulSeed != 0U ) ? ulSeed : 1U;
+    uint32_t * pulLive;
+    size_t * pxLiveSize;
+    size_t xLive = 0;
+    size_t xShortLived = 0;
+    size_t xLiveBytes = 0;
+    size_t xTarget = ( ( size_t ) configTOTAL_HEAP_SIZE * replayFILL_PERCENT ) / 100U;
+    uint32_t ulNextId = 0;
+    size_t xIndex;
+    size_t xSize;
+    BaseType_t xLongLived;
+
+    /* The live blocks, long lived blocks are kept at the front so they are
+     * freed less often than the short lived ones. */
+    pulLive = malloc( xOps * sizeof( uint32_t ) );
+    pxLiveSize = malloc( xOps * sizeof( size_t ) );
+
+    if( ( pulLive == NULL ) || ( pxLiveSize == NULL ) )
+    {
+        fprintf( stderr, "Out of memory\n" );
+        exit( 1 );
+    }
+
+    while( xOpCount < xOps )
+    {
+        BaseType_t xAllocate;
+
+        if( xLive == 0U )
+        {
+            xAllocate = pdTRUE;
+        }
+        else if( xLiveBytes < xTarget )
+        {
+            xAllocate = ( ( prvRand( &ulState ) % 100U ) < 60U ) ? pdTRUE : pdFALSE;
+        }
+        else
+        {
+            xAllocate = ( ( prvRand( &ulState ) % 100U ) < 40U ) ? pdTRUE : pdFALSE;
+        }
+
+        if( xAllocate != pdFALSE )
+        {
+            xSize = prvRandSize( &ulState, &xLongLived );
+            prvAddOp( eReplayMalloc, ulNextId, xSize );
+
+            if( xLongLived != pdFALSE )
+            {
+                /* Move the first short lived block to the back. */
+                pulLive[ xLive ] = pulLive[ xLive - xShortLived ];
+                pxLiveSize[ xLive ] = pxLiveSize[ xLive - xShortLived ];
+                pulLive[ xLive - xShortLived ] = ulNextId;
+                pxLiveSize[ xLive - xShortLived ] = xSize;
+            }
+            else
+            {
+                pulLive[ xLive ] = ulNextId;
+                pxLiveSize[ xLive ] = xSize;
+                xShortLived++;
+            }
+
+            xLive++;
+            xLiveBytes += xSize;
+            ulNextId++;
+        }
+        else
+        {
+            /* One in sixteen frees releases a long lived block. */
+            if( ( xShortLived == 0U ) ||
+                ( ( xShortLived < xLive ) && ( ( prvRand( &ulState ) % 16U ) == 0U ) ) )
+            {
+                xIndex = prvRand( &ulState ) % ( xLive - xShortLived );
+
+                /* Keep the long lived blocks contiguous. */
+                prvAddOp( eReplayFree, pulLive[ xIndex ], 0 );
+                xLiveBytes -= pxLiveSize[ xIndex ];
+                pulLive[ xIndex ] = pulLive[ xLive - xShortLived - 1U ];
+                pxLiveSize[ xIndex ] = pxLiveSize[ xLive - xShortLived - 1U ];
+                pulLive[ xLive - xShortLived - 1U ] = pulLive[ xLive - 1U ];
+                pxLiveSize[ xLive - xShortLived - 1U ] = pxLiveSize[ xLive - 1U ];
+            }
+            else
+            {
+                xIndex = ( xLive - xShortLived ) + ( prvRand( &ulState ) % xShortLived );
+
+                prvAddOp( eReplayFree, pulLive[ xIndex ], 0 );
+                xLiveBytes -= pxLiveSize[ xIndex ];
+                pulLive[ xIndex ] = pulLive[ xLive - 1U ];
+                pxLiveSize[ xIndex ] = pxLiveSize[ xLive - 1U ];
+                xShortLived--;
+            }
+
+            xLive--;
+        }
+    }
+
+    free( pulLive );
+    free( pxLiveSize );
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvNow( void )
+{
+    struct timespec xTime;
+
+    clock_gettime( CLOCK_MONOTONIC, &xTime );
+
+    return ( ( uint64_t ) xTime.tv_sec * 1000000000ULL ) + ( uint64_t ) xTime.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvClockOverhead( void )
+{
+    uint64_t ullMin = UINT64_MAX;
+    uint64_t ullStart;
+    uint64_t ullNs;
+    uint32_t ulRun;
+
+    for( ulRun = 0; ulRun < 1000U; ulRun++ )
+    {
+        ullStart = prvNow();
+        ullNs = prvNow() - ullStart;
+
+        if( ullNs < ullMin )
+        {
+            ullMin = ullNs;
+        }
+    }
+
+    return ullMin;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRecordLatency( ReplayLatency_t * pxLatency,
+                              uint64_t ullNs )
+{
+    ullNs = ( ullNs > ullClockOverhead ) ? ( ullNs - ullClockOverhead ) : 0U;
+
+    pxLatency->ullCount++;
+    pxLatency->ullTotalNs += ullNs;
+
+    if( ullNs > pxLatency->ullMaxNs )
+    {
+        pxLatency->ullMaxNs = ullNs;
+    }
+
+    if( ullNs >= replayLATENCY_BUCKETS )
+    {
+        ullNs = replayLATENCY_BUCKETS - 1U;
+    }
+
+    pxLatency->pullHistogram[ ullNs ]++;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvPercentile( const ReplayLatency_t * pxLatency,
+                               uint32_t ulPercent )
+{
+    uint64_t ullLimit = ( pxLatency->ullCount * ulPercent ) / 100U;
+    uint64_t ullSeen = 0;
+    uint32_t ulBucket;
+
+    for( ulBucket = 0; ulBucket < replayLATENCY_BUCKETS; ulBucket++ )
+    {
+        ullSeen += pxLatency->pullHistogram[ ulBucket ];
+
+        if( ullSeen > ullLimit )
+        {
+            break;
+        }
+    }
+
+    return ulBucket;
+}
+/*-----------------------------------------------------------*/
+
+static uint8_t prvPattern( uint32_t ulId )
+{
+    return ( uint8_t ) ( ( ulId * 0x9dU ) ^ ( ulId >> 8 ) ^ 0x5aU );
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvFragmentation( const HeapStats_t * pxStats )
+{
+    if( pxStats->xAvailableHeapSpaceInBytes == 0U )
+    {
+        return 0;
+    }
+
+    return 100U - ( size_t ) ( ( ( uint64_t ) pxStats->xSizeOfLargestFreeBlockInBytes * 100U ) /
+                               pxStats->xAvailableHeapSpaceInBytes );
+}
+/*-----------------------------------------------------------*/
+
+static int prvReplay( const ReplayHeap_t * pxHeap,
+                      uint32_t ulIterations )
+{
+    uint8_t ** ppucBlocks;
+    size_t * pxSizes;
+    ReplayLatency_t xMallocLatency = { 0 };
+    ReplayLatency_t xFreeLatency = { 0 };
+    HeapStats_t xStats;
+    TlsfHeapStats_t xTlsfStats;
+    uint64_t ullFragmentationSum = 0;
+    uint64_t ullSamples = 0;
+    size_t xFragmentationMax = 0;
+    size_t xFragmentation;
+    size_t xFailed = 0;
+    size_t xLiveBytes = 0;
+    size_t xPeakLiveBytes = 0;
+    size_t xLiveBlocks = 0;
+    size_t xErrors = 0;
+    size_t xIndex;
+    size_t xByte;
+    uint32_t ulIteration;
+    uint32_t ulId;
+    uint64_t ullStart;
+    uint8_t ucPattern;
+
+    ppucBlocks = calloc( ( size_t ) ulMaxId + 1U, sizeof( uint8_t * ) );
+    pxSizes = calloc( ( size_t ) ulMaxId + 1U, sizeof( size_t ) );
+    xMallocLatency.pullHistogram = calloc( replayLATENCY_BUCKETS, sizeof( uint64_t ) );
+    xFreeLatency.pullHistogram = calloc( replayLATENCY_BUCKETS, sizeof( uint64_t ) );
+
+    if( ( ppucBlocks == NULL ) || ( pxSizes == NULL ) ||
+        ( xMallocLatency.pullHistogram == NULL ) || ( xFreeLatency.pullHistogram == NULL ) )
+    {
+        fprintf( stderr, "Out of memory\n" );
+        exit( 1 );
+    }
+
+    for( ulIteration = 0; ulIteration < ulIterations; ulIteration++ )
+    {
+        for( xIndex = 0; xIndex < xOpCount; xIndex++ )
+        {
+            ulId = pxOps[ xIndex ].ulId;
+
+            if( pxOps[ xIndex ].eType == eReplayMalloc )
+            {
+                if( ppucBlocks[ ulId ] != NULL )
+                {
+                    fprintf( stderr, "%s: block %u allocated twice by the trace\n", pxHeap->pcName, ulId );
+                    xErrors++;
+                    continue;
+                }
+
+                ullStart = prvNow();
+                ppucBlocks[ ulId ] = pxHeap->pvMalloc( pxOps[ xIndex ].xSize );
+                prvRecordLatency( &xMallocLatency, prvNow() - ullStart );
+
+                if( ppucBlocks[ ulId ] == NULL )
+                {
+                    xFailed++;
+                    continue;
+                }
+
+                if( ( ( uintptr_t ) ppucBlocks[ ulId ] & portBYTE_ALIGNMENT_MASK ) != 0U )
+                {
+                    fprintf( stderr, "%s: block %u is not aligned\n", pxHeap->pcName, ulId );
+                    xErrors++;
+                }
+
+                pxSizes[ ulId ] = pxOps[ xIndex ].xSize;
+                memset( ppucBlocks[ ulId ], prvPattern( ulId ), pxSizes[ ulId ] );
+                xLiveBytes += pxSizes[ ulId ];
+                xLiveBlocks++;
+
+                if( xLiveBytes > xPeakLiveBytes )
+                {
+                    xPeakLiveBytes = xLiveBytes;
+                }
+            }
+            else
+            {
+                /* Frees of blocks that failed to allocate are skipped. */
+                if( ppucBlocks[ ulId ] == NULL )
+                {
+                    continue;
+                }
+
+                ucPattern = prvPattern( ulId );
+
+                for( xByte = 0; xByte < pxSizes[ ulId ]; xByte++ )
+                {
+                    if( ppucBlocks[ ulId ][ xByte ] != ucPattern )
+                    {
+                        fprintf( stderr, "%s: block %u corrupted at offset %zu\n", pxHeap->pcName, ulId, xByte );
+                        xErrors++;
+                        break;
+                    }
+                }
+
+                ullStart = prvNow();
+                pxHeap->vFree( ppucBlocks[ ulId ] );
+                prvRecordLatency( &xFreeLatency, prvNow() - ullStart );
+
+                ppucBlocks[ ulId ] = NULL;
+                xLiveBytes -= pxSizes[ ulId ];
+                xLiveBlocks--;
+            }
+
+            if( ( xIndex % replaySAMPLE_INTERVAL ) == 0U )
+            {
+                pxHeap->vGetHeapStats( &xStats );
+                xFragmentation = prvFragmentation( &xStats );
+                ullFragmentationSum += xFragmentation;
+                ullSamples++;
+
+                if( xFragmentation > xFragmentationMax )
+                {
+                    xFragmentationMax = xFragmentation;
+                }
+            }
+        }
+
+        if( pxHeap->vGetTlsfHeapStats != NULL )
+        {
+            /* Cross check the live allocations seen by the heap. */
+            pxHeap->vGetTlsfHeapStats( &xTlsfStats );
+
+            for( xIndex = 0, xByte = 0; xIndex < portHEAP_SIZE_CLASS_COUNT; xIndex++ )
+            {
+                xByte += xTlsfStats.xAllocatedBlocks[ xIndex ];
+            }
+
+            if( xByte != xLiveBlocks )
+            {
+                fprintf( stderr, "%s: %zu blocks allocated, heap reports %zu\n", pxHeap->pcName, xLiveBlocks, xByte );
+                xErrors++;
+            }
+
+            if( xTlsfStats.xFragmentationPercent != prvFragmentation( &xTlsfStats.xHeapStats ) )
+            {
+                fprintf( stderr, "%s: fragmentation reported as %zu%%\n", pxHeap->pcName, xTlsfStats.xFragmentationPercent );
+                xErrors++;
+            }
+        }
+
+        /* Free the blocks still allocated at the end of the trace, the next
+         * run starts from an empty heap. */
+        for( ulId = 0; ulId <= ulMaxId; ulId++ )
+        {
+            if( ppucBlocks[ ulId ] != NULL )
+            {
+                pxHeap->vFree( ppucBlocks[ ulId ] );
+                ppucBlocks[ ulId ] = NULL;
+                xLiveBytes -= pxSizes[ ulId ];
+                xLiveBlocks--;
+            }
+        }
+
+        pxHeap->vGetHeapStats( &xStats );
+
+        if( xStats.xNumberOfFreeBlocks != 1U )
+        {
+            fprintf( stderr, "%s: %zu free blocks left after the run\n", pxHeap->pcName, xStats.xNumberOfFreeBlocks );
+            xErrors++;
+        }
+    }
+
+    pxHeap->vGetHeapStats( &xStats );
+
+    printf( "%-10s %6.0f %6llu %8llu   %6.0f %6llu %8llu   %8zu   %3zu %3llu   %9zu %9zu",
+            pxHeap->pcName,
+            ( double ) xMallocLatency.ullTotalNs / ( double ) ( xMallocLatency.ullCount ? xMallocLatency.ullCount : 1U ),
+            ( unsigned long long ) prvPercentile( &xMallocLatency, 99U ),
+            ( unsigned long long ) xMallocLatency.ullMaxNs,
+            ( double ) xFreeLatency.ullTotalNs / ( double ) ( xFreeLatency.ullCount ? xFreeLatency.ullCount : 1U ),
+            ( unsigned long long ) prvPercentile( &xFreeLatency, 99U ),
+            ( unsigned long long ) xFreeLatency.ullMaxNs,
+            xFailed,
+            xFragmentationMax,
+            ( unsigned long long ) ( ullSamples ? ( ullFragmentationSum / ullSamples ) : 0U ),
+            xPeakLiveBytes,
+            xStats.xMinimumEverFreeBytesRemaining );
+
+    if( pxHeap->vGetTlsfHeapStats != NULL )
+    {
+        pxHeap->vGetTlsfHeapStats( &xTlsfStats );
+        printf( "   hwm %zu of %zu", xTlsfStats.xHighWaterMarkInBytes, xTlsfStats.xTotalHeapSizeInBytes );
+    }
+
+    printf( "\n" );
+
+    free( ppucBlocks );
+    free( pxSizes );
+    free( xMallocLatency.pullHistogram );
+    free( xFreeLatency.pullHistogram );
+
+    return ( xErrors == 0U ) ? 0 : -1;
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc,
+          char ** argv )
+{
+    unsigned long ulIterations = 1;
+    unsigned long ulOps = replayDEFAULT_OPS;
+    unsigned long ulSeed = replayDEFAULT_SEED;
+    BaseType_t xWrite = pdFALSE;
+    size_t xIndex;
+    int iStatus = 0;
+    int iOpt;
+
+    while( ( iOpt = getopt( argc, argv, "n:o:s:w" ) ) != -1 )
+    {
+        switch( iOpt )
+        {
+            case 'n':
+                ulIterations = strtoul( optarg, NULL, 0 );
+                break;
+
+            case 'o':
+                ulOps = strtoul( optarg, NULL, 0 );
+                break;
+
+            case 's':
+                ulSeed = strtoul( optarg, NULL, 0 );
+                break;
+
+            case 'w':
+                xWrite = pdTRUE;
+                break;
+
+            default:
+                fprintf( stderr, "Usage: %s [-n iterations] [-o ops] [-s seed] [-w] [trace]\n", argv[ 0 ] );
+                return 2;
+        }
+    }
+
+    if( optind < argc )
+    {
+        if( prvLoadTrace( argv[ optind ] ) != 0 )
+        {
+            return 2;
+        }
+    }
+    else
+    {
+        prvGenerateTrace( ( size_t ) ulOps, ( uint32_t ) ulSeed );
+    }
+
+    if( xWrite != pdFALSE )
+    {
+        for( xIndex = 0; xIndex < xOpCount; xIndex++ )
+        {
+            if( pxOps[ xIndex ].eType == eReplayMalloc )
+            {
+                printf( "m %u %zu\n", pxOps[ xIndex ].ulId, pxOps[ xIndex ].xSize );
+            }
+            else
+            {
+                printf( "f %u\n", pxOps[ xIndex ].ulId );
+            }
+        }
+
+        return 0;
+    }
+
+    ullClockOverhead = prvClockOverhead();
+
+    printf( "%zu operations, %lu runs, heap %zu bytes, alignment %d\n",
+            xOpCount, ulIterations, ( size_t ) configTOTAL_HEAP_SIZE, portBYTE_ALIGNMENT );
+    printf( "%-10s %24s   %24s   %8s   %7s   %9s %9s\n", "", "malloc ns avg/p99/max", "free ns avg/p99/max",
+            "failed", "frag %", "peak live", "min free" );
+
+    for( xIndex = 0; xIndex < ( sizeof( xHeaps ) / sizeof( xHeaps[ 0 ] ) ); xIndex++ )
+    {
+        if( prvReplay( &xHeaps[ xIndex ], ( uint32_t ) ulIterations ) != 0 )
+        {
+            iStatus = 1;
+        }
+    }
+
+    free( pxOps );
+
+    return iStatus;
+}
+/*-----------------------------------------------------------*/
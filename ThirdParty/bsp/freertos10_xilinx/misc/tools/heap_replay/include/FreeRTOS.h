@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Host replacement of FreeRTOS.h for the heap replay harness.  Provides just
+ * enough of the kernel configuration to build the heap implementations on the
+ * host.  configTOTAL_HEAP_SIZE and portBYTE_ALIGNMENT are set by the Makefile.
+ */
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+
+#include "projdefs.h"
+#include "portmacro.h"
+
+#define configSUPPORT_DYNAMIC_ALLOCATION    1
+#define configAPPLICATION_ALLOCATED_HEAP    0
+#define configUSE_MALLOC_FAILED_HOOK        0
+
+#ifndef configTOTAL_HEAP_SIZE
+    #define configTOTAL_HEAP_SIZE    ( ( size_t ) 65536 )
+#endif
+
+#define configASSERT( x )    assert( x )
+
+#define traceMALLOC( pvAddress, uiSize )
+#define traceFREE( pvAddress, uiSize )
+#define mtCOVERAGE_TEST_MARKER()
+
+#include "portable.h"
+
+#endif /* INC_FREERTOS_H */
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Host replacement of portmacro.h for the heap replay harness.  The types
+ * follow the 32-bit ports, the scheduler is never started so the critical
+ * section macros are empty.
+ */
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#include <stdint.h>
+
+#define portCHAR          char
+#define portFLOAT         float
+#define portDOUBLE        double
+#define portLONG          long
+#define portSHORT         short
+#define portSTACK_TYPE    uint32_t
+#define portBASE_TYPE     long
+
+typedef portSTACK_TYPE   StackType_t;
+typedef long             BaseType_t;
+typedef unsigned long    UBaseType_t;
+typedef uint32_t         TickType_t;
+
+#define portMAX_DELAY              ( ( TickType_t ) 0xffffffffUL )
+#define portPOINTER_SIZE_TYPE      uintptr_t
+
+#ifndef portBYTE_ALIGNMENT
+    #define portBYTE_ALIGNMENT     8
+#endif
+
+#define portENTER_CRITICAL()
+#define portEXIT_CRITICAL()
+
+#endif /* PORTMACRO_H */
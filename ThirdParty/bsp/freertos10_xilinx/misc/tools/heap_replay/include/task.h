@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Host replacement of task.h for the heap replay harness.  The replay is
+ * single threaded, so suspending the scheduler is a no-op.
+ */
+#ifndef INC_TASK_H
+#define INC_TASK_H
+
+#define vTaskSuspendAll()
+#define xTaskResumeAll()        ( ( BaseType_t ) 0 )
+#define taskENTER_CRITICAL()    portENTER_CRITICAL()
+#define taskEXIT_CRITICAL()     portEXIT_CRITICAL()
+
+#endif /* INC_TASK_H */
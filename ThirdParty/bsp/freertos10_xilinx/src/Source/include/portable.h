@@ -152,6 +152,19 @@ typedef struct xHeapStats
     size_t xNumberOfSuccessfulFrees;        /* The number of calls to vPortFree() that has successfully freed a block of memory. */
 } HeapStats_t;
 
+/* Number of power of two block size classes reported by vPortGetTlsfHeapStats(). */
+#define portHEAP_SIZE_CLASS_COUNT    32
+
+/* Used to pass information about the heap out of vPortGetTlsfHeapStats(). */
+typedef struct xTlsfHeapStats
+{
+    HeapStats_t xHeapStats;                                 /* The same information as returned by vPortGetHeapStats(). */
+    size_t xTotalHeapSizeInBytes;                           /* The size of the heap that can be allocated, excluding the space used by the heap itself. */
+    size_t xHighWaterMarkInBytes;                           /* The maximum amount of memory that has been allocated at any one time since the system booted. */
+    size_t xFragmentationPercent;                           /* The percentage of the free memory that is not part of the largest free block. */
+    size_t xAllocatedBlocks[ portHEAP_SIZE_CLASS_COUNT ];   /* The number of allocated blocks per size class, class n holds the blocks of 2^n to 2^(n+1)-1 bytes including the block header. */
+} TlsfHeapStats_t;
+
 /*
  * Used to define multiple heap regions for use by heap_5.c.  This function
  * must be called before any calls to pvPortMalloc() - not creating a task,
@@ -171,6 +184,13 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEG
  */
 void vPortGetHeapStats( HeapStats_t * pxHeapStats );
 
+/*
+ * Returns a TlsfHeapStats_t structure filled with information about the
+ * current heap state, including fragmentation and the allocation size class
+ * histogram.  Only provided by heap_tlsf.c.
+ */
+void vPortGetTlsfHeapStats( TlsfHeapStats_t * pxTlsfHeapStats );
+
 /*
  * Map to the memory management routines required for the port.
  */
@@ -0,0 +1,746 @@
+/*
+ * FreeRTOS Kernel V10.6.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * An implementation of pvPortMalloc() and vPortFree() using a two level
+ * segregated fit (TLSF) allocator.  Like heap_4.c adjacent free blocks are
+ * combined as they are freed, but free blocks are kept in size segregated
+ * lists indexed by two bitmaps, so both pvPortMalloc() and vPortFree() execute
+ * in constant time regardless of the number of free blocks.  This bounds the
+ * worst case allocation latency, which heap_4.c cannot do as it walks its
+ * address ordered free list.
+ *
+ * The first level splits the block sizes into power of two classes, the second
+ * level splits each of those linearly into heapSL_INDEX_COUNT lists.  An
+ * allocation takes the first non empty list whose blocks are all large enough,
+ * so the worst case internal fragmentation is 1/heapSL_INDEX_COUNT of the
+ * request size.
+ *
+ * In addition to vPortGetHeapStats() the heap provides vPortGetTlsfHeapStats(),
+ * which also reports the fragmentation of the free space, the high water mark
+ * and a histogram of the live allocations per power of two size class.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c and heap_5.c for alternative
+ * implementations, and the memory management pages of https://www.FreeRTOS.org
+ * for more information.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+    #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+#ifndef configHEAP_CLEAR_MEMORY_ON_FREE
+    #define configHEAP_CLEAR_MEMORY_ON_FREE    0
+#endif
+
+#if ( portBYTE_ALIGNMENT == 32 )
+    #define heapALIGNMENT_LOG2    5
+#elif ( portBYTE_ALIGNMENT == 16 )
+    #define heapALIGNMENT_LOG2    4
+#elif ( portBYTE_ALIGNMENT == 8 )
+    #define heapALIGNMENT_LOG2    3
+#elif ( portBYTE_ALIGNMENT == 4 )
+    #define heapALIGNMENT_LOG2    2
+#else
+    #error heap_tlsf.c requires a portBYTE_ALIGNMENT of at least 4
+#endif
+
+/* Number of second level lists per first level class, as a power of two. */
+#define heapSL_INDEX_COUNT_LOG2    4
+#define heapSL_INDEX_COUNT         ( 1U << heapSL_INDEX_COUNT_LOG2 )
+
+/* Blocks smaller than heapSMALL_BLOCK_SIZE all go in first level class 0,
+ * which is split linearly in portBYTE_ALIGNMENT steps. */
+#define heapFL_INDEX_SHIFT         ( heapSL_INDEX_COUNT_LOG2 + heapALIGNMENT_LOG2 )
+#define heapSMALL_BLOCK_SIZE       ( ( size_t ) 1 << heapFL_INDEX_SHIFT )
+
+/* Blocks must be smaller than 2^heapFL_INDEX_MAX bytes. */
+#define heapFL_INDEX_MAX           30
+#define heapFL_INDEX_COUNT         ( heapFL_INDEX_MAX - heapFL_INDEX_SHIFT + 1 )
+
+/* Bit 0 of the xBlockSize member of a TlsfBlock_t structure is set while the
+ * block is in a free list.  Block sizes are multiples of portBYTE_ALIGNMENT so
+ * the bit is never part of the size. */
+#define heapBLOCK_FREE_BITMASK                ( ( size_t ) 1 )
+#define heapBLOCK_SIZE( pxBlock )             ( ( pxBlock )->xBlockSize & ~heapBLOCK_FREE_BITMASK )
+#define heapBLOCK_IS_FREE( pxBlock )          ( ( ( pxBlock )->xBlockSize & heapBLOCK_FREE_BITMASK ) != 0 )
+#define heapNEXT_PHYS_BLOCK( pxBlock )        ( ( TlsfBlock_t * ) ( ( ( uint8_t * ) ( pxBlock ) ) + heapBLOCK_SIZE( pxBlock ) ) )
+
+/* Max value that fits in a size_t type. */
+#define heapSIZE_MAX                          ( ~( ( size_t ) 0 ) )
+
+/* Check if multiplying a and b will result in overflow. */
+#define heapMULTIPLY_WILL_OVERFLOW( a, b )    ( ( ( a ) > 0 ) && ( ( b ) > ( heapSIZE_MAX / ( a ) ) ) )
+
+/* Check if adding a and b will result in overflow. */
+#define heapADD_WILL_OVERFLOW( a, b )         ( ( a ) > ( heapSIZE_MAX - ( b ) ) )
+
+/*-----------------------------------------------------------*/
+
+/* Allocate the memory for the heap. */
+#if ( configAPPLICATION_ALLOCATED_HEAP == 1 )
+
+/* The application writer has already defined the array used for the RTOS
+* heap - probably so it can be placed in a special segment or address. */
+    extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#else
+    PRIVILEGED_DATA static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#endif /* configAPPLICATION_ALLOCATED_HEAP */
+
+/* Header of every block in the heap.  The blocks are laid out back to back, so
+ * the physically next block is found from the block size and the physically
+ * previous block from pxPrevPhysBlock.  The free list links are only valid
+ * while the block is free and overlay the start of the user data. */
+typedef struct A_TLSF_BLOCK
+{
+    struct A_TLSF_BLOCK * pxPrevPhysBlock; /**< The physically previous block, NULL for the first block. */
+    size_t xBlockSize;                     /**< The size of the block including this header. */
+    struct A_TLSF_BLOCK * pxNextFreeBlock; /**< The next block in the same free list. */
+    struct A_TLSF_BLOCK * pxPrevFreeBlock; /**< The previous block in the same free list. */
+} TlsfBlock_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Calculates the free list indexes that a block of xBlockSize bytes belongs to.
+ */
+static void prvMappingInsert( size_t xBlockSize,
+                              UBaseType_t * puxFl,
+                              UBaseType_t * puxSl ) PRIVILEGED_FUNCTION;
+
+/*
+ * Finds a free block that can hold at least xWantedSize bytes and removes it
+ * from its free list.  Returns NULL if there is no such block.
+ */
+static TlsfBlock_t * prvFindFreeBlock( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * Inserts a free block into, or removes it from, its free list.
+ */
+static void prvInsertFreeBlock( TlsfBlock_t * pxBlock ) PRIVILEGED_FUNCTION;
+static void prvRemoveFreeBlock( TlsfBlock_t * pxBlock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called automatically to setup the required heap structures the first time
+ * pvPortMalloc() is called.
+ */
+static void prvHeapInit( void ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+/* The size of the header placed at the beginning of each allocated memory
+ * block must by correctly byte aligned. */
+static const size_t xHeapStructSize = ( offsetof( TlsfBlock_t, pxNextFreeBlock ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* Block sizes must not get too small to hold the free list links. */
+static const size_t xMinimumBlockSize = ( sizeof( TlsfBlock_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* Free list heads and the bitmaps of the non empty lists.  Bit n of
+ * ulFlBitmap is set if any list of first level class n is non empty. */
+PRIVILEGED_DATA static TlsfBlock_t * pxFreeLists[ heapFL_INDEX_COUNT ][ heapSL_INDEX_COUNT ];
+PRIVILEGED_DATA static uint32_t ulFlBitmap = 0U;
+PRIVILEGED_DATA static uint32_t ulSlBitmap[ heapFL_INDEX_COUNT ];
+
+/* Marks the end of the heap, it is never free so it stops merging. */
+PRIVILEGED_DATA static TlsfBlock_t * pxEnd = NULL;
+
+/* Keeps track of the number of calls to allocate and free memory, the free
+ * blocks and the number of free bytes remaining. */
+PRIVILEGED_DATA static size_t xTotalHeapBytes = 0U;
+PRIVILEGED_DATA static size_t xFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xNumberOfFreeBlocks = 0U;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulAllocations = 0;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulFrees = 0;
+
+/* Number of live allocations per power of two block size class. */
+PRIVILEGED_DATA static size_t xAllocatedBlocks[ portHEAP_SIZE_CLASS_COUNT ];
+
+/*-----------------------------------------------------------*/
+
+/* Index of the most significant set bit, ulValue must not be 0. */
+#define heapFLS( ulValue )    ( ( UBaseType_t ) ( 31U - ( UBaseType_t ) __builtin_clz( ( unsigned int ) ( ulValue ) ) ) )
+
+/* Index of the least significant set bit, ulValue must not be 0. */
+#define heapFFS( ulValue )    ( ( UBaseType_t ) __builtin_ctz( ( unsigned int ) ( ulValue ) ) )
+
+/*-----------------------------------------------------------*/
+
+static void prvMappingInsert( size_t xBlockSize,
+                              UBaseType_t * puxFl,
+                              UBaseType_t * puxSl ) /* PRIVILEGED_FUNCTION */
+{
+    UBaseType_t uxFls;
+
+    if( xBlockSize < heapSMALL_BLOCK_SIZE )
+    {
+        *puxFl = 0;
+        *puxSl = ( UBaseType_t ) ( xBlockSize >> heapALIGNMENT_LOG2 );
+    }
+    else
+    {
+        uxFls = heapFLS( xBlockSize );
+        *puxSl = ( UBaseType_t ) ( xBlockSize >> ( uxFls - heapSL_INDEX_COUNT_LOG2 ) ) ^ heapSL_INDEX_COUNT;
+        *puxFl = uxFls - ( heapFL_INDEX_SHIFT - 1 );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( TlsfBlock_t * pxBlock ) /* PRIVILEGED_FUNCTION */
+{
+    UBaseType_t uxFl, uxSl;
+
+    prvMappingInsert( heapBLOCK_SIZE( pxBlock ), &uxFl, &uxSl );
+
+    pxBlock->xBlockSize |= heapBLOCK_FREE_BITMASK;
+    pxBlock->pxPrevFreeBlock = NULL;
+    pxBlock->pxNextFreeBlock = pxFreeLists[ uxFl ][ uxSl ];
+
+    if( pxBlock->pxNextFreeBlock != NULL )
+    {
+        pxBlock->pxNextFreeBlock->pxPrevFreeBlock = pxBlock;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    pxFreeLists[ uxFl ][ uxSl ] = pxBlock;
+    ulFlBitmap |= ( 1UL << uxFl );
+    ulSlBitmap[ uxFl ] |= ( 1UL << uxSl );
+    xNumberOfFreeBlocks++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( TlsfBlock_t * pxBlock ) /* PRIVILEGED_FUNCTION */
+{
+    UBaseType_t uxFl, uxSl;
+
+    prvMappingInsert( heapBLOCK_SIZE( pxBlock ), &uxFl, &uxSl );
+
+    if( pxBlock->pxNextFreeBlock != NULL )
+    {
+        pxBlock->pxNextFreeBlock->pxPrevFreeBlock = pxBlock->pxPrevFreeBlock;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    if( pxBlock->pxPrevFreeBlock != NULL )
+    {
+        pxBlock->pxPrevFreeBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+    }
+    else
+    {
+        /* The block is the list head. */
+        pxFreeLists[ uxFl ][ uxSl ] = pxBlock->pxNextFreeBlock;
+
+        if( pxFreeLists[ uxFl ][ uxSl ] == NULL )
+        {
+            ulSlBitmap[ uxFl ] &= ~( 1UL << uxSl );
+
+            if( ulSlBitmap[ uxFl ] == 0U )
+            {
+                ulFlBitmap &= ~( 1UL << uxFl );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    pxBlock->xBlockSize &= ~heapBLOCK_FREE_BITMASK;
+    xNumberOfFreeBlocks--;
+}
+/*-----------------------------------------------------------*/
+
+static TlsfBlock_t * prvFindFreeBlock( size_t xWantedSize ) /* PRIVILEGED_FUNCTION */
+{
+    TlsfBlock_t * pxBlock = NULL;
+    UBaseType_t uxFl, uxSl;
+    uint32_t ulMap;
+
+    /* Round the size up to the next list boundary, so that every block of the
+     * list found is large enough and the first one can be taken. */
+    if( xWantedSize >= heapSMALL_BLOCK_SIZE )
+    {
+        xWantedSize += ( ( size_t ) 1 << ( heapFLS( xWantedSize ) - heapSL_INDEX_COUNT_LOG2 ) ) - 1;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    prvMappingInsert( xWantedSize, &uxFl, &uxSl );
+
+    if( uxFl < heapFL_INDEX_COUNT )
+    {
+        /* A list of the same first level class with large enough blocks. */
+        ulMap = ulSlBitmap[ uxFl ] & ( ~0UL << uxSl );
+
+        if( ulMap == 0U )
+        {
+            /* Otherwise the smallest non empty larger first level class. */
+            ulMap = ( uxFl + 1U < heapFL_INDEX_COUNT ) ? ( ulFlBitmap & ( ~0UL << ( uxFl + 1U ) ) ) : 0U;
+
+            if( ulMap != 0U )
+            {
+                uxFl = heapFFS( ulMap );
+                ulMap = ulSlBitmap[ uxFl ];
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( ulMap != 0U )
+        {
+            uxSl = heapFFS( ulMap );
+            pxBlock = pxFreeLists[ uxFl ][ uxSl ];
+            prvRemoveFreeBlock( pxBlock );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortMalloc( size_t xWantedSize )
+{
+    TlsfBlock_t * pxBlock;
+    TlsfBlock_t * pxNewBlock;
+    void * pvReturn = NULL;
+    size_t xAdditionalRequiredSize;
+
+    vTaskSuspendAll();
+    {
+        /* If this is the first call to malloc then the heap will require
+         * initialisation to setup the free lists. */
+        if( pxEnd == NULL )
+        {
+            prvHeapInit();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( xWantedSize > 0 )
+        {
+            /* The wanted size must be increased so it can contain the block
+             * header in addition to the requested amount of bytes. */
+            if( heapADD_WILL_OVERFLOW( xWantedSize, xHeapStructSize ) == 0 )
+            {
+                xWantedSize += xHeapStructSize;
+
+                /* Ensure that blocks are always aligned to the required number
+                 * of bytes. */
+                if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+                {
+                    /* Byte alignment required. */
+                    xAdditionalRequiredSize = portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK );
+
+                    if( heapADD_WILL_OVERFLOW( xWantedSize, xAdditionalRequiredSize ) == 0 )
+                    {
+                        xWantedSize += xAdditionalRequiredSize;
+                    }
+                    else
+                    {
+                        xWantedSize = 0;
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( ( xWantedSize > 0 ) && ( xWantedSize < xMinimumBlockSize ) )
+                {
+                    xWantedSize = xMinimumBlockSize;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                xWantedSize = 0;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
+        {
+            pxBlock = prvFindFreeBlock( xWantedSize );
+
+            if( pxBlock != NULL )
+            {
+                /* If the block is larger than required it can be split into
+                 * two, the remainder going back into a free list. */
+                if( ( heapBLOCK_SIZE( pxBlock ) - xWantedSize ) >= xMinimumBlockSize )
+                {
+                    pxNewBlock = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+                    configASSERT( ( ( ( size_t ) pxNewBlock ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+
+                    pxNewBlock->xBlockSize = heapBLOCK_SIZE( pxBlock ) - xWantedSize;
+                    pxNewBlock->pxPrevPhysBlock = pxBlock;
+                    heapNEXT_PHYS_BLOCK( pxNewBlock )->pxPrevPhysBlock = pxNewBlock;
+                    pxBlock->xBlockSize = xWantedSize;
+
+                    prvInsertFreeBlock( pxNewBlock );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xFreeBytesRemaining -= heapBLOCK_SIZE( pxBlock );
+
+                if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+                {
+                    xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xAllocatedBlocks[ heapFLS( heapBLOCK_SIZE( pxBlock ) ) ]++;
+                xNumberOfSuccessfulAllocations++;
+
+                /* Return the memory space pointed to - jumping over the block
+                 * header at its start. */
+                pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceMALLOC( pvReturn, xWantedSize );
+    }
+    ( void ) xTaskResumeAll();
+
+    #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
+    {
+        if( pvReturn == NULL )
+        {
+            vApplicationMallocFailedHook();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* if ( configUSE_MALLOC_FAILED_HOOK == 1 ) */
+
+    configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+    uint8_t * puc = ( uint8_t * ) pv;
+    TlsfBlock_t * pxBlock;
+    TlsfBlock_t * pxNeighbour;
+
+    if( pv != NULL )
+    {
+        /* The memory being freed will have a block header immediately before
+         * it. */
+        puc -= xHeapStructSize;
+
+        /* This casting is to keep the compiler from issuing warnings. */
+        pxBlock = ( void * ) puc;
+
+        configASSERT( heapBLOCK_IS_FREE( pxBlock ) == 0 );
+        configASSERT( heapNEXT_PHYS_BLOCK( pxBlock )->pxPrevPhysBlock == pxBlock );
+
+        if( heapBLOCK_IS_FREE( pxBlock ) == 0 )
+        {
+            #if ( configHEAP_CLEAR_MEMORY_ON_FREE == 1 )
+            {
+                ( void ) memset( puc + xHeapStructSize, 0, heapBLOCK_SIZE( pxBlock ) - xHeapStructSize );
+            }
+            #endif
+
+            vTaskSuspendAll();
+            {
+                xFreeBytesRemaining += heapBLOCK_SIZE( pxBlock );
+                xAllocatedBlocks[ heapFLS( heapBLOCK_SIZE( pxBlock ) ) ]--;
+                traceFREE( pv, heapBLOCK_SIZE( pxBlock ) );
+
+                /* Merge with the physically previous block if it is free. */
+                pxNeighbour = pxBlock->pxPrevPhysBlock;
+
+                if( ( pxNeighbour != NULL ) && ( heapBLOCK_IS_FREE( pxNeighbour ) != 0 ) )
+                {
+                    prvRemoveFreeBlock( pxNeighbour );
+                    pxNeighbour->xBlockSize += pxBlock->xBlockSize;
+                    pxBlock = pxNeighbour;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Merge with the physically next block if it is free.  pxEnd
+                 * is never free. */
+                pxNeighbour = heapNEXT_PHYS_BLOCK( pxBlock );
+
+                if( heapBLOCK_IS_FREE( pxNeighbour ) != 0 )
+                {
+                    prvRemoveFreeBlock( pxNeighbour );
+                    pxBlock->xBlockSize += pxNeighbour->xBlockSize;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                heapNEXT_PHYS_BLOCK( pxBlock )->pxPrevPhysBlock = pxBlock;
+                prvInsertFreeBlock( pxBlock );
+                xNumberOfSuccessfulFrees++;
+            }
+            ( void ) xTaskResumeAll();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+    return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+    return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+    /* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortCalloc( size_t xNum,
+                     size_t xSize )
+{
+    void * pv = NULL;
+
+    if( heapMULTIPLY_WILL_OVERFLOW( xNum, xSize ) == 0 )
+    {
+        pv = pvPortMalloc( xNum * xSize );
+
+        if( pv != NULL )
+        {
+            ( void ) memset( pv, 0, xNum * xSize );
+        }
+    }
+
+    return pv;
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapInit( void ) /* PRIVILEGED_FUNCTION */
+{
+    TlsfBlock_t * pxFirstFreeBlock;
+    uint8_t * pucAlignedHeap;
+    portPOINTER_SIZE_TYPE uxAddress;
+    size_t xTotalHeapSize = configTOTAL_HEAP_SIZE;
+
+    /* The first level classes only cover blocks below 2^heapFL_INDEX_MAX. */
+    configASSERT( xTotalHeapSize < ( ( size_t ) 1 << heapFL_INDEX_MAX ) );
+
+    /* Ensure the heap starts on a correctly aligned boundary. */
+    uxAddress = ( portPOINTER_SIZE_TYPE ) ucHeap;
+
+    if( ( uxAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+    {
+        uxAddress += ( portBYTE_ALIGNMENT - 1 );
+        uxAddress &= ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK );
+        xTotalHeapSize -= ( size_t ) ( uxAddress - ( portPOINTER_SIZE_TYPE ) ucHeap );
+    }
+
+    pucAlignedHeap = ( uint8_t * ) uxAddress;
+
+    /* pxEnd is used to mark the end of the heap and is placed at the end of the
+     * heap space.  It is never free, so it is never merged. */
+    uxAddress = ( portPOINTER_SIZE_TYPE ) ( pucAlignedHeap + xTotalHeapSize );
+    uxAddress -= xHeapStructSize;
+    uxAddress &= ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK );
+    pxEnd = ( TlsfBlock_t * ) uxAddress;
+
+    /* To start with there is a single free block that is sized to take up the
+     * entire heap space, minus the space taken by pxEnd. */
+    pxFirstFreeBlock = ( TlsfBlock_t * ) pucAlignedHeap;
+    pxFirstFreeBlock->xBlockSize = ( size_t ) ( uxAddress - ( portPOINTER_SIZE_TYPE ) pxFirstFreeBlock );
+    pxFirstFreeBlock->pxPrevPhysBlock = NULL;
+
+    pxEnd->xBlockSize = 0;
+    pxEnd->pxPrevPhysBlock = pxFirstFreeBlock;
+
+    prvInsertFreeBlock( pxFirstFreeBlock );
+
+    /* Only one block exists - and it covers the entire usable heap space. */
+    xTotalHeapBytes = heapBLOCK_SIZE( pxFirstFreeBlock );
+    xMinimumEverFreeBytesRemaining = xTotalHeapBytes;
+    xFreeBytesRemaining = xTotalHeapBytes;
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t * pxHeapStats )
+{
+    TlsfBlock_t * pxBlock;
+    UBaseType_t uxFl, uxSl;
+    size_t xMaxSize = 0, xMinSize = portMAX_DELAY; /* portMAX_DELAY used as a portable way of getting the maximum value. */
+
+    vTaskSuspendAll();
+    {
+        /* The smallest free block is in the lowest non empty list and the
+         * largest one in the highest non empty list, only those two lists are
+         * walked. */
+        if( ulFlBitmap != 0U )
+        {
+            uxFl = heapFFS( ulFlBitmap );
+            uxSl = heapFFS( ulSlBitmap[ uxFl ] );
+
+            for( pxBlock = pxFreeLists[ uxFl ][ uxSl ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+            {
+                if( heapBLOCK_SIZE( pxBlock ) < xMinSize )
+                {
+                    xMinSize = heapBLOCK_SIZE( pxBlock );
+                }
+            }
+
+            uxFl = heapFLS( ulFlBitmap );
+            uxSl = heapFLS( ulSlBitmap[ uxFl ] );
+
+            for( pxBlock = pxFreeLists[ uxFl ][ uxSl ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+            {
+                if( heapBLOCK_SIZE( pxBlock ) > xMaxSize )
+                {
+                    xMaxSize = heapBLOCK_SIZE( pxBlock );
+                }
+            }
+        }
+
+        pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+        pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+        pxHeapStats->xNumberOfFreeBlocks = xNumberOfFreeBlocks;
+        pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+        pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+        pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+        pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+    }
+    ( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetTlsfHeapStats( TlsfHeapStats_t * pxTlsfHeapStats )
+{
+    HeapStats_t * pxHeapStats = &( pxTlsfHeapStats->xHeapStats );
+    UBaseType_t uxClass;
+
+    vPortGetHeapStats( pxHeapStats );
+
+    vTaskSuspendAll();
+    {
+        pxTlsfHeapStats->xTotalHeapSizeInBytes = xTotalHeapBytes;
+        pxTlsfHeapStats->xHighWaterMarkInBytes = xTotalHeapBytes - xMinimumEverFreeBytesRemaining;
+
+        for( uxClass = 0; uxClass < portHEAP_SIZE_CLASS_COUNT; uxClass++ )
+        {
+            pxTlsfHeapStats->xAllocatedBlocks[ uxClass ] = xAllocatedBlocks[ uxClass ];
+        }
+    }
+    ( void ) xTaskResumeAll();
+
+    /* The share of the free space that cannot be used by an allocation the
+     * size of the largest free block. */
+    if( pxHeapStats->xAvailableHeapSpaceInBytes != 0U )
+    {
+        pxTlsfHeapStats->xFragmentationPercent = 100U - ( size_t ) ( ( ( uint64_t ) pxHeapStats->xSizeOfLargestFreeBlockInBytes * 100U ) /
+                                                                     pxHeapStats->xAvailableHeapSpaceInBytes );
+    }
+    else
+    {
+        pxTlsfHeapStats->xFragmentationPercent = 0U;
+    }
+}
+/*-----------------------------------------------------------*/
@@ -22,6 +22,10 @@ the main FreeRTOS download.")
 set(freertos_total_heap_size 65536 CACHE STRING "Sets the amount of RAM reserved \
 for use by FreeRTOS - used when tasks, queues, semaphores and \
 event groups are created.")
+set(freertos_heap_type heap_4 CACHE STRING "The heap implementation. heap_4 \
+is the first fit allocator, heap_tlsf allocates and frees in constant time \
+and provides vPortGetTlsfHeapStats().")
+set_property(CACHE freertos_heap_type PROPERTY STRINGS heap_4 heap_tlsf)
 set(freertos_max_task_name 10 CACHE STRING "The maximum number of characters \
 that can be in the name of a task.")
 option(freertos_use_timeslicing "When true equal priority ready tasks will share \
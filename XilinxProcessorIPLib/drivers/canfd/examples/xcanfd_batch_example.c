@@ -0,0 +1,501 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+*
+* @file xcanfd_batch_example.c
+*
+* Contains an example of how to receive frames in batches with the XCanFd
+* driver. The example configures the device for internal loopback mode and
+* sends bursts of CAN FD frames. Each burst is received once with one
+* XCanFd_Recv_Sequential() call per frame and once with a single
+* XCanFd_Recv_Batch() call, and the frames are verified.
+*
+* For both methods the example reports the CPU time spent per frame and the
+* resulting receive rate per percent of CPU, that is the number of frames per
+* second which can be received for each percent of CPU time spent on it.
+*
+* The example then queues bursts of frames with descending CAN IDs to the TX
+* scheduler, sends each burst with one XCanFd_TxSchedFill() call and checks
+* that the frames arrive in CAN ID priority order.
+*
+* @note
+*
+* This example is meant for a core in sequential receive mode. The bit
+* timing is the same as in xcanfd_polled_example.c.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date	Changes
+* ----- -----  -------- -----------------------------------------------
+* 2.9   ag     10/18/26 First release
+* 2.9   ag     10/18/26 Added the TX scheduler test
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xparameters.h"
+#include "xcanfd.h"
+#include "xstatus.h"
+#include "xil_printf.h"
+#ifdef SDT
+#include "xiltimer.h"
+#else
+#include "xtime_l.h"
+#endif
+
+/************************** Constant Definitions *****************************/
+/*
+ * The following constants map to the XPAR parameters created in the
+ * xparameters.h file. They are defined here such that a user can easily
+ * change all the needed parameters in one place.
+ */
+#ifndef SDT
+#define CANFD_DEVICE_ID	XPAR_CANFD_0_DEVICE_ID
+#else
+#define XCANFD_BASEADDRESS XPAR_XCANFD_0_BASEADDR
+#endif
+
+/* Maximum CAN frame length in words */
+#define XCANFD_MAX_FRAME_SIZE_IN_WORDS	(XCANFD_MAX_FRAME_SIZE / XCANFD_DW_BYTES)
+
+/* Message Id Constant */
+#define TEST_MESSAGE_ID			1024
+
+/* Bit timing, see xcanfd_polled_example.c */
+#define TEST_BRPR_BAUD_PRESCALAR	29
+
+#define TEST_BTR_SYNCJUMPWIDTH		3
+#define TEST_BTR_SECOND_TIMESEGMENT	2
+#define TEST_BTR_FIRST_TIMESEGMENT	15
+
+#define TEST_FBRPR_BAUD_PRESCALAR	29
+
+#define TEST_FBTR_SYNCJUMPWIDTH		3
+#define TEST_FBTR_SECOND_TIMESEGMENT	2
+#define TEST_FBTR_FIRST_TIMESEGMENT	15
+
+/* Test Message Dlc, 64 data bytes */
+#define TESTMSG_DLC	15
+
+/* Number of bursts received with each method */
+#define TEST_BURSTS	16U
+
+/* Number of frames in the ring, must be a power of 2 */
+#define TEST_RING_FRAMES	64U
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+#ifndef SDT
+int XCanFdBatchExample(u16 DeviceId);
+#else
+int XCanFdBatchExample(UINTPTR BaseAddress);
+#endif
+static int SendBurst(XCanFd *InstancePtr, u32 NumFrames, u32 Seq);
+static void WaitBurst(XCanFd *InstancePtr, u32 NumFrames);
+static int SchedBurst(XCanFd_TxSched *SchedPtr, u32 NumFrames);
+static int CheckFrame(u32 Id, u32 Dlc, const u32 *DataPtr, u32 Seq);
+static void Report(const char8 *Name, XTime Counts, u32 Frames);
+
+/************************** Variable Definitions *****************************/
+
+/*
+ * Buffers to hold frames to send and receive. These are declared as global so
+ * that they are not on the stack.
+ */
+static u32 TxFrame[XCANFD_MAX_FRAME_SIZE_IN_WORDS];
+static u32 RxFrame[XCANFD_MAX_FRAME_SIZE_IN_WORDS];
+static XCanFd_RxFrame RingFrames[TEST_RING_FRAMES];
+static XCanFd_RxRing Ring;
+static XCanFd_TxSchedEntry SchedEntries[TEST_RING_FRAMES];
+static XCanFd_TxSched Sched;
+
+/* Driver instance */
+static XCanFd CanFd;
+
+/*****************************************************************************/
+/**
+*
+* Main function to call the example.
+*
+* @return
+*		- XST_SUCCESS if the example has completed successfully.
+*		- XST_FAILURE if the example has failed.
+*
+* @note		None
+*
+******************************************************************************/
+#ifndef TESTAPP_GEN
+int main(void)
+{
+	xil_printf("XCanFd Batch Receive example\n\r");
+#ifndef SDT
+	if (XCanFdBatchExample(CANFD_DEVICE_ID)) {
+#else
+	if (XCanFdBatchExample(XCANFD_BASEADDRESS)) {
+#endif
+		xil_printf("XCanFd Batch Receive example Failed\n\r");
+		return XST_FAILURE;
+	}
+	xil_printf("Successfully ran XCanFd Batch Receive example\n\r");
+	return XST_SUCCESS;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* The entry point of the example. It configures the device for internal
+* loopback mode, then compares the receive paths as described in the file
+* header.
+*
+* @param	DeviceId is the XPAR_CANFD_<instance_num>_DEVICE_ID value from
+*		xparameters.h.
+*
+* @return	XST_SUCCESS if successful, otherwise XST_FAILURE.
+*
+* @note		If the device is not working correctly, this function may
+*		enter an infinite loop and will never return to the caller.
+*
+******************************************************************************/
+#ifndef SDT
+int XCanFdBatchExample(u16 DeviceId)
+#else
+int XCanFdBatchExample(UINTPTR BaseAddress)
+#endif
+{
+	int Status;
+	XCanFd *CanFdInstPtr = &CanFd;
+	XCanFd_Config *ConfigPtr;
+	XCanFd_RxFrame *FramePtr;
+	XTime Start;
+	XTime End;
+	XTime SeqCounts = 0U;
+	XTime BatchCounts = 0U;
+	XTime SchedCounts = 0U;
+	u32 Burst;
+	u32 Index;
+	u32 Frames = 0U;
+
+#ifndef SDT
+	ConfigPtr = XCanFd_LookupConfig(DeviceId);
+#else
+	ConfigPtr = XCanFd_LookupConfig(BaseAddress);
+#endif
+	if (ConfigPtr == NULL) {
+		return XST_FAILURE;
+	}
+	Status = XCanFd_CfgInitialize(CanFdInstPtr, ConfigPtr,
+				      ConfigPtr->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	if (XCANFD_GET_RX_MODE(CanFdInstPtr) != 0) {
+		xil_printf("Batch receive needs sequential mode\n\r");
+		return XST_FAILURE;
+	}
+
+	XCanFd_EnterMode(CanFdInstPtr, XCANFD_MODE_CONFIG);
+	while (XCanFd_GetMode(CanFdInstPtr) != XCANFD_MODE_CONFIG);
+
+	XCanFd_SetBaudRatePrescaler(CanFdInstPtr, TEST_BRPR_BAUD_PRESCALAR);
+	XCanFd_SetBitTiming(CanFdInstPtr, TEST_BTR_SYNCJUMPWIDTH,
+			    TEST_BTR_SECOND_TIMESEGMENT, TEST_BTR_FIRST_TIMESEGMENT);
+	XCanFd_SetFBaudRatePrescaler(CanFdInstPtr, TEST_FBRPR_BAUD_PRESCALAR);
+	XCanFd_SetFBitTiming(CanFdInstPtr, TEST_FBTR_SYNCJUMPWIDTH,
+			     TEST_FBTR_SECOND_TIMESEGMENT, TEST_FBTR_FIRST_TIMESEGMENT);
+	XCanFd_SetBitRateSwitch_DisableNominal(CanFdInstPtr);
+
+	XCanFd_AcceptFilterDisable(CanFdInstPtr, XCANFD_AFR_UAF_ALL_MASK);
+	XCanFd_AcceptFilterEnable(CanFdInstPtr, XCANFD_AFR_UAF_ALL_MASK);
+
+	XCanFd_EnterMode(CanFdInstPtr, XCANFD_MODE_LOOPBACK);
+	while (XCanFd_GetMode(CanFdInstPtr) != XCANFD_MODE_LOOPBACK);
+
+	Status = XCanFd_RxRingInit(&Ring, RingFrames, TEST_RING_FRAMES);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/* A burst fits into the TX buffers, the RX FIFO and the ring */
+	Frames = ConfigPtr->NumofTxBuf;
+	if (Frames > ConfigPtr->NumofRxMbBuf) {
+		Frames = ConfigPtr->NumofRxMbBuf;
+	}
+	if (Frames > TEST_RING_FRAMES) {
+		Frames = TEST_RING_FRAMES;
+	}
+
+	for (Burst = 0U; Burst < TEST_BURSTS; Burst++) {
+		/* One call per frame */
+		Status = SendBurst(CanFdInstPtr, Frames, 0U);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		WaitBurst(CanFdInstPtr, Frames);
+
+		XTime_GetTime(&Start);
+		for (Index = 0U; Index < Frames; Index++) {
+			Status = (int)XCanFd_Recv_Sequential(CanFdInstPtr,
+							     RxFrame);
+			if (Status != XST_SUCCESS) {
+				return XST_FAILURE;
+			}
+			if (CheckFrame(RxFrame[0], RxFrame[1], &RxFrame[2],
+				       Index) != XST_SUCCESS) {
+				return XST_FAILURE;
+			}
+		}
+		XTime_GetTime(&End);
+		SeqCounts += End - Start;
+
+		/* One call per burst */
+		Status = SendBurst(CanFdInstPtr, Frames, 0U);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		WaitBurst(CanFdInstPtr, Frames);
+
+		XTime_GetTime(&Start);
+		if (XCanFd_Recv_Batch(CanFdInstPtr, &Ring) != Frames) {
+			return XST_FAILURE;
+		}
+		for (Index = 0U; Index < Frames; Index++) {
+			FramePtr = XCanFd_RxRingPeek(&Ring);
+			if ((FramePtr == NULL) ||
+			    (CheckFrame(FramePtr->Id, FramePtr->Dlc,
+					FramePtr->Data, Index) != XST_SUCCESS)) {
+				return XST_FAILURE;
+			}
+			XCanFd_RxRingRelease(&Ring);
+		}
+		XTime_GetTime(&End);
+		BatchCounts += End - Start;
+	}
+
+	/*
+	 * Scheduled send, the frames are queued with descending IDs and must
+	 * arrive with ascending IDs
+	 */
+	Status = XCanFd_TxSchedInit(&Sched, CanFdInstPtr, SchedEntries,
+				    TEST_RING_FRAMES);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	for (Burst = 0U; Burst < TEST_BURSTS; Burst++) {
+		XTime_GetTime(&Start);
+		Status = SchedBurst(&Sched, Frames);
+		XTime_GetTime(&End);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		SchedCounts += End - Start;
+		WaitBurst(CanFdInstPtr, Frames);
+
+		if (XCanFd_Recv_Batch(CanFdInstPtr, &Ring) != Frames) {
+			return XST_FAILURE;
+		}
+		for (Index = 0U; Index < Frames; Index++) {
+			FramePtr = XCanFd_RxRingPeek(&Ring);
+			if ((FramePtr == NULL) ||
+			    (FramePtr->Id != XCanFd_CreateIdValue(
+					TEST_MESSAGE_ID + Index, 0, 0, 0, 0)) ||
+			    (FramePtr->Data[0] != Index)) {
+				return XST_FAILURE;
+			}
+			XCanFd_RxRingRelease(&Ring);
+		}
+	}
+
+	xil_printf("%d bursts of %d frames\n\r", TEST_BURSTS, Frames);
+	Report("Recv_Sequential", SeqCounts, TEST_BURSTS * Frames);
+	Report("Recv_Batch", BatchCounts, TEST_BURSTS * Frames);
+	Report("TxSched", SchedCounts, TEST_BURSTS * Frames);
+
+	XCanFd_stop(CanFdInstPtr);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Sends a burst of CAN FD frames. The first data word of each frame holds
+* its sequence number within the burst.
+*
+* @param	InstancePtr is a pointer to the driver instance.
+* @param	NumFrames is the number of frames to send.
+* @param	Seq is the sequence number of the first frame.
+*
+* @return	XST_SUCCESS if successful, a driver-specific return code if not.
+*
+* @note		None.
+*
+******************************************************************************/
+static int SendBurst(XCanFd *InstancePtr, u32 NumFrames, u32 Seq)
+{
+	int Status = XST_SUCCESS;
+	u32 TxBufferNumber;
+	u32 Index;
+	u32 DwIndex;
+
+	TxFrame[0] = XCanFd_CreateIdValue(TEST_MESSAGE_ID, 0, 0, 0, 0);
+	TxFrame[1] = XCanFd_Create_CanFD_Dlc_BrsValue(TESTMSG_DLC);
+
+	for (Index = 0U; Index < NumFrames; Index++) {
+		TxFrame[2] = Seq + Index;
+		for (DwIndex = 1U; DwIndex < XCANFD_MAX_FRAME_DW; DwIndex++) {
+			TxFrame[2U + DwIndex] = DwIndex;
+		}
+		Status = XCanFd_Send(InstancePtr, TxFrame, &TxBufferNumber);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* Queues a burst of CAN FD frames with descending IDs to the TX scheduler and
+* sends them with one fill of the TX buffers. The first data word of each
+* frame holds the offset of its ID from TEST_MESSAGE_ID.
+*
+* @param	SchedPtr is a pointer to the TX scheduler.
+* @param	NumFrames is the number of frames to send.
+*
+* @return	XST_SUCCESS if successful, otherwise XST_FAILURE.
+*
+* @note		None.
+*
+******************************************************************************/
+static int SchedBurst(XCanFd_TxSched *SchedPtr, u32 NumFrames)
+{
+	u32 Index;
+	u32 DwIndex;
+	u32 Offset;
+
+	TxFrame[1] = XCanFd_Create_CanFD_Dlc_BrsValue(TESTMSG_DLC);
+	for (DwIndex = 1U; DwIndex < XCANFD_MAX_FRAME_DW; DwIndex++) {
+		TxFrame[2U + DwIndex] = DwIndex;
+	}
+
+	for (Index = 0U; Index < NumFrames; Index++) {
+		Offset = NumFrames - 1U - Index;
+		TxFrame[0] = XCanFd_CreateIdValue(TEST_MESSAGE_ID + Offset,
+						  0, 0, 0, 0);
+		TxFrame[2] = Offset;
+		if (XCanFd_TxSchedEnqueue(SchedPtr, TxFrame) != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	if (XCanFd_TxSchedFill(SchedPtr) != NumFrames) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Waits until a burst of frames has been looped back into the RX FIFOs.
+*
+* @param	InstancePtr is a pointer to the driver instance.
+* @param	NumFrames is the number of frames of the burst.
+*
+* @return	None.
+*
+* @note		This function may block if the hardware is not working.
+*
+******************************************************************************/
+static void WaitBurst(XCanFd *InstancePtr, u32 NumFrames)
+{
+	u32 Stored;
+
+	do {
+		Stored = (u32)XCanFd_GetNofMessages_Stored_Rx_Fifo(InstancePtr,
+				XCANFD_RX_FIFO_0) +
+			 (u32)XCanFd_GetNofMessages_Stored_Rx_Fifo(InstancePtr,
+				XCANFD_RX_FIFO_1);
+	} while (Stored < NumFrames);
+}
+
+/*****************************************************************************/
+/**
+*
+* Verifies a received frame.
+*
+* @param	Id is the ID register of the frame.
+* @param	Dlc is the DLC register of the frame.
+* @param	DataPtr is a pointer to the data words of the frame.
+* @param	Seq is the expected sequence number.
+*
+* @return	XST_SUCCESS if the frame is correct, otherwise XST_FAILURE.
+*
+* @note		None.
+*
+******************************************************************************/
+static int CheckFrame(u32 Id, u32 Dlc, const u32 *DataPtr, u32 Seq)
+{
+	u32 DwIndex;
+
+	if ((Id != XCanFd_CreateIdValue(TEST_MESSAGE_ID, 0, 0, 0, 0)) ||
+	    (XCanFd_GetFrameLen(Dlc) != XCANFD_MAX_FRAME_DW * XCANFD_DW_BYTES) ||
+	    (DataPtr[0] != Seq)) {
+		return XST_FAILURE;
+	}
+
+	for (DwIndex = 1U; DwIndex < XCANFD_MAX_FRAME_DW; DwIndex++) {
+		if (DataPtr[DwIndex] != DwIndex) {
+			return XST_FAILURE;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Prints the CPU time per frame and the receive rate per percent of CPU.
+*
+* @param	Name is the name of the receive method.
+* @param	Counts is the CPU time spent, in timer counts.
+* @param	Frames is the number of frames received in that time.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void Report(const char8 *Name, XTime Counts, u32 Frames)
+{
+	u64 Ns = ((u64)Counts * 1000000000U) / COUNTS_PER_SECOND;
+	u64 NsPerFrame = Ns / Frames;
+	u64 RatePerPercent = 0U;
+
+	/*
+	 * 1% of the CPU is 10 ms per second, which receives this many frames
+	 */
+	if (NsPerFrame != 0U) {
+		RatePerPercent = 10000000U / NsPerFrame;
+	}
+
+	xil_printf("%s: %d ns per frame, %d frames/s per CPU %%\n\r", Name,
+		   (u32)NsPerFrame, (u32)RatePerPercent);
+}
@@ -63,6 +63,9 @@
 * 2.3	se   03/09/20 Initialize IsPl of config structure.
 * 2.8	ht   06/19/23 Added support for system device-tree flow.
 * 2.8	gm   06/22/23 Add support for request/release node.
+* 2.9	ag   10/18/26 Made XCanFd_GetDlc2len() table driven.
+* 2.9	ag   10/18/26 Moved the TRR write of XCanFd_Send_Queue() to
+*		      XCanFd_TriggerTxBuffers().
 *
 * </pre>
 ******************************************************************************/
@@ -93,6 +96,15 @@
 
 /************************** Variable Definitions *****************************/
 
+/*
+ * Number of data bytes for each DLC value. CAN frames carry at most 8 bytes,
+ * so DLC values above 8 map to 8 bytes.
+ */
+const u8 XCanFd_DlcLenTable[2][16] = {
+	{ 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 8U, 8U, 8U, 8U, 8U, 8U, 8U },
+	{ 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 12U, 16U, 20U, 24U, 32U, 48U, 64U }
+};
+
 /************************** Function Prototypes ******************************/
 
 static void StubHandler(void);
@@ -1409,79 +1421,10 @@ static void StubHandler(void)
 ******************************************************************************/
 int XCanFd_GetDlc2len(u32 Dlc, u32 Edl)
 {
+	u32 Index = (Edl != (u32)0U) ? (u32)1U : (u32)0U;
 
-	u32 NofBytes;
-
-	if ((Edl == (u32)0U) && ((Dlc >> XCANFD_DLCR_DLC_SHIFT) > (u32)8)) {
-		Dlc = XCANFD_DLC8;
-	}
-
-	switch (Dlc) {
-
-		case  XCANFD_DLC1:
-			NofBytes = 1;
-			break;
-
-		case XCANFD_DLC2:
-			NofBytes = 2;
-			break;
-
-		case  XCANFD_DLC3:
-			NofBytes = 3;
-			break;
-
-		case  XCANFD_DLC4:
-			NofBytes = 4;
-			break;
-
-		case  XCANFD_DLC5:
-			NofBytes = 5;
-			break;
-
-		case  XCANFD_DLC6:
-			NofBytes = 6;
-			break;
-
-		case  XCANFD_DLC7:
-			NofBytes = 7;
-			break;
-
-		case  XCANFD_DLC8:
-			NofBytes = 8;
-			break;
-
-		case  XCANFD_DLC9:
-			NofBytes = 12;
-			break;
-
-		case  XCANFD_DLC10:
-			NofBytes = 16;
-			break;
-
-		case  XCANFD_DLC11:
-			NofBytes = 20;
-			break;
-
-		case  XCANFD_DLC12:
-			NofBytes = 24;
-			break;
-
-		case  XCANFD_DLC13:
-			NofBytes = 32;
-			break;
-
-		case XCANFD_DLC14:
-			NofBytes = 48;
-			break;
-
-		case XCANFD_DLC15:
-			NofBytes = 64;
-			break;
-		default	:
-			NofBytes = 0;
-			break;
-	}
-	return (s32)NofBytes;
+	return (s32)XCanFd_DlcLenTable[Index][(Dlc & XCANFD_DLCR_DLC_MASK) >>
+					      XCANFD_DLCR_DLC_SHIFT];
 }
 
 /*****************************************************************************/
@@ -1569,12 +1512,6 @@ u32 XCanFd_GetFreeBuffer(XCanFd *InstancePtr)
 ******************************************************************************/
 int XCanFd_Send_Queue(XCanFd *InstancePtr)
 {
-
-	u32 TrrVal;
-#ifdef versal
-	u32 BufferNumber;
-#endif
-
 	Xil_AssertNonvoid(InstancePtr != NULL);
 	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
 
@@ -1583,7 +1520,39 @@ int XCanFd_Send_Queue(XCanFd *InstancePtr)
 	 * InstancePtr->MultiBuffTrr is updated by calling
 	 * XCanFd_Addto_Queue()
 	 */
-	TrrVal = InstancePtr->MultiBuffTrr;
+	XCanFd_TriggerTxBuffers(InstancePtr, InstancePtr->MultiBuffTrr);
+	InstancePtr->GlobalTrrValue = TRR_INIT_VAL;
+	InstancePtr->GlobalTrrMask  = TRR_MASK_INIT_VAL;
+
+	return (s32)XST_SUCCESS;
+
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine sets the given bits of the Transmit Ready Request Register, so
+* that the core transmits the frames in those TX buffers. All buffers are
+* triggered with one register write, except on the PS CANFD of Versal with
+* PS version 0x10, where each buffer is triggered with its own write.
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	TrrVal is the mask of TX buffers to be triggered.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XCanFd_TriggerTxBuffers(XCanFd *InstancePtr, u32 TrrVal)
+{
+#ifdef versal
+	u32 BufferNumber;
+#endif
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
 #ifdef versal
 #ifndef SDT
 	if ((XGetPSVersion_Info() == (u32)0x10) &&
@@ -1594,9 +1563,11 @@ int XCanFd_Send_Queue(XCanFd *InstancePtr)
 #endif
 		for (BufferNumber = 0; BufferNumber < MAX_BUFFER_VAL;
 		     BufferNumber++) {
-			XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
-					XCANFD_TRR_OFFSET, (TrrVal &
-							    ((u32)1 << BufferNumber)));
+			if ((TrrVal & ((u32)1 << BufferNumber)) != (u32)0) {
+				XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+						XCANFD_TRR_OFFSET,
+						((u32)1 << BufferNumber));
+			}
 		}
 	} else
 #endif
@@ -1604,11 +1575,6 @@ int XCanFd_Send_Queue(XCanFd *InstancePtr)
 		XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
 				XCANFD_TRR_OFFSET, TrrVal);
 	}
-	InstancePtr->GlobalTrrValue = TRR_INIT_VAL;
-	InstancePtr->GlobalTrrMask  = TRR_MASK_INIT_VAL;
-
-	return (s32)XST_SUCCESS;
-
 }
 
 /*****************************************************************************/
@@ -260,6 +260,12 @@ exclusion
 * 2.8	ht   06/19/23 Added support for system device-tree flow.
 * 2.8	gm   06/22/23 Add XCanFd_stop to support release node.
 * 2.8	ht   07/18/23 Fixed GCC warnings.
+* 2.9	ag   10/18/26 Added XCanFd_Recv_Batch() in xcanfd_batch.c to drain
+*		      both RX FIFOs into a ring of frames in one pass, and
+*		      made XCanFd_GetDlc2len() table driven.
+* 2.9	ag   10/18/26 Added the TX scheduler in xcanfd_batch.c, which fills
+*		      all free TX buffers by CAN ID priority and triggers
+*		      them with one TRR write.
 * </pre>
 *
 ******************************************************************************/
@@ -320,6 +326,15 @@ extern "C" {
 #define XCANFD_RX_FIFO_1	         1 /**< Selection for RX Fifo 1 */
 /** @} */
 
+#define XCANFD_MAX_FRAME_DW	16U /**< Maximum number of data words of a
+				      *  frame */
+
+#ifndef XCANFD_TXSCHED_MAX_FRAMES
+#define XCANFD_TXSCHED_MAX_FRAMES	64U /**< Maximum number of frames
+					      *  pending in a TX scheduler,
+					      *  at most 256 */
+#endif
+
 /** @name Callback identifiers used as parameters to XCanFd_SetHandler()
  *  @{
  */
@@ -430,6 +445,63 @@ typedef struct {
 
 } XCanFd;
 
+/**
+ * A received frame as stored by XCanFd_Recv_Batch(). The data words are
+ * stored in the same byte order as XCanFd_Recv_Sequential() stores them.
+ */
+typedef struct {
+	u32 Id;		/**< ID register of the frame */
+	u32 Dlc;	/**< DLC register of the frame, with EDL, BRS and
+			  *  timestamp */
+	u32 Len;	/**< Number of data bytes */
+	u16 TimeStamp;	/**< Receive timestamp of the core */
+	u8 FifoNo;	/**< RX FIFO the frame was read from */
+	u32 Data[XCANFD_MAX_FRAME_DW];	/**< Data words of the frame */
+} XCanFd_RxFrame;
+
+/**
+ * A ring of received frames, filled by XCanFd_Recv_Batch() and emptied by
+ * the application. Head and Tail are free running frame counters.
+ */
+typedef struct {
+	XCanFd_RxFrame *FramePtr;	/**< Frame storage of the ring */
+	u32 Mask;			/**< Number of frames - 1 */
+	volatile u32 Head;		/**< Frames added by the driver */
+	volatile u32 Tail;		/**< Frames removed by the application */
+} XCanFd_RxRing;
+
+/**
+ * A frame pending in a TX scheduler.
+ */
+typedef struct {
+	u32 Id;		/**< ID register of the frame */
+	u32 Dlc;	/**< DLC register of the frame */
+	u32 Seq;	/**< Enqueue order, keeps frames with equal IDs in order */
+	u32 Data[XCANFD_MAX_FRAME_DW];	/**< Data words of the frame */
+} XCanFd_TxSchedEntry;
+
+/**
+ * A TX scheduler. Pending frames are kept in a binary heap ordered by CAN ID
+ * priority, and are moved to free TX buffers in priority order whenever
+ * buffers become free.
+ */
+typedef struct {
+	XCanFd *InstancePtr;		/**< Device the frames are sent on */
+	XCanFd_TxSchedEntry *EntryPtr;	/**< Frame storage */
+	u32 NumEntries;			/**< Number of entries in EntryPtr */
+	u32 Count;			/**< Number of pending frames */
+	u32 FreeCount;			/**< Number of free entries */
+	u32 Seq;			/**< Next enqueue order */
+	u32 BufMask;			/**< TX buffers owned by the scheduler */
+	u32 SentCount;			/**< Frames handed to TX buffers */
+	u32 BatchCount;			/**< Number of TRR writes */
+	u8 Heap[XCANFD_TXSCHED_MAX_FRAMES]; /**< Entry indices, heap ordered */
+	u8 Free[XCANFD_TXSCHED_MAX_FRAMES]; /**< Stack of free entry indices */
+} XCanFd_TxSched;
+
+/** Number of data bytes for each DLC value, for CAN [0] and CAN FD [1] */
+extern const u8 XCanFd_DlcLenTable[2][16];
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -1020,6 +1092,24 @@ typedef struct {
 #define XCanFd_Get_RxBuffers(InstancePtr)	\
 	InstancePtr->CanFdConfig.NumofRxMbBuf;
 
+/****************************************************************************/
+/**
+*
+* This macro returns the number of data bytes of a frame from the value of
+* its DLC register.
+*
+* @param	DlcReg is the value of the DLC register.
+*
+* @return	Number of data bytes of the frame.
+*
+* @note		C-Style signature:
+*		u32 XCanFd_GetFrameLen(u32 DlcReg);
+*
+*****************************************************************************/
+#define XCanFd_GetFrameLen(DlcReg) \
+	((u32)XCanFd_DlcLenTable[((DlcReg) & XCANFD_DLCR_EDL_MASK) != 0U] \
+	 [((DlcReg) & XCANFD_DLCR_DLC_MASK) >> XCANFD_DLCR_DLC_SHIFT])
+
 /****************************************************************************/
 /**
 *
@@ -1079,6 +1169,21 @@ void XCanFd_Enable_Tranceiver_Delay_Compensation(XCanFd *InstancePtr);
 void XCanFd_Set_Tranceiver_Delay_Compensation(XCanFd *InstancePtr, u32 TdcOffset);
 void XCanFd_Disable_Tranceiver_Delay_Compensation(XCanFd *InstancePtr);
 void XCanFd_Pee_BusOff_Handler(XCanFd *InstancePtr);
+void XCanFd_TriggerTxBuffers(XCanFd *InstancePtr, u32 TrrVal);
+
+/* Batched receive and transmit functions in xcanfd_batch.c */
+int XCanFd_RxRingInit(XCanFd_RxRing *RingPtr, XCanFd_RxFrame *FramePtr,
+		      u32 NumFrames);
+u32 XCanFd_Recv_Batch(XCanFd *InstancePtr, XCanFd_RxRing *RingPtr);
+u32 XCanFd_RxRingGetCount(XCanFd_RxRing *RingPtr);
+XCanFd_RxFrame *XCanFd_RxRingPeek(XCanFd_RxRing *RingPtr);
+void XCanFd_RxRingRelease(XCanFd_RxRing *RingPtr);
+int XCanFd_TxSchedInit(XCanFd_TxSched *SchedPtr, XCanFd *InstancePtr,
+		       XCanFd_TxSchedEntry *EntryPtr, u32 NumEntries);
+int XCanFd_TxSchedEnqueue(XCanFd_TxSched *SchedPtr, const u32 *FramePtr);
+u32 XCanFd_TxSchedFill(XCanFd_TxSched *SchedPtr);
+void XCanFd_TxSchedHandler(void *CallBackRef);
+u32 XCanFd_TxSchedGetPending(XCanFd_TxSched *SchedPtr);
 
 /* Configuration functions in xcan_config.c */
 int XCanFd_SetBaudRatePrescaler(XCanFd *InstancePtr, u8 Prescaler);
@@ -0,0 +1,753 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xcanfd_batch.c
+* @addtogroup canfd Overview
+* @{
+*
+* Functions in this file drain the RX FIFOs of a sequential mode core in
+* batches. XCanFd_Recv_Batch() reads the FSR once per batch and reads all
+* frames it reports from both RX FIFOs into a ring of XCanFd_RxFrame
+* entries, instead of one frame per XCanFd_Recv_Sequential() call.
+*
+* The ring is lock free for one producer and one consumer, so the RX
+* interrupt callback can fill it while the application empties it.
+*
+* The TX scheduler keeps pending frames in a binary heap ordered by CAN ID
+* priority. XCanFd_TxSchedFill() reads the TRR once, moves the highest
+* priority frames into all free TX buffers and triggers them with one TRR
+* write. Installed as the send callback, XCanFd_TxSchedHandler() refills the
+* buffers from the TX complete interrupt, so the bus stays busy as long as
+* frames are pending.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date	Changes
+* ----- ---- -------- -------------------------------------------------------
+* 2.9   ag   10/18/26 First release
+* 2.9   ag   10/18/26 Added the TX scheduler.
+* </pre>
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xil_types.h"
+#include "xil_assert.h"
+#include "xil_io.h"
+#include "xcanfd.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/*
+ * Keeps the compiler from moving frame accesses across the update of the
+ * ring counters, which publishes them to the other side of the ring.
+ */
+#if defined (__GNUC__)
+#define XCANFD_BATCH_BARRIER()	__asm__ __volatile__ ("" : : : "memory")
+#else
+#define XCANFD_BATCH_BARRIER()
+#endif
+
+/************************** Function Prototypes ******************************/
+
+static void XCanFd_ReadRxFrame(UINTPTR BaseAddress, UINTPTR IdOffset,
+			       XCanFd_RxFrame *FramePtr);
+static u32 XCanFd_TxSchedBefore(const XCanFd_TxSched *SchedPtr, u8 Index1,
+				u8 Index2);
+static void XCanFd_TxSchedPush(XCanFd_TxSched *SchedPtr, u8 Index);
+static u8 XCanFd_TxSchedPop(XCanFd_TxSched *SchedPtr);
+static u32 XCanFd_TxSchedMove(XCanFd_TxSched *SchedPtr);
+static void XCanFd_WriteTxFrame(UINTPTR BaseAddress, u32 Buffer,
+				const XCanFd_TxSchedEntry *EntryPtr);
+static u32 XCanFd_LowestBit(u32 Value);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a ring of received frames.
+*
+* @param	RingPtr is a pointer to the ring to be initialized.
+* @param	FramePtr is the frame storage of the ring.
+* @param	NumFrames is the number of frames in FramePtr, which must be a
+*		power of 2.
+*
+* @return	- XST_SUCCESS if the ring is initialized.
+*		- XST_INVALID_PARAM if NumFrames is not a power of 2.
+*
+* @note		None.
+*
+******************************************************************************/
+int XCanFd_RxRingInit(XCanFd_RxRing *RingPtr, XCanFd_RxFrame *FramePtr,
+		      u32 NumFrames)
+{
+	Xil_AssertNonvoid(RingPtr != NULL);
+	Xil_AssertNonvoid(FramePtr != NULL);
+
+	if ((NumFrames == (u32)0) ||
+	    ((NumFrames & (NumFrames - (u32)1)) != (u32)0)) {
+		return XST_INVALID_PARAM;
+	}
+
+	RingPtr->FramePtr = FramePtr;
+	RingPtr->Mask = NumFrames - (u32)1;
+	RingPtr->Head = 0U;
+	RingPtr->Tail = 0U;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function receives all frames pending in RX FIFO 0 and RX FIFO 1 into
+* a ring of frames. The FSR is read once per batch to get the fill levels of
+* both FIFOs and the read index of RX FIFO 0, the frames of RX FIFO 0 are then
+* read without further FSR reads. The configuration has no RX FIFO 1 depth,
+* so the read index of RX FIFO 1 is read back from the FSR after every
+* increment. Once a batch is done the FSR is read again to pick up frames
+* which arrived in the meantime, until both FIFOs are empty or the ring is
+* full.
+*
+* Frames which do not fit into the ring are left in the RX FIFOs, so they are
+* received by a later call once the application has released ring entries.
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	RingPtr is a pointer to the ring to be filled.
+*
+* @return	Number of frames added to the ring.
+*
+* @note		This routine is meant for the sequential receive mode. Within
+*		a batch, the frames of RX FIFO 0 are read before the frames of
+*		RX FIFO 1.
+*
+******************************************************************************/
+u32 XCanFd_Recv_Batch(XCanFd *InstancePtr, XCanFd_RxRing *RingPtr)
+{
+	UINTPTR BaseAddress;
+	u32 Depth;
+	u32 Head;
+	u32 Free;
+	u32 Fsr;
+	u32 Fill0;
+	u32 Fill1;
+	u32 Index0;
+	u32 Index1;
+	u32 Count = 0U;
+	XCanFd_RxFrame *FramePtr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(XCANFD_GET_RX_MODE(InstancePtr) == (u32)0);
+	Xil_AssertNonvoid(RingPtr != NULL);
+	Xil_AssertNonvoid(RingPtr->FramePtr != NULL);
+
+	BaseAddress = InstancePtr->CanFdConfig.BaseAddress;
+	Depth = InstancePtr->CanFdConfig.NumofRxMbBuf;
+	Head = RingPtr->Head;
+	Free = RingPtr->Mask + (u32)1 - (Head - RingPtr->Tail);
+
+	while (Free != (u32)0) {
+		Fsr = XCanFd_ReadReg(BaseAddress, XCANFD_FSR_OFFSET);
+		Fill0 = (Fsr & XCANFD_FSR_FL_MASK) >> XCANFD_FSR_FL_0_SHIFT;
+		Fill1 = (Fsr & XCANFD_FSR_FL_1_MASK) >> XCANFD_FSR_FL_1_SHIFT;
+		if ((Fill0 == (u32)0) && (Fill1 == (u32)0)) {
+			break;
+		}
+
+		Index0 = Fsr & XCANFD_FSR_RI_MASK;
+		Index1 = (Fsr & XCANFD_FSR_RI_1_MASK) >> XCANFD_FSR_RI_1_SHIFT;
+
+		while ((Fill0 != (u32)0) && (Free != (u32)0)) {
+			FramePtr = &RingPtr->FramePtr[Head & RingPtr->Mask];
+			XCanFd_ReadRxFrame(BaseAddress,
+					   XCANFD_RXID_OFFSET(Index0), FramePtr);
+			FramePtr->FifoNo = (u8)XCANFD_RX_FIFO_0;
+			/* Core increments RI of FIFO 0, other bits are RO */
+			XCanFd_WriteReg(BaseAddress, XCANFD_FSR_OFFSET,
+					XCANFD_FSR_IRI_MASK);
+			Index0++;
+			if (Index0 == Depth) {
+				Index0 = 0U;
+			}
+			Fill0--;
+			Head++;
+			Free--;
+		}
+
+		while ((Fill1 != (u32)0) && (Free != (u32)0)) {
+			FramePtr = &RingPtr->FramePtr[Head & RingPtr->Mask];
+			XCanFd_ReadRxFrame(BaseAddress,
+					   XCANFD_FIFO_1_RXID_OFFSET(Index1),
+					   FramePtr);
+			FramePtr->FifoNo = (u8)XCANFD_RX_FIFO_1;
+			/* Core increments RI of FIFO 1, other bits are RO */
+			XCanFd_WriteReg(BaseAddress, XCANFD_FSR_OFFSET,
+					XCANFD_FSR_IRI_1_MASK);
+			/* The core wraps RI of FIFO 1 at its own depth */
+			Fsr = XCanFd_ReadReg(BaseAddress, XCANFD_FSR_OFFSET);
+			Index1 = (Fsr & XCANFD_FSR_RI_1_MASK) >>
+				 XCANFD_FSR_RI_1_SHIFT;
+			Fill1--;
+			Head++;
+			Free--;
+		}
+
+		/* Publish the batch to the consumer */
+		XCANFD_BATCH_BARRIER();
+		Count += Head - RingPtr->Head;
+		RingPtr->Head = Head;
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the number of frames in a ring of received frames.
+*
+* @param	RingPtr is a pointer to the ring.
+*
+* @return	Number of frames which can be taken from the ring.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XCanFd_RxRingGetCount(XCanFd_RxRing *RingPtr)
+{
+	Xil_AssertNonvoid(RingPtr != NULL);
+
+	return RingPtr->Head - RingPtr->Tail;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the oldest frame of a ring of received frames. The
+* frame stays in the ring until it is released with XCanFd_RxRingRelease().
+*
+* @param	RingPtr is a pointer to the ring.
+*
+* @return	Pointer to the oldest frame, or NULL if the ring is empty.
+*
+* @note		None.
+*
+******************************************************************************/
+XCanFd_RxFrame *XCanFd_RxRingPeek(XCanFd_RxRing *RingPtr)
+{
+	XCanFd_RxFrame *FramePtr = NULL;
+	u32 Tail;
+
+	Xil_AssertNonvoid(RingPtr != NULL);
+
+	Tail = RingPtr->Tail;
+	if (RingPtr->Head != Tail) {
+		XCANFD_BATCH_BARRIER();
+		FramePtr = &RingPtr->FramePtr[Tail & RingPtr->Mask];
+	}
+
+	return FramePtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function releases the oldest frame of a ring of received frames, so
+* that its entry can be reused by XCanFd_Recv_Batch().
+*
+* @param	RingPtr is a pointer to the ring.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XCanFd_RxRingRelease(XCanFd_RxRing *RingPtr)
+{
+	Xil_AssertVoid(RingPtr != NULL);
+	Xil_AssertVoid(RingPtr->Head != RingPtr->Tail);
+
+	XCANFD_BATCH_BARRIER();
+	RingPtr->Tail++;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a TX scheduler. The scheduler owns all TX buffers
+* of the device, so XCanFd_Send() and XCanFd_Addto_Queue() must not be used
+* on the same device while the scheduler is in use.
+*
+* @param	SchedPtr is a pointer to the scheduler to be initialized.
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	EntryPtr is the frame storage of the scheduler.
+* @param	NumEntries is the number of entries in EntryPtr, at most
+*		XCANFD_TXSCHED_MAX_FRAMES.
+*
+* @return	- XST_SUCCESS if the scheduler is initialized.
+*		- XST_INVALID_PARAM if NumEntries is out of range.
+*
+* @note		To refill the TX buffers from the TX complete interrupt,
+*		install XCanFd_TxSchedHandler() as the XCANFD_HANDLER_SEND
+*		callback with SchedPtr as the callback reference, and enable
+*		the TXOK interrupt.
+*
+******************************************************************************/
+int XCanFd_TxSchedInit(XCanFd_TxSched *SchedPtr, XCanFd *InstancePtr,
+		       XCanFd_TxSchedEntry *EntryPtr, u32 NumEntries)
+{
+	u32 Index;
+
+	Xil_AssertNonvoid(SchedPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(EntryPtr != NULL);
+
+	if ((NumEntries == (u32)0) || (NumEntries > XCANFD_TXSCHED_MAX_FRAMES)) {
+		return XST_INVALID_PARAM;
+	}
+
+	SchedPtr->InstancePtr = InstancePtr;
+	SchedPtr->EntryPtr = EntryPtr;
+	SchedPtr->NumEntries = NumEntries;
+	SchedPtr->Count = 0U;
+	SchedPtr->Seq = 0U;
+	SchedPtr->SentCount = 0U;
+	SchedPtr->BatchCount = 0U;
+
+	if (InstancePtr->CanFdConfig.NumofTxBuf >= MAX_BUFFER_VAL) {
+		SchedPtr->BufMask = TRR_MASK_INIT_VAL;
+	} else {
+		SchedPtr->BufMask = ((u32)1 << InstancePtr->CanFdConfig.NumofTxBuf) -
+				    (u32)1;
+	}
+
+	for (Index = 0U; Index < NumEntries; Index++) {
+		SchedPtr->Free[Index] = (u8)Index;
+	}
+	SchedPtr->FreeCount = NumEntries;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds a frame to a TX scheduler. The frame is not sent until
+* XCanFd_TxSchedFill() or XCanFd_TxSchedHandler() runs, so that a batch of
+* frames can be enqueued and then triggered together.
+*
+* @param	SchedPtr is a pointer to the scheduler.
+* @param	FramePtr is a pointer to a 32-bit aligned buffer containing the
+*		CAN frame, in the format used by XCanFd_Send().
+*
+* @return	- XST_SUCCESS if the frame was added.
+*		- XST_FIFO_NO_ROOM if the scheduler is full.
+*
+* @note		The TXOK interrupt of the device is masked while the frame is
+*		added, so the function can be called while the scheduler is
+*		refilled from the interrupt handler.
+*
+******************************************************************************/
+int XCanFd_TxSchedEnqueue(XCanFd_TxSched *SchedPtr, const u32 *FramePtr)
+{
+	XCanFd_TxSchedEntry *EntryPtr;
+	XCanFd *InstancePtr;
+	u32 IntrMask;
+	u32 Len;
+	u32 DwIndex;
+	u8 Index;
+	int Status = XST_FIFO_NO_ROOM;
+
+	Xil_AssertNonvoid(SchedPtr != NULL);
+	Xil_AssertNonvoid(SchedPtr->InstancePtr != NULL);
+	Xil_AssertNonvoid(FramePtr != NULL);
+
+	InstancePtr = SchedPtr->InstancePtr;
+	IntrMask = XCanFd_InterruptGetEnabled(InstancePtr) & XCANFD_IXR_TXOK_MASK;
+	if (IntrMask != (u32)0) {
+		XCanFd_InterruptDisable(InstancePtr, IntrMask);
+	}
+
+	if (SchedPtr->FreeCount != (u32)0) {
+		SchedPtr->FreeCount--;
+		Index = SchedPtr->Free[SchedPtr->FreeCount];
+		EntryPtr = &SchedPtr->EntryPtr[Index];
+
+		EntryPtr->Id = FramePtr[0];
+		EntryPtr->Dlc = FramePtr[1];
+		EntryPtr->Seq = SchedPtr->Seq;
+		SchedPtr->Seq++;
+		Len = XCanFd_GetFrameLen(FramePtr[1]);
+		for (DwIndex = 0U; (DwIndex * XCANFD_DW_BYTES) < Len; DwIndex++) {
+			EntryPtr->Data[DwIndex] = FramePtr[(u32)2 + DwIndex];
+		}
+
+		XCanFd_TxSchedPush(SchedPtr, Index);
+		Status = XST_SUCCESS;
+	}
+
+	if (IntrMask != (u32)0) {
+		XCanFd_InterruptEnable(InstancePtr, IntrMask);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function moves pending frames of a TX scheduler into all free TX
+* buffers, highest priority first, and triggers them with one TRR write.
+* Call it after a batch of frames has been enqueued.
+*
+* @param	SchedPtr is a pointer to the scheduler.
+*
+* @return	Number of frames moved to TX buffers.
+*
+* @note		The TXOK interrupt of the device is masked while the buffers
+*		are filled.
+*
+******************************************************************************/
+u32 XCanFd_TxSchedFill(XCanFd_TxSched *SchedPtr)
+{
+	XCanFd *InstancePtr;
+	u32 IntrMask;
+	u32 Count;
+
+	Xil_AssertNonvoid(SchedPtr != NULL);
+	Xil_AssertNonvoid(SchedPtr->InstancePtr != NULL);
+
+	InstancePtr = SchedPtr->InstancePtr;
+	IntrMask = XCanFd_InterruptGetEnabled(InstancePtr) & XCANFD_IXR_TXOK_MASK;
+	if (IntrMask != (u32)0) {
+		XCanFd_InterruptDisable(InstancePtr, IntrMask);
+	}
+
+	Count = XCanFd_TxSchedMove(SchedPtr);
+
+	if (IntrMask != (u32)0) {
+		XCanFd_InterruptEnable(InstancePtr, IntrMask);
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the send callback of a TX scheduler. It refills the TX
+* buffers freed by the transmitted frames.
+*
+* @param	CallBackRef is a pointer to the scheduler.
+*
+* @return	None.
+*
+* @note		Install it with XCanFd_SetHandler() for XCANFD_HANDLER_SEND.
+*		It runs in interrupt context.
+*
+******************************************************************************/
+void XCanFd_TxSchedHandler(void *CallBackRef)
+{
+	XCanFd_TxSched *SchedPtr = (XCanFd_TxSched *)CallBackRef;
+
+	Xil_AssertVoid(SchedPtr != NULL);
+
+	(void)XCanFd_TxSchedMove(SchedPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the number of frames of a TX scheduler which are not
+* yet in a TX buffer.
+*
+* @param	SchedPtr is a pointer to the scheduler.
+*
+* @return	Number of pending frames.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XCanFd_TxSchedGetPending(XCanFd_TxSched *SchedPtr)
+{
+	Xil_AssertNonvoid(SchedPtr != NULL);
+
+	return SchedPtr->Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function moves pending frames into all free TX buffers and triggers
+* them with one TRR write.
+*
+* The raw value of the ID register holds the ID, SRR, IDE and RTR bits in the
+* order they are sent on the bus, so a lower value wins the arbitration and
+* the frames are moved in that order. Frames with equal IDs are moved in the
+* order they were enqueued, into TX buffers with ascending numbers.
+*
+* @param	SchedPtr is a pointer to the scheduler.
+*
+* @return	Number of frames moved to TX buffers.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XCanFd_TxSchedMove(XCanFd_TxSched *SchedPtr)
+{
+	XCanFd *InstancePtr = SchedPtr->InstancePtr;
+	UINTPTR BaseAddress = InstancePtr->CanFdConfig.BaseAddress;
+	u32 FreeBufs;
+	u32 Buffer;
+	u32 TrrVal = 0U;
+	u32 Count = 0U;
+	u8 Index;
+
+	if (SchedPtr->Count == (u32)0) {
+		return 0U;
+	}
+
+	FreeBufs = ~XCanFd_ReadReg(BaseAddress, XCANFD_TRR_OFFSET) &
+		   SchedPtr->BufMask;
+
+	while ((FreeBufs != (u32)0) && (SchedPtr->Count != (u32)0)) {
+		Buffer = XCanFd_LowestBit(FreeBufs);
+		FreeBufs &= FreeBufs - (u32)1;
+
+		Index = XCanFd_TxSchedPop(SchedPtr);
+		XCanFd_WriteTxFrame(BaseAddress, Buffer,
+				    &SchedPtr->EntryPtr[Index]);
+		SchedPtr->Free[SchedPtr->FreeCount] = Index;
+		SchedPtr->FreeCount++;
+
+		TrrVal |= (u32)1 << Buffer;
+		Count++;
+	}
+
+	if (TrrVal != (u32)0) {
+		XCanFd_TriggerTxBuffers(InstancePtr, TrrVal);
+		SchedPtr->SentCount += Count;
+		SchedPtr->BatchCount++;
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks whether a pending frame is sent before another one.
+*
+* @param	SchedPtr is a pointer to the scheduler.
+* @param	Index1 is the entry index of the first frame.
+* @param	Index2 is the entry index of the second frame.
+*
+* @return	TRUE if the first frame is sent first, otherwise FALSE.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XCanFd_TxSchedBefore(const XCanFd_TxSched *SchedPtr, u8 Index1,
+				u8 Index2)
+{
+	const XCanFd_TxSchedEntry *Entry1 = &SchedPtr->EntryPtr[Index1];
+	const XCanFd_TxSchedEntry *Entry2 = &SchedPtr->EntryPtr[Index2];
+	u32 Result;
+
+	if (Entry1->Id != Entry2->Id) {
+		Result = (Entry1->Id < Entry2->Id) ? (u32)TRUE : (u32)FALSE;
+	} else {
+		/* Sequence numbers wrap, compare their distance */
+		Result = ((s32)(Entry1->Seq - Entry2->Seq) < 0) ?
+			 (u32)TRUE : (u32)FALSE;
+	}
+
+	return Result;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds an entry to the heap of pending frames.
+*
+* @param	SchedPtr is a pointer to the scheduler.
+* @param	Index is the entry index of the frame.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XCanFd_TxSchedPush(XCanFd_TxSched *SchedPtr, u8 Index)
+{
+	u32 Pos = SchedPtr->Count;
+	u32 Parent;
+
+	SchedPtr->Count++;
+	while (Pos != (u32)0) {
+		Parent = (Pos - (u32)1) >> 1U;
+		if (XCanFd_TxSchedBefore(SchedPtr, Index,
+					 SchedPtr->Heap[Parent]) == (u32)FALSE) {
+			break;
+		}
+		SchedPtr->Heap[Pos] = SchedPtr->Heap[Parent];
+		Pos = Parent;
+	}
+	SchedPtr->Heap[Pos] = Index;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function removes the highest priority entry from the heap of pending
+* frames. The heap must not be empty.
+*
+* @param	SchedPtr is a pointer to the scheduler.
+*
+* @return	Entry index of the highest priority frame.
+*
+* @note		None.
+*
+******************************************************************************/
+static u8 XCanFd_TxSchedPop(XCanFd_TxSched *SchedPtr)
+{
+	u8 Top = SchedPtr->Heap[0];
+	u8 Last;
+	u32 Pos = 0U;
+	u32 Child;
+
+	SchedPtr->Count--;
+	Last = SchedPtr->Heap[SchedPtr->Count];
+
+	for (;;) {
+		Child = (Pos << 1U) + (u32)1;
+		if (Child >= SchedPtr->Count) {
+			break;
+		}
+		if (((Child + (u32)1) < SchedPtr->Count) &&
+		    (XCanFd_TxSchedBefore(SchedPtr, SchedPtr->Heap[Child + (u32)1],
+					  SchedPtr->Heap[Child]) == (u32)TRUE)) {
+			Child++;
+		}
+		if (XCanFd_TxSchedBefore(SchedPtr, SchedPtr->Heap[Child],
+					 Last) == (u32)FALSE) {
+			break;
+		}
+		SchedPtr->Heap[Pos] = SchedPtr->Heap[Child];
+		Pos = Child;
+	}
+	SchedPtr->Heap[Pos] = Last;
+
+	return Top;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes a frame into a TX buffer.
+*
+* @param	BaseAddress is the base address of the device.
+* @param	Buffer is the number of the TX buffer.
+* @param	EntryPtr is a pointer to the frame.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XCanFd_WriteTxFrame(UINTPTR BaseAddress, u32 Buffer,
+				const XCanFd_TxSchedEntry *EntryPtr)
+{
+	UINTPTR Addr = BaseAddress + XCANFD_TXFIFO_0_BASE_ID_OFFSET +
+		       ((UINTPTR)Buffer * XCANFD_MAX_FRAME_SIZE);
+	u32 Len = XCanFd_GetFrameLen(EntryPtr->Dlc);
+	u32 DwIndex;
+
+	Xil_Out32(Addr, EntryPtr->Id);
+	Xil_Out32(Addr + XCANFD_DW_BYTES, EntryPtr->Dlc);
+	Addr += (UINTPTR)2 * XCANFD_DW_BYTES;
+
+	for (DwIndex = 0U; (DwIndex * XCANFD_DW_BYTES) < Len; DwIndex++) {
+		Xil_Out32(Addr, Xil_EndianSwap32(EntryPtr->Data[DwIndex]));
+		Addr += XCANFD_DW_BYTES;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the position of the lowest set bit of a value.
+*
+* @param	Value is the value, which must not be zero.
+*
+* @return	Position of the lowest set bit.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XCanFd_LowestBit(u32 Value)
+{
+#if defined (__GNUC__)
+	return (u32)__builtin_ctz(Value);
+#else
+	u32 Pos = 0U;
+
+	while ((Value & ((u32)1 << Pos)) == (u32)0) {
+		Pos++;
+	}
+
+	return Pos;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads one frame from an RX buffer. The ID, DLC and data word
+* registers of a buffer are consecutive, and CAN and CAN FD frames use the
+* same data word layout, so one loop serves both frame types.
+*
+* @param	BaseAddress is the base address of the device.
+* @param	IdOffset is the offset of the ID register of the RX buffer.
+* @param	FramePtr is a pointer to the frame to be filled.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XCanFd_ReadRxFrame(UINTPTR BaseAddress, UINTPTR IdOffset,
+			       XCanFd_RxFrame *FramePtr)
+{
+	UINTPTR DwAddr = BaseAddress + IdOffset + ((UINTPTR)2 * XCANFD_DW_BYTES);
+	u32 Dlc;
+	u32 Len;
+	u32 DwIndex;
+
+	FramePtr->Id = Xil_In32(BaseAddress + IdOffset);
+	Dlc = Xil_In32(BaseAddress + IdOffset + XCANFD_DW_BYTES);
+	Len = XCanFd_GetFrameLen(Dlc);
+
+	FramePtr->Dlc = Dlc;
+	FramePtr->Len = Len;
+	FramePtr->TimeStamp = (u16)(Dlc & XCANFD_DLCR_TIMESTAMP_MASK);
+
+	for (DwIndex = 0U; (DwIndex * XCANFD_DW_BYTES) < Len; DwIndex++) {
+		FramePtr->Data[DwIndex] = Xil_EndianSwap32(Xil_In32(DwAddr));
+		DwAddr += XCANFD_DW_BYTES;
+	}
+}
+/** @} */
@@ -0,0 +1,547 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xhdcp22_aes_test.c
+*
+* Host known answer test and benchmark of the HDCP 2.2 AES (aes.c).
+*
+* aes.c is included in this file so that its internal AES-192/256 and CTR
+* functions can be tested as well. The test checks:
+*  - FIPS-197 appendix B and appendix C.1 to C.3 vectors, encrypt and
+*    decrypt, through the internal key setup and cipher functions.
+*  - The appendix B and C.1 vectors through XHdcp22Cmn_Aes128Encrypt and
+*    XHdcp22Cmn_Aes128Decrypt.
+*  - SP800-38A F.5.1 and F.5.2 CTR-AES128 vectors, in place and out of
+*    place, including a trailing partial block.
+*  - Decrypt(Encrypt(x)) == x for random keys and blocks.
+*
+* When built with LEGACY_AES set to an earlier aes.c, e.g.
+*   git show <rev>:XilinxProcessorIPLib/drivers/hdcp22_common/src/aes.c > legacy_aes.c
+*   make LEGACY_AES=legacy_aes.c
+* the random blocks are also encrypted and decrypted with that
+* implementation and compared, and it is added to the benchmark.
+*
+* On an AArch64 host, make CE=1 builds with -march=armv8-a+crypto so that
+* aes.c uses the ARMv8 Crypto Extension instead of the T-tables. The
+* backend in use is printed by the test.
+*
+* The benchmark reports ns/byte and cycles/byte of
+* XHdcp22Cmn_Aes128Encrypt/Decrypt, which set up the key for every block as
+* the HDCP 2.2 key derivation does, of single blocks with an expanded key
+* and of AES-128 CTR over a 4KB buffer. Cycles are derived from the time
+* and the core clock given with -f. On x86 the TSC rate is used when -f is
+* not given, which is close to but not the same as core cycles.
+*
+* Usage: xhdcp22_aes_test [-n blocks] [-s seed] [-f MHz] [-b]
+*
+*  -n  Number of random blocks, 100000 by default.
+*  -s  Seed of the random blocks, 1 by default.
+*  -f  Core clock in MHz used to convert the time to cycles.
+*  -b  Runs the benchmark after the test.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ag   10/18/2026 Initial release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <getopt.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#define AES_CIPHER_CTR_MODE
+#include "aes.c"
+#include "xhdcp22_common.h"
+
+/************************** Constant Definitions *****************************/
+#define XHDCP22_TEST_DEF_BLOCKS		100000U
+#define XHDCP22_TEST_BENCH_BYTES	(16U * 1024U * 1024U)
+#define XHDCP22_TEST_CTR_SIZE		4096U
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	const char *Name;
+	int KeySize;		/* Key size in bits */
+	const char *Key;
+	const char *Plain;
+	const char *Cipher;
+} XHdcp22Test_AesVector;
+
+typedef void (*XHdcp22Test_BenchFunc)(u8 *Buf, u32 Size);
+
+/************************** Function Prototypes ******************************/
+#ifdef XHDCP22_TEST_LEGACY
+/* Earlier aes.c built with renamed entry points */
+void XLegacy_Aes128Encrypt(const u8 *Data, const u8 *Key, u8 *Output);
+void XLegacy_Aes128Decrypt(const u8 *Data, const u8 *Key, u8 *Output);
+#endif
+
+/************************** Variable Definitions *****************************/
+static const XHdcp22Test_AesVector aes_vectors[] = {
+	{ "FIPS-197 B", 128,
+	  "2b7e151628aed2a6abf7158809cf4f3c",
+	  "3243f6a8885a308d313198a2e0370734",
+	  "3925841d02dc09fbdc118597196a0b32" },
+	{ "FIPS-197 C.1", 128,
+	  "000102030405060708090a0b0c0d0e0f",
+	  "00112233445566778899aabbccddeeff",
+	  "69c4e0d86a7b0430d8cdb78070b4c55a" },
+	{ "FIPS-197 C.2", 192,
+	  "000102030405060708090a0b0c0d0e0f1011121314151617",
+	  "00112233445566778899aabbccddeeff",
+	  "dda97ca4864cdfe06eaf70a0ec0d7191" },
+	{ "FIPS-197 C.3", 256,
+	  "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f",
+	  "00112233445566778899aabbccddeeff",
+	  "8ea2b7ca516745bfeafc49904b496089" },
+};
+
+/* SP800-38A F.5.1/F.5.2 CTR-AES128 */
+static const char ctr_key[] = "2b7e151628aed2a6abf7158809cf4f3c";
+static const char ctr_iv[] = "f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff";
+static const char ctr_plain[] =
+	"6bc1bee22e409f96e93d7e117393172a"
+	"ae2d8a571e03ac9c9eb76fac45af8e51"
+	"30c81c46a35ce411e5fbc1191a0a52ef"
+	"f69f2445df4f9b17ad2b417be66c3710";
+static const char ctr_cipher[] =
+	"874d6191b620e3261bef6864990db6ce"
+	"9806f66b7970fdff8617187bb9fffdff"
+	"5ae4df3edbd5d35e5b4f09020db03eab"
+	"1e031dda2fbe03d1792170a0f3009cee";
+
+static u32 bench_key_schedule[60];
+static const u8 bench_key[16] = {
+	0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+	0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+static const u8 bench_iv[16];
+static u32 errors;
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+* This function converts a hex string to bytes.
+*
+* @param	Hex is the hex string, two digits per byte.
+* @param	Out is the output buffer.
+*
+* @return	Number of bytes written
+*
+******************************************************************************/
+static u32 XHdcp22Test_FromHex(const char *Hex, u8 *Out)
+{
+	u32 Len = (u32)strlen(Hex) / 2U;
+	u32 Idx;
+	unsigned int Byte;
+
+	for (Idx = 0; Idx < Len; Idx++) {
+		sscanf(&Hex[Idx * 2U], "%2x", &Byte);
+		Out[Idx] = (u8)Byte;
+	}
+
+	return Len;
+}
+
+/*****************************************************************************/
+/**
+* This function compares a result with the expected bytes and reports a
+* mismatch.
+*
+* @param	Name is the name of the check.
+* @param	Got is the result.
+* @param	Exp is the expected result.
+* @param	Size is the number of bytes compared.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_Check(const char *Name, const u8 *Got, const u8 *Exp,
+		u32 Size)
+{
+	u32 Idx;
+
+	if (memcmp(Got, Exp, Size) == 0) {
+		return;
+	}
+
+	errors++;
+	printf("FAIL %s\n  got ", Name);
+	for (Idx = 0; Idx < Size; Idx++) {
+		printf("%02x", Got[Idx]);
+	}
+	printf("\n  exp ");
+	for (Idx = 0; Idx < Size; Idx++) {
+		printf("%02x", Exp[Idx]);
+	}
+	printf("\n");
+}
+
+/*****************************************************************************/
+/**
+* This function runs the FIPS-197 known answer tests.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_AesKat(void)
+{
+	const XHdcp22Test_AesVector *Vec;
+	u32 Schedule[60];
+	u8 Key[32], Plain[16], Cipher[16], Out[16];
+	char Name[64];
+	u32 Idx;
+
+	for (Idx = 0; Idx < sizeof(aes_vectors) / sizeof(aes_vectors[0]); Idx++) {
+		Vec = &aes_vectors[Idx];
+		(void)XHdcp22Test_FromHex(Vec->Key, Key);
+		(void)XHdcp22Test_FromHex(Vec->Plain, Plain);
+		(void)XHdcp22Test_FromHex(Vec->Cipher, Cipher);
+
+		AesKeySetup(Key, Schedule, Vec->KeySize);
+		AesEncrypt(Plain, Out, Schedule, Vec->KeySize);
+		snprintf(Name, sizeof(Name), "%s encrypt", Vec->Name);
+		XHdcp22Test_Check(Name, Out, Cipher, 16U);
+
+		AesKeySetupDec(Key, Schedule, Vec->KeySize);
+		AesDecrypt(Cipher, Out, Schedule, Vec->KeySize);
+		snprintf(Name, sizeof(Name), "%s decrypt", Vec->Name);
+		XHdcp22Test_Check(Name, Out, Plain, 16U);
+
+		if (Vec->KeySize != 128) {
+			continue;
+		}
+
+		XHdcp22Cmn_Aes128Encrypt(Plain, Key, Out);
+		snprintf(Name, sizeof(Name), "%s Aes128Encrypt", Vec->Name);
+		XHdcp22Test_Check(Name, Out, Cipher, 16U);
+
+		XHdcp22Cmn_Aes128Decrypt(Cipher, Key, Out);
+		snprintf(Name, sizeof(Name), "%s Aes128Decrypt", Vec->Name);
+		XHdcp22Test_Check(Name, Out, Plain, 16U);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function runs the SP800-38A CTR-AES128 known answer tests. The full
+* vector is processed in place and out of place, and a truncated vector
+* checks the trailing partial block.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_CtrKat(void)
+{
+	u32 Schedule[60];
+	u8 Key[16], Iv[16], Plain[64], Cipher[64], Out[64];
+	u32 Size;
+
+	(void)XHdcp22Test_FromHex(ctr_key, Key);
+	(void)XHdcp22Test_FromHex(ctr_iv, Iv);
+	Size = XHdcp22Test_FromHex(ctr_plain, Plain);
+	(void)XHdcp22Test_FromHex(ctr_cipher, Cipher);
+	AesKeySetup(Key, Schedule, 128);
+
+	AesEncryptCtr(Plain, Size, Out, Schedule, 128, Iv);
+	XHdcp22Test_Check("SP800-38A F.5.1 CTR encrypt", Out, Cipher, Size);
+
+	memcpy(Out, Cipher, Size);
+	AesDecryptCtr(Out, Size, Out, Schedule, 128, Iv);
+	XHdcp22Test_Check("SP800-38A F.5.2 CTR decrypt in place", Out, Plain,
+			Size);
+
+	memset(Out, 0, sizeof(Out));
+	AesEncryptCtr(Plain, Size - 5U, Out, Schedule, 128, Iv);
+	XHdcp22Test_Check("SP800-38A F.5.1 CTR partial block", Out, Cipher,
+			Size - 5U);
+}
+
+/*****************************************************************************/
+/**
+* This function encrypts and decrypts random blocks with random keys and
+* checks the round trip, and the legacy implementation when it is built in.
+*
+* @param	Blocks is the number of random blocks.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_AesRandom(u32 Blocks)
+{
+	u8 Key[16], Plain[16], Cipher[16], Out[16];
+#ifdef XHDCP22_TEST_LEGACY
+	u8 Legacy[16];
+#endif
+	u32 Idx, Byte;
+
+	for (Idx = 0; (Idx < Blocks) && (errors < 10U); Idx++) {
+		for (Byte = 0; Byte < 16U; Byte++) {
+			Key[Byte] = (u8)rand();
+			Plain[Byte] = (u8)rand();
+		}
+
+		XHdcp22Cmn_Aes128Encrypt(Plain, Key, Cipher);
+		XHdcp22Cmn_Aes128Decrypt(Cipher, Key, Out);
+		XHdcp22Test_Check("random round trip", Out, Plain, 16U);
+
+#ifdef XHDCP22_TEST_LEGACY
+		XLegacy_Aes128Encrypt(Plain, Key, Legacy);
+		XHdcp22Test_Check("random encrypt vs legacy", Cipher, Legacy,
+				16U);
+		XLegacy_Aes128Decrypt(Cipher, Key, Legacy);
+		XHdcp22Test_Check("random decrypt vs legacy", Out, Legacy, 16U);
+#endif
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function returns the current host time.
+*
+* @return	Time in ns
+*
+******************************************************************************/
+static u64 XHdcp22Test_Now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ((u64)ts.tv_sec * 1000000000ULL) + (u64)ts.tv_nsec;
+}
+
+/*****************************************************************************/
+/**
+* This function estimates the x86 TSC rate.
+*
+* @return	TSC rate in MHz, 0 when there is no TSC
+*
+******************************************************************************/
+static double XHdcp22Test_TscMhz(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	struct timespec Delay = { 0, 100000000L };
+	u64 Start = XHdcp22Test_Now();
+	u64 Tsc = __rdtsc();
+
+	nanosleep(&Delay, NULL);
+	Tsc = __rdtsc() - Tsc;
+
+	return (double)Tsc * 1000.0 / (double)(XHdcp22Test_Now() - Start);
+#else
+	return 0.0;
+#endif
+}
+
+/*
+ * Benchmark cases, each processes Size bytes of Buf in place
+ */
+static void XHdcp22Test_BenchEncrypt(u8 *Buf, u32 Size)
+{
+	u32 Idx;
+
+	for (Idx = 0; Idx < Size; Idx += 16U) {
+		XHdcp22Cmn_Aes128Encrypt(&Buf[Idx], bench_key, &Buf[Idx]);
+	}
+}
+
+static void XHdcp22Test_BenchDecrypt(u8 *Buf, u32 Size)
+{
+	u32 Idx;
+
+	for (Idx = 0; Idx < Size; Idx += 16U) {
+		XHdcp22Cmn_Aes128Decrypt(&Buf[Idx], bench_key, &Buf[Idx]);
+	}
+}
+
+#ifdef XHDCP22_TEST_LEGACY
+static void XHdcp22Test_BenchLegacyEncrypt(u8 *Buf, u32 Size)
+{
+	u32 Idx;
+
+	for (Idx = 0; Idx < Size; Idx += 16U) {
+		XLegacy_Aes128Encrypt(&Buf[Idx], bench_key, &Buf[Idx]);
+	}
+}
+
+static void XHdcp22Test_BenchLegacyDecrypt(u8 *Buf, u32 Size)
+{
+	u32 Idx;
+
+	for (Idx = 0; Idx < Size; Idx += 16U) {
+		XLegacy_Aes128Decrypt(&Buf[Idx], bench_key, &Buf[Idx]);
+	}
+}
+#endif
+
+static void XHdcp22Test_BenchBlock(u8 *Buf, u32 Size)
+{
+	u32 Idx;
+
+	for (Idx = 0; Idx < Size; Idx += 16U) {
+		AesEncrypt(&Buf[Idx], &Buf[Idx], bench_key_schedule, 128);
+	}
+}
+
+static void XHdcp22Test_BenchCtr(u8 *Buf, u32 Size)
+{
+	u32 Idx;
+
+	for (Idx = 0; Idx < Size; Idx += XHDCP22_TEST_CTR_SIZE) {
+		AesEncryptCtr(&Buf[Idx], XHDCP22_TEST_CTR_SIZE, &Buf[Idx],
+				bench_key_schedule, 128, bench_iv);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function times one benchmark case and prints ns/byte and cycles/byte.
+* The fastest of a few runs is reported.
+*
+* @param	Name is the name of the case.
+* @param	Func is the function processing the buffer.
+* @param	Buf is the buffer, XHDCP22_TEST_BENCH_BYTES long.
+* @param	Mhz is the clock used for cycles, 0 if unknown.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_BenchCase(const char *Name, XHdcp22Test_BenchFunc Func,
+		u8 *Buf, double Mhz)
+{
+	u64 Best = ~0ULL;
+	u64 Start, Time;
+	double NsPerByte;
+	u32 Run;
+
+	for (Run = 0; Run < 5U; Run++) {
+		Start = XHdcp22Test_Now();
+		Func(Buf, XHDCP22_TEST_BENCH_BYTES);
+		Time = XHdcp22Test_Now() - Start;
+		if (Time < Best) {
+			Best = Time;
+		}
+	}
+
+	NsPerByte = (double)Best / (double)XHDCP22_TEST_BENCH_BYTES;
+	if (Mhz > 0.0) {
+		printf("%-36s %8.2f ns/byte %8.2f cycles/byte\n", Name,
+				NsPerByte, NsPerByte * Mhz / 1000.0);
+	} else {
+		printf("%-36s %8.2f ns/byte\n", Name, NsPerByte);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function runs the benchmark.
+*
+* @param	Mhz is the clock used for cycles, 0 to use the TSC rate.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_Bench(double Mhz)
+{
+	u8 *Buf = calloc(1U, XHDCP22_TEST_BENCH_BYTES);
+
+	if (Buf == NULL) {
+		printf("Out of memory\n");
+		errors++;
+		return;
+	}
+
+	if (Mhz <= 0.0) {
+		Mhz = XHdcp22Test_TscMhz();
+	}
+	AesKeySetup(bench_key, bench_key_schedule, 128);
+
+	XHdcp22Test_BenchCase("Aes128Encrypt (key + block)",
+			XHdcp22Test_BenchEncrypt, Buf, Mhz);
+	XHdcp22Test_BenchCase("Aes128Decrypt (key + block)",
+			XHdcp22Test_BenchDecrypt, Buf, Mhz);
+#ifdef XHDCP22_TEST_LEGACY
+	XHdcp22Test_BenchCase("legacy Aes128Encrypt (key + block)",
+			XHdcp22Test_BenchLegacyEncrypt, Buf, Mhz);
+	XHdcp22Test_BenchCase("legacy Aes128Decrypt (key + block)",
+			XHdcp22Test_BenchLegacyDecrypt, Buf, Mhz);
+#endif
+	XHdcp22Test_BenchCase("AesEncrypt (expanded key)",
+			XHdcp22Test_BenchBlock, Buf, Mhz);
+	XHdcp22Test_BenchCase("AesEncryptCtr (4KB)",
+			XHdcp22Test_BenchCtr, Buf, Mhz);
+
+	free(Buf);
+}
+
+int main(int argc, char **argv)
+{
+	u32 Blocks = XHDCP22_TEST_DEF_BLOCKS;
+	unsigned int Seed = 1U;
+	double Mhz = 0.0;
+	int Bench = 0;
+	int Opt;
+
+	while ((Opt = getopt(argc, argv, "n:s:f:b")) != -1) {
+		switch (Opt) {
+		case 'n':
+			Blocks = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			Seed = (unsigned int)strtoul(optarg, NULL, 0);
+			break;
+		case 'f':
+			Mhz = strtod(optarg, NULL);
+			break;
+		case 'b':
+			Bench = 1;
+			break;
+		default:
+			fprintf(stderr, "Usage: %s [-n blocks] [-s seed] "
+					"[-f MHz] [-b]\n", argv[0]);
+			return 2;
+		}
+	}
+
+#ifdef AES_ARMV8_CE
+	printf("AES backend: ARMv8 Crypto Extension\n");
+#else
+	printf("AES backend: T-table\n");
+#endif
+
+	srand(Seed);
+	XHdcp22Test_AesKat();
+	XHdcp22Test_CtrKat();
+	XHdcp22Test_AesRandom(Blocks);
+	printf("%s: %u random blocks%s, %u errors\n",
+			(errors == 0U) ? "PASS" : "FAIL", Blocks,
+#ifdef XHDCP22_TEST_LEGACY
+			" (compared with legacy)",
+#else
+			"",
+#endif
+			errors);
+
+	if ((errors == 0U) && (Bench != 0)) {
+		XHdcp22Test_Bench(Mhz);
+	}
+
+	return (errors == 0U) ? 0 : 1;
+}
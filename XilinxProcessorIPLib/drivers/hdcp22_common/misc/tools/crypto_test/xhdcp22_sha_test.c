@@ -0,0 +1,784 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xhdcp22_sha_test.c
+*
+* Host known answer test and benchmark of the HDCP 2.2 SHA-256 (sha2.c) and
+* HMAC-SHA256 (hmac.c).
+*
+* The test checks:
+*  - FIPS 180-2 SHA-256 examples: "", "abc", the 56 and 112 byte messages
+*    and one million times 'a'.
+*  - RFC 4231 HMAC-SHA256 test cases 1 to 7, through
+*    XHdcp22Cmn_HmacSha256Hash and through a context prepared once with
+*    XHdcp22Cmn_HmacSha256Init and used twice.
+*  - Random messages of 0 to 300 bytes, covering every padding boundary,
+*    and random HMAC keys of 0 to 150 bytes against a plain reference
+*    SHA-256 in this file.
+*  - XHdcp22Cmn_Sha256Resume(XHdcp22Cmn_Sha256Midstate(block), data) is
+*    the hash of the block followed by the data.
+*
+* When built with LEGACY_SHA2 and LEGACY_HMAC set to an earlier sha2.c and
+* hmac.c, e.g.
+*   git show <rev>:XilinxProcessorIPLib/drivers/hdcp22_common/src/sha2.c > legacy_sha2.c
+*   git show <rev>:XilinxProcessorIPLib/drivers/hdcp22_common/src/hmac.c > legacy_hmac.c
+*   make LEGACY_SHA2=legacy_sha2.c LEGACY_HMAC=legacy_hmac.c
+* the legacy implementation is added to the benchmark.
+*
+* On an AArch64 host, make CE=1 builds with -march=armv8-a+crypto so that
+* sha2.c uses the ARMv8 SHA-2 instructions. The backend in use is printed
+* by the test.
+*
+* The benchmark reports ns/byte and cycles/byte of XHdcp22Cmn_Sha256Hash
+* on 4KB and 64 byte messages, and the time of one HMAC of 32 bytes with a
+* 32 byte key, as used for H', L' and the key derivation. Cycles are
+* derived from the time and the core clock given with -f. On x86 the TSC
+* rate is used when -f is not given.
+*
+* Usage: xhdcp22_sha_test [-n messages] [-s seed] [-f MHz] [-b]
+*
+*  -n  Number of random messages and HMAC keys, 2000 by default.
+*  -s  Seed of the random messages, 1 by default.
+*  -f  Core clock in MHz used to convert the time to cycles.
+*  -b  Runs the benchmark after the test.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ag   10/18/2026 Initial release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <getopt.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xhdcp22_common.h"
+
+/************************** Constant Definitions *****************************/
+#define XHDCP22_TEST_DEF_MESSAGES	2000U
+#define XHDCP22_TEST_MAX_MESSAGE	300U
+#define XHDCP22_TEST_MAX_KEY		150U
+#define XHDCP22_TEST_MILLION		1000000U
+#define XHDCP22_TEST_BENCH_BYTES	(16U * 1024U * 1024U)
+#define XHDCP22_TEST_BENCH_MACS		100000U
+
+/* Same condition as sha2.c */
+#if defined(__aarch64__) && !defined(__AARCH64EB__) && \
+    (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_SHA2))
+#define XHDCP22_TEST_SHA2_CE
+#endif
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	const char *Message;
+	u32 Repeat;		/* Number of times the message is hashed */
+	const char *Hash;
+} XHdcp22Test_ShaVector;
+
+/*
+ * RFC 4231 test case. A key or data given as NULL consists of Size times
+ * the Fill byte.
+ */
+typedef struct {
+	const char *KeyHex;
+	u8 KeyFill;
+	u32 KeySize;
+	const char *Data;
+	u8 DataFill;
+	u32 DataSize;
+	const char *Mac;	/* Truncated for test case 5 */
+} XHdcp22Test_HmacVector;
+
+typedef void (*XHdcp22Test_BenchFunc)(u8 *Buf, u32 Size);
+
+/************************** Function Prototypes ******************************/
+#ifdef XHDCP22_TEST_LEGACY
+/* Earlier sha2.c and hmac.c built with renamed entry points */
+void XLegacy_Sha256Hash(const u8 *Data, u32 DataSize, u8 *HashedData);
+int XLegacy_HmacSha256Hash(const u8 *Data, int DataSize, const u8 *Key,
+		int KeySize, u8 *HashedData);
+#endif
+
+/************************** Variable Definitions *****************************/
+static const XHdcp22Test_ShaVector sha_vectors[] = {
+	{ "", 1,
+	  "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" },
+	{ "abc", 1,
+	  "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" },
+	{ "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 1,
+	  "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1" },
+	{ "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmn"
+	  "hijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu", 1,
+	  "cf5b16a778af8380036ce59e7b0492370b249b11e8f07a51afac45037afee9d1" },
+	{ "a", XHDCP22_TEST_MILLION,
+	  "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0" },
+};
+
+static const XHdcp22Test_HmacVector hmac_vectors[] = {
+	{ NULL, 0x0b, 20, "Hi There", 0, 0,
+	  "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7" },
+	{ "4a656665", 0, 0, "what do ya want for nothing?", 0, 0,
+	  "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843" },
+	{ NULL, 0xaa, 20, NULL, 0xdd, 50,
+	  "773ea91e36800e46854db8ebd09181a72959098b3ef8c122d9635514ced565fe" },
+	{ "0102030405060708090a0b0c0d0e0f10111213141516171819", 0, 0,
+	  NULL, 0xcd, 50,
+	  "82558a389a443c0ea4cc819899f2083a85f0faa3e578f8077a2e3ff46729665b" },
+	{ NULL, 0x0c, 20, "Test With Truncation", 0, 0,
+	  "a3b6167473100ee06e0c796c2955552b" },
+	{ NULL, 0xaa, 131,
+	  "Test Using Larger Than Block-Size Key - Hash Key First", 0, 0,
+	  "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54" },
+	{ NULL, 0xaa, 131,
+	  "This is a test using a larger than block-size key and a larger "
+	  "than block-size data. The key needs to be hashed before being used "
+	  "by the HMAC algorithm.", 0, 0,
+	  "9b09ffa71b942fcb27635fbcd5b0e944bfdc63644f0713938a7f51535c3a35e2" },
+};
+
+/* SHA-256 round constants of the reference implementation */
+static const u32 ref_k[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+	0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+	0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+	0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+	0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+	0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+	0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+	0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+	0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static const u8 bench_key[32] = {
+	0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+	0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
+	0x0f, 0x1e, 0x2d, 0x3c, 0x4b, 0x5a, 0x69, 0x78,
+	0x87, 0x96, 0xa5, 0xb4, 0xc3, 0xd2, 0xe1, 0xf0
+};
+static XHdcp22Cmn_HmacSha256Ctx bench_ctx;
+static u32 errors;
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+* This function converts a hex string to bytes.
+*
+* @param	Hex is the hex string, two digits per byte.
+* @param	Out is the output buffer.
+*
+* @return	Number of bytes written
+*
+******************************************************************************/
+static u32 XHdcp22Test_FromHex(const char *Hex, u8 *Out)
+{
+	u32 Len = (u32)strlen(Hex) / 2U;
+	u32 Idx;
+	unsigned int Byte;
+
+	for (Idx = 0; Idx < Len; Idx++) {
+		sscanf(&Hex[Idx * 2U], "%2x", &Byte);
+		Out[Idx] = (u8)Byte;
+	}
+
+	return Len;
+}
+
+/*****************************************************************************/
+/**
+* This function compares a result with the expected bytes and reports a
+* mismatch.
+*
+* @param	Name is the name of the check.
+* @param	Got is the result.
+* @param	Exp is the expected result.
+* @param	Size is the number of bytes compared.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_Check(const char *Name, const u8 *Got, const u8 *Exp,
+		u32 Size)
+{
+	u32 Idx;
+
+	if (memcmp(Got, Exp, Size) == 0) {
+		return;
+	}
+
+	errors++;
+	printf("FAIL %s\n  got ", Name);
+	for (Idx = 0; Idx < Size; Idx++) {
+		printf("%02x", Got[Idx]);
+	}
+	printf("\n  exp ");
+	for (Idx = 0; Idx < Size; Idx++) {
+		printf("%02x", Exp[Idx]);
+	}
+	printf("\n");
+}
+
+/*****************************************************************************/
+/**
+* This function compresses one block with the plain FIPS 180-2 SHA-256
+* transform, used as reference.
+*
+* @param	State is the hash state.
+* @param	Block is the 64 byte block.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_RefTransform(u32 *State, const u8 *Block)
+{
+	u32 W[64];
+	u32 V[8];
+	u32 T1, T2;
+	u32 Idx;
+
+#define XHDCP22_TEST_ROTR(x, n)	(((x) >> (n)) | ((x) << (32 - (n))))
+	for (Idx = 0; Idx < 16U; Idx++) {
+		W[Idx] = ((u32)Block[4 * Idx] << 24) |
+			 ((u32)Block[4 * Idx + 1] << 16) |
+			 ((u32)Block[4 * Idx + 2] << 8) | Block[4 * Idx + 3];
+	}
+	for (Idx = 16; Idx < 64U; Idx++) {
+		W[Idx] = (XHDCP22_TEST_ROTR(W[Idx - 2], 17) ^
+			  XHDCP22_TEST_ROTR(W[Idx - 2], 19) ^ (W[Idx - 2] >> 10)) +
+			 W[Idx - 7] +
+			 (XHDCP22_TEST_ROTR(W[Idx - 15], 7) ^
+			  XHDCP22_TEST_ROTR(W[Idx - 15], 18) ^ (W[Idx - 15] >> 3)) +
+			 W[Idx - 16];
+	}
+
+	memcpy(V, State, sizeof(V));
+	for (Idx = 0; Idx < 64U; Idx++) {
+		T1 = V[7] + (XHDCP22_TEST_ROTR(V[4], 6) ^
+			     XHDCP22_TEST_ROTR(V[4], 11) ^
+			     XHDCP22_TEST_ROTR(V[4], 25)) +
+		     ((V[4] & V[5]) ^ (~V[4] & V[6])) + ref_k[Idx] + W[Idx];
+		T2 = (XHDCP22_TEST_ROTR(V[0], 2) ^ XHDCP22_TEST_ROTR(V[0], 13) ^
+		      XHDCP22_TEST_ROTR(V[0], 22)) +
+		     ((V[0] & V[1]) ^ (V[0] & V[2]) ^ (V[1] & V[2]));
+		memmove(&V[1], &V[0], 7 * sizeof(u32));
+		V[4] += T1;
+		V[0] = T1 + T2;
+	}
+#undef XHDCP22_TEST_ROTR
+
+	for (Idx = 0; Idx < 8U; Idx++) {
+		State[Idx] += V[Idx];
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function computes a reference SHA-256 hash of a message.
+*
+* @param	Data is the message.
+* @param	Size is the size of the message.
+* @param	Hash is the 32 byte hash.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_RefSha256(const u8 *Data, u32 Size, u8 *Hash)
+{
+	u32 State[8] = {
+		0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+		0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+	};
+	u8 Block[128];
+	u64 Bits = (u64)Size * 8U;
+	u32 Off = 0, Rest, PadSize, Idx;
+
+	for (; Size - Off >= 64U; Off += 64U) {
+		XHdcp22Test_RefTransform(State, &Data[Off]);
+	}
+
+	Rest = Size - Off;
+	PadSize = (Rest < 56U) ? 64U : 128U;
+	memset(Block, 0, sizeof(Block));
+	memcpy(Block, &Data[Off], Rest);
+	Block[Rest] = 0x80;
+	for (Idx = 0; Idx < 8U; Idx++) {
+		Block[PadSize - 1U - Idx] = (u8)(Bits >> (8U * Idx));
+	}
+	XHdcp22Test_RefTransform(State, Block);
+	if (PadSize == 128U) {
+		XHdcp22Test_RefTransform(State, &Block[64]);
+	}
+
+	for (Idx = 0; Idx < 8U; Idx++) {
+		Hash[4 * Idx] = (u8)(State[Idx] >> 24);
+		Hash[4 * Idx + 1] = (u8)(State[Idx] >> 16);
+		Hash[4 * Idx + 2] = (u8)(State[Idx] >> 8);
+		Hash[4 * Idx + 3] = (u8)State[Idx];
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function computes a reference HMAC-SHA256.
+*
+* @param	Data is the message.
+* @param	Size is the size of the message.
+* @param	Key is the key.
+* @param	KeySize is the size of the key.
+* @param	Mac is the 32 byte MAC.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_RefHmac(const u8 *Data, u32 Size, const u8 *Key,
+		u32 KeySize, u8 *Mac)
+{
+	u8 Buf[64 + XHDCP22_TEST_MAX_MESSAGE];
+	u8 K[64];
+	u32 Idx;
+
+	memset(K, 0, sizeof(K));
+	if (KeySize > 64U) {
+		XHdcp22Test_RefSha256(Key, KeySize, K);
+	} else {
+		memcpy(K, Key, KeySize);
+	}
+
+	for (Idx = 0; Idx < 64U; Idx++) {
+		Buf[Idx] = K[Idx] ^ 0x36;
+	}
+	memcpy(&Buf[64], Data, Size);
+	XHdcp22Test_RefSha256(Buf, 64U + Size, Mac);
+
+	for (Idx = 0; Idx < 64U; Idx++) {
+		Buf[Idx] = K[Idx] ^ 0x5c;
+	}
+	memcpy(&Buf[64], Mac, 32U);
+	XHdcp22Test_RefSha256(Buf, 64U + 32U, Mac);
+}
+
+/*****************************************************************************/
+/**
+* This function runs the FIPS 180-2 SHA-256 known answer tests.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_ShaKat(void)
+{
+	const XHdcp22Test_ShaVector *Vec;
+	u8 *Msg;
+	u8 Hash[32], Exp[32];
+	char Name[64];
+	u32 Idx, Len, Rep;
+
+	for (Idx = 0; Idx < sizeof(sha_vectors) / sizeof(sha_vectors[0]); Idx++) {
+		Vec = &sha_vectors[Idx];
+		Len = (u32)strlen(Vec->Message);
+		Msg = malloc((Len * Vec->Repeat) + 1U);
+		if (Msg == NULL) {
+			printf("Out of memory\n");
+			errors++;
+			return;
+		}
+		for (Rep = 0; Rep < Vec->Repeat; Rep++) {
+			memcpy(&Msg[Rep * Len], Vec->Message, Len);
+		}
+
+		(void)XHdcp22Test_FromHex(Vec->Hash, Exp);
+		XHdcp22Cmn_Sha256Hash(Msg, Len * Vec->Repeat, Hash);
+		snprintf(Name, sizeof(Name), "SHA-256 FIPS 180-2 example %u",
+				Idx + 1U);
+		XHdcp22Test_Check(Name, Hash, Exp, sizeof(Hash));
+
+		free(Msg);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function runs the RFC 4231 HMAC-SHA256 known answer tests.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_HmacKat(void)
+{
+	const XHdcp22Test_HmacVector *Vec;
+	XHdcp22Cmn_HmacSha256Ctx Ctx;
+	u8 Key[256], Data[256], Mac[32], Exp[32];
+	u32 KeySize, DataSize, MacSize, Idx, Run;
+	char Name[64];
+
+	for (Idx = 0; Idx < sizeof(hmac_vectors) / sizeof(hmac_vectors[0]); Idx++) {
+		Vec = &hmac_vectors[Idx];
+		if (Vec->KeyHex != NULL) {
+			KeySize = XHdcp22Test_FromHex(Vec->KeyHex, Key);
+		} else {
+			KeySize = Vec->KeySize;
+			memset(Key, Vec->KeyFill, KeySize);
+		}
+		if (Vec->Data != NULL) {
+			DataSize = (u32)strlen(Vec->Data);
+			memcpy(Data, Vec->Data, DataSize);
+		} else {
+			DataSize = Vec->DataSize;
+			memset(Data, Vec->DataFill, DataSize);
+		}
+		MacSize = XHdcp22Test_FromHex(Vec->Mac, Exp);
+
+		memset(Mac, 0, sizeof(Mac));
+		if (XHdcp22Cmn_HmacSha256Hash(Data, (int)DataSize, Key,
+				(int)KeySize, Mac) != XST_SUCCESS) {
+			errors++;
+		}
+		snprintf(Name, sizeof(Name), "HMAC RFC 4231 test case %u",
+				Idx + 1U);
+		XHdcp22Test_Check(Name, Mac, Exp, MacSize);
+
+		/* The context is not changed by a MAC */
+		XHdcp22Cmn_HmacSha256Init(&Ctx, Key, (int)KeySize);
+		for (Run = 0; Run < 2U; Run++) {
+			memset(Mac, 0, sizeof(Mac));
+			if (XHdcp22Cmn_HmacSha256Compute(&Ctx, Data, (int)DataSize,
+					Mac) != XST_SUCCESS) {
+				errors++;
+			}
+			snprintf(Name, sizeof(Name),
+					"HMAC RFC 4231 test case %u context %u",
+					Idx + 1U, Run + 1U);
+			XHdcp22Test_Check(Name, Mac, Exp, MacSize);
+		}
+	}
+
+	if (XHdcp22Cmn_HmacSha256Hash(Data, -1, Key, 20, Mac) != XST_FAILURE) {
+		printf("FAIL HMAC of a negative data size\n");
+		errors++;
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function compares hashes, midstate hashes and HMACs of random
+* messages and keys with the reference implementation.
+*
+* @param	Count is the number of random messages.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_Random(u32 Count)
+{
+	u8 Msg[XHDCP22_TEST_MAX_MESSAGE];
+	u8 Key[XHDCP22_TEST_MAX_KEY];
+	u8 Hash[32], Exp[32];
+	u32 State[8];
+	u32 Size, KeySize, Idx, Byte;
+	char Name[64];
+
+	for (Idx = 0; (Idx < Count) && (errors < 10U); Idx++) {
+		/* Every size is covered once before random sizes are used */
+		Size = (Idx <= XHDCP22_TEST_MAX_MESSAGE) ? Idx :
+			(u32)rand() % (XHDCP22_TEST_MAX_MESSAGE + 1U);
+		KeySize = (u32)rand() % (XHDCP22_TEST_MAX_KEY + 1U);
+		for (Byte = 0; Byte < Size; Byte++) {
+			Msg[Byte] = (u8)rand();
+		}
+		for (Byte = 0; Byte < KeySize; Byte++) {
+			Key[Byte] = (u8)rand();
+		}
+
+		XHdcp22Test_RefSha256(Msg, Size, Exp);
+		XHdcp22Cmn_Sha256Hash(Msg, Size, Hash);
+		snprintf(Name, sizeof(Name), "SHA-256 of %u random bytes", Size);
+		XHdcp22Test_Check(Name, Hash, Exp, sizeof(Hash));
+
+		if (Size >= 64U) {
+			XHdcp22Cmn_Sha256Midstate(Msg, State);
+			XHdcp22Cmn_Sha256Resume(State, &Msg[64], Size - 64U, Hash);
+			snprintf(Name, sizeof(Name),
+					"SHA-256 midstate of %u random bytes", Size);
+			XHdcp22Test_Check(Name, Hash, Exp, sizeof(Hash));
+		}
+
+		XHdcp22Test_RefHmac(Msg, Size, Key, KeySize, Exp);
+		(void)XHdcp22Cmn_HmacSha256Hash(Msg, (int)Size, Key,
+				(int)KeySize, Hash);
+		snprintf(Name, sizeof(Name),
+				"HMAC of %u random bytes, %u byte key", Size,
+				KeySize);
+		XHdcp22Test_Check(Name, Hash, Exp, sizeof(Hash));
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function returns the current host time.
+*
+* @return	Time in ns
+*
+******************************************************************************/
+static u64 XHdcp22Test_Now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ((u64)ts.tv_sec * 1000000000ULL) + (u64)ts.tv_nsec;
+}
+
+/*****************************************************************************/
+/**
+* This function estimates the x86 TSC rate.
+*
+* @return	TSC rate in MHz, 0 when there is no TSC
+*
+******************************************************************************/
+static double XHdcp22Test_TscMhz(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	struct timespec Delay = { 0, 100000000L };
+	u64 Start = XHdcp22Test_Now();
+	u64 Tsc = __rdtsc();
+
+	nanosleep(&Delay, NULL);
+	Tsc = __rdtsc() - Tsc;
+
+	return (double)Tsc * 1000.0 / (double)(XHdcp22Test_Now() - Start);
+#else
+	return 0.0;
+#endif
+}
+
+/*
+ * Benchmark cases, each processes Size bytes of Buf
+ */
+static void XHdcp22Test_BenchHash4K(u8 *Buf, u32 Size)
+{
+	u32 Idx;
+
+	for (Idx = 0; Idx < Size; Idx += 4096U) {
+		XHdcp22Cmn_Sha256Hash(&Buf[Idx], 4096U, &Buf[Idx]);
+	}
+}
+
+static void XHdcp22Test_BenchHash64(u8 *Buf, u32 Size)
+{
+	u32 Idx;
+
+	for (Idx = 0; Idx < Size; Idx += 64U) {
+		XHdcp22Cmn_Sha256Hash(&Buf[Idx], 64U, &Buf[Idx]);
+	}
+}
+
+static void XHdcp22Test_BenchHmac(u8 *Buf, u32 Size)
+{
+	u32 Idx;
+
+	for (Idx = 0; Idx < Size; Idx += 32U) {
+		(void)XHdcp22Cmn_HmacSha256Hash(&Buf[Idx], 32, bench_key, 32,
+				&Buf[Idx]);
+	}
+}
+
+static void XHdcp22Test_BenchHmacCtx(u8 *Buf, u32 Size)
+{
+	u32 Idx;
+
+	for (Idx = 0; Idx < Size; Idx += 32U) {
+		(void)XHdcp22Cmn_HmacSha256Compute(&bench_ctx, &Buf[Idx], 32,
+				&Buf[Idx]);
+	}
+}
+
+#ifdef XHDCP22_TEST_LEGACY
+static void XHdcp22Test_BenchLegacyHash4K(u8 *Buf, u32 Size)
+{
+	u32 Idx;
+
+	for (Idx = 0; Idx < Size; Idx += 4096U) {
+		XLegacy_Sha256Hash(&Buf[Idx], 4096U, &Buf[Idx]);
+	}
+}
+
+static void XHdcp22Test_BenchLegacyHash64(u8 *Buf, u32 Size)
+{
+	u32 Idx;
+
+	for (Idx = 0; Idx < Size; Idx += 64U) {
+		XLegacy_Sha256Hash(&Buf[Idx], 64U, &Buf[Idx]);
+	}
+}
+
+static void XHdcp22Test_BenchLegacyHmac(u8 *Buf, u32 Size)
+{
+	u32 Idx;
+
+	for (Idx = 0; Idx < Size; Idx += 32U) {
+		(void)XLegacy_HmacSha256Hash(&Buf[Idx], 32, bench_key, 32,
+				&Buf[Idx]);
+	}
+}
+#endif
+
+/*****************************************************************************/
+/**
+* This function times one benchmark case. The fastest of a few runs is
+* reported as ns/byte and cycles/byte, or for HMAC as the time per MAC.
+*
+* @param	Name is the name of the case.
+* @param	Func is the function processing the buffer.
+* @param	Buf is the buffer.
+* @param	Size is the number of bytes processed per run.
+* @param	MacSize is the data size of one MAC, 0 for hash cases.
+* @param	Mhz is the clock used for cycles, 0 if unknown.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_BenchCase(const char *Name, XHdcp22Test_BenchFunc Func,
+		u8 *Buf, u32 Size, u32 MacSize, double Mhz)
+{
+	u64 Best = ~0ULL;
+	u64 Start, Time;
+	double NsPerUnit;
+	u32 Run;
+
+	for (Run = 0; Run < 5U; Run++) {
+		Start = XHdcp22Test_Now();
+		Func(Buf, Size);
+		Time = XHdcp22Test_Now() - Start;
+		if (Time < Best) {
+			Best = Time;
+		}
+	}
+
+	if (MacSize != 0U) {
+		NsPerUnit = (double)Best / (double)(Size / MacSize);
+		printf("%-36s %8.0f ns/MAC", Name, NsPerUnit);
+		if (Mhz > 0.0) {
+			printf(" %8.0f cycles/MAC", NsPerUnit * Mhz / 1000.0);
+		}
+	} else {
+		NsPerUnit = (double)Best / (double)Size;
+		printf("%-36s %8.2f ns/byte", Name, NsPerUnit);
+		if (Mhz > 0.0) {
+			printf(" %8.2f cycles/byte", NsPerUnit * Mhz / 1000.0);
+		}
+	}
+	printf("\n");
+}
+
+/*****************************************************************************/
+/**
+* This function runs the benchmark.
+*
+* @param	Mhz is the clock used for cycles, 0 to use the TSC rate.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_Bench(double Mhz)
+{
+	u32 MacBytes = XHDCP22_TEST_BENCH_MACS * 32U;
+	u8 *Buf = calloc(1U, XHDCP22_TEST_BENCH_BYTES);
+
+	if (Buf == NULL) {
+		printf("Out of memory\n");
+		errors++;
+		return;
+	}
+
+	if (Mhz <= 0.0) {
+		Mhz = XHdcp22Test_TscMhz();
+	}
+	XHdcp22Cmn_HmacSha256Init(&bench_ctx, bench_key, 32);
+
+	XHdcp22Test_BenchCase("Sha256Hash (4KB)", XHdcp22Test_BenchHash4K,
+			Buf, XHDCP22_TEST_BENCH_BYTES, 0U, Mhz);
+	XHdcp22Test_BenchCase("Sha256Hash (64 bytes)", XHdcp22Test_BenchHash64,
+			Buf, XHDCP22_TEST_BENCH_BYTES / 4U, 0U, Mhz);
+	XHdcp22Test_BenchCase("HmacSha256Hash (32 bytes)",
+			XHdcp22Test_BenchHmac, Buf, MacBytes, 32U, Mhz);
+	XHdcp22Test_BenchCase("HmacSha256Compute (32 bytes)",
+			XHdcp22Test_BenchHmacCtx, Buf, MacBytes, 32U, Mhz);
+#ifdef XHDCP22_TEST_LEGACY
+	XHdcp22Test_BenchCase("legacy Sha256Hash (4KB)",
+			XHdcp22Test_BenchLegacyHash4K, Buf,
+			XHDCP22_TEST_BENCH_BYTES, 0U, Mhz);
+	XHdcp22Test_BenchCase("legacy Sha256Hash (64 bytes)",
+			XHdcp22Test_BenchLegacyHash64, Buf,
+			XHDCP22_TEST_BENCH_BYTES / 4U, 0U, Mhz);
+	XHdcp22Test_BenchCase("legacy HmacSha256Hash (32 bytes)",
+			XHdcp22Test_BenchLegacyHmac, Buf, MacBytes, 32U, Mhz);
+#endif
+
+	free(Buf);
+}
+
+int main(int argc, char **argv)
+{
+	u32 Count = XHDCP22_TEST_DEF_MESSAGES;
+	unsigned int Seed = 1U;
+	double Mhz = 0.0;
+	int Bench = 0;
+	int Opt;
+
+	while ((Opt = getopt(argc, argv, "n:s:f:b")) != -1) {
+		switch (Opt) {
+		case 'n':
+			Count = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			Seed = (unsigned int)strtoul(optarg, NULL, 0);
+			break;
+		case 'f':
+			Mhz = strtod(optarg, NULL);
+			break;
+		case 'b':
+			Bench = 1;
+			break;
+		default:
+			fprintf(stderr, "Usage: %s [-n messages] [-s seed] "
+					"[-f MHz] [-b]\n", argv[0]);
+			return 2;
+		}
+	}
+
+#ifdef XHDCP22_TEST_SHA2_CE
+	printf("SHA-256 backend: ARMv8 SHA-2 instructions\n");
+#else
+	printf("SHA-256 backend: portable\n");
+#endif
+
+	srand(Seed);
+	XHdcp22Test_ShaKat();
+	XHdcp22Test_HmacKat();
+	XHdcp22Test_Random(Count);
+	printf("%s: %u random messages, %u errors\n",
+			(errors == 0U) ? "PASS" : "FAIL", Count, errors);
+
+	if ((errors == 0U) && (Bench != 0)) {
+		XHdcp22Test_Bench(Mhz);
+	}
+
+	return (errors == 0U) ? 0 : 1;
+}
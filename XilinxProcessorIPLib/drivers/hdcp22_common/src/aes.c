@@ -25,6 +25,9 @@
 * ----- ---- -------- -----------------------------------------------
 * 1.00  MH   10/30/15 First Release
 * 1.01  MH   01/28/17 Fixed warnings and errors.
+* 1.02  ag   10/18/26 Replaced the byte wise cipher with a 32-bit T-table
+*                     implementation, use the ARMv8 Crypto Extension when
+*                     it is enabled at build time.
 *</pre>
 *
 *****************************************************************************/
@@ -34,182 +37,128 @@
 #include "stdlib.h"
 #include "xil_types.h"
 
+/* The ARMv8 Crypto Extension AESE/AESMC instructions are used when the
+   compiler targets them (e.g. -march=armv8-a+crypto), otherwise the
+   portable T-table implementation is built. */
+#if defined(__aarch64__) && !defined(__AARCH64EB__) && \
+    (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES))
+#define AES_ARMV8_CE
+#include <arm_neon.h>
+#endif
+
 /************************** Constant Definitions *****************************/
-/* This is the specified AES SBox. To look up a substitution value, put the first
-   nibble in the first index (row) and the second nibble in the second index (column). */
-static const u8 Aes_Sbox[16][16] = {
-	{0x63,0x7C,0x77,0x7B,0xF2,0x6B,0x6F,0xC5,0x30,0x01,0x67,0x2B,0xFE,0xD7,0xAB,0x76},
-	{0xCA,0x82,0xC9,0x7D,0xFA,0x59,0x47,0xF0,0xAD,0xD4,0xA2,0xAF,0x9C,0xA4,0x72,0xC0},
-	{0xB7,0xFD,0x93,0x26,0x36,0x3F,0xF7,0xCC,0x34,0xA5,0xE5,0xF1,0x71,0xD8,0x31,0x15},
-	{0x04,0xC7,0x23,0xC3,0x18,0x96,0x05,0x9A,0x07,0x12,0x80,0xE2,0xEB,0x27,0xB2,0x75},
-	{0x09,0x83,0x2C,0x1A,0x1B,0x6E,0x5A,0xA0,0x52,0x3B,0xD6,0xB3,0x29,0xE3,0x2F,0x84},
-	{0x53,0xD1,0x00,0xED,0x20,0xFC,0xB1,0x5B,0x6A,0xCB,0xBE,0x39,0x4A,0x4C,0x58,0xCF},
-	{0xD0,0xEF,0xAA,0xFB,0x43,0x4D,0x33,0x85,0x45,0xF9,0x02,0x7F,0x50,0x3C,0x9F,0xA8},
-	{0x51,0xA3,0x40,0x8F,0x92,0x9D,0x38,0xF5,0xBC,0xB6,0xDA,0x21,0x10,0xFF,0xF3,0xD2},
-	{0xCD,0x0C,0x13,0xEC,0x5F,0x97,0x44,0x17,0xC4,0xA7,0x7E,0x3D,0x64,0x5D,0x19,0x73},
-	{0x60,0x81,0x4F,0xDC,0x22,0x2A,0x90,0x88,0x46,0xEE,0xB8,0x14,0xDE,0x5E,0x0B,0xDB},
-	{0xE0,0x32,0x3A,0x0A,0x49,0x06,0x24,0x5C,0xC2,0xD3,0xAC,0x62,0x91,0x95,0xE4,0x79},
-	{0xE7,0xC8,0x37,0x6D,0x8D,0xD5,0x4E,0xA9,0x6C,0x56,0xF4,0xEA,0x65,0x7A,0xAE,0x08},
-	{0xBA,0x78,0x25,0x2E,0x1C,0xA6,0xB4,0xC6,0xE8,0xDD,0x74,0x1F,0x4B,0xBD,0x8B,0x8A},
-	{0x70,0x3E,0xB5,0x66,0x48,0x03,0xF6,0x0E,0x61,0x35,0x57,0xB9,0x86,0xC1,0x1D,0x9E},
-	{0xE1,0xF8,0x98,0x11,0x69,0xD9,0x8E,0x94,0x9B,0x1E,0x87,0xE9,0xCE,0x55,0x28,0xDF},
-	{0x8C,0xA1,0x89,0x0D,0xBF,0xE6,0x42,0x68,0x41,0x99,0x2D,0x0F,0xB0,0x54,0xBB,0x16}
+/* This is the specified AES SBox, indexed by the input byte. */
+static const u8 Aes_Sbox[256] = {
+	0x63,0x7C,0x77,0x7B,0xF2,0x6B,0x6F,0xC5,0x30,0x01,0x67,0x2B,0xFE,0xD7,0xAB,0x76,
+	0xCA,0x82,0xC9,0x7D,0xFA,0x59,0x47,0xF0,0xAD,0xD4,0xA2,0xAF,0x9C,0xA4,0x72,0xC0,
+	0xB7,0xFD,0x93,0x26,0x36,0x3F,0xF7,0xCC,0x34,0xA5,0xE5,0xF1,0x71,0xD8,0x31,0x15,
+	0x04,0xC7,0x23,0xC3,0x18,0x96,0x05,0x9A,0x07,0x12,0x80,0xE2,0xEB,0x27,0xB2,0x75,
+	0x09,0x83,0x2C,0x1A,0x1B,0x6E,0x5A,0xA0,0x52,0x3B,0xD6,0xB3,0x29,0xE3,0x2F,0x84,
+	0x53,0xD1,0x00,0xED,0x20,0xFC,0xB1,0x5B,0x6A,0xCB,0xBE,0x39,0x4A,0x4C,0x58,0xCF,
+	0xD0,0xEF,0xAA,0xFB,0x43,0x4D,0x33,0x85,0x45,0xF9,0x02,0x7F,0x50,0x3C,0x9F,0xA8,
+	0x51,0xA3,0x40,0x8F,0x92,0x9D,0x38,0xF5,0xBC,0xB6,0xDA,0x21,0x10,0xFF,0xF3,0xD2,
+	0xCD,0x0C,0x13,0xEC,0x5F,0x97,0x44,0x17,0xC4,0xA7,0x7E,0x3D,0x64,0x5D,0x19,0x73,
+	0x60,0x81,0x4F,0xDC,0x22,0x2A,0x90,0x88,0x46,0xEE,0xB8,0x14,0xDE,0x5E,0x0B,0xDB,
+	0xE0,0x32,0x3A,0x0A,0x49,0x06,0x24,0x5C,0xC2,0xD3,0xAC,0x62,0x91,0x95,0xE4,0x79,
+	0xE7,0xC8,0x37,0x6D,0x8D,0xD5,0x4E,0xA9,0x6C,0x56,0xF4,0xEA,0x65,0x7A,0xAE,0x08,
+	0xBA,0x78,0x25,0x2E,0x1C,0xA6,0xB4,0xC6,0xE8,0xDD,0x74,0x1F,0x4B,0xBD,0x8B,0x8A,
+	0x70,0x3E,0xB5,0x66,0x48,0x03,0xF6,0x0E,0x61,0x35,0x57,0xB9,0x86,0xC1,0x1D,0x9E,
+	0xE1,0xF8,0x98,0x11,0x69,0xD9,0x8E,0x94,0x9B,0x1E,0x87,0xE9,0xCE,0x55,0x28,0xDF,
+	0x8C,0xA1,0x89,0x0D,0xBF,0xE6,0x42,0x68,0x41,0x99,0x2D,0x0F,0xB0,0x54,0xBB,0x16
+};
+
+/* This is the inverse AES SBox, indexed by the input byte. */
+static const u8 Aes_Invsbox[256] = {
+	0x52,0x09,0x6A,0xD5,0x30,0x36,0xA5,0x38,0xBF,0x40,0xA3,0x9E,0x81,0xF3,0xD7,0xFB,
+	0x7C,0xE3,0x39,0x82,0x9B,0x2F,0xFF,0x87,0x34,0x8E,0x43,0x44,0xC4,0xDE,0xE9,0xCB,
+	0x54,0x7B,0x94,0x32,0xA6,0xC2,0x23,0x3D,0xEE,0x4C,0x95,0x0B,0x42,0xFA,0xC3,0x4E,
+	0x08,0x2E,0xA1,0x66,0x28,0xD9,0x24,0xB2,0x76,0x5B,0xA2,0x49,0x6D,0x8B,0xD1,0x25,
+	0x72,0xF8,0xF6,0x64,0x86,0x68,0x98,0x16,0xD4,0xA4,0x5C,0xCC,0x5D,0x65,0xB6,0x92,
+	0x6C,0x70,0x48,0x50,0xFD,0xED,0xB9,0xDA,0x5E,0x15,0x46,0x57,0xA7,0x8D,0x9D,0x84,
+	0x90,0xD8,0xAB,0x00,0x8C,0xBC,0xD3,0x0A,0xF7,0xE4,0x58,0x05,0xB8,0xB3,0x45,0x06,
+	0xD0,0x2C,0x1E,0x8F,0xCA,0x3F,0x0F,0x02,0xC1,0xAF,0xBD,0x03,0x01,0x13,0x8A,0x6B,
+	0x3A,0x91,0x11,0x41,0x4F,0x67,0xDC,0xEA,0x97,0xF2,0xCF,0xCE,0xF0,0xB4,0xE6,0x73,
+	0x96,0xAC,0x74,0x22,0xE7,0xAD,0x35,0x85,0xE2,0xF9,0x37,0xE8,0x1C,0x75,0xDF,0x6E,
+	0x47,0xF1,0x1A,0x71,0x1D,0x29,0xC5,0x89,0x6F,0xB7,0x62,0x0E,0xAA,0x18,0xBE,0x1B,
+	0xFC,0x56,0x3E,0x4B,0xC6,0xD2,0x79,0x20,0x9A,0xDB,0xC0,0xFE,0x78,0xCD,0x5A,0xF4,
+	0x1F,0xDD,0xA8,0x33,0x88,0x07,0xC7,0x31,0xB1,0x12,0x10,0x59,0x27,0x80,0xEC,0x5F,
+	0x60,0x51,0x7F,0xA9,0x19,0xB5,0x4A,0x0D,0x2D,0xE5,0x7A,0x9F,0x93,0xC9,0x9C,0xEF,
+	0xA0,0xE0,0x3B,0x4D,0xAE,0x2A,0xF5,0xB0,0xC8,0xEB,0xBB,0x3C,0x83,0x53,0x99,0x61,
+	0x17,0x2B,0x04,0x7E,0xBA,0x77,0xD6,0x26,0xE1,0x69,0x14,0x63,0x55,0x21,0x0C,0x7D
 };
 
-static const u8 Aes_Invsbox[16][16] = {
-	{0x52,0x09,0x6A,0xD5,0x30,0x36,0xA5,0x38,0xBF,0x40,0xA3,0x9E,0x81,0xF3,0xD7,0xFB},
-	{0x7C,0xE3,0x39,0x82,0x9B,0x2F,0xFF,0x87,0x34,0x8E,0x43,0x44,0xC4,0xDE,0xE9,0xCB},
-	{0x54,0x7B,0x94,0x32,0xA6,0xC2,0x23,0x3D,0xEE,0x4C,0x95,0x0B,0x42,0xFA,0xC3,0x4E},
-	{0x08,0x2E,0xA1,0x66,0x28,0xD9,0x24,0xB2,0x76,0x5B,0xA2,0x49,0x6D,0x8B,0xD1,0x25},
-	{0x72,0xF8,0xF6,0x64,0x86,0x68,0x98,0x16,0xD4,0xA4,0x5C,0xCC,0x5D,0x65,0xB6,0x92},
-	{0x6C,0x70,0x48,0x50,0xFD,0xED,0xB9,0xDA,0x5E,0x15,0x46,0x57,0xA7,0x8D,0x9D,0x84},
-	{0x90,0xD8,0xAB,0x00,0x8C,0xBC,0xD3,0x0A,0xF7,0xE4,0x58,0x05,0xB8,0xB3,0x45,0x06},
-	{0xD0,0x2C,0x1E,0x8F,0xCA,0x3F,0x0F,0x02,0xC1,0xAF,0xBD,0x03,0x01,0x13,0x8A,0x6B},
-	{0x3A,0x91,0x11,0x41,0x4F,0x67,0xDC,0xEA,0x97,0xF2,0xCF,0xCE,0xF0,0xB4,0xE6,0x73},
-	{0x96,0xAC,0x74,0x22,0xE7,0xAD,0x35,0x85,0xE2,0xF9,0x37,0xE8,0x1C,0x75,0xDF,0x6E},
-	{0x47,0xF1,0x1A,0x71,0x1D,0x29,0xC5,0x89,0x6F,0xB7,0x62,0x0E,0xAA,0x18,0xBE,0x1B},
-	{0xFC,0x56,0x3E,0x4B,0xC6,0xD2,0x79,0x20,0x9A,0xDB,0xC0,0xFE,0x78,0xCD,0x5A,0xF4},
-	{0x1F,0xDD,0xA8,0x33,0x88,0x07,0xC7,0x31,0xB1,0x12,0x10,0x59,0x27,0x80,0xEC,0x5F},
-	{0x60,0x51,0x7F,0xA9,0x19,0xB5,0x4A,0x0D,0x2D,0xE5,0x7A,0x9F,0x93,0xC9,0x9C,0xEF},
-	{0xA0,0xE0,0x3B,0x4D,0xAE,0x2A,0xF5,0xB0,0xC8,0xEB,0xBB,0x3C,0x83,0x53,0x99,0x61},
-	{0x17,0x2B,0x04,0x7E,0xBA,0x77,0xD6,0x26,0xE1,0x69,0x14,0x63,0x55,0x21,0x0C,0x7D}
+/* Encryption T-table. Each entry holds the MixColumns column
+   {02,01,01,03} multiplied by SBox[x], the first byte in the MSB. */
+static const u32 Aes_Te0[256] = {
+	0xC66363A5U,0xF87C7C84U,0xEE777799U,0xF67B7B8DU,0xFFF2F20DU,0xD66B6BBDU,0xDE6F6FB1U,0x91C5C554U,
+	0x60303050U,0x02010103U,0xCE6767A9U,0x562B2B7DU,0xE7FEFE19U,0xB5D7D762U,0x4DABABE6U,0xEC76769AU,
+	0x8FCACA45U,0x1F82829DU,0x89C9C940U,0xFA7D7D87U,0xEFFAFA15U,0xB25959EBU,0x8E4747C9U,0xFBF0F00BU,
+	0x41ADADECU,0xB3D4D467U,0x5FA2A2FDU,0x45AFAFEAU,0x239C9CBFU,0x53A4A4F7U,0xE4727296U,0x9BC0C05BU,
+	0x75B7B7C2U,0xE1FDFD1CU,0x3D9393AEU,0x4C26266AU,0x6C36365AU,0x7E3F3F41U,0xF5F7F702U,0x83CCCC4FU,
+	0x6834345CU,0x51A5A5F4U,0xD1E5E534U,0xF9F1F108U,0xE2717193U,0xABD8D873U,0x62313153U,0x2A15153FU,
+	0x0804040CU,0x95C7C752U,0x46232365U,0x9DC3C35EU,0x30181828U,0x379696A1U,0x0A05050FU,0x2F9A9AB5U,
+	0x0E070709U,0x24121236U,0x1B80809BU,0xDFE2E23DU,0xCDEBEB26U,0x4E272769U,0x7FB2B2CDU,0xEA75759FU,
+	0x1209091BU,0x1D83839EU,0x582C2C74U,0x341A1A2EU,0x361B1B2DU,0xDC6E6EB2U,0xB45A5AEEU,0x5BA0A0FBU,
+	0xA45252F6U,0x763B3B4DU,0xB7D6D661U,0x7DB3B3CEU,0x5229297BU,0xDDE3E33EU,0x5E2F2F71U,0x13848497U,
+	0xA65353F5U,0xB9D1D168U,0x00000000U,0xC1EDED2CU,0x40202060U,0xE3FCFC1FU,0x79B1B1C8U,0xB65B5BEDU,
+	0xD46A6ABEU,0x8DCBCB46U,0x67BEBED9U,0x7239394BU,0x944A4ADEU,0x984C4CD4U,0xB05858E8U,0x85CFCF4AU,
+	0xBBD0D06BU,0xC5EFEF2AU,0x4FAAAAE5U,0xEDFBFB16U,0x864343C5U,0x9A4D4DD7U,0x66333355U,0x11858594U,
+	0x8A4545CFU,0xE9F9F910U,0x04020206U,0xFE7F7F81U,0xA05050F0U,0x783C3C44U,0x259F9FBAU,0x4BA8A8E3U,
+	0xA25151F3U,0x5DA3A3FEU,0x804040C0U,0x058F8F8AU,0x3F9292ADU,0x219D9DBCU,0x70383848U,0xF1F5F504U,
+	0x63BCBCDFU,0x77B6B6C1U,0xAFDADA75U,0x42212163U,0x20101030U,0xE5FFFF1AU,0xFDF3F30EU,0xBFD2D26DU,
+	0x81CDCD4CU,0x180C0C14U,0x26131335U,0xC3ECEC2FU,0xBE5F5FE1U,0x359797A2U,0x884444CCU,0x2E171739U,
+	0x93C4C457U,0x55A7A7F2U,0xFC7E7E82U,0x7A3D3D47U,0xC86464ACU,0xBA5D5DE7U,0x3219192BU,0xE6737395U,
+	0xC06060A0U,0x19818198U,0x9E4F4FD1U,0xA3DCDC7FU,0x44222266U,0x542A2A7EU,0x3B9090ABU,0x0B888883U,
+	0x8C4646CAU,0xC7EEEE29U,0x6BB8B8D3U,0x2814143CU,0xA7DEDE79U,0xBC5E5EE2U,0x160B0B1DU,0xADDBDB76U,
+	0xDBE0E03BU,0x64323256U,0x743A3A4EU,0x140A0A1EU,0x924949DBU,0x0C06060AU,0x4824246CU,0xB85C5CE4U,
+	0x9FC2C25DU,0xBDD3D36EU,0x43ACACEFU,0xC46262A6U,0x399191A8U,0x319595A4U,0xD3E4E437U,0xF279798BU,
+	0xD5E7E732U,0x8BC8C843U,0x6E373759U,0xDA6D6DB7U,0x018D8D8CU,0xB1D5D564U,0x9C4E4ED2U,0x49A9A9E0U,
+	0xD86C6CB4U,0xAC5656FAU,0xF3F4F407U,0xCFEAEA25U,0xCA6565AFU,0xF47A7A8EU,0x47AEAEE9U,0x10080818U,
+	0x6FBABAD5U,0xF0787888U,0x4A25256FU,0x5C2E2E72U,0x381C1C24U,0x57A6A6F1U,0x73B4B4C7U,0x97C6C651U,
+	0xCBE8E823U,0xA1DDDD7CU,0xE874749CU,0x3E1F1F21U,0x964B4BDDU,0x61BDBDDCU,0x0D8B8B86U,0x0F8A8A85U,
+	0xE0707090U,0x7C3E3E42U,0x71B5B5C4U,0xCC6666AAU,0x904848D8U,0x06030305U,0xF7F6F601U,0x1C0E0E12U,
+	0xC26161A3U,0x6A35355FU,0xAE5757F9U,0x69B9B9D0U,0x17868691U,0x99C1C158U,0x3A1D1D27U,0x279E9EB9U,
+	0xD9E1E138U,0xEBF8F813U,0x2B9898B3U,0x22111133U,0xD26969BBU,0xA9D9D970U,0x078E8E89U,0x339494A7U,
+	0x2D9B9BB6U,0x3C1E1E22U,0x15878792U,0xC9E9E920U,0x87CECE49U,0xAA5555FFU,0x50282878U,0xA5DFDF7AU,
+	0x038C8C8FU,0x59A1A1F8U,0x09898980U,0x1A0D0D17U,0x65BFBFDAU,0xD7E6E631U,0x844242C6U,0xD06868B8U,
+	0x824141C3U,0x299999B0U,0x5A2D2D77U,0x1E0F0F11U,0x7BB0B0CBU,0xA85454FCU,0x6DBBBBD6U,0x2C16163AU
 };
 
-/* This table stores pre-calculated values for all possible GF(2^8) calculations.This
-   table is only used by the (Inv)MixColumns steps.
-   USAGE: The second index (column) is the coefficient of multiplication. Only 7 different
-   coefficients are used: 0x01, 0x02, 0x03, 0x09, 0x0b, 0x0d, 0x0e, but multiplication by
-   1 is negligible leaving only 6 coefficients. Each column of the table is devoted to one
-   of these coefficients, in the ascending order of value, from values 0x00 to 0xFF. */
-static const u8 Aes_GfMul[256][6] = {
-	{0x00,0x00,0x00,0x00,0x00,0x00},{0x02,0x03,0x09,0x0b,0x0d,0x0e},
-	{0x04,0x06,0x12,0x16,0x1a,0x1c},{0x06,0x05,0x1b,0x1d,0x17,0x12},
-	{0x08,0x0c,0x24,0x2c,0x34,0x38},{0x0a,0x0f,0x2d,0x27,0x39,0x36},
-	{0x0c,0x0a,0x36,0x3a,0x2e,0x24},{0x0e,0x09,0x3f,0x31,0x23,0x2a},
-	{0x10,0x18,0x48,0x58,0x68,0x70},{0x12,0x1b,0x41,0x53,0x65,0x7e},
-	{0x14,0x1e,0x5a,0x4e,0x72,0x6c},{0x16,0x1d,0x53,0x45,0x7f,0x62},
-	{0x18,0x14,0x6c,0x74,0x5c,0x48},{0x1a,0x17,0x65,0x7f,0x51,0x46},
-	{0x1c,0x12,0x7e,0x62,0x46,0x54},{0x1e,0x11,0x77,0x69,0x4b,0x5a},
-	{0x20,0x30,0x90,0xb0,0xd0,0xe0},{0x22,0x33,0x99,0xbb,0xdd,0xee},
-	{0x24,0x36,0x82,0xa6,0xca,0xfc},{0x26,0x35,0x8b,0xad,0xc7,0xf2},
-	{0x28,0x3c,0xb4,0x9c,0xe4,0xd8},{0x2a,0x3f,0xbd,0x97,0xe9,0xd6},
-	{0x2c,0x3a,0xa6,0x8a,0xfe,0xc4},{0x2e,0x39,0xaf,0x81,0xf3,0xca},
-	{0x30,0x28,0xd8,0xe8,0xb8,0x90},{0x32,0x2b,0xd1,0xe3,0xb5,0x9e},
-	{0x34,0x2e,0xca,0xfe,0xa2,0x8c},{0x36,0x2d,0xc3,0xf5,0xaf,0x82},
-	{0x38,0x24,0xfc,0xc4,0x8c,0xa8},{0x3a,0x27,0xf5,0xcf,0x81,0xa6},
-	{0x3c,0x22,0xee,0xd2,0x96,0xb4},{0x3e,0x21,0xe7,0xd9,0x9b,0xba},
-	{0x40,0x60,0x3b,0x7b,0xbb,0xdb},{0x42,0x63,0x32,0x70,0xb6,0xd5},
-	{0x44,0x66,0x29,0x6d,0xa1,0xc7},{0x46,0x65,0x20,0x66,0xac,0xc9},
-	{0x48,0x6c,0x1f,0x57,0x8f,0xe3},{0x4a,0x6f,0x16,0x5c,0x82,0xed},
-	{0x4c,0x6a,0x0d,0x41,0x95,0xff},{0x4e,0x69,0x04,0x4a,0x98,0xf1},
-	{0x50,0x78,0x73,0x23,0xd3,0xab},{0x52,0x7b,0x7a,0x28,0xde,0xa5},
-	{0x54,0x7e,0x61,0x35,0xc9,0xb7},{0x56,0x7d,0x68,0x3e,0xc4,0xb9},
-	{0x58,0x74,0x57,0x0f,0xe7,0x93},{0x5a,0x77,0x5e,0x04,0xea,0x9d},
-	{0x5c,0x72,0x45,0x19,0xfd,0x8f},{0x5e,0x71,0x4c,0x12,0xf0,0x81},
-	{0x60,0x50,0xab,0xcb,0x6b,0x3b},{0x62,0x53,0xa2,0xc0,0x66,0x35},
-	{0x64,0x56,0xb9,0xdd,0x71,0x27},{0x66,0x55,0xb0,0xd6,0x7c,0x29},
-	{0x68,0x5c,0x8f,0xe7,0x5f,0x03},{0x6a,0x5f,0x86,0xec,0x52,0x0d},
-	{0x6c,0x5a,0x9d,0xf1,0x45,0x1f},{0x6e,0x59,0x94,0xfa,0x48,0x11},
-	{0x70,0x48,0xe3,0x93,0x03,0x4b},{0x72,0x4b,0xea,0x98,0x0e,0x45},
-	{0x74,0x4e,0xf1,0x85,0x19,0x57},{0x76,0x4d,0xf8,0x8e,0x14,0x59},
-	{0x78,0x44,0xc7,0xbf,0x37,0x73},{0x7a,0x47,0xce,0xb4,0x3a,0x7d},
-	{0x7c,0x42,0xd5,0xa9,0x2d,0x6f},{0x7e,0x41,0xdc,0xa2,0x20,0x61},
-	{0x80,0xc0,0x76,0xf6,0x6d,0xad},{0x82,0xc3,0x7f,0xfd,0x60,0xa3},
-	{0x84,0xc6,0x64,0xe0,0x77,0xb1},{0x86,0xc5,0x6d,0xeb,0x7a,0xbf},
-	{0x88,0xcc,0x52,0xda,0x59,0x95},{0x8a,0xcf,0x5b,0xd1,0x54,0x9b},
-	{0x8c,0xca,0x40,0xcc,0x43,0x89},{0x8e,0xc9,0x49,0xc7,0x4e,0x87},
-	{0x90,0xd8,0x3e,0xae,0x05,0xdd},{0x92,0xdb,0x37,0xa5,0x08,0xd3},
-	{0x94,0xde,0x2c,0xb8,0x1f,0xc1},{0x96,0xdd,0x25,0xb3,0x12,0xcf},
-	{0x98,0xd4,0x1a,0x82,0x31,0xe5},{0x9a,0xd7,0x13,0x89,0x3c,0xeb},
-	{0x9c,0xd2,0x08,0x94,0x2b,0xf9},{0x9e,0xd1,0x01,0x9f,0x26,0xf7},
-	{0xa0,0xf0,0xe6,0x46,0xbd,0x4d},{0xa2,0xf3,0xef,0x4d,0xb0,0x43},
-	{0xa4,0xf6,0xf4,0x50,0xa7,0x51},{0xa6,0xf5,0xfd,0x5b,0xaa,0x5f},
-	{0xa8,0xfc,0xc2,0x6a,0x89,0x75},{0xaa,0xff,0xcb,0x61,0x84,0x7b},
-	{0xac,0xfa,0xd0,0x7c,0x93,0x69},{0xae,0xf9,0xd9,0x77,0x9e,0x67},
-	{0xb0,0xe8,0xae,0x1e,0xd5,0x3d},{0xb2,0xeb,0xa7,0x15,0xd8,0x33},
-	{0xb4,0xee,0xbc,0x08,0xcf,0x21},{0xb6,0xed,0xb5,0x03,0xc2,0x2f},
-	{0xb8,0xe4,0x8a,0x32,0xe1,0x05},{0xba,0xe7,0x83,0x39,0xec,0x0b},
-	{0xbc,0xe2,0x98,0x24,0xfb,0x19},{0xbe,0xe1,0x91,0x2f,0xf6,0x17},
-	{0xc0,0xa0,0x4d,0x8d,0xd6,0x76},{0xc2,0xa3,0x44,0x86,0xdb,0x78},
-	{0xc4,0xa6,0x5f,0x9b,0xcc,0x6a},{0xc6,0xa5,0x56,0x90,0xc1,0x64},
-	{0xc8,0xac,0x69,0xa1,0xe2,0x4e},{0xca,0xaf,0x60,0xaa,0xef,0x40},
-	{0xcc,0xaa,0x7b,0xb7,0xf8,0x52},{0xce,0xa9,0x72,0xbc,0xf5,0x5c},
-	{0xd0,0xb8,0x05,0xd5,0xbe,0x06},{0xd2,0xbb,0x0c,0xde,0xb3,0x08},
-	{0xd4,0xbe,0x17,0xc3,0xa4,0x1a},{0xd6,0xbd,0x1e,0xc8,0xa9,0x14},
-	{0xd8,0xb4,0x21,0xf9,0x8a,0x3e},{0xda,0xb7,0x28,0xf2,0x87,0x30},
-	{0xdc,0xb2,0x33,0xef,0x90,0x22},{0xde,0xb1,0x3a,0xe4,0x9d,0x2c},
-	{0xe0,0x90,0xdd,0x3d,0x06,0x96},{0xe2,0x93,0xd4,0x36,0x0b,0x98},
-	{0xe4,0x96,0xcf,0x2b,0x1c,0x8a},{0xe6,0x95,0xc6,0x20,0x11,0x84},
-	{0xe8,0x9c,0xf9,0x11,0x32,0xae},{0xea,0x9f,0xf0,0x1a,0x3f,0xa0},
-	{0xec,0x9a,0xeb,0x07,0x28,0xb2},{0xee,0x99,0xe2,0x0c,0x25,0xbc},
-	{0xf0,0x88,0x95,0x65,0x6e,0xe6},{0xf2,0x8b,0x9c,0x6e,0x63,0xe8},
-	{0xf4,0x8e,0x87,0x73,0x74,0xfa},{0xf6,0x8d,0x8e,0x78,0x79,0xf4},
-	{0xf8,0x84,0xb1,0x49,0x5a,0xde},{0xfa,0x87,0xb8,0x42,0x57,0xd0},
-	{0xfc,0x82,0xa3,0x5f,0x40,0xc2},{0xfe,0x81,0xaa,0x54,0x4d,0xcc},
-	{0x1b,0x9b,0xec,0xf7,0xda,0x41},{0x19,0x98,0xe5,0xfc,0xd7,0x4f},
-	{0x1f,0x9d,0xfe,0xe1,0xc0,0x5d},{0x1d,0x9e,0xf7,0xea,0xcd,0x53},
-	{0x13,0x97,0xc8,0xdb,0xee,0x79},{0x11,0x94,0xc1,0xd0,0xe3,0x77},
-	{0x17,0x91,0xda,0xcd,0xf4,0x65},{0x15,0x92,0xd3,0xc6,0xf9,0x6b},
-	{0x0b,0x83,0xa4,0xaf,0xb2,0x31},{0x09,0x80,0xad,0xa4,0xbf,0x3f},
-	{0x0f,0x85,0xb6,0xb9,0xa8,0x2d},{0x0d,0x86,0xbf,0xb2,0xa5,0x23},
-	{0x03,0x8f,0x80,0x83,0x86,0x09},{0x01,0x8c,0x89,0x88,0x8b,0x07},
-	{0x07,0x89,0x92,0x95,0x9c,0x15},{0x05,0x8a,0x9b,0x9e,0x91,0x1b},
-	{0x3b,0xab,0x7c,0x47,0x0a,0xa1},{0x39,0xa8,0x75,0x4c,0x07,0xaf},
-	{0x3f,0xad,0x6e,0x51,0x10,0xbd},{0x3d,0xae,0x67,0x5a,0x1d,0xb3},
-	{0x33,0xa7,0x58,0x6b,0x3e,0x99},{0x31,0xa4,0x51,0x60,0x33,0x97},
-	{0x37,0xa1,0x4a,0x7d,0x24,0x85},{0x35,0xa2,0x43,0x76,0x29,0x8b},
-	{0x2b,0xb3,0x34,0x1f,0x62,0xd1},{0x29,0xb0,0x3d,0x14,0x6f,0xdf},
-	{0x2f,0xb5,0x26,0x09,0x78,0xcd},{0x2d,0xb6,0x2f,0x02,0x75,0xc3},
-	{0x23,0xbf,0x10,0x33,0x56,0xe9},{0x21,0xbc,0x19,0x38,0x5b,0xe7},
-	{0x27,0xb9,0x02,0x25,0x4c,0xf5},{0x25,0xba,0x0b,0x2e,0x41,0xfb},
-	{0x5b,0xfb,0xd7,0x8c,0x61,0x9a},{0x59,0xf8,0xde,0x87,0x6c,0x94},
-	{0x5f,0xfd,0xc5,0x9a,0x7b,0x86},{0x5d,0xfe,0xcc,0x91,0x76,0x88},
-	{0x53,0xf7,0xf3,0xa0,0x55,0xa2},{0x51,0xf4,0xfa,0xab,0x58,0xac},
-	{0x57,0xf1,0xe1,0xb6,0x4f,0xbe},{0x55,0xf2,0xe8,0xbd,0x42,0xb0},
-	{0x4b,0xe3,0x9f,0xd4,0x09,0xea},{0x49,0xe0,0x96,0xdf,0x04,0xe4},
-	{0x4f,0xe5,0x8d,0xc2,0x13,0xf6},{0x4d,0xe6,0x84,0xc9,0x1e,0xf8},
-	{0x43,0xef,0xbb,0xf8,0x3d,0xd2},{0x41,0xec,0xb2,0xf3,0x30,0xdc},
-	{0x47,0xe9,0xa9,0xee,0x27,0xce},{0x45,0xea,0xa0,0xe5,0x2a,0xc0},
-	{0x7b,0xcb,0x47,0x3c,0xb1,0x7a},{0x79,0xc8,0x4e,0x37,0xbc,0x74},
-	{0x7f,0xcd,0x55,0x2a,0xab,0x66},{0x7d,0xce,0x5c,0x21,0xa6,0x68},
-	{0x73,0xc7,0x63,0x10,0x85,0x42},{0x71,0xc4,0x6a,0x1b,0x88,0x4c},
-	{0x77,0xc1,0x71,0x06,0x9f,0x5e},{0x75,0xc2,0x78,0x0d,0x92,0x50},
-	{0x6b,0xd3,0x0f,0x64,0xd9,0x0a},{0x69,0xd0,0x06,0x6f,0xd4,0x04},
-	{0x6f,0xd5,0x1d,0x72,0xc3,0x16},{0x6d,0xd6,0x14,0x79,0xce,0x18},
-	{0x63,0xdf,0x2b,0x48,0xed,0x32},{0x61,0xdc,0x22,0x43,0xe0,0x3c},
-	{0x67,0xd9,0x39,0x5e,0xf7,0x2e},{0x65,0xda,0x30,0x55,0xfa,0x20},
-	{0x9b,0x5b,0x9a,0x01,0xb7,0xec},{0x99,0x58,0x93,0x0a,0xba,0xe2},
-	{0x9f,0x5d,0x88,0x17,0xad,0xf0},{0x9d,0x5e,0x81,0x1c,0xa0,0xfe},
-	{0x93,0x57,0xbe,0x2d,0x83,0xd4},{0x91,0x54,0xb7,0x26,0x8e,0xda},
-	{0x97,0x51,0xac,0x3b,0x99,0xc8},{0x95,0x52,0xa5,0x30,0x94,0xc6},
-	{0x8b,0x43,0xd2,0x59,0xdf,0x9c},{0x89,0x40,0xdb,0x52,0xd2,0x92},
-	{0x8f,0x45,0xc0,0x4f,0xc5,0x80},{0x8d,0x46,0xc9,0x44,0xc8,0x8e},
-	{0x83,0x4f,0xf6,0x75,0xeb,0xa4},{0x81,0x4c,0xff,0x7e,0xe6,0xaa},
-	{0x87,0x49,0xe4,0x63,0xf1,0xb8},{0x85,0x4a,0xed,0x68,0xfc,0xb6},
-	{0xbb,0x6b,0x0a,0xb1,0x67,0x0c},{0xb9,0x68,0x03,0xba,0x6a,0x02},
-	{0xbf,0x6d,0x18,0xa7,0x7d,0x10},{0xbd,0x6e,0x11,0xac,0x70,0x1e},
-	{0xb3,0x67,0x2e,0x9d,0x53,0x34},{0xb1,0x64,0x27,0x96,0x5e,0x3a},
-	{0xb7,0x61,0x3c,0x8b,0x49,0x28},{0xb5,0x62,0x35,0x80,0x44,0x26},
-	{0xab,0x73,0x42,0xe9,0x0f,0x7c},{0xa9,0x70,0x4b,0xe2,0x02,0x72},
-	{0xaf,0x75,0x50,0xff,0x15,0x60},{0xad,0x76,0x59,0xf4,0x18,0x6e},
-	{0xa3,0x7f,0x66,0xc5,0x3b,0x44},{0xa1,0x7c,0x6f,0xce,0x36,0x4a},
-	{0xa7,0x79,0x74,0xd3,0x21,0x58},{0xa5,0x7a,0x7d,0xd8,0x2c,0x56},
-	{0xdb,0x3b,0xa1,0x7a,0x0c,0x37},{0xd9,0x38,0xa8,0x71,0x01,0x39},
-	{0xdf,0x3d,0xb3,0x6c,0x16,0x2b},{0xdd,0x3e,0xba,0x67,0x1b,0x25},
-	{0xd3,0x37,0x85,0x56,0x38,0x0f},{0xd1,0x34,0x8c,0x5d,0x35,0x01},
-	{0xd7,0x31,0x97,0x40,0x22,0x13},{0xd5,0x32,0x9e,0x4b,0x2f,0x1d},
-	{0xcb,0x23,0xe9,0x22,0x64,0x47},{0xc9,0x20,0xe0,0x29,0x69,0x49},
-	{0xcf,0x25,0xfb,0x34,0x7e,0x5b},{0xcd,0x26,0xf2,0x3f,0x73,0x55},
-	{0xc3,0x2f,0xcd,0x0e,0x50,0x7f},{0xc1,0x2c,0xc4,0x05,0x5d,0x71},
-	{0xc7,0x29,0xdf,0x18,0x4a,0x63},{0xc5,0x2a,0xd6,0x13,0x47,0x6d},
-	{0xfb,0x0b,0x31,0xca,0xdc,0xd7},{0xf9,0x08,0x38,0xc1,0xd1,0xd9},
-	{0xff,0x0d,0x23,0xdc,0xc6,0xcb},{0xfd,0x0e,0x2a,0xd7,0xcb,0xc5},
-	{0xf3,0x07,0x15,0xe6,0xe8,0xef},{0xf1,0x04,0x1c,0xed,0xe5,0xe1},
-	{0xf7,0x01,0x07,0xf0,0xf2,0xf3},{0xf5,0x02,0x0e,0xfb,0xff,0xfd},
-	{0xeb,0x13,0x79,0x92,0xb4,0xa7},{0xe9,0x10,0x70,0x99,0xb9,0xa9},
-	{0xef,0x15,0x6b,0x84,0xae,0xbb},{0xed,0x16,0x62,0x8f,0xa3,0xb5},
-	{0xe3,0x1f,0x5d,0xbe,0x80,0x9f},{0xe1,0x1c,0x54,0xb5,0x8d,0x91},
-	{0xe7,0x19,0x4f,0xa8,0x9a,0x83},{0xe5,0x1a,0x46,0xa3,0x97,0x8d}
+/* Decryption T-table. Each entry holds the InvMixColumns column
+   {0e,09,0d,0b} multiplied by InvSBox[x], the first byte in the MSB. */
+static const u32 Aes_Td0[256] = {
+	0x51F4A750U,0x7E416553U,0x1A17A4C3U,0x3A275E96U,0x3BAB6BCBU,0x1F9D45F1U,0xACFA58ABU,0x4BE30393U,
+	0x2030FA55U,0xAD766DF6U,0x88CC7691U,0xF5024C25U,0x4FE5D7FCU,0xC52ACBD7U,0x26354480U,0xB562A38FU,
+	0xDEB15A49U,0x25BA1B67U,0x45EA0E98U,0x5DFEC0E1U,0xC32F7502U,0x814CF012U,0x8D4697A3U,0x6BD3F9C6U,
+	0x038F5FE7U,0x15929C95U,0xBF6D7AEBU,0x955259DAU,0xD4BE832DU,0x587421D3U,0x49E06929U,0x8EC9C844U,
+	0x75C2896AU,0xF48E7978U,0x99583E6BU,0x27B971DDU,0xBEE14FB6U,0xF088AD17U,0xC920AC66U,0x7DCE3AB4U,
+	0x63DF4A18U,0xE51A3182U,0x97513360U,0x62537F45U,0xB16477E0U,0xBB6BAE84U,0xFE81A01CU,0xF9082B94U,
+	0x70486858U,0x8F45FD19U,0x94DE6C87U,0x527BF8B7U,0xAB73D323U,0x724B02E2U,0xE31F8F57U,0x6655AB2AU,
+	0xB2EB2807U,0x2FB5C203U,0x86C57B9AU,0xD33708A5U,0x302887F2U,0x23BFA5B2U,0x02036ABAU,0xED16825CU,
+	0x8ACF1C2BU,0xA779B492U,0xF307F2F0U,0x4E69E2A1U,0x65DAF4CDU,0x0605BED5U,0xD134621FU,0xC4A6FE8AU,
+	0x342E539DU,0xA2F355A0U,0x058AE132U,0xA4F6EB75U,0x0B83EC39U,0x4060EFAAU,0x5E719F06U,0xBD6E1051U,
+	0x3E218AF9U,0x96DD063DU,0xDD3E05AEU,0x4DE6BD46U,0x91548DB5U,0x71C45D05U,0x0406D46FU,0x605015FFU,
+	0x1998FB24U,0xD6BDE997U,0x894043CCU,0x67D99E77U,0xB0E842BDU,0x07898B88U,0xE7195B38U,0x79C8EEDBU,
+	0xA17C0A47U,0x7C420FE9U,0xF8841EC9U,0x00000000U,0x09808683U,0x322BED48U,0x1E1170ACU,0x6C5A724EU,
+	0xFD0EFFFBU,0x0F853856U,0x3DAED51EU,0x362D3927U,0x0A0FD964U,0x685CA621U,0x9B5B54D1U,0x24362E3AU,
+	0x0C0A67B1U,0x9357E70FU,0xB4EE96D2U,0x1B9B919EU,0x80C0C54FU,0x61DC20A2U,0x5A774B69U,0x1C121A16U,
+	0xE293BA0AU,0xC0A02AE5U,0x3C22E043U,0x121B171DU,0x0E090D0BU,0xF28BC7ADU,0x2DB6A8B9U,0x141EA9C8U,
+	0x57F11985U,0xAF75074CU,0xEE99DDBBU,0xA37F60FDU,0xF701269FU,0x5C72F5BCU,0x44663BC5U,0x5BFB7E34U,
+	0x8B432976U,0xCB23C6DCU,0xB6EDFC68U,0xB8E4F163U,0xD731DCCAU,0x42638510U,0x13972240U,0x84C61120U,
+	0x854A247DU,0xD2BB3DF8U,0xAEF93211U,0xC729A16DU,0x1D9E2F4BU,0xDCB230F3U,0x0D8652ECU,0x77C1E3D0U,
+	0x2BB3166CU,0xA970B999U,0x119448FAU,0x47E96422U,0xA8FC8CC4U,0xA0F03F1AU,0x567D2CD8U,0x223390EFU,
+	0x87494EC7U,0xD938D1C1U,0x8CCAA2FEU,0x98D40B36U,0xA6F581CFU,0xA57ADE28U,0xDAB78E26U,0x3FADBFA4U,
+	0x2C3A9DE4U,0x5078920DU,0x6A5FCC9BU,0x547E4662U,0xF68D13C2U,0x90D8B8E8U,0x2E39F75EU,0x82C3AFF5U,
+	0x9F5D80BEU,0x69D0937CU,0x6FD52DA9U,0xCF2512B3U,0xC8AC993BU,0x10187DA7U,0xE89C636EU,0xDB3BBB7BU,
+	0xCD267809U,0x6E5918F4U,0xEC9AB701U,0x834F9AA8U,0xE6956E65U,0xAAFFE67EU,0x21BCCF08U,0xEF15E8E6U,
+	0xBAE79BD9U,0x4A6F36CEU,0xEA9F09D4U,0x29B07CD6U,0x31A4B2AFU,0x2A3F2331U,0xC6A59430U,0x35A266C0U,
+	0x744EBC37U,0xFC82CAA6U,0xE090D0B0U,0x33A7D815U,0xF104984AU,0x41ECDAF7U,0x7FCD500EU,0x1791F62FU,
+	0x764DD68DU,0x43EFB04DU,0xCCAA4D54U,0xE49604DFU,0x9ED1B5E3U,0x4C6A881BU,0xC12C1FB8U,0x4665517FU,
+	0x9D5EEA04U,0x018C355DU,0xFA877473U,0xFB0B412EU,0xB3671D5AU,0x92DBD252U,0xE9105633U,0x6DD64713U,
+	0x9AD7618CU,0x37A10C7AU,0x59F8148EU,0xEB133C89U,0xCEA927EEU,0xB761C935U,0xE11CE5EDU,0x7A47B13CU,
+	0x9CD2DF59U,0x55F2733FU,0x1814CE79U,0x73C737BFU,0x53F7CDEAU,0x5FFDAA5BU,0xDF3D6F14U,0x7844DB86U,
+	0xCAAFF381U,0xB968C43EU,0x3824342CU,0xC2A3405FU,0x161DC372U,0xBCE2250CU,0x283C498BU,0xFF0D9541U,
+	0x39A80171U,0x080CB3DEU,0xD8B4E49CU,0x6456C190U,0x7BCB8461U,0xD532B670U,0x486C5C74U,0xD0B85742U
 };
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -217,18 +166,33 @@ static const u8 Aes_GfMul[256][6] = {
 #define AES_BLOCK_SIZE 16 /* AES operates on 16 bytes at a time */
 #define KE_ROTWORD(x) (((x) << 8) | ((x) >> 24))
 
+/* Only the first T-table of each direction is stored, the other three are
+   byte rotations of it. This keeps the tables at 2KB in total which matters
+   on MicroBlaze where they are placed in local memory. */
+#define AES_ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+#define AES_TE0(x) (Aes_Te0[(x)])
+#define AES_TE1(x) AES_ROTR(Aes_Te0[(x)], 8)
+#define AES_TE2(x) AES_ROTR(Aes_Te0[(x)], 16)
+#define AES_TE3(x) AES_ROTR(Aes_Te0[(x)], 24)
+#define AES_TD0(x) (Aes_Td0[(x)])
+#define AES_TD1(x) AES_ROTR(Aes_Td0[(x)], 8)
+#define AES_TD2(x) AES_ROTR(Aes_Td0[(x)], 16)
+#define AES_TD3(x) AES_ROTR(Aes_Td0[(x)], 24)
+
+/* Big endian load and store of a state column */
+#define AES_GETU32(p) (((u32)(p)[0] << 24) | ((u32)(p)[1] << 16) | \
+                       ((u32)(p)[2] << 8) | ((u32)(p)[3]))
+#define AES_PUTU32(p, v) do { (p)[0] = (u8)((v) >> 24); \
+                              (p)[1] = (u8)((v) >> 16); \
+                              (p)[2] = (u8)((v) >> 8);  \
+                              (p)[3] = (u8)(v); } while (0)
+
 /**************************** Type Definitions *******************************/
 
 /************************** Function Prototypes ******************************/
 static u32  AesSubWord(u32 Word);
 static void AesKeySetup(const u8 Key[], u32 W[], int KeySizeBits);
-static void AesAddRoundKey(u8 State[][4], const u32 W[]);
-static void AesSubBytes(u8 State[][4]);
-static void AesInvSubBytes(u8 State[][4]);
-static void AesShiftRows(u8 State[][4]);
-static void AesInvShiftRows(u8 State[][4]);
-static void AesMixColumns(u8 State[][4]);
-static void AesInvMixColumns(u8 State[][4]);
+static void AesKeySetupDec(const u8 Key[], u32 W[], int KeySizeBits);
 static void AesEncrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize);
 static void AesDecrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize);
 #ifdef AES_CIPHER_CTR_MODE
@@ -284,9 +248,9 @@ void XHdcp22Cmn_Aes128Decrypt(const u8 *Data, const u8 *Key, u8 *Output)
 {
 	u32 KeySchedule[60];
 
-	/* Setup the AES internal key */
-	AesKeySetup(Key, KeySchedule, 128);
-	/* Encrypt 128-bits*/
+	/* Setup the AES internal decryption key */
+	AesKeySetupDec(Key, KeySchedule, 128);
+	/* Decrypt 128-bits*/
 	AesDecrypt(Data, Output, KeySchedule, 128);
 }
 
@@ -332,12 +296,12 @@ static void Xor(u8 *C, const u8 *A, const u8 *B, u32 Size)
 ******************************************************************************/
 static u32 AesSubWord(u32 Word)
 {
-	unsigned int result;
+	u32 result;
 
-	result = (int)Aes_Sbox[(Word >> 4) & 0x0000000F][Word & 0x0000000F];
-	result += (int)Aes_Sbox[(Word >> 12) & 0x0000000F][(Word >> 8) & 0x0000000F] << 8;
-	result += (int)Aes_Sbox[(Word >> 20) & 0x0000000F][(Word >> 16) & 0x0000000F] << 16;
-	result += (int)Aes_Sbox[(Word >> 28) & 0x0000000F][(Word >> 24) & 0x0000000F] << 24;
+	result = (u32)Aes_Sbox[Word & 0xFF];
+	result |= (u32)Aes_Sbox[(Word >> 8) & 0xFF] << 8;
+	result |= (u32)Aes_Sbox[(Word >> 16) & 0xFF] << 16;
+	result |= (u32)Aes_Sbox[(Word >> 24) & 0xFF] << 24;
 	return(result);
 }
 
@@ -388,409 +352,54 @@ static void AesKeySetup(const u8 Key[], u32 W[], int KeySizeBits)
 /*****************************************************************************/
 /**
 *
-* Performs the AddRoundKey step.
-* Each round has its own pre-generated 16-byte key in the form of 4 integers W.
-* Each integer is XOR'd by one column of the state.
-* Also performs the job of InvAddRoundKey(); since the function is a simple XOR process,
-* it is its own inverse.
-*
-* @param	State are the statevalues of the AES conversion
-* @param	W are the 4 integers.
-*
-* @return	None.
-*
-* @note		None.
-*
-******************************************************************************/
-static void AesAddRoundKey(u8 State[][4], const u32 w[])
-{
-	u8 subkey[4];
-
-	// memcpy(subkey,&w[Idx],4); // Not accurate for big endian machines
-	// Subkey 1
-	subkey[0] = w[0] >> 24;
-	subkey[1] = w[0] >> 16;
-	subkey[2] = w[0] >> 8;
-	subkey[3] = w[0];
-	State[0][0] ^= subkey[0];
-	State[1][0] ^= subkey[1];
-	State[2][0] ^= subkey[2];
-	State[3][0] ^= subkey[3];
-	// Subkey 2
-	subkey[0] = w[1] >> 24;
-	subkey[1] = w[1] >> 16;
-	subkey[2] = w[1] >> 8;
-	subkey[3] = w[1];
-	State[0][1] ^= subkey[0];
-	State[1][1] ^= subkey[1];
-	State[2][1] ^= subkey[2];
-	State[3][1] ^= subkey[3];
-	// Subkey 3
-	subkey[0] = w[2] >> 24;
-	subkey[1] = w[2] >> 16;
-	subkey[2] = w[2] >> 8;
-	subkey[3] = w[2];
-	State[0][2] ^= subkey[0];
-	State[1][2] ^= subkey[1];
-	State[2][2] ^= subkey[2];
-	State[3][2] ^= subkey[3];
-	// Subkey 4
-	subkey[0] = w[3] >> 24;
-	subkey[1] = w[3] >> 16;
-	subkey[2] = w[3] >> 8;
-	subkey[3] = w[3];
-	State[0][3] ^= subkey[0];
-	State[1][3] ^= subkey[1];
-	State[2][3] ^= subkey[2];
-	State[3][3] ^= subkey[3];
-}
-
-/*****************************************************************************/
-/**
-*
-* Performs the SubBytes step. All bytes in the State are substituted with a
-* pre-calculated value from a lookup table.
-*
-* @param	State are the statevalues of the AES conversion.
-*
-* @return	None.
-*
-* @note		None.
-*
-******************************************************************************/
-static void AesSubBytes(u8 State[][4])
-{
-	State[0][0] = Aes_Sbox[State[0][0] >> 4][State[0][0] & 0x0F];
-	State[0][1] = Aes_Sbox[State[0][1] >> 4][State[0][1] & 0x0F];
-	State[0][2] = Aes_Sbox[State[0][2] >> 4][State[0][2] & 0x0F];
-	State[0][3] = Aes_Sbox[State[0][3] >> 4][State[0][3] & 0x0F];
-	State[1][0] = Aes_Sbox[State[1][0] >> 4][State[1][0] & 0x0F];
-	State[1][1] = Aes_Sbox[State[1][1] >> 4][State[1][1] & 0x0F];
-	State[1][2] = Aes_Sbox[State[1][2] >> 4][State[1][2] & 0x0F];
-	State[1][3] = Aes_Sbox[State[1][3] >> 4][State[1][3] & 0x0F];
-	State[2][0] = Aes_Sbox[State[2][0] >> 4][State[2][0] & 0x0F];
-	State[2][1] = Aes_Sbox[State[2][1] >> 4][State[2][1] & 0x0F];
-	State[2][2] = Aes_Sbox[State[2][2] >> 4][State[2][2] & 0x0F];
-	State[2][3] = Aes_Sbox[State[2][3] >> 4][State[2][3] & 0x0F];
-	State[3][0] = Aes_Sbox[State[3][0] >> 4][State[3][0] & 0x0F];
-	State[3][1] = Aes_Sbox[State[3][1] >> 4][State[3][1] & 0x0F];
-	State[3][2] = Aes_Sbox[State[3][2] >> 4][State[3][2] & 0x0F];
-	State[3][3] = Aes_Sbox[State[3][3] >> 4][State[3][3] & 0x0F];
-}
-
-/*****************************************************************************/
-/**
-*
-* This function Performs the inverted substates step.
-*
-* @param	State are the statevalues of the AES conversion
-*
-* @return	None.
-*
-* @note		None.
-*
-******************************************************************************/
-static void AesInvSubBytes(u8 State[][4])
-{
-	State[0][0] = Aes_Invsbox[State[0][0] >> 4][State[0][0] & 0x0F];
-	State[0][1] = Aes_Invsbox[State[0][1] >> 4][State[0][1] & 0x0F];
-	State[0][2] = Aes_Invsbox[State[0][2] >> 4][State[0][2] & 0x0F];
-	State[0][3] = Aes_Invsbox[State[0][3] >> 4][State[0][3] & 0x0F];
-	State[1][0] = Aes_Invsbox[State[1][0] >> 4][State[1][0] & 0x0F];
-	State[1][1] = Aes_Invsbox[State[1][1] >> 4][State[1][1] & 0x0F];
-	State[1][2] = Aes_Invsbox[State[1][2] >> 4][State[1][2] & 0x0F];
-	State[1][3] = Aes_Invsbox[State[1][3] >> 4][State[1][3] & 0x0F];
-	State[2][0] = Aes_Invsbox[State[2][0] >> 4][State[2][0] & 0x0F];
-	State[2][1] = Aes_Invsbox[State[2][1] >> 4][State[2][1] & 0x0F];
-	State[2][2] = Aes_Invsbox[State[2][2] >> 4][State[2][2] & 0x0F];
-	State[2][3] = Aes_Invsbox[State[2][3] >> 4][State[2][3] & 0x0F];
-	State[3][0] = Aes_Invsbox[State[3][0] >> 4][State[3][0] & 0x0F];
-	State[3][1] = Aes_Invsbox[State[3][1] >> 4][State[3][1] & 0x0F];
-	State[3][2] = Aes_Invsbox[State[3][2] >> 4][State[3][2] & 0x0F];
-	State[3][3] = Aes_Invsbox[State[3][3] >> 4][State[3][3] & 0x0F];
-}
-
-/*****************************************************************************/
-/**
-*
-* This function erforms the ShiftRows step. All rows are shifted cylindrically
-* to the left.
-*
-* @param	State are the statevalues of the AES conversion.
-*
-* @return	None.
-*
-* @note		None.
-*
-******************************************************************************/
-static void AesShiftRows(u8 State[][4])
-{
-	int t;
-
-	// Shift left by 1
-	t = State[1][0];
-	State[1][0] = State[1][1];
-	State[1][1] = State[1][2];
-	State[1][2] = State[1][3];
-	State[1][3] = t;
-	// Shift left by 2
-	t = State[2][0];
-	State[2][0] = State[2][2];
-	State[2][2] = t;
-	t = State[2][1];
-	State[2][1] = State[2][3];
-	State[2][3] = t;
-	// Shift left by 3
-	t = State[3][0];
-	State[3][0] = State[3][3];
-	State[3][3] = State[3][2];
-	State[3][2] = State[3][1];
-	State[3][1] = t;
-}
-
-/*****************************************************************************/
-/**
-*
-* All rows are shifted cylindrically to the right.
+* Generates the key schedule for the equivalent inverse cipher
+* (FIPS-197 section 5.3.5). The encryption round keys are stored in
+* reverse order and InvMixColumns is applied to all but the first and
+* last round key, so decryption can use the same round structure as
+* encryption.
 *
-* @param	State are the statevalues of the AES conversion.
+* @param	Key is the user-supplied input key.
+* @param	W is the output key schedule.
+* @param	KeySize is the length in bits of "Key", must be 128, 192, or 256.
 *
 * @return	None.
 *
 * @note		None.
 *
 ******************************************************************************/
-static void AesInvShiftRows(u8 State[][4])
+static void AesKeySetupDec(const u8 Key[], u32 W[], int KeySizeBits)
 {
-	int t;
-
-	// Shift right by 1
-	t = State[1][3];
-	State[1][3] = State[1][2];
-	State[1][2] = State[1][1];
-	State[1][1] = State[1][0];
-	State[1][0] = t;
-	// Shift right by 2
-	t = State[2][3];
-	State[2][3] = State[2][1];
-	State[2][1] = t;
-	t = State[2][2];
-	State[2][2] = State[2][0];
-	State[2][0] = t;
-	// Shift right by 3
-	t = State[3][3];
-	State[3][3] = State[3][0];
-	State[3][0] = State[3][1];
-	State[3][1] = State[3][2];
-	State[3][2] = t;
-}
+	int Nr, Idx, Jdx, Col;
+	u32 Temp;
 
-/*****************************************************************************/
-/**
-*
-* This function Performs the MixColums step.
-* The State is multiplied by itself using matrix
-* multiplication in a Galios Field 2^8. All multiplication is pre-computed in a table.
-* Addition is equivilent to XOR. (Must always make a copy of the column as the original
-* values will be destoyed.)
-*
-* @param	State are the statevalues of the AES conversion.
-*
-* @return	None.
-*
-* @note		None.
-*
-******************************************************************************/
-static void AesMixColumns(u8 State[][4])
-{
-	u8 Col[4];
+	switch (KeySizeBits) {
+		case 128: Nr = 10; break;
+		case 192: Nr = 12; break;
+		case 256: Nr = 14; break;
+		default: return;
+	}
 
-	// Column 1
-	Col[0] = State[0][0];
-	Col[1] = State[1][0];
-	Col[2] = State[2][0];
-	Col[3] = State[3][0];
-	State[0][0] = Aes_GfMul[Col[0]][0];
-	State[0][0] ^= Aes_GfMul[Col[1]][1];
-	State[0][0] ^= Col[2];
-	State[0][0] ^= Col[3];
-	State[1][0] = Col[0];
-	State[1][0] ^= Aes_GfMul[Col[1]][0];
-	State[1][0] ^= Aes_GfMul[Col[2]][1];
-	State[1][0] ^= Col[3];
-	State[2][0] = Col[0];
-	State[2][0] ^= Col[1];
-	State[2][0] ^= Aes_GfMul[Col[2]][0];
-	State[2][0] ^= Aes_GfMul[Col[3]][1];
-	State[3][0] = Aes_GfMul[Col[0]][1];
-	State[3][0] ^= Col[1];
-	State[3][0] ^= Col[2];
-	State[3][0] ^= Aes_GfMul[Col[3]][0];
-	// Column 2
-	Col[0] = State[0][1];
-	Col[1] = State[1][1];
-	Col[2] = State[2][1];
-	Col[3] = State[3][1];
-	State[0][1] = Aes_GfMul[Col[0]][0];
-	State[0][1] ^= Aes_GfMul[Col[1]][1];
-	State[0][1] ^= Col[2];
-	State[0][1] ^= Col[3];
-	State[1][1] = Col[0];
-	State[1][1] ^= Aes_GfMul[Col[1]][0];
-	State[1][1] ^= Aes_GfMul[Col[2]][1];
-	State[1][1] ^= Col[3];
-	State[2][1] = Col[0];
-	State[2][1] ^= Col[1];
-	State[2][1] ^= Aes_GfMul[Col[2]][0];
-	State[2][1] ^= Aes_GfMul[Col[3]][1];
-	State[3][1] = Aes_GfMul[Col[0]][1];
-	State[3][1] ^= Col[1];
-	State[3][1] ^= Col[2];
-	State[3][1] ^= Aes_GfMul[Col[3]][0];
-	// Column 3
-	Col[0] = State[0][2];
-	Col[1] = State[1][2];
-	Col[2] = State[2][2];
-	Col[3] = State[3][2];
-	State[0][2] = Aes_GfMul[Col[0]][0];
-	State[0][2] ^= Aes_GfMul[Col[1]][1];
-	State[0][2] ^= Col[2];
-	State[0][2] ^= Col[3];
-	State[1][2] = Col[0];
-	State[1][2] ^= Aes_GfMul[Col[1]][0];
-	State[1][2] ^= Aes_GfMul[Col[2]][1];
-	State[1][2] ^= Col[3];
-	State[2][2] = Col[0];
-	State[2][2] ^= Col[1];
-	State[2][2] ^= Aes_GfMul[Col[2]][0];
-	State[2][2] ^= Aes_GfMul[Col[3]][1];
-	State[3][2] = Aes_GfMul[Col[0]][1];
-	State[3][2] ^= Col[1];
-	State[3][2] ^= Col[2];
-	State[3][2] ^= Aes_GfMul[Col[3]][0];
-	// Column 4
-	Col[0] = State[0][3];
-	Col[1] = State[1][3];
-	Col[2] = State[2][3];
-	Col[3] = State[3][3];
-	State[0][3] = Aes_GfMul[Col[0]][0];
-	State[0][3] ^= Aes_GfMul[Col[1]][1];
-	State[0][3] ^= Col[2];
-	State[0][3] ^= Col[3];
-	State[1][3] = Col[0];
-	State[1][3] ^= Aes_GfMul[Col[1]][0];
-	State[1][3] ^= Aes_GfMul[Col[2]][1];
-	State[1][3] ^= Col[3];
-	State[2][3] = Col[0];
-	State[2][3] ^= Col[1];
-	State[2][3] ^= Aes_GfMul[Col[2]][0];
-	State[2][3] ^= Aes_GfMul[Col[3]][1];
-	State[3][3] = Aes_GfMul[Col[0]][1];
-	State[3][3] ^= Col[1];
-	State[3][3] ^= Col[2];
-	State[3][3] ^= Aes_GfMul[Col[3]][0];
-}
+	AesKeySetup(Key, W, KeySizeBits);
 
-/*****************************************************************************/
-/**
-*
-* This function Performs the the inverted MixColums step.
-*
-* @param	State are the statevalues of the AES conversion.
-*
-* @return	None.
-*
-* @note		None.
-*
-******************************************************************************/
-static void AesInvMixColumns(u8 State[][4])
-{
-	u8 Col[4];
+	/* Reverse the order of the round keys */
+	for (Idx = 0, Jdx = 4 * Nr; Idx < Jdx; Idx += 4, Jdx -= 4) {
+		for (Col = 0; Col < 4; Col++) {
+			Temp = W[Idx + Col];
+			W[Idx + Col] = W[Jdx + Col];
+			W[Jdx + Col] = Temp;
+		}
+	}
 
-	// Column 1
-	Col[0] = State[0][0];
-	Col[1] = State[1][0];
-	Col[2] = State[2][0];
-	Col[3] = State[3][0];
-	State[0][0] = Aes_GfMul[Col[0]][5];
-	State[0][0] ^= Aes_GfMul[Col[1]][3];
-	State[0][0] ^= Aes_GfMul[Col[2]][4];
-	State[0][0] ^= Aes_GfMul[Col[3]][2];
-	State[1][0] = Aes_GfMul[Col[0]][2];
-	State[1][0] ^= Aes_GfMul[Col[1]][5];
-	State[1][0] ^= Aes_GfMul[Col[2]][3];
-	State[1][0] ^= Aes_GfMul[Col[3]][4];
-	State[2][0] = Aes_GfMul[Col[0]][4];
-	State[2][0] ^= Aes_GfMul[Col[1]][2];
-	State[2][0] ^= Aes_GfMul[Col[2]][5];
-	State[2][0] ^= Aes_GfMul[Col[3]][3];
-	State[3][0] = Aes_GfMul[Col[0]][3];
-	State[3][0] ^= Aes_GfMul[Col[1]][4];
-	State[3][0] ^= Aes_GfMul[Col[2]][2];
-	State[3][0] ^= Aes_GfMul[Col[3]][5];
-	// Column 2
-	Col[0] = State[0][1];
-	Col[1] = State[1][1];
-	Col[2] = State[2][1];
-	Col[3] = State[3][1];
-	State[0][1] = Aes_GfMul[Col[0]][5];
-	State[0][1] ^= Aes_GfMul[Col[1]][3];
-	State[0][1] ^= Aes_GfMul[Col[2]][4];
-	State[0][1] ^= Aes_GfMul[Col[3]][2];
-	State[1][1] = Aes_GfMul[Col[0]][2];
-	State[1][1] ^= Aes_GfMul[Col[1]][5];
-	State[1][1] ^= Aes_GfMul[Col[2]][3];
-	State[1][1] ^= Aes_GfMul[Col[3]][4];
-	State[2][1] = Aes_GfMul[Col[0]][4];
-	State[2][1] ^= Aes_GfMul[Col[1]][2];
-	State[2][1] ^= Aes_GfMul[Col[2]][5];
-	State[2][1] ^= Aes_GfMul[Col[3]][3];
-	State[3][1] = Aes_GfMul[Col[0]][3];
-	State[3][1] ^= Aes_GfMul[Col[1]][4];
-	State[3][1] ^= Aes_GfMul[Col[2]][2];
-	State[3][1] ^= Aes_GfMul[Col[3]][5];
-	// Column 3
-	Col[0] = State[0][2];
-	Col[1] = State[1][2];
-	Col[2] = State[2][2];
-	Col[3] = State[3][2];
-	State[0][2] = Aes_GfMul[Col[0]][5];
-	State[0][2] ^= Aes_GfMul[Col[1]][3];
-	State[0][2] ^= Aes_GfMul[Col[2]][4];
-	State[0][2] ^= Aes_GfMul[Col[3]][2];
-	State[1][2] = Aes_GfMul[Col[0]][2];
-	State[1][2] ^= Aes_GfMul[Col[1]][5];
-	State[1][2] ^= Aes_GfMul[Col[2]][3];
-	State[1][2] ^= Aes_GfMul[Col[3]][4];
-	State[2][2] = Aes_GfMul[Col[0]][4];
-	State[2][2] ^= Aes_GfMul[Col[1]][2];
-	State[2][2] ^= Aes_GfMul[Col[2]][5];
-	State[2][2] ^= Aes_GfMul[Col[3]][3];
-	State[3][2] = Aes_GfMul[Col[0]][3];
-	State[3][2] ^= Aes_GfMul[Col[1]][4];
-	State[3][2] ^= Aes_GfMul[Col[2]][2];
-	State[3][2] ^= Aes_GfMul[Col[3]][5];
-	// Column 4
-	Col[0] = State[0][3];
-	Col[1] = State[1][3];
-	Col[2] = State[2][3];
-	Col[3] = State[3][3];
-	State[0][3] = Aes_GfMul[Col[0]][5];
-	State[0][3] ^= Aes_GfMul[Col[1]][3];
-	State[0][3] ^= Aes_GfMul[Col[2]][4];
-	State[0][3] ^= Aes_GfMul[Col[3]][2];
-	State[1][3] = Aes_GfMul[Col[0]][2];
-	State[1][3] ^= Aes_GfMul[Col[1]][5];
-	State[1][3] ^= Aes_GfMul[Col[2]][3];
-	State[1][3] ^= Aes_GfMul[Col[3]][4];
-	State[2][3] = Aes_GfMul[Col[0]][4];
-	State[2][3] ^= Aes_GfMul[Col[1]][2];
-	State[2][3] ^= Aes_GfMul[Col[2]][5];
-	State[2][3] ^= Aes_GfMul[Col[3]][3];
-	State[3][3] = Aes_GfMul[Col[0]][3];
-	State[3][3] ^= Aes_GfMul[Col[1]][4];
-	State[3][3] ^= Aes_GfMul[Col[2]][2];
-	State[3][3] ^= Aes_GfMul[Col[3]][5];
+	/* Apply InvMixColumns to the inner round keys. Td0 holds
+	   InvMixColumns(InvSubBytes(x)), so the S-Box cancels the
+	   InvSubBytes part. */
+	for (Idx = 4; Idx < 4 * Nr; Idx++) {
+		Temp = W[Idx];
+		W[Idx] = AES_TD0(Aes_Sbox[Temp >> 24]) ^
+		         AES_TD1(Aes_Sbox[(Temp >> 16) & 0xFF]) ^
+		         AES_TD2(Aes_Sbox[(Temp >> 8) & 0xFF]) ^
+		         AES_TD3(Aes_Sbox[Temp & 0xFF]);
+	}
 }
 
 #ifdef AES_CIPHER_CTR_MODE
@@ -821,6 +430,27 @@ static void AesIncrementIv(u8 Iv[], int CounterSize)
 }
 #endif
 
+#ifdef AES_ARMV8_CE
+/*****************************************************************************/
+/**
+*
+* This function loads one round key of the key schedule into a vector
+* register in the byte order expected by the AES instructions.
+*
+* @param	W points to the 4 words of the round key.
+*
+* @return	The round key as 16 bytes.
+*
+* @note		None.
+*
+******************************************************************************/
+static inline uint8x16_t AesLoadRoundKey(const u32 W[])
+{
+	/* The key schedule holds big endian words */
+	return vrev32q_u8(vreinterpretq_u8_u32(vld1q_u32(W)));
+}
+#endif
+
 /*****************************************************************************/
 /**
 *
@@ -839,91 +469,63 @@ static void AesIncrementIv(u8 Iv[], int CounterSize)
 ******************************************************************************/
 static void AesEncrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize)
 {
-	u8 State[4][4];
-
-	/* Copy input array (should be 16 bytes long) to a matrix (sequential bytes are ordered
-	   by row, not Col) called "State" for processing.
-	   *** Implementation note: The official AES documentation references the State by
-	   column, then row. Accessing an element in C requires row then column. Thus, all State
-	   references in AES must have the column and row indexes reversed for C implementation. */
-	State[0][0] = In[0];
-	State[1][0] = In[1];
-	State[2][0] = In[2];
-	State[3][0] = In[3];
-	State[0][1] = In[4];
-	State[1][1] = In[5];
-	State[2][1] = In[6];
-	State[3][1] = In[7];
-	State[0][2] = In[8];
-	State[1][2] = In[9];
-	State[2][2] = In[10];
-	State[3][2] = In[11];
-	State[0][3] = In[12];
-	State[1][3] = In[13];
-	State[2][3] = In[14];
-	State[3][3] = In[15];
-
-	// Perform the necessary number of rounds. The round key is added first.
-	// The last round does not perform the MixColumns step.
-	AesAddRoundKey(State,&Key[0]);
-	AesSubBytes(State); AesShiftRows(State);
-	AesMixColumns(State); AesAddRoundKey(State,&Key[4]);
-	AesSubBytes(State); AesShiftRows(State);
-	AesMixColumns(State); AesAddRoundKey(State,&Key[8]);
-	AesSubBytes(State); AesShiftRows(State);
-	AesMixColumns(State); AesAddRoundKey(State,&Key[12]);
-	AesSubBytes(State); AesShiftRows(State);
-	AesMixColumns(State); AesAddRoundKey(State,&Key[16]);
-	AesSubBytes(State); AesShiftRows(State);
-	AesMixColumns(State); AesAddRoundKey(State,&Key[20]);
-	AesSubBytes(State); AesShiftRows(State);
-	AesMixColumns(State); AesAddRoundKey(State,&Key[24]);
-	AesSubBytes(State); AesShiftRows(State);
-	AesMixColumns(State); AesAddRoundKey(State,&Key[28]);
-	AesSubBytes(State); AesShiftRows(State);
-	AesMixColumns(State); AesAddRoundKey(State,&Key[32]);
-	AesSubBytes(State); AesShiftRows(State);
-	AesMixColumns(State); AesAddRoundKey(State,&Key[36]);
-	if (KeySize != 128) {
-		AesSubBytes(State); AesShiftRows(State);
-		AesMixColumns(State); AesAddRoundKey(State,&Key[40]);
-		AesSubBytes(State); AesShiftRows(State);
-		AesMixColumns(State); AesAddRoundKey(State,&Key[44]);
-		if (KeySize != 192) {
-			AesSubBytes(State); AesShiftRows(State);
-			AesMixColumns(State); AesAddRoundKey(State,&Key[48]);
-			AesSubBytes(State); AesShiftRows(State);
-			AesMixColumns(State); AesAddRoundKey(State,&Key[52]);
-			AesSubBytes(State); AesShiftRows(State);
-			AesAddRoundKey(State,&Key[56]);
-		}
-		else {
-			AesSubBytes(State); AesShiftRows(State);
-			AesAddRoundKey(State,&Key[48]);
-		}
+	int Nr = (KeySize / 32) + 6, Round;
+#ifdef AES_ARMV8_CE
+	uint8x16_t State;
+
+	/* AESE performs AddRoundKey, SubBytes and ShiftRows, AESMC the
+	   MixColumns step. The last round has no MixColumns and is followed
+	   by the final AddRoundKey. */
+	State = vld1q_u8(In);
+	for (Round = 0; Round < Nr - 1; Round++) {
+		State = vaesmcq_u8(vaeseq_u8(State, AesLoadRoundKey(&Key[4 * Round])));
 	}
-	else {
-		AesSubBytes(State); AesShiftRows(State);
-		AesAddRoundKey(State,&Key[40]);
+	State = vaeseq_u8(State, AesLoadRoundKey(&Key[4 * (Nr - 1)]));
+	State = veorq_u8(State, AesLoadRoundKey(&Key[4 * Nr]));
+	vst1q_u8(Out, State);
+#else
+	u32 S0, S1, S2, S3, T0, T1, T2, T3;
+	const u32 *Rk = Key;
+
+	/* The State is kept as 4 big endian column words. The round key is
+	   added first. */
+	S0 = AES_GETU32(&In[0]) ^ Rk[0];
+	S1 = AES_GETU32(&In[4]) ^ Rk[1];
+	S2 = AES_GETU32(&In[8]) ^ Rk[2];
+	S3 = AES_GETU32(&In[12]) ^ Rk[3];
+
+	/* Each T-table lookup combines SubBytes, ShiftRows and MixColumns
+	   for one byte of the State. */
+	for (Round = 1; Round < Nr; Round++) {
+		Rk += 4;
+		T0 = AES_TE0(S0 >> 24) ^ AES_TE1((S1 >> 16) & 0xFF) ^
+		     AES_TE2((S2 >> 8) & 0xFF) ^ AES_TE3(S3 & 0xFF) ^ Rk[0];
+		T1 = AES_TE0(S1 >> 24) ^ AES_TE1((S2 >> 16) & 0xFF) ^
+		     AES_TE2((S3 >> 8) & 0xFF) ^ AES_TE3(S0 & 0xFF) ^ Rk[1];
+		T2 = AES_TE0(S2 >> 24) ^ AES_TE1((S3 >> 16) & 0xFF) ^
+		     AES_TE2((S0 >> 8) & 0xFF) ^ AES_TE3(S1 & 0xFF) ^ Rk[2];
+		T3 = AES_TE0(S3 >> 24) ^ AES_TE1((S0 >> 16) & 0xFF) ^
+		     AES_TE2((S1 >> 8) & 0xFF) ^ AES_TE3(S2 & 0xFF) ^ Rk[3];
+		S0 = T0; S1 = T1; S2 = T2; S3 = T3;
 	}
 
+	// The last round does not perform the MixColumns step.
+	Rk += 4;
+	T0 = ((u32)Aes_Sbox[S0 >> 24] << 24) ^ ((u32)Aes_Sbox[(S1 >> 16) & 0xFF] << 16) ^
+	     ((u32)Aes_Sbox[(S2 >> 8) & 0xFF] << 8) ^ (u32)Aes_Sbox[S3 & 0xFF] ^ Rk[0];
+	T1 = ((u32)Aes_Sbox[S1 >> 24] << 24) ^ ((u32)Aes_Sbox[(S2 >> 16) & 0xFF] << 16) ^
+	     ((u32)Aes_Sbox[(S3 >> 8) & 0xFF] << 8) ^ (u32)Aes_Sbox[S0 & 0xFF] ^ Rk[1];
+	T2 = ((u32)Aes_Sbox[S2 >> 24] << 24) ^ ((u32)Aes_Sbox[(S3 >> 16) & 0xFF] << 16) ^
+	     ((u32)Aes_Sbox[(S0 >> 8) & 0xFF] << 8) ^ (u32)Aes_Sbox[S1 & 0xFF] ^ Rk[2];
+	T3 = ((u32)Aes_Sbox[S3 >> 24] << 24) ^ ((u32)Aes_Sbox[(S0 >> 16) & 0xFF] << 16) ^
+	     ((u32)Aes_Sbox[(S1 >> 8) & 0xFF] << 8) ^ (u32)Aes_Sbox[S2 & 0xFF] ^ Rk[3];
+
 	// Copy the State to the output array.
-	Out[0] = State[0][0];
-	Out[1] = State[1][0];
-	Out[2] = State[2][0];
-	Out[3] = State[3][0];
-	Out[4] = State[0][1];
-	Out[5] = State[1][1];
-	Out[6] = State[2][1];
-	Out[7] = State[3][1];
-	Out[8] = State[0][2];
-	Out[9] = State[1][2];
-	Out[10] = State[2][2];
-	Out[11] = State[3][2];
-	Out[12] = State[0][3];
-	Out[13] = State[1][3];
-	Out[14] = State[2][3];
-	Out[15] = State[3][3];
+	AES_PUTU32(&Out[0], T0);
+	AES_PUTU32(&Out[4], T1);
+	AES_PUTU32(&Out[8], T2);
+	AES_PUTU32(&Out[12], T3);
+#endif
 }
 
 /*****************************************************************************/
@@ -933,96 +535,69 @@ static void AesEncrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize)
 *
 * @param	In is 16 bytes of ciphertext
 * @param	Out is 16 bytes of plaintext
-* @param	Key is from the key setup
+* @param	Key is from the decryption key setup
 * @param	KeySize is the bit length of the key, 128, 192, or 256
 *
 * @return	None.
 *
-* @note		Key setup must be done before any AES en/de-cryption functions
-* 			can be used.
+* @note		The key schedule must be generated with AesKeySetupDec.
 *
 ******************************************************************************/
 static void AesDecrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize)
 {
-	u8 State[4][4];
-
-	// Copy the input to the State.
-	State[0][0] = In[0];
-	State[1][0] = In[1];
-	State[2][0] = In[2];
-	State[3][0] = In[3];
-	State[0][1] = In[4];
-	State[1][1] = In[5];
-	State[2][1] = In[6];
-	State[3][1] = In[7];
-	State[0][2] = In[8];
-	State[1][2] = In[9];
-	State[2][2] = In[10];
-	State[3][2] = In[11];
-	State[0][3] = In[12];
-	State[1][3] = In[13];
-	State[2][3] = In[14];
-	State[3][3] = In[15];
-
-	// Perform the necessary number of rounds. The round key is added first.
-	// The last round does not perform the MixColumns step.
-	if (KeySize > 128) {
-		if (KeySize > 192) {
-			AesAddRoundKey(State,&Key[56]);
-			AesInvShiftRows(State);AesInvSubBytes(State);
-			AesAddRoundKey(State,&Key[52]);AesInvMixColumns(State);
-			AesInvShiftRows(State);AesInvSubBytes(State);
-			AesAddRoundKey(State,&Key[48]);AesInvMixColumns(State);
-		}
-		else {
-			AesAddRoundKey(State,&Key[48]);
-		}
-		AesInvShiftRows(State);AesInvSubBytes(State);
-		AesAddRoundKey(State,&Key[44]);AesInvMixColumns(State);
-		AesInvShiftRows(State);AesInvSubBytes(State);
-		AesAddRoundKey(State,&Key[40]);AesInvMixColumns(State);
+	int Nr = (KeySize / 32) + 6, Round;
+#ifdef AES_ARMV8_CE
+	uint8x16_t State;
+
+	/* AESD performs AddRoundKey, InvShiftRows and InvSubBytes, AESIMC
+	   the InvMixColumns step, matching the equivalent inverse cipher. */
+	State = vld1q_u8(In);
+	for (Round = 0; Round < Nr - 1; Round++) {
+		State = vaesimcq_u8(vaesdq_u8(State, AesLoadRoundKey(&Key[4 * Round])));
 	}
-	else {
-		AesAddRoundKey(State,&Key[40]);
+	State = vaesdq_u8(State, AesLoadRoundKey(&Key[4 * (Nr - 1)]));
+	State = veorq_u8(State, AesLoadRoundKey(&Key[4 * Nr]));
+	vst1q_u8(Out, State);
+#else
+	u32 S0, S1, S2, S3, T0, T1, T2, T3;
+	const u32 *Rk = Key;
+
+	// Copy the input to the State and add the first round key.
+	S0 = AES_GETU32(&In[0]) ^ Rk[0];
+	S1 = AES_GETU32(&In[4]) ^ Rk[1];
+	S2 = AES_GETU32(&In[8]) ^ Rk[2];
+	S3 = AES_GETU32(&In[12]) ^ Rk[3];
+
+	for (Round = 1; Round < Nr; Round++) {
+		Rk += 4;
+		T0 = AES_TD0(S0 >> 24) ^ AES_TD1((S3 >> 16) & 0xFF) ^
+		     AES_TD2((S2 >> 8) & 0xFF) ^ AES_TD3(S1 & 0xFF) ^ Rk[0];
+		T1 = AES_TD0(S1 >> 24) ^ AES_TD1((S0 >> 16) & 0xFF) ^
+		     AES_TD2((S3 >> 8) & 0xFF) ^ AES_TD3(S2 & 0xFF) ^ Rk[1];
+		T2 = AES_TD0(S2 >> 24) ^ AES_TD1((S1 >> 16) & 0xFF) ^
+		     AES_TD2((S0 >> 8) & 0xFF) ^ AES_TD3(S3 & 0xFF) ^ Rk[2];
+		T3 = AES_TD0(S3 >> 24) ^ AES_TD1((S2 >> 16) & 0xFF) ^
+		     AES_TD2((S1 >> 8) & 0xFF) ^ AES_TD3(S0 & 0xFF) ^ Rk[3];
+		S0 = T0; S1 = T1; S2 = T2; S3 = T3;
 	}
-	AesInvShiftRows(State);AesInvSubBytes(State);
-	AesAddRoundKey(State,&Key[36]);AesInvMixColumns(State);
-	AesInvShiftRows(State);AesInvSubBytes(State);
-	AesAddRoundKey(State,&Key[32]);AesInvMixColumns(State);
-	AesInvShiftRows(State);AesInvSubBytes(State);
-	AesAddRoundKey(State,&Key[28]);AesInvMixColumns(State);
-	AesInvShiftRows(State);AesInvSubBytes(State);
-	AesAddRoundKey(State,&Key[24]);AesInvMixColumns(State);
-	AesInvShiftRows(State);AesInvSubBytes(State);
-	AesAddRoundKey(State,&Key[20]);AesInvMixColumns(State);
-	AesInvShiftRows(State);AesInvSubBytes(State);
-	AesAddRoundKey(State,&Key[16]);AesInvMixColumns(State);
-	AesInvShiftRows(State);AesInvSubBytes(State);
-	AesAddRoundKey(State,&Key[12]);AesInvMixColumns(State);
-	AesInvShiftRows(State);AesInvSubBytes(State);
-	AesAddRoundKey(State,&Key[8]);AesInvMixColumns(State);
-	AesInvShiftRows(State);AesInvSubBytes(State);
-	AesAddRoundKey(State,&Key[4]);AesInvMixColumns(State);
-	AesInvShiftRows(State);AesInvSubBytes(State);
-	AesAddRoundKey(State,&Key[0]);
+
+	// The last round does not perform the InvMixColumns step.
+	Rk += 4;
+	T0 = ((u32)Aes_Invsbox[S0 >> 24] << 24) ^ ((u32)Aes_Invsbox[(S3 >> 16) & 0xFF] << 16) ^
+	     ((u32)Aes_Invsbox[(S2 >> 8) & 0xFF] << 8) ^ (u32)Aes_Invsbox[S1 & 0xFF] ^ Rk[0];
+	T1 = ((u32)Aes_Invsbox[S1 >> 24] << 24) ^ ((u32)Aes_Invsbox[(S0 >> 16) & 0xFF] << 16) ^
+	     ((u32)Aes_Invsbox[(S3 >> 8) & 0xFF] << 8) ^ (u32)Aes_Invsbox[S2 & 0xFF] ^ Rk[1];
+	T2 = ((u32)Aes_Invsbox[S2 >> 24] << 24) ^ ((u32)Aes_Invsbox[(S1 >> 16) & 0xFF] << 16) ^
+	     ((u32)Aes_Invsbox[(S0 >> 8) & 0xFF] << 8) ^ (u32)Aes_Invsbox[S3 & 0xFF] ^ Rk[2];
+	T3 = ((u32)Aes_Invsbox[S3 >> 24] << 24) ^ ((u32)Aes_Invsbox[(S2 >> 16) & 0xFF] << 16) ^
+	     ((u32)Aes_Invsbox[(S1 >> 8) & 0xFF] << 8) ^ (u32)Aes_Invsbox[S0 & 0xFF] ^ Rk[3];
 
 	// Copy the State to the output array.
-	Out[0] = State[0][0];
-	Out[1] = State[1][0];
-	Out[2] = State[2][0];
-	Out[3] = State[3][0];
-	Out[4] = State[0][1];
-	Out[5] = State[1][1];
-	Out[6] = State[2][1];
-	Out[7] = State[3][1];
-	Out[8] = State[0][2];
-	Out[9] = State[1][2];
-	Out[10] = State[2][2];
-	Out[11] = State[3][2];
-	Out[12] = State[0][3];
-	Out[13] = State[1][3];
-	Out[14] = State[2][3];
-	Out[15] = State[3][3];
+	AES_PUTU32(&Out[0], T0);
+	AES_PUTU32(&Out[4], T1);
+	AES_PUTU32(&Out[8], T2);
+	AES_PUTU32(&Out[12], T3);
+#endif
 }
 
 
@@ -16,6 +16,8 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- -----------------------------------------------
 * 1.00  MH   10/30/15 First Release
+* 1.10  ag   10/18/26 Added HMAC contexts with precomputed ipad/opad state,
+*                     removed the 192 byte data size limit.
 *</pre>
 *
 *****************************************************************************/
@@ -56,28 +58,42 @@
 * @param	HashedData is the output of this function.
 *
 * @return	- XST_SUCCESS if no errors occured
-*			- XST_FAILURE if the datasize execeeds the size of the local buffer.
+*			- XST_FAILURE if the datasize is negative.
 *
-* @note		None.
+* @note		Use XHdcp22Cmn_HmacSha256Init and XHdcp22Cmn_HmacSha256Compute
+*		when several MACs are computed with the same key.
 *
 ******************************************************************************/
 int XHdcp22Cmn_HmacSha256Hash(const u8 *Data, int DataSize, const u8 *Key, int KeySize, u8  *HashedData)
 {
-	u8 Ipad[65];   /* inner padding-key XORd with ipad */
-	u8 Opad[65];   /* outer padding-key XORd with opad */
-	u8 Ktemp[SHA256_SIZE];
-	u8 Ktemp2[SHA256_SIZE];
-	u8 BufferIn[256];
-	u8 BufferOut[256];
-	int i;
+	XHdcp22Cmn_HmacSha256Ctx Ctx;
 
-	memset(BufferIn, 0x00, 256);
-	memset(BufferOut, 0x00, 256);
+	XHdcp22Cmn_HmacSha256Init(&Ctx, Key, KeySize);
 
-	/* If the input size exceeds the local buffers, return an error */
-	if(DataSize + 64 >  256) {
-		return XST_FAILURE;
-	}
+	return XHdcp22Cmn_HmacSha256Compute(&Ctx, Data, DataSize, HashedData);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prepares a HMAC_SHA256 context for a key. The SHA256 states
+* after the (K XOR ipad) and (K XOR opad) blocks are computed once and
+* reused by every XHdcp22Cmn_HmacSha256Compute call on the context.
+*
+* @param	Ctx is the HMAC context to initialize.
+* @param	Key is the hash-key to use.
+* @param	KeySize is the size of the hash key.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XHdcp22Cmn_HmacSha256Init(XHdcp22Cmn_HmacSha256Ctx *Ctx, const u8 *Key, int KeySize)
+{
+	u8 Pad[64];
+	u8 Ktemp[SHA256_SIZE];
+	int i;
 
 	/* If key is longer than 64 bytes reset it to Key=sha256(Key) */
 	if(KeySize > 64) {
@@ -86,28 +102,59 @@ int XHdcp22Cmn_HmacSha256Hash(const u8 *Data, int DataSize, const u8 *Key, int K
 		KeySize = SHA256_SIZE;
 	}
 
-	/* start out by storing Key in pads */
-	memset(Ipad, 0, sizeof Ipad );
-	memset(Opad, 0, sizeof Opad );
-	memcpy(Ipad, Key, KeySize );
-	memcpy(Opad, Key, KeySize );
+	/* start out by storing Key in the pad */
+	memset(Pad, 0, sizeof Pad );
+	memcpy(Pad, Key, KeySize );
 
-	/* XOR Key with Ipad and Opad values */
+	/* XOR Key with Ipad value */
 	for(i = 0; i < 64; i++) {
-		Ipad[i] ^= 0x36;
-		Opad[i] ^= 0x5c;
+		Pad[i] ^= 0x36;
+	}
+	XHdcp22Cmn_Sha256Midstate(Pad, Ctx->InnerState);
+
+	/* Turn the Ipad into the Opad value */
+	for(i = 0; i < 64; i++) {
+		Pad[i] ^= 0x36 ^ 0x5c;
+	}
+	XHdcp22Cmn_Sha256Midstate(Pad, Ctx->OuterState);
+
+	/* Do not leave key material on the stack */
+	memset(Pad, 0, sizeof Pad );
+	memset(Ktemp, 0, sizeof Ktemp );
+}
+
+/*****************************************************************************/
+/**
+*
+* This function computes a HMAC_SHA256 with a context prepared by
+* XHdcp22Cmn_HmacSha256Init. Only the data and the inner hash are
+* compressed, the key blocks are taken from the context.
+*
+* @param	Ctx is the HMAC context.
+* @param	Data is the input data.
+* @param	DataSize is the size of the data buffer.
+* @param	HashedData is the output of this function.
+*
+* @return	- XST_SUCCESS if no errors occured
+*			- XST_FAILURE if the datasize is negative.
+*
+* @note		None.
+*
+******************************************************************************/
+int XHdcp22Cmn_HmacSha256Compute(const XHdcp22Cmn_HmacSha256Ctx *Ctx, const u8 *Data,
+	int DataSize, u8 *HashedData)
+{
+	u8 Ktemp[SHA256_SIZE];
+
+	if(DataSize < 0) {
+		return XST_FAILURE;
 	}
 
 	/* Execute inner SHA256 */
-	memcpy(BufferIn, Ipad, 64 );
-	memcpy(BufferIn + 64, Data, DataSize );
-	XHdcp22Cmn_Sha256Hash(BufferIn, 64 + DataSize, Ktemp2 );
+	XHdcp22Cmn_Sha256Resume(Ctx->InnerState, Data, DataSize, Ktemp);
 
 	/* Execute outer SHA256 */
-	memcpy(BufferOut, Opad, 64);
-	memcpy(BufferOut + 64, Ktemp2, SHA256_SIZE );
-	XHdcp22Cmn_Sha256Hash(BufferOut, 64 + SHA256_SIZE,
-						(u8 *)HashedData );
+	XHdcp22Cmn_Sha256Resume(Ctx->OuterState, Ktemp, SHA256_SIZE, HashedData);
 
 	return XST_SUCCESS;
 }
@@ -16,6 +16,9 @@
 * ----- ---- -------- -----------------------------------------------
 * 1.00  MH   10/30/15 First Release
 * 1.10  GM   10/14/19 Added "volatile" attribute to all "i" variables
+* 1.20  ag   10/18/26 Unrolled the transform, added the ARMv8 SHA-2
+*                     instruction backend, block wise update and the
+*                     midstate functions used by HMAC.
 *</pre>
 *
 *****************************************************************************/
@@ -23,6 +26,16 @@
 /***************************** Include Files ********************************/
 #include "string.h"
 #include "xil_types.h"
+#include "xhdcp22_common.h"
+
+/* The ARMv8 SHA256H/SHA256SU0 instructions are used when the compiler
+   targets them (e.g. -march=armv8-a+crypto), otherwise the portable
+   unrolled transform is built. */
+#if defined(__aarch64__) && !defined(__AARCH64EB__) && \
+    (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_SHA2))
+#define SHA2_ARMV8_CE
+#include <arm_neon.h>
+#endif
 
 /**************************** Type Definitions ******************************/
 typedef struct {
@@ -45,6 +58,31 @@ typedef struct {
 #define SIG0(x) (ROTRIGHT(x,7) ^ ROTRIGHT(x,18) ^ ((x) >> 3))
 #define SIG1(x) (ROTRIGHT(x,17) ^ ROTRIGHT(x,19) ^ ((x) >> 10))
 
+// The message schedule is kept in a 16 word circular buffer
+#define SHA256_LOAD(i) \
+   (m[i] = ((u32)Data[4*(i)] << 24) | ((u32)Data[4*(i)+1] << 16) | \
+           ((u32)Data[4*(i)+2] << 8) | ((u32)Data[4*(i)+3]))
+#define SHA256_MSG(i) (m[(i)])
+#define SHA256_SCHED(i) \
+   (m[(i) & 15] += SIG1(m[((i) - 2) & 15]) + m[((i) - 7) & 15] + \
+                   SIG0(m[((i) - 15) & 15]))
+
+// One round, the working variables are renamed instead of shifted
+#define SHA256_RND(a,b,c,d,e,f,g,h,i,W) \
+   t1 = h + EP1(e) + CH(e,f,g) + k[i] + W(i); \
+   d += t1; \
+   h = t1 + EP0(a) + MAJ(a,b,c);
+
+#define SHA256_RND8(i,W) \
+   SHA256_RND(a,b,c,d,e,f,g,h,(i)+0,W) \
+   SHA256_RND(h,a,b,c,d,e,f,g,(i)+1,W) \
+   SHA256_RND(g,h,a,b,c,d,e,f,(i)+2,W) \
+   SHA256_RND(f,g,h,a,b,c,d,e,(i)+3,W) \
+   SHA256_RND(e,f,g,h,a,b,c,d,(i)+4,W) \
+   SHA256_RND(d,e,f,g,h,a,b,c,(i)+5,W) \
+   SHA256_RND(c,d,e,f,g,h,a,b,(i)+6,W) \
+   SHA256_RND(b,c,d,e,f,g,h,a,(i)+7,W)
+
 /************************** Variable Definitions ****************************/
 static const u32 k[64] = {
    0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5,0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5,
@@ -60,7 +98,7 @@ static const u32 k[64] = {
 /************************** Function Prototypes *****************************/
 
 /* SHA-256 Hashing */
-static void Sha256Transform(Sha256Type *Ctx, u8 *Data);
+static void Sha256Transform(Sha256Type *Ctx, const u8 *Data);
 static void Sha256Init(Sha256Type *Ctx);
 static void Sha256Update(Sha256Type *Ctx, const u8 *Data, u32 Len);
 static void Sha256Final(Sha256Type *Ctx, u8 *Hash);
@@ -91,27 +129,109 @@ void XHdcp22Cmn_Sha256Hash(const u8 *Data, u32 DataSize, u8 *HashedData)
 	Sha256Final(&Ctx, HashedData);
 }
 
+/*****************************************************************************/
+/**
+*
+* This function computes the SHA256 state after hashing a single 64 byte
+* block. It is used by HMAC to precompute the state after the padded key.
+*
+* @param  Block is the 64 byte block.
+* @param  State is the resulting 8 word hash state.
+*
+* @return None.
+*
+* @note   None.
+*
+******************************************************************************/
+void XHdcp22Cmn_Sha256Midstate(const u8 *Block, u32 *State)
+{
+	Sha256Type Ctx;
+
+	Sha256Init(&Ctx);
+	Sha256Transform(&Ctx, Block);
+	memcpy(State, Ctx.state, sizeof(Ctx.state));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function computes a SHA256 hash of a 64 byte block followed by an
+* array of data, starting from the state returned by
+* XHdcp22Cmn_Sha256Midstate for that block.
+*
+* @param  State is the hash state after the first block.
+* @param  Data is the data following the first block.
+* @param  DataSize is the size of the data array.
+* @param  HashedData is a 256-bits size hash.
+*
+* @return None.
+*
+* @note   None.
+*
+******************************************************************************/
+void XHdcp22Cmn_Sha256Resume(const u32 *State, const u8 *Data, u32 DataSize,
+	u8 *HashedData)
+{
+	Sha256Type Ctx;
+
+	memcpy(Ctx.state, State, sizeof(Ctx.state));
+	Ctx.datalen = 0;
+	Ctx.bitlen[0] = 512;
+	Ctx.bitlen[1] = 0;
+
+	Sha256Update(&Ctx, Data, DataSize);
+	Sha256Final(&Ctx, HashedData);
+}
+
 /*****************************************************************************/
 /**
 * This function executes a SHA256 transformation.
 *
 * @param  Ctx is the context data for SHA256.
-* @param  Data is the data to transform.
+* @param  Data is the 64 byte block to transform.
 *
 * @return None.
 *
-* @note   None.
+* @note   The ARMv8 backend uses the SHA256H/SHA256H2 instructions for
+*         4 rounds at a time and SHA256SU0/SHA256SU1 for the message
+*         schedule. The portable version is fully unrolled.
 *
 ******************************************************************************/
-static void Sha256Transform(Sha256Type *Ctx, u8 *Data)
+static void Sha256Transform(Sha256Type *Ctx, const u8 *Data)
 {
-  volatile u32 i;
-  u32 a,b,c,d,e,f,g,h,j,t1,t2,m[64];
+#ifdef SHA2_ARMV8_CE
+  uint32x4_t Abcd, Efgh, Abcd0, Efgh0, Prev, Tmp, Next;
+  uint32x4_t Msg0, Msg1, Msg2, Msg3;
+  int i;
+
+   Abcd0 = Abcd = vld1q_u32(&Ctx->state[0]);
+   Efgh0 = Efgh = vld1q_u32(&Ctx->state[4]);
+
+   // The message words are big endian.
+   Msg0 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(&Data[0])));
+   Msg1 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(&Data[16])));
+   Msg2 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(&Data[32])));
+   Msg3 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(&Data[48])));
 
-   for (i=0,j=0; i < 16; ++i, j += 4)
-      m[i] = (Data[j] << 24) | (Data[j+1] << 16) | (Data[j+2] << 8) | (Data[j+3]);
-   for ( ; i < 64; ++i)
-      m[i] = SIG1(m[i-2]) + m[i-7] + SIG0(m[i-15]) + m[i-16];
+   for (i = 0; i < 64; i += 4) {
+      Tmp = vaddq_u32(Msg0, vld1q_u32(&k[i]));
+      if (i < 48)
+         Next = vsha256su1q_u32(vsha256su0q_u32(Msg0, Msg1), Msg2, Msg3);
+      else
+         Next = Msg0;
+      Prev = Abcd;
+      Abcd = vsha256hq_u32(Abcd, Efgh, Tmp);
+      Efgh = vsha256h2q_u32(Efgh, Prev, Tmp);
+      Msg0 = Msg1;
+      Msg1 = Msg2;
+      Msg2 = Msg3;
+      Msg3 = Next;
+   }
+
+   vst1q_u32(&Ctx->state[0], vaddq_u32(Abcd, Abcd0));
+   vst1q_u32(&Ctx->state[4], vaddq_u32(Efgh, Efgh0));
+#else
+  u32 a,b,c,d,e,f,g,h,t1,m[16];
 
    a = Ctx->state[0];
    b = Ctx->state[1];
@@ -122,18 +242,19 @@ static void Sha256Transform(Sha256Type *Ctx, u8 *Data)
    g = Ctx->state[6];
    h = Ctx->state[7];
 
-   for (i = 0; i < 64; ++i) {
-      t1 = h + EP1(e) + CH(e,f,g) + k[i] + m[i];
-      t2 = EP0(a) + MAJ(a,b,c);
-      h = g;
-      g = f;
-      f = e;
-      e = d + t1;
-      d = c;
-      c = b;
-      b = a;
-      a = t1 + t2;
-   }
+   SHA256_LOAD(0);  SHA256_LOAD(1);  SHA256_LOAD(2);  SHA256_LOAD(3);
+   SHA256_LOAD(4);  SHA256_LOAD(5);  SHA256_LOAD(6);  SHA256_LOAD(7);
+   SHA256_LOAD(8);  SHA256_LOAD(9);  SHA256_LOAD(10); SHA256_LOAD(11);
+   SHA256_LOAD(12); SHA256_LOAD(13); SHA256_LOAD(14); SHA256_LOAD(15);
+
+   SHA256_RND8(0, SHA256_MSG)
+   SHA256_RND8(8, SHA256_MSG)
+   SHA256_RND8(16, SHA256_SCHED)
+   SHA256_RND8(24, SHA256_SCHED)
+   SHA256_RND8(32, SHA256_SCHED)
+   SHA256_RND8(40, SHA256_SCHED)
+   SHA256_RND8(48, SHA256_SCHED)
+   SHA256_RND8(56, SHA256_SCHED)
 
    Ctx->state[0] += a;
    Ctx->state[1] += b;
@@ -143,6 +264,7 @@ static void Sha256Transform(Sha256Type *Ctx, u8 *Data)
    Ctx->state[5] += f;
    Ctx->state[6] += g;
    Ctx->state[7] += h;
+#endif
 }
 
 /*****************************************************************************/
@@ -187,17 +309,34 @@ static void Sha256Init(Sha256Type *Ctx)
 ******************************************************************************/
 static void Sha256Update(Sha256Type *Ctx, const u8 *Data, u32 Len)
 {
-   volatile u32 i;
+   u32 Fill;
+
+   // Complete a partially filled block first.
+   if (Ctx->datalen > 0) {
+      Fill = 64 - Ctx->datalen;
+      if (Fill > Len)
+         Fill = Len;
+      memcpy(&Ctx->data[Ctx->datalen], Data, Fill);
+      Ctx->datalen += Fill;
+      Data += Fill;
+      Len -= Fill;
+      if (Ctx->datalen < 64)
+         return;
+      Sha256Transform(Ctx,Ctx->data);
+      DBL_INT_ADD(Ctx->bitlen[0],Ctx->bitlen[1],512);
+      Ctx->datalen = 0;
+   }
 
-   for (i=0; i < Len; ++i) {
-      Ctx->data[Ctx->datalen] = Data[i];
-      Ctx->datalen++;
-      if (Ctx->datalen == 64) {
-	  Sha256Transform(Ctx,Ctx->data);
-         DBL_INT_ADD(Ctx->bitlen[0],Ctx->bitlen[1],512);
-         Ctx->datalen = 0;
-      }
+   // Transform whole blocks directly from the input.
+   while (Len >= 64) {
+      Sha256Transform(Ctx,Data);
+      DBL_INT_ADD(Ctx->bitlen[0],Ctx->bitlen[1],512);
+      Data += 64;
+      Len -= 64;
    }
+
+   memcpy(Ctx->data, Data, Len);
+   Ctx->datalen = Len;
 }
 
 /*****************************************************************************/
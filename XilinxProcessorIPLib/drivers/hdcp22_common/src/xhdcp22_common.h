@@ -17,6 +17,7 @@
 * 1.00  MH   10/30/15 First Release.
 * 1.01  MH   01/15/16 Added prefix to function names.
 * 2.00  MH   06/21/17 Changed DIGIT_T type to u32 for ARM support.
+* 2.10  ag   10/18/26 Added HMAC-SHA256 contexts with precomputed key state.
 *</pre>
 *
 *****************************************************************************/
@@ -34,6 +35,15 @@ extern "C" {
 /************************** Constant Definitions ****************************/
 
 /**************************** Type Definitions ******************************/
+/**
+ * This typedef contains the SHA256 states after the HMAC ipad and opad
+ * key blocks, so MACs under the same key skip both key compressions.
+ */
+typedef struct
+{
+	u32 InnerState[8];	/**< State after (Key XOR ipad) */
+	u32 OuterState[8];	/**< State after (Key XOR opad) */
+} XHdcp22Cmn_HmacSha256Ctx;
 
 /***************** Macros (Inline Functions) Definitions ********************/
 
@@ -42,6 +52,12 @@ extern "C" {
 /* Cryptographic functions */
 void XHdcp22Cmn_Sha256Hash(const u8 *Data, u32 DataSize, u8 *HashedData);
 int  XHdcp22Cmn_HmacSha256Hash(const u8 *Data, int DataSize, const u8 *Key, int KeySize, u8  *HashedData);
+void XHdcp22Cmn_HmacSha256Init(XHdcp22Cmn_HmacSha256Ctx *Ctx, const u8 *Key, int KeySize);
+int  XHdcp22Cmn_HmacSha256Compute(const XHdcp22Cmn_HmacSha256Ctx *Ctx, const u8 *Data,
+	int DataSize, u8 *HashedData);
+void XHdcp22Cmn_Sha256Midstate(const u8 *Block, u32 *State);
+void XHdcp22Cmn_Sha256Resume(const u32 *State, const u8 *Data, u32 DataSize,
+	u8 *HashedData);
 void XHdcp22Cmn_Aes128Encrypt(const u8 *Data, const u8 *Key, u8 *Output);
 void XHdcp22Cmn_Aes128Decrypt(const u8 *Data, const u8 *Key, u8 *Output);
 
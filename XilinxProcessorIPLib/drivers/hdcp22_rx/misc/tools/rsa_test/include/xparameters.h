@@ -0,0 +1,14 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+* Host replacement of the generated xparameters.h for the RSA test.
+* No parameters are used by the HDCP 2.2 receiver crypto functions.
+*/
+
+#ifndef XPARAMETERS_H
+#define XPARAMETERS_H
+
+#endif /* XPARAMETERS_H */
@@ -0,0 +1,51 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xhdcp22_rx_legacy_crypt.c
+*
+* Builds the earlier xhdcp22_rx_crypt.c given with LEGACY_CRYPT next to the
+* current one for xhdcp22_rx_rsa_test.c. The public functions are renamed
+* and its internal RSADP is exported as XLegacy_Pkcs1Rsadp.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ag   10/18/2026 Initial release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+/* The current prototypes are declared under their own names first, so the
+ * include guard keeps them from clashing with the renamed legacy ones */
+#include "xhdcp22_rx_i.h"
+
+#define XHdcp22Rx_CalcMontNPrime	XLegacy_CalcMontNPrime
+#define XHdcp22Rx_RsaesOaepEncrypt	XLegacy_RsaesOaepEncrypt
+#define XHdcp22Rx_RsaesOaepDecrypt	XLegacy_RsaesOaepDecrypt
+#define XHdcp22Rx_GenerateRandom	XLegacy_GenerateRandom
+#define XHdcp22Rx_ComputeHPrime		XLegacy_ComputeHPrime
+#define XHdcp22Rx_ComputeEkh		XLegacy_ComputeEkh
+#define XHdcp22Rx_ComputeLPrime		XLegacy_ComputeLPrime
+#define XHdcp22Rx_ComputeKs		XLegacy_ComputeKs
+#define XHdcp22Rx_ComputeVPrime		XLegacy_ComputeVPrime
+#define XHdcp22Rx_ComputeMPrime		XLegacy_ComputeMPrime
+
+#include XHDCP22_TEST_LEGACY_FILE
+
+/************************** Function Definitions *****************************/
+int XLegacy_Pkcs1Rsadp(XHdcp22_Rx *InstancePtr,
+		const XHdcp22_Rx_KprivRx *KprivRx, u8 *EncryptedMessage,
+		u8 *Message)
+{
+	return XHdcp22Rx_Pkcs1Rsadp(InstancePtr, KprivRx, EncryptedMessage,
+			Message);
+}
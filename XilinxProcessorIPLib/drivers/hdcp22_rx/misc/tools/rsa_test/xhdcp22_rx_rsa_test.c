@@ -0,0 +1,689 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xhdcp22_rx_rsa_test.c
+*
+* Host test and benchmark of the HDCP 2.2 receiver RSA private key
+* operation (xhdcp22_rx_crypt.c), which decrypts km during AKE.
+*
+* xhdcp22_rx_crypt.c is included in this file so that its internal RSADP
+* and RSAEP functions can be called. The test uses the R1 and R2 receiver
+* keys of the HDCP 2.2 specification errata test vectors, also used by
+* xhdcp22_rx_test.c, and checks:
+*  - XHdcp22Rx_RsaesOaepDecrypt(Ekpub(km)) returns the km test vector.
+*  - RSAEP(RSADP(c)) == c for random ciphertexts c < n and for 0, 1, n-2
+*    and n-1. RSAEP uses the public exponent through bigdigits mpModExp,
+*    so it does not share code with the Montgomery exponentiation.
+*
+* The Montgomery multiplications run on the software FIOS implementation
+* by default (SW_MMULT=1, _XHDCP22_RX_SW_MMULT_). With SW_MMULT=0 the
+* driver uses the MMULT core, which is replaced by a host model computing
+* A*B*R^-1 mod N with bigdigits. The model also counts the operations,
+* which set the AKE latency on the target when the core is used.
+*
+* When built with LEGACY_CRYPT set to an earlier xhdcp22_rx_crypt.c, e.g.
+*   git show <rev>:XilinxProcessorIPLib/drivers/hdcp22_rx/src/xhdcp22_rx_crypt.c > legacy_crypt.c
+*   make LEGACY_CRYPT=legacy_crypt.c
+* every RSADP result is also computed with that implementation and compared
+* byte for byte, and it is added to the benchmark.
+*
+* The benchmark reports the time of one RSADP and of one km decryption
+* (RSADP and EME-OAEP decoding) for the R1 key, and with SW_MMULT=0 the
+* number of MMULT operations of one RSADP.
+*
+* Usage: xhdcp22_rx_rsa_test [-n ciphertexts] [-s seed] [-b]
+*
+*  -n  Number of random ciphertexts per key, 200 by default.
+*  -s  Seed of the random ciphertexts, 1 by default.
+*  -b  Runs the benchmark after the test.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ag   10/18/2026 Initial release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <getopt.h>
+#include "xhdcp22_rx_crypt.c"
+
+/************************** Constant Definitions *****************************/
+#define XHDCP22_TEST_DEF_CIPHERTEXTS	200U
+#define XHDCP22_TEST_NUM_KEYS		2U
+#define XHDCP22_TEST_BENCH_BATCHES	5U
+#define XHDCP22_TEST_BENCH_RUNS		40U
+#define XHDCP22_TEST_MMULT_DIGITS	(XHDCP22_RX_P_SIZE/4)
+
+/**************************** Type Definitions *******************************/
+
+/************************** Function Prototypes ******************************/
+#ifdef XHDCP22_TEST_LEGACY
+/* Earlier xhdcp22_rx_crypt.c, see xhdcp22_rx_legacy_crypt.c */
+int XLegacy_Pkcs1Rsadp(XHdcp22_Rx *InstancePtr,
+		const XHdcp22_Rx_KprivRx *KprivRx, u8 *EncryptedMessage,
+		u8 *Message);
+int XLegacy_RsaesOaepDecrypt(XHdcp22_Rx *InstancePtr,
+		const XHdcp22_Rx_KprivRx *KprivRx, u8 *EncryptedMessage,
+		u8 *Message, int *MessageLen);
+#endif
+
+/************************** Variable Definitions *****************************/
+/*
+ * HDCP 2.2 receiver test vectors, from xhdcp22_rx_test.c
+ */
+/* KpubRx of the test certificates, n followed by e */
+static const u8 rsa_kpub[2][131] = {
+	/* R1 */
+	{
+		0xaf, 0xb5, 0xc5, 0xc6, 0x7b, 0xc5, 0x3a, 0x34, 0x90, 0xa9, 0x54, 0xc0,
+		0x8f, 0xb7, 0xeb, 0xa1, 0x54, 0xd2, 0x4f, 0x22, 0xde, 0x83, 0xf5, 0x03,
+		0xa6, 0xc6, 0x68, 0x46, 0x9b, 0xc0, 0xb8, 0xc8, 0x6c, 0xdb, 0x26, 0xf9,
+		0x3c, 0x49, 0x2f, 0x02, 0xe1, 0x71, 0xdf, 0x4e, 0xf3, 0x0e, 0xc8, 0xbf,
+		0x22, 0x9d, 0x04, 0xcf, 0xbf, 0xa9, 0x0d, 0xff, 0x68, 0xab, 0x05, 0x6f,
+		0x1f, 0x12, 0x8a, 0x68, 0x62, 0xeb, 0xfe, 0xc9, 0xea, 0x9f, 0xa7, 0xfb,
+		0x8c, 0xba, 0xb1, 0xbd, 0x65, 0xac, 0x35, 0x9c, 0xa0, 0x33, 0xb1, 0xdd,
+		0xa6, 0x05, 0x36, 0xaf, 0x00, 0xa2, 0x7f, 0xbc, 0x07, 0xb2, 0xdd, 0xb5,
+		0xcc, 0x57, 0x5c, 0xdc, 0xc0, 0x95, 0x50, 0xe5, 0xff, 0x1f, 0x20, 0xdb,
+		0x59, 0x46, 0xfa, 0x47, 0xc4, 0xed, 0x12, 0x2e, 0x9e, 0x22, 0xbd, 0x95,
+		0xa9, 0x85, 0x59, 0xa1, 0x59, 0x3c, 0xc7, 0x83, 0x01, 0x00, 0x01,
+	},
+	/* R2 */
+	{
+		0xe4, 0x68, 0x63, 0x8a, 0xda, 0x97, 0x2d, 0xde, 0x9a, 0x8d, 0x1c, 0xb1,
+		0x65, 0x4b, 0x85, 0x8d, 0xe5, 0x46, 0xd6, 0xdb, 0x95, 0xa5, 0xf6, 0x66,
+		0x74, 0xea, 0x81, 0x0b, 0x9a, 0x58, 0x58, 0x66, 0x26, 0x86, 0xa6, 0xb4,
+		0x56, 0x2b, 0x29, 0x43, 0xe5, 0xbb, 0x81, 0x74, 0x86, 0xa7, 0xb7, 0x16,
+		0x2f, 0x07, 0xec, 0xd1, 0xb5, 0xf9, 0xae, 0x4f, 0x98, 0x89, 0xa9, 0x91,
+		0x7d, 0x58, 0x5b, 0x8d, 0x20, 0xd5, 0xc5, 0x08, 0x40, 0x3b, 0x86, 0xaf,
+		0xf4, 0xd6, 0xb9, 0x20, 0x95, 0xe8, 0x90, 0x3b, 0x8f, 0x9f, 0x36, 0x5b,
+		0x46, 0xb6, 0xd4, 0x1e, 0xf5, 0x05, 0x88, 0x80, 0x14, 0xe7, 0x2c, 0x77,
+		0x5d, 0x6e, 0x54, 0xe9, 0x65, 0x81, 0x5a, 0x68, 0x92, 0xa5, 0xd6, 0x40,
+		0x78, 0x11, 0x97, 0x65, 0xd7, 0x64, 0x36, 0x5e, 0x8d, 0x2a, 0x87, 0xa8,
+		0xeb, 0x7d, 0x06, 0x2c, 0x10, 0xf8, 0x0a, 0x7d, 0x01, 0x00, 0x01,
+	},
+};
+
+/* KprivRx, p, q, dP, dQ and qInv */
+static const u8 rsa_kpriv[2][320] = {
+	/* R1 */
+	{
+		0xec, 0xbe, 0xe5, 0x5b, 0x9e, 0x7a, 0x50, 0x8a, 0x96, 0x80, 0xc8, 0xdb,
+		0xb0, 0xed, 0x44, 0xf2, 0xba, 0x1d, 0x5d, 0x80, 0xc1, 0xc8, 0xb3, 0xc2,
+		0x74, 0xde, 0xee, 0x28, 0xec, 0xdc, 0x78, 0xc8, 0x67, 0x53, 0x07, 0xf2,
+		0xf8, 0x75, 0x9c, 0x4c, 0xa5, 0x6c, 0x48, 0x94, 0xc8, 0xeb, 0xad, 0xd7,
+		0x7d, 0xd2, 0xea, 0xdf, 0x74, 0x20, 0x62, 0xc9, 0x81, 0xa8, 0x3c, 0x36,
+		0xb9, 0xea, 0x40, 0xfd, 0xbe, 0x00, 0x19, 0x76, 0xc6, 0xb4, 0xba, 0x19,
+		0xd4, 0x69, 0xfa, 0x4d, 0xe2, 0xf8, 0x30, 0x27, 0x36, 0x2b, 0x4c, 0xc4,
+		0x34, 0xab, 0xd3, 0xd9, 0x8c, 0xd6, 0xb8, 0x0d, 0x37, 0x5e, 0x59, 0x4b,
+		0x76, 0x70, 0x68, 0x2b, 0x1f, 0x4c, 0x3d, 0x47, 0x5f, 0xa5, 0xb1, 0xcd,
+		0x74, 0x56, 0x88, 0xfe, 0x7c, 0xf8, 0x3b, 0x30, 0x6f, 0xfd, 0xc3, 0xed,
+		0x87, 0x3c, 0xa1, 0x53, 0x84, 0xc3, 0xd2, 0x7f, 0x60, 0x71, 0x9b, 0xe9,
+		0xe8, 0xf3, 0x97, 0x1f, 0xfe, 0x13, 0xd4, 0xbf, 0x7a, 0xa2, 0x0d, 0xf6,
+		0x7b, 0xcf, 0x3e, 0xaa, 0x17, 0x47, 0x75, 0xc3, 0x7f, 0xec, 0xd9, 0x44,
+		0x9e, 0xc9, 0x6a, 0x02, 0xe9, 0xe4, 0xaf, 0x56, 0x51, 0xd5, 0x47, 0xa9,
+		0x09, 0xb2, 0xc5, 0x16, 0xa7, 0x8b, 0x2b, 0x34, 0xa0, 0x33, 0x6e, 0x2f,
+		0x3d, 0x95, 0x7b, 0xe8, 0xef, 0x02, 0xe4, 0x14, 0xbf, 0x44, 0x28, 0xd9,
+		0x10, 0x0e, 0x2e, 0x18, 0xad, 0x5d, 0xe4, 0x43, 0xfe, 0x81, 0x1e, 0x17,
+		0xaa, 0xd0, 0x52, 0x31, 0x5e, 0x10, 0x76, 0xa2, 0x35, 0xd9, 0x37, 0x43,
+		0xb0, 0xf5, 0x0c, 0x04, 0x81, 0xe3, 0x45, 0x24, 0x6d, 0x53, 0xbe, 0x59,
+		0xb6, 0x81, 0x58, 0xc4, 0x49, 0x3e, 0xd5, 0x31, 0x89, 0x5d, 0x2e, 0xa2,
+		0x62, 0xa9, 0x0f, 0x47, 0x5e, 0x8f, 0x51, 0x19, 0x27, 0x4e, 0x66, 0x4b,
+		0x8a, 0x72, 0x89, 0xbd, 0x3e, 0x53, 0x0a, 0xf4, 0x8e, 0x75, 0xe1, 0x52,
+		0xc6, 0x24, 0xe9, 0xf7, 0xbb, 0xac, 0x3f, 0x22, 0x5f, 0xe8, 0xe0, 0x79,
+		0x35, 0xff, 0x91, 0xee, 0x22, 0x56, 0xd2, 0x00, 0x68, 0x32, 0xc4, 0xe1,
+		0x5f, 0xff, 0xf8, 0xb1, 0x1d, 0xee, 0xdc, 0x57, 0x81, 0xd1, 0xab, 0x8b,
+		0x37, 0x22, 0xe3, 0x9f, 0xd0, 0xa1, 0xc1, 0xce, 0x1d, 0xd0, 0x24, 0x23,
+		0xa0, 0x0e, 0xf7, 0xa6, 0xdb, 0xa3, 0xea, 0xd3,
+	},
+	/* R2 */
+	{
+		0xf5, 0xf6, 0xfa, 0x44, 0xa2, 0x16, 0x2f, 0xa7, 0x1f, 0x7f, 0x16, 0x05,
+		0x99, 0x26, 0xc4, 0x1b, 0x80, 0x7f, 0xfa, 0x52, 0x4e, 0x3e, 0xaa, 0x3d,
+		0x1e, 0xb0, 0xf1, 0x9a, 0xc6, 0x3d, 0x8f, 0x57, 0x2b, 0x9e, 0xcd, 0xe8,
+		0x03, 0xd6, 0xf3, 0x91, 0x75, 0xe2, 0x19, 0x44, 0x9e, 0x11, 0x58, 0x5f,
+		0xd6, 0x88, 0x7c, 0xc4, 0xc1, 0x5b, 0x45, 0x9b, 0x84, 0xcf, 0x72, 0x1d,
+		0x35, 0xbf, 0x24, 0xd5, 0xed, 0xba, 0x08, 0xbf, 0x42, 0x2c, 0x0e, 0xfa,
+		0x3a, 0xc4, 0xd2, 0xc7, 0x01, 0x51, 0x25, 0xae, 0xb0, 0xa1, 0xcc, 0xdb,
+		0x67, 0x9b, 0xaa, 0x50, 0xf0, 0x80, 0xac, 0x4b, 0x9f, 0x5c, 0xba, 0x1e,
+		0xf4, 0x7f, 0xa9, 0xb3, 0x21, 0x8b, 0x62, 0x2c, 0x36, 0xda, 0xcd, 0xa7,
+		0x4d, 0xa4, 0xd6, 0x44, 0xed, 0xb1, 0x34, 0xe7, 0x69, 0x10, 0x77, 0x5a,
+		0x6a, 0xff, 0xf5, 0x63, 0x8a, 0x2c, 0x43, 0x09, 0x61, 0x5a, 0xc4, 0x6c,
+		0x6e, 0x0b, 0x82, 0x09, 0x10, 0x3a, 0x69, 0x29, 0x06, 0x19, 0x85, 0xfd,
+		0xac, 0xba, 0xfb, 0x05, 0xa0, 0xda, 0xc4, 0xdf, 0x34, 0x4a, 0xad, 0x16,
+		0xa9, 0xe8, 0xab, 0xd7, 0xc0, 0xf8, 0x36, 0x5f, 0xe3, 0x45, 0x2d, 0x5b,
+		0x21, 0xe1, 0xc0, 0x46, 0x9c, 0x9a, 0x18, 0xf4, 0xb6, 0x21, 0x87, 0xe1,
+		0x08, 0xf7, 0x6b, 0x71, 0xc6, 0xfb, 0xa5, 0x1b, 0x52, 0xae, 0xb9, 0x91,
+		0x5a, 0x83, 0x7f, 0xbb, 0x1a, 0xbd, 0xdd, 0xc2, 0x06, 0xc8, 0x54, 0x1c,
+		0xb3, 0x72, 0xab, 0x2f, 0x55, 0x4f, 0x75, 0xc9, 0x80, 0x2c, 0x73, 0xef,
+		0xb7, 0x72, 0xb6, 0xa7, 0x60, 0x79, 0x14, 0xe0, 0x9e, 0x65, 0x51, 0x3e,
+		0xc4, 0x21, 0xe6, 0xf2, 0x40, 0xbc, 0x94, 0x9b, 0x03, 0xe4, 0x24, 0x35,
+		0x40, 0x6f, 0x3d, 0x5e, 0x72, 0xd1, 0x73, 0x30, 0x39, 0x17, 0x55, 0xde,
+		0x5d, 0x88, 0xb6, 0xc9, 0xbc, 0x91, 0x2a, 0x93, 0x6a, 0x8d, 0x24, 0x3c,
+		0xd5, 0x7d, 0x12, 0x3b, 0xa3, 0x71, 0xc7, 0x3a, 0xf0, 0x64, 0x72, 0x50,
+		0x7e, 0x18, 0x71, 0xe1, 0xb4, 0x3b, 0x1e, 0xfc, 0x38, 0xca, 0xe6, 0x8c,
+		0x16, 0x51, 0x97, 0xd6, 0x3f, 0x04, 0xee, 0x23, 0x8b, 0x45, 0x0c, 0x4b,
+		0x98, 0x36, 0x18, 0x27, 0x29, 0x1b, 0x4d, 0x73, 0x7e, 0xe8, 0xb0, 0x1a,
+		0xc7, 0xfb, 0x5c, 0xea, 0x78, 0xd0, 0x6e, 0x97,
+	},
+};
+
+/* Ekpub(km) of AKE_No_Stored_km */
+static const u8 rsa_ekm[2][128] = {
+	/* R1 */
+	{
+		0x9b, 0x9f, 0x80, 0x19, 0xad, 0x0e, 0xa2, 0xf0, 0xdd, 0xa0, 0x29, 0x33,
+		0xd9, 0x6d, 0x1c, 0x77, 0x31, 0x37, 0x57, 0xe0, 0xe5, 0xb2, 0xbd, 0xdd,
+		0x36, 0x3e, 0x38, 0x4e, 0x7d, 0x40, 0x78, 0x66, 0x97, 0x7a, 0x4c, 0xce,
+		0xc5, 0xc7, 0x5d, 0x01, 0x57, 0x26, 0xcc, 0xa2, 0xf6, 0xde, 0x34, 0xdd,
+		0x29, 0xbe, 0x5e, 0x31, 0xe8, 0xf1, 0x34, 0xe8, 0x1a, 0x63, 0xa3, 0x6d,
+		0x46, 0xdc, 0x0a, 0x06, 0x08, 0x99, 0x9d, 0xdb, 0x3c, 0xa2, 0x9c, 0x04,
+		0xdd, 0x4e, 0xd9, 0x02, 0x7d, 0x20, 0x54, 0xec, 0xca, 0x86, 0x42, 0x1b,
+		0x18, 0xda, 0x30, 0x9c, 0xc4, 0xcb, 0xac, 0xb4, 0x54, 0xde, 0x84, 0x68,
+		0x71, 0x53, 0x6d, 0x92, 0x17, 0xca, 0x08, 0x8a, 0x7a, 0xf9, 0x98, 0x9a,
+		0xb6, 0x7b, 0x22, 0x92, 0xac, 0x7d, 0x0d, 0x6b, 0xd6, 0x7f, 0x31, 0xab,
+		0xf0, 0x10, 0xc5, 0x2a, 0x0f, 0x6d, 0x27, 0xa0,
+	},
+	/* R2 */
+	{
+		0xa8, 0x55, 0xc2, 0xc4, 0xc6, 0xbe, 0xef, 0xcd, 0xcb, 0x9f, 0xe3, 0x9f,
+		0x2a, 0xb7, 0x29, 0x76, 0xfe, 0xd8, 0xda, 0xc9, 0x38, 0xfa, 0x39, 0xf0,
+		0xab, 0xca, 0x8a, 0xed, 0x95, 0x7b, 0x93, 0xb2, 0xdf, 0xd0, 0x7d, 0x09,
+		0x9d, 0x05, 0x96, 0x66, 0x03, 0x6e, 0xba, 0xe0, 0x63, 0x0f, 0x30, 0x77,
+		0xc2, 0xbb, 0xe2, 0x11, 0x39, 0xe5, 0x27, 0x78, 0xee, 0x64, 0xf2, 0x85,
+		0x36, 0x57, 0xc3, 0x39, 0xd2, 0x7b, 0x79, 0x03, 0xb7, 0xcc, 0x82, 0xcb,
+		0xf0, 0x62, 0x82, 0x43, 0x38, 0x09, 0x9b, 0x71, 0xaa, 0x38, 0xa6, 0x3f,
+		0x48, 0x12, 0x6d, 0x8c, 0x5e, 0x07, 0x90, 0x76, 0xac, 0x90, 0x99, 0x51,
+		0x5b, 0x06, 0xa5, 0xfa, 0x50, 0xe4, 0xf9, 0x25, 0xc3, 0x07, 0x12, 0x37,
+		0x64, 0x92, 0xd7, 0xdb, 0xd3, 0x34, 0x1c, 0xe4, 0xfa, 0xdd, 0x09, 0xe6,
+		0x28, 0x3d, 0x0c, 0xad, 0xa9, 0xd8, 0xe1, 0xb5,
+	},
+};
+
+/* km */
+static const u8 rsa_km[2][16] = {
+	/* R1 */
+	{
+		0x68, 0xbc, 0xc5, 0x1b, 0xa9, 0xdb, 0x1b, 0xd0, 0xfa, 0xf1, 0x5e, 0x9a,
+		0xd8, 0xa5, 0xaf, 0xb9,
+	},
+	/* R2 */
+	{
+		0xca, 0x9f, 0x83, 0x95, 0x70, 0xd0, 0xd0, 0xf9, 0xcf, 0xe4, 0xeb, 0x54,
+		0x7e, 0x09, 0xfa, 0x3b,
+	},
+};
+
+static XHdcp22_Rx test_inst;
+static u32 errors;
+
+/* State of the MMULT core model */
+static u32 mmult_n[XHDCP22_TEST_MMULT_DIGITS];
+static u32 mmult_rinv[XHDCP22_TEST_MMULT_DIGITS];
+static u32 mmult_a[XHDCP22_TEST_MMULT_DIGITS];
+static u32 mmult_b[XHDCP22_TEST_MMULT_DIGITS];
+static u32 mmult_u[XHDCP22_TEST_MMULT_DIGITS];
+static u64 mmult_ops;
+
+/*
+ * Standalone BSP and HDCP driver functions used by xhdcp22_rx_crypt.c
+ */
+u32 Xil_AssertStatus;
+s32 Xil_AssertWait = 0;
+
+void Xil_Assert(const char8 *File, s32 Line)
+{
+	fprintf(stderr, "Assert %s:%d\n", File, (int)Line);
+	Xil_AssertStatus = XIL_ASSERT_OCCURRED;
+	errors++;
+}
+
+void xil_printf(const char8 *ctrl1, ...)
+{
+	(void)ctrl1;
+}
+
+void print(const char8 *ptr)
+{
+	fputs(ptr, stderr);
+}
+
+void XHdcp22Rx_LogWr(XHdcp22_Rx *InstancePtr, u16 Evt, u16 Data)
+{
+	(void)InstancePtr;
+	(void)Evt;
+	(void)Data;
+}
+
+void XHdcp22Rng_GetRandom(XHdcp22_Rng *InstancePtr, u8 *BufferPtr,
+		u16 BufferLength, u16 RandomLength)
+{
+	u16 Idx;
+
+	(void)InstancePtr;
+	(void)BufferLength;
+	for (Idx = 0; Idx < RandomLength; Idx++) {
+		BufferPtr[Idx] = (u8)rand();
+	}
+}
+
+/*
+ * MMULT core model. The core computes U = A*B*R^-1 mod N with R = 2^512
+ * for the N written last.
+ */
+u32 XHdcp22_mmult_IsReady(XHdcp22_mmult *InstancePtr)
+{
+	(void)InstancePtr;
+	return 1;
+}
+
+u32 XHdcp22_mmult_IsDone(XHdcp22_mmult *InstancePtr)
+{
+	(void)InstancePtr;
+	return 1;
+}
+
+u32 XHdcp22_mmult_Write_N_Words(XHdcp22_mmult *InstancePtr, int offset,
+		int *data, int length)
+{
+	u32 R[XHDCP22_TEST_MMULT_DIGITS + 1];
+	u32 RModN[XHDCP22_TEST_MMULT_DIGITS];
+
+	(void)InstancePtr;
+	memcpy(&mmult_n[offset], data, 4 * length);
+
+	/* R^-1 mod N, N is odd so the inverse exists */
+	mpSetZero(R, XHDCP22_TEST_MMULT_DIGITS + 1);
+	R[XHDCP22_TEST_MMULT_DIGITS] = 1;
+	mpModulo(RModN, R, XHDCP22_TEST_MMULT_DIGITS + 1, mmult_n,
+			XHDCP22_TEST_MMULT_DIGITS);
+	mpModInv(mmult_rinv, RModN, mmult_n, XHDCP22_TEST_MMULT_DIGITS);
+
+	return length;
+}
+
+u32 XHdcp22_mmult_Write_NPrime_Words(XHdcp22_mmult *InstancePtr, int offset,
+		int *data, int length)
+{
+	(void)InstancePtr;
+	(void)offset;
+	(void)data;
+
+	return length;
+}
+
+u32 XHdcp22_mmult_Write_A_Words(XHdcp22_mmult *InstancePtr, int offset,
+		int *data, int length)
+{
+	(void)InstancePtr;
+	memcpy(&mmult_a[offset], data, 4 * length);
+
+	return length;
+}
+
+u32 XHdcp22_mmult_Write_B_Words(XHdcp22_mmult *InstancePtr, int offset,
+		int *data, int length)
+{
+	(void)InstancePtr;
+	memcpy(&mmult_b[offset], data, 4 * length);
+
+	return length;
+}
+
+u32 XHdcp22_mmult_Read_U_Words(XHdcp22_mmult *InstancePtr, int offset,
+		int *data, int length)
+{
+	(void)InstancePtr;
+	memcpy(data, &mmult_u[offset], 4 * length);
+
+	return length;
+}
+
+void XHdcp22_mmult_Start(XHdcp22_mmult *InstancePtr)
+{
+	u32 T[XHDCP22_TEST_MMULT_DIGITS];
+
+	(void)InstancePtr;
+	mpModMult(T, mmult_a, mmult_b, mmult_n, XHDCP22_TEST_MMULT_DIGITS);
+	mpModMult(mmult_u, T, mmult_rinv, mmult_n, XHDCP22_TEST_MMULT_DIGITS);
+	mmult_ops++;
+}
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+* This function prints a byte string.
+*
+* @param	Name is printed before the bytes.
+* @param	Data is the byte string.
+* @param	Size is the number of bytes.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_Dump(const char *Name, const u8 *Data, u32 Size)
+{
+	u32 Idx;
+
+	printf("  %s ", Name);
+	for (Idx = 0; Idx < Size; Idx++) {
+		printf("%02x", Data[Idx]);
+	}
+	printf("\n");
+}
+
+/*****************************************************************************/
+/**
+* This function loads a receiver test key into the driver instance and the
+* key structures.
+*
+* @param	Key is the index of the test key.
+* @param	KprivRx is filled with the private key.
+* @param	KpubRx is filled with the public key.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_LoadKey(u32 Key, XHdcp22_Rx_KprivRx *KprivRx,
+		XHdcp22_Rx_KpubRx *KpubRx)
+{
+	memcpy(KprivRx, rsa_kpriv[Key], sizeof(*KprivRx));
+	memcpy(KpubRx, rsa_kpub[Key], sizeof(*KpubRx));
+
+	(void)XHdcp22Rx_CalcMontNPrime(test_inst.NPrimeP, KprivRx->p, 16);
+	(void)XHdcp22Rx_CalcMontNPrime(test_inst.NPrimeQ, KprivRx->q, 16);
+}
+
+/*****************************************************************************/
+/**
+* This function decrypts Ekpub(km) of the test vectors and checks km.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_Kat(void)
+{
+	XHdcp22_Rx_KprivRx KprivRx;
+	XHdcp22_Rx_KpubRx KpubRx;
+	u8 Ekm[XHDCP22_RX_N_SIZE];
+	u8 Km[XHDCP22_RX_N_SIZE];
+	int KmLen;
+	u32 Key;
+
+	for (Key = 0; Key < XHDCP22_TEST_NUM_KEYS; Key++) {
+		XHdcp22Test_LoadKey(Key, &KprivRx, &KpubRx);
+
+		memcpy(Ekm, rsa_ekm[Key], sizeof(Ekm));
+		KmLen = 0;
+		if ((XHdcp22Rx_RsaesOaepDecrypt(&test_inst, &KprivRx, Ekm, Km,
+				&KmLen) != XST_SUCCESS) ||
+		    (KmLen != (int)sizeof(rsa_km[Key])) ||
+		    (memcmp(Km, rsa_km[Key], sizeof(rsa_km[Key])) != 0)) {
+			printf("FAIL R%u km decryption\n", Key + 1);
+			XHdcp22Test_Dump("got", Km, sizeof(rsa_km[Key]));
+			XHdcp22Test_Dump("exp", rsa_km[Key], sizeof(rsa_km[Key]));
+			errors++;
+		}
+
+#ifdef XHDCP22_TEST_LEGACY
+		memcpy(Ekm, rsa_ekm[Key], sizeof(Ekm));
+		KmLen = 0;
+		if ((XLegacy_RsaesOaepDecrypt(&test_inst, &KprivRx, Ekm, Km,
+				&KmLen) != XST_SUCCESS) ||
+		    (KmLen != (int)sizeof(rsa_km[Key])) ||
+		    (memcmp(Km, rsa_km[Key], sizeof(rsa_km[Key])) != 0)) {
+			printf("FAIL R%u legacy km decryption\n", Key + 1);
+			errors++;
+		}
+#endif
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function returns a ciphertext smaller than the modulus. The first
+* ciphertexts are the edge cases 0, 1, n-2 and n-1, random ones follow.
+*
+* @param	Index is the index of the ciphertext.
+* @param	KpubRx is the public key.
+* @param	C is filled with the ciphertext.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_Ciphertext(u32 Index, const XHdcp22_Rx_KpubRx *KpubRx,
+		u8 *C)
+{
+	u32 Idx;
+
+	switch (Index) {
+	case 0:
+		memset(C, 0, XHDCP22_RX_N_SIZE);
+		break;
+	case 1:
+		memset(C, 0, XHDCP22_RX_N_SIZE);
+		C[XHDCP22_RX_N_SIZE - 1] = 1;
+		break;
+	case 2:
+	case 3:
+		/* n is odd, so the subtraction does not borrow */
+		memcpy(C, KpubRx->N, XHDCP22_RX_N_SIZE);
+		C[XHDCP22_RX_N_SIZE - 1] -= (u8)(4U - Index);
+		break;
+	default:
+		for (Idx = 0; Idx < XHDCP22_RX_N_SIZE; Idx++) {
+			C[Idx] = (u8)rand();
+		}
+		/* Below n, the most significant byte of n is not zero */
+		C[0] = (u8)((u32)rand() % KpubRx->N[0]);
+		break;
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function checks RSADP on the edge cases and random ciphertexts of
+* each test key.
+*
+* @param	Count is the number of random ciphertexts per key.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_Rsadp(u32 Count)
+{
+	XHdcp22_Rx_KprivRx KprivRx;
+	XHdcp22_Rx_KpubRx KpubRx;
+	u8 C[XHDCP22_RX_N_SIZE];
+	u8 M[XHDCP22_RX_N_SIZE];
+	u8 C2[XHDCP22_RX_N_SIZE];
+#ifdef XHDCP22_TEST_LEGACY
+	u8 Legacy[XHDCP22_RX_N_SIZE];
+#endif
+	u32 Key, Idx;
+
+	for (Key = 0; Key < XHDCP22_TEST_NUM_KEYS; Key++) {
+		XHdcp22Test_LoadKey(Key, &KprivRx, &KpubRx);
+
+		for (Idx = 0; (Idx < Count + 4U) && (errors < 10U); Idx++) {
+			XHdcp22Test_Ciphertext(Idx, &KpubRx, C);
+			(void)XHdcp22Rx_Pkcs1Rsadp(&test_inst, &KprivRx, C, M);
+			(void)XHdcp22Rx_Pkcs1Rsaep(&KpubRx, M, C2);
+			if (memcmp(C, C2, sizeof(C)) != 0) {
+				printf("FAIL R%u ciphertext %u RSAEP(RSADP(c))\n",
+						Key + 1, Idx);
+				XHdcp22Test_Dump("c", C, sizeof(C));
+				XHdcp22Test_Dump("m", M, sizeof(M));
+				errors++;
+			}
+
+#ifdef XHDCP22_TEST_LEGACY
+			(void)XLegacy_Pkcs1Rsadp(&test_inst, &KprivRx, C,
+					Legacy);
+			if (memcmp(M, Legacy, sizeof(M)) != 0) {
+				printf("FAIL R%u ciphertext %u vs legacy\n",
+						Key + 1, Idx);
+				XHdcp22Test_Dump("c", C, sizeof(C));
+				XHdcp22Test_Dump("m", M, sizeof(M));
+				XHdcp22Test_Dump("legacy", Legacy, sizeof(Legacy));
+				errors++;
+			}
+#endif
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function returns the current host time.
+*
+* @return	Time in ns
+*
+******************************************************************************/
+static u64 XHdcp22Test_Now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ((u64)ts.tv_sec * 1000000000ULL) + (u64)ts.tv_nsec;
+}
+
+/*****************************************************************************/
+/**
+* This function times RSADP and the km decryption of the R1 key and prints
+* the time per operation and the MMULT operations of one RSADP.
+*
+* @param	Name is the name of the implementation.
+* @param	Rsadp is the RSADP function.
+* @param	Decrypt is the km decryption function.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XHdcp22Test_BenchImpl(const char *Name,
+		int (*Rsadp)(XHdcp22_Rx *, const XHdcp22_Rx_KprivRx *, u8 *,
+			u8 *),
+		int (*Decrypt)(XHdcp22_Rx *, const XHdcp22_Rx_KprivRx *, u8 *,
+			u8 *, int *))
+{
+	XHdcp22_Rx_KprivRx KprivRx;
+	XHdcp22_Rx_KpubRx KpubRx;
+	u8 Ekm[XHDCP22_RX_N_SIZE];
+	u8 M[XHDCP22_RX_N_SIZE];
+	u64 Start, Time, RsadpTime, DecryptTime, Ops;
+	int KmLen;
+	u32 Batch, Run;
+
+	XHdcp22Test_LoadKey(0, &KprivRx, &KpubRx);
+	memcpy(Ekm, rsa_ekm[0], sizeof(Ekm));
+
+	mmult_ops = 0;
+	(void)Rsadp(&test_inst, &KprivRx, Ekm, M);
+	Ops = mmult_ops;
+
+	/* Fastest of a few batches, the host is not idle */
+	RsadpTime = ~0ULL;
+	DecryptTime = ~0ULL;
+	for (Batch = 0; Batch < XHDCP22_TEST_BENCH_BATCHES; Batch++) {
+		Start = XHdcp22Test_Now();
+		for (Run = 0; Run < XHDCP22_TEST_BENCH_RUNS; Run++) {
+			(void)Rsadp(&test_inst, &KprivRx, Ekm, M);
+		}
+		Time = (XHdcp22Test_Now() - Start) / XHDCP22_TEST_BENCH_RUNS;
+		if (Time < RsadpTime) {
+			RsadpTime = Time;
+		}
+
+		Start = XHdcp22Test_Now();
+		for (Run = 0; Run < XHDCP22_TEST_BENCH_RUNS; Run++) {
+			(void)Decrypt(&test_inst, &KprivRx, Ekm, M, &KmLen);
+		}
+		Time = (XHdcp22Test_Now() - Start) / XHDCP22_TEST_BENCH_RUNS;
+		if (Time < DecryptTime) {
+			DecryptTime = Time;
+		}
+	}
+
+#ifdef _XHDCP22_RX_SW_MMULT_
+	(void)Ops;
+	printf("%-8s RSADP %9.1f us, km decryption %9.1f us\n", Name,
+			(double)RsadpTime / 1000.0,
+			(double)DecryptTime / 1000.0);
+#else
+	printf("%-8s RSADP %9.1f us, km decryption %9.1f us, "
+			"%llu MMULT operations\n", Name,
+			(double)RsadpTime / 1000.0,
+			(double)DecryptTime / 1000.0,
+			(unsigned long long)Ops);
+#endif
+}
+
+int main(int argc, char **argv)
+{
+	u32 Count = XHDCP22_TEST_DEF_CIPHERTEXTS;
+	unsigned int Seed = 1U;
+	int Bench = 0;
+	int Opt;
+
+	while ((Opt = getopt(argc, argv, "n:s:b")) != -1) {
+		switch (Opt) {
+		case 'n':
+			Count = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			Seed = (unsigned int)strtoul(optarg, NULL, 0);
+			break;
+		case 'b':
+			Bench = 1;
+			break;
+		default:
+			fprintf(stderr, "Usage: %s [-n ciphertexts] [-s seed] "
+					"[-b]\n", argv[0]);
+			return 2;
+		}
+	}
+
+#ifdef _XHDCP22_RX_SW_MMULT_
+	printf("Montgomery multiplication: software FIOS\n");
+#else
+	printf("Montgomery multiplication: MMULT core model\n");
+#endif
+
+	srand(Seed);
+	XHdcp22Test_Kat();
+	XHdcp22Test_Rsadp(Count);
+	printf("%s: km test vectors, %u ciphertexts per key%s, %u errors\n",
+			(errors == 0U) ? "PASS" : "FAIL", Count + 4U,
+#ifdef XHDCP22_TEST_LEGACY
+			" (compared with legacy)",
+#else
+			"",
+#endif
+			errors);
+
+	if ((errors == 0U) && (Bench != 0)) {
+		XHdcp22Test_BenchImpl("current", XHdcp22Rx_Pkcs1Rsadp,
+				XHdcp22Rx_RsaesOaepDecrypt);
+#ifdef XHDCP22_TEST_LEGACY
+		XHdcp22Test_BenchImpl("legacy", XLegacy_Pkcs1Rsadp,
+				XLegacy_RsaesOaepDecrypt);
+#endif
+	}
+
+	return (errors == 0U) ? 0 : 1;
+}
@@ -32,6 +32,7 @@
 * 2.00  MH   04/14/16 Updated for repeater upstream support.
 * 2.01  MH   02/28/17 Fixed compiler warnings.
 * 2.20  MH   06/08/17 Updated for 64 bit support.
+* 3.2   ag   10/18/26 Reuse the Kd keyed HMAC context of HPrime for VPrime.
 *</pre>
 *
 *****************************************************************************/
@@ -1771,6 +1772,7 @@ static void XHdcp22Rx_ResetParams(XHdcp22_Rx *InstancePtr)
 	memset(InstancePtr->Params.SeqNumM,      0, sizeof(InstancePtr->Params.SeqNumM));
 	memset(InstancePtr->Params.StreamIdType, 0, sizeof(InstancePtr->Params.StreamIdType));
 	memset(InstancePtr->Params.MPrime,       0, sizeof(InstancePtr->Params.MPrime));
+	memset(&InstancePtr->Params.KdCtx,       0, sizeof(InstancePtr->Params.KdCtx));
 }
 
 /*****************************************************************************/
@@ -3126,7 +3128,7 @@ static int XHdcp22Rx_SendMessageAKESendHPrime(XHdcp22_Rx *InstancePtr)
 	XHdcp22Rx_LogWr(InstancePtr, XHDCP22_RX_LOG_EVT_DEBUG, XHDCP22_RX_LOG_DEBUG_COMPUTE_HPRIME);
 	XHdcp22Rx_ComputeHPrime(InstancePtr->Params.Rrx, InstancePtr->Params.RxCaps,
 			InstancePtr->Params.Rtx, InstancePtr->Params.TxCaps, InstancePtr->Params.Km,
-			MsgPtr->AKESendHPrime.HPrime);
+			MsgPtr->AKESendHPrime.HPrime, &InstancePtr->Params.KdCtx);
 	XHdcp22Rx_LogWr(InstancePtr, XHDCP22_RX_LOG_EVT_DEBUG, XHDCP22_RX_LOG_DEBUG_COMPUTE_HPRIME_DONE);
 
 	/* Generate AKE_Send_H_prime message */
@@ -3429,9 +3431,7 @@ static int XHdcp22Rx_SendMessageRepeaterAuthSendRxIdList(XHdcp22_Rx *InstancePtr
 			InstancePtr->Topology.DeviceCnt,
 			MsgPtr->RepeaterAuthSendRxIdList.RxInfo,
 			MsgPtr->RepeaterAuthSendRxIdList.SeqNumV,
-			InstancePtr->Params.Km,
-			InstancePtr->Params.Rrx,
-			InstancePtr->Params.Rtx,
+			&InstancePtr->Params.KdCtx,
 			InstancePtr->Params.VPrime);
 		XHdcp22Rx_LogWr(InstancePtr, XHDCP22_RX_LOG_EVT_DEBUG, XHDCP22_RX_LOG_DEBUG_COMPUTE_VPRIME_DONE);
 
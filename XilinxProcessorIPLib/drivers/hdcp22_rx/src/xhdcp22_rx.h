@@ -77,6 +77,7 @@
 *                     to array. Added function XHDCP22Rx_GetVersion.
 * 2.00  MH   04/14/16 Updated for repeater upstream support.
 * 2.01  MH   02/28/17 Fixed compiler warnings.
+* 3.2   ag   10/18/26 Added the Kd keyed HMAC context to the parameters.
 *</pre>
 *
 *****************************************************************************/
@@ -97,6 +98,7 @@ extern "C" {
 #include "xhdcp22_rng.h"
 #include "xhdcp22_mmult.h"
 #include "xhdcp22_cipher.h"
+#include "xhdcp22_common.h"
 
 /************************** Constant Definitions ****************************/
 #define XHDCP22_RX_MAX_MESSAGE_SIZE           534  /**< Maximum message size */
@@ -405,6 +407,8 @@ typedef struct
 	u8 SeqNumM[3];
 	u8 StreamIdType[2];
 	u8 MPrime[32];
+	XHdcp22Cmn_HmacSha256Ctx KdCtx; /**< HMAC-SHA256 keyed with Kd,
+					  *  set when HPrime is computed */
 } XHdcp22_Rx_Parameters;
 
 /**
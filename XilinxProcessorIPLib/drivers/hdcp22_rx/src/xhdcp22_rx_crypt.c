@@ -23,6 +23,11 @@
 * 1.00  MH   10/30/15 First Release
 * 2.00  MH   04/14/16 Updated for repeater upstream support.
 * 2.20  MH   06/21/17 Updated for 64 bit support.
+* 3.2   ag   10/18/26 Use fixed window exponentiation for the CRT private
+*                     key operation and a 64-bit multiply-accumulate
+*                     software Montgomery multiplier.
+*       ag   10/18/26 Key the Kd HMAC context once in HPrime and reuse it
+*                     for VPrime.
 *</pre>
 *
 *****************************************************************************/
@@ -37,6 +42,9 @@
 #include "xhdcp22_common.h"
 
 /************************** Constant Definitions ****************************/
+#define XHDCP22_RX_MONTEXP_WINDOW       4  /**< Exponent bits per window,
+                                                must divide 32 */
+#define XHDCP22_RX_MONTEXP_TABLE_SIZE   (1 << XHDCP22_RX_MONTEXP_WINDOW)
 
 /**************************** Type Definitions ******************************/
 
@@ -63,8 +71,9 @@ static void XHdcp22Rx_Pkcs1MontMultFios(XHdcp22_Rx *InstancePtr, u32 *U, u32 *A,
 #else
 static void XHdcp22Rx_Pkcs1MontMultFiosStub(u32 *U, u32 *A, u32 *B, u32 *N,
 	            const u32 *NPrime, int NDigits);
-static void XHdcp22Rx_Pkcs1MontMultAdd(u32 *A, u32 C, int SDigit, int NDigits);
 #endif
+static void XHdcp22Rx_Pkcs1MontMult(XHdcp22_Rx *InstancePtr, u32 *U, u32 *A,
+	            u32 *B, u32 *N, const u32 *NPrime, int NDigits);
 static int  XHdcp22Rx_Pkcs1MontExp(XHdcp22_Rx *InstancePtr, u32 *C, u32 *A, u32 *E,
 	            u32 *N, const u32 *NPrime, int NDigits);
 
@@ -643,57 +652,15 @@ static int XHdcp22Rx_Pkcs1EmeOaepDecode(u8 *EncodedMessage, u8 *Message, int *Me
 	return XST_SUCCESS;
 }
 
-#ifdef _XHDCP22_RX_SW_MMULT_
-/****************************************************************************/
-/**
-* This function performs a carry propagation adding C to the input
-* array A of size NDigits, given by the first argument starting from
-* the first element SDigit, and propagates it until no further carry
-* is generated.
-*
-* ADD(A[i],C)
-*
-* Reference:
-* Analyzing and Comparing Montgomery Multiplication Algorithms
-* IEEE Micro, 16(3):26-33,June 1996
-* By: Cetin Koc, Tolga Acar, and Burton Kaliski
-*
-* @param	A is an input array of size NDigits
-* @param	C is the value being added to the input A
-* @param	SDigit is the start digit
-* @param	NDigits is the integer precision of the arguments (A)
-*
-* @return	None.
-*
-* @note		None.
-*****************************************************************************/
-static void XHdcp22Rx_Pkcs1MontMultAdd(u32 *A, u32 C, int SDigit, int NDigits)
-{
-	/* Verify arguments */
-	Xil_AssertVoid(A != NULL);
-	Xil_AssertVoid(SDigit <= NDigits);
-
-	int i;
-
-	for(i=SDigit; i<NDigits; i++)
-	{
-		C = mpAdd(A+i, A+i, &C, 1);
-
-		if(C == 0)
-		{
-			return;
-		}
-	}
-}
-#endif
-
 #ifdef _XHDCP22_RX_SW_MMULT_
 /****************************************************************************/
 /**
 * This function implements the Montgomery Modular Multiplication (MMM)
 * Finely Integrated Operand Scanning (FIOS) algorithm. The FIOS method
-* interleaves multiplication and reduction operations. Requires NDigits+3
-* words of temporary storage.
+* interleaves multiplication and reduction operations. The inner loop
+* keeps one 64-bit accumulator for the multiplication and one for the
+* reduction, so every digit costs two 32x32->64 multiply-accumulates
+* and requires NDigits+1 words of temporary storage.
 *
 * U = MontMult(A,B,N)
 *
@@ -711,7 +678,7 @@ static void XHdcp22Rx_Pkcs1MontMultAdd(u32 *A, u32 C, int SDigit, int NDigits)
 *
 * @return	None.
 *
-* @note		None.
+* @note		U may be the same array as A or B.
 *****************************************************************************/
 static void XHdcp22Rx_Pkcs1MontMultFiosStub(u32 *U, u32 *A, u32 *B,
 	u32 *N, const u32 *NPrime, int NDigits)
@@ -725,65 +692,53 @@ static void XHdcp22Rx_Pkcs1MontMultFiosStub(u32 *U, u32 *A, u32 *B,
 	Xil_AssertVoid(NDigits == 16);
 
 	int i, j;
-	u32 S, C, C1, C2, M[2], X[2];
-	u32 T[XHDCP22_RX_N_SIZE];
+	u32 M, C1, C2, Borrow;
+	u64 Mul, Red;
+	u32 T[XHDCP22_RX_P_SIZE/4 + 1];
 
-	memset(T, 0, 4*(NDigits+3));
+	memset(T, 0, sizeof(T));
 
 	for(i=0; i<NDigits; i++)
 	{
-		// (C,S) = t[0] + a[0]*b[i], worst case 2 words
-		spMultiply(X, A[0], B[i]);	// X[Upper,Lower] = a[0]*b[i]
-		C = mpAdd(&S, T+0, X+0, 1);	// [C,S] = t[0] + X[Lower]
-		mpAdd(&C, &C, X+1, 1);		// [~,C] = C + X[Upper], No carry
-
-		// ADD(t[1],C)
-		XHdcp22Rx_Pkcs1MontMultAdd(T, C, 1, NDigits+3);
+		// (C1,S) = t[0] + a[0]*b[i]
+		Mul = (u64)A[0] * B[i] + T[0];
+		C1 = (u32)(Mul >> 32);
 
 		// m = S*n'[0] mod W, where W=2^32
-		// Note: X[Upper,Lower] = S*n'[0], m=X[Lower]
-		spMultiply(M, S, NPrime[0]);
+		M = (u32)Mul * NPrime[0];
 
-		// (C,S) = S + m*n[0], worst case 2 words
-		spMultiply(X, M[0], N[0]);	// X[Upper,Lower] = m*n[0]
-		C = mpAdd(&S, &S, X+0, 1);	// [C,S] = S + X[Lower]
-		mpAdd(&C, &C, X+1, 1);		// [~,C] = C + X[Upper]
+		// (C2,~) = S + m*n[0], the lower word is zero by construction
+		Red = (u64)M * N[0] + (u32)Mul;
+		C2 = (u32)(Red >> 32);
 
 		for(j=1; j<NDigits; j++)
 		{
-			// (C,S) = t[j] + a[j]*b[i] + C, worst case 2 words
-			spMultiply(X, A[j], B[i]);	 	// X[Upper,Lower] = a[j]*b[i], double precision
-			C1 = mpAdd(&S, T+j, &C, 1);		// (C1,S) = t[j] + C
-			C2 = mpAdd(&S, &S, X+0, 1); 	// (C2,S) = S + X[Lower]
-			mpAdd(&C, &C1, X+1, 1);			// (~,C)  = C1 + X[Upper], doesn't produce carry
-			mpAdd(&C, &C, &C2, 1); 			// (~,C)  = C + C2, doesn't produce carry
-
-			// ADD(t[j+1],C)
-			XHdcp22Rx_Pkcs1MontMultAdd(T, C, j+1, NDigits+3);
-
-			// (C,S) = S + m*n[j]
-			spMultiply(X, M[0], N[j]);	// X[Upper,Lower] = m*n[j]
-			C = mpAdd(&S, &S, X+0, 1);	// [C,S] = S + X[Lower]
-			mpAdd(&C, &C, X+1, 1);		// [~,C] = C + X[Upper]
-
-			// t[j-1] = S
-			T[j-1] = S;
+			// (C1,S) = t[j] + a[j]*b[i] + C1
+			Mul = (u64)A[j] * B[i] + T[j] + C1;
+			C1 = (u32)(Mul >> 32);
+
+			// (C2,t[j-1]) = S + m*n[j] + C2
+			Red = (u64)M * N[j] + (u32)Mul + C2;
+			C2 = (u32)(Red >> 32);
+			T[j-1] = (u32)Red;
 		}
 
-		// (C,S) = t[s] + C
-		C = mpAdd(&S, T+NDigits, &C, 1);
-		// t[s-1] = S
-		T[NDigits-1] = S;
-		// t[s] = t[s+1] + C
-		mpAdd(T+NDigits, T+NDigits+1, &C, 1);
-		// t[s+1] = 0
-		T[NDigits+1] = 0;
+		// (t[s],t[s-1]) = t[s] + C1 + C2
+		Mul = (u64)T[NDigits] + C1 + C2;
+		T[NDigits-1] = (u32)Mul;
+		T[NDigits] = (u32)(Mul >> 32);
 	}
 
 	/* Step 3: if(u>=n) return u-n else return u */
-	if(mpCompare(T, N, NDigits+3) >= 0)
+	if((T[NDigits] != 0) || (mpCompare(T, N, NDigits) >= 0))
 	{
-		mpSubtract(T, T, N, NDigits+3);
+		Borrow = 0;
+		for(j=0; j<NDigits; j++)
+		{
+			Red = (u64)T[j] - N[j] - Borrow;
+			T[j] = (u32)Red;
+			Borrow = (u32)(Red >> 32) & 1;
+		}
 	}
 
 	memcpy(U, T, 4*NDigits);
@@ -878,10 +833,47 @@ static void XHdcp22Rx_Pkcs1MontMultFios(XHdcp22_Rx *InstancePtr, u32 *U,
 }
 #endif
 
+/****************************************************************************/
+/**
+* This function runs one Montgomery multiplication on the MMULT hardware
+* or, when the core is not present, with the software implementation.
+*
+* U = MontMult(A,B,N)
+*
+* @param	InstancePtr is a pointer to the MMULT instance.
+* @param	U is the MMM result
+* @param	A is the n-residue input, A' = A*R mod N
+* @param	B is the n-residue input, B' = B*R mod N
+* @param	N is the modulus
+* @param	NPrime is a pre-computed constant, NPrime = (1-R*Rbar)/N
+* @param	NDigits is the integer precision of the arguments (C,A,B,N,NPrime)
+*
+* @return	None.
+*
+* @note		The hardware must have been initialized with
+*		XHdcp22Rx_Pkcs1MontMultFiosInit for the modulus N.
+*****************************************************************************/
+static void XHdcp22Rx_Pkcs1MontMult(XHdcp22_Rx *InstancePtr, u32 *U,
+	u32 *A, u32 *B, u32 *N, const u32 *NPrime, int NDigits)
+{
+#ifndef _XHDCP22_RX_SW_MMULT_
+	(void)N;
+	(void)NPrime;
+	XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, U, A, B, NDigits);
+#else
+	(void)InstancePtr;
+	XHdcp22Rx_Pkcs1MontMultFiosStub(U, A, B, N, NPrime, NDigits);
+#endif
+}
+
 /****************************************************************************/
 /**
 * This function performs the modular exponentation operation using the
-* binary square and multiply method.
+* fixed window method. The powers A^0..A^(2^w-1) are precomputed in
+* Montgomery form, after which the exponent is processed w bits at a
+* time with w squarings and at most one multiplication per window.
+* For a 512-bit exponent this needs at most 128 multiplications
+* instead of up to 512 with binary square and multiply.
 *
 * C = ModExp(A, E, N) = A^E*mod(N)
 *
@@ -900,13 +892,13 @@ static void XHdcp22Rx_Pkcs1MontMultFios(XHdcp22_Rx *InstancePtr, u32 *U,
 static int XHdcp22Rx_Pkcs1MontExp(XHdcp22_Rx *InstancePtr, u32 *C, u32 *A,
 	u32 *E, u32 *N, const u32 *NPrime, int NDigits)
 {
-	int Offset;
+	int Offset, Idx;
+	u32 Window;
 	u32 R[XHDCP22_RX_N_SIZE/4];
-	u32 Abar[XHDCP22_RX_N_SIZE/4];
 	u32 Xbar[XHDCP22_RX_N_SIZE/4];
+	u32 Table[XHDCP22_RX_MONTEXP_TABLE_SIZE][XHDCP22_RX_P_SIZE/4];
 
 	memset(R, 0, sizeof(R));
-	memset(Abar, 0, sizeof(Abar));
 	memset(Xbar, 0, sizeof(Xbar));
 
 #ifndef _XHDCP22_RX_SW_MMULT_
@@ -920,25 +912,33 @@ static int XHdcp22Rx_Pkcs1MontExp(XHdcp22_Rx *InstancePtr, u32 *C, u32 *A,
 	/* Step 1: Xbar = 1*R*mod(N) */
 	mpModulo(Xbar, R, XHDCP22_RX_N_SIZE/4, N, NDigits); // Optimization
 
-	/* Step 2: Abar = A*R*mod(N) */
-	mpModMult(Abar, A, Xbar, N, 2*NDigits);
+	/* Step 2: Table[i] = A^i*R*mod(N) */
+	memcpy(Table[0], Xbar, 4*NDigits);
+	mpModMult(R, A, Xbar, N, 2*NDigits);
+	memcpy(Table[1], R, 4*NDigits);
+	for(Idx=2; Idx<XHDCP22_RX_MONTEXP_TABLE_SIZE; Idx++)
+	{
+		XHdcp22Rx_Pkcs1MontMult(InstancePtr, Table[Idx], Table[Idx-1],
+			Table[1], N, NPrime, NDigits);
+	}
 
-	/* Step 3: Binary square and multiply */
-	for(Offset=32*NDigits-1; Offset>=0; Offset--)
+	/* Step 3: Fixed window square and multiply, the windows are aligned
+	   to the exponent digits */
+	for(Offset=32*NDigits-XHDCP22_RX_MONTEXP_WINDOW; Offset>=0;
+	    Offset-=XHDCP22_RX_MONTEXP_WINDOW)
 	{
-#ifndef _XHDCP22_RX_SW_MMULT_
-		XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, Xbar, Xbar, Xbar, NDigits);
-#else
-		XHdcp22Rx_Pkcs1MontMultFiosStub(Xbar, Xbar, Xbar, N, NPrime, NDigits);
-#endif
+		for(Idx=0; Idx<XHDCP22_RX_MONTEXP_WINDOW; Idx++)
+		{
+			XHdcp22Rx_Pkcs1MontMult(InstancePtr, Xbar, Xbar, Xbar,
+				N, NPrime, NDigits);
+		}
 
-		if(mpGetBit(E, NDigits, Offset) == TRUE)
+		Window = (E[Offset/32] >> (Offset%32)) &
+			 (XHDCP22_RX_MONTEXP_TABLE_SIZE-1);
+		if(Window != 0)
 		{
-#ifndef _XHDCP22_RX_SW_MMULT_
-			XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, Xbar, Xbar, Abar, NDigits);
-#else
-			XHdcp22Rx_Pkcs1MontMultFiosStub(Xbar, Xbar, Abar, N, NPrime, NDigits);
-#endif
+			XHdcp22Rx_Pkcs1MontMult(InstancePtr, Xbar, Xbar, Table[Window],
+				N, NPrime, NDigits);
 		}
 	}
 
@@ -946,11 +946,7 @@ static int XHdcp22Rx_Pkcs1MontExp(XHdcp22_Rx *InstancePtr, u32 *C, u32 *A,
 	memset(R, 0, sizeof(R));
 	R[0] = 1;
 
-#ifndef _XHDCP22_RX_SW_MMULT_
-	XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, C, Xbar, R, NDigits);
-#else
-	XHdcp22Rx_Pkcs1MontMultFiosStub(C, Xbar, R, N, NPrime, NDigits);
-#endif
+	XHdcp22Rx_Pkcs1MontMult(InstancePtr, C, Xbar, R, N, NPrime, NDigits);
 
 	return XST_SUCCESS;
 }
@@ -1040,13 +1036,15 @@ static void XHdcp22Rx_ComputeDKey(const u8* Rrx, const u8* Rtx, const u8 *Km,
 * @param	TxCaps are the capabilities of the receiver.
 * @param	Km is the master key generated by tx.
 * @param	HPrime is a pointer to the HPrime hash from the HDCP2.2 receiver.
+* @param	KdCtx is the HMAC context keyed with Kd on return, which is
+*		reused for VPrime of the same session.
 *
 * @return	None.
 *
 * @note		None.
 ******************************************************************************/
 void XHdcp22Rx_ComputeHPrime(const u8* Rrx, const u8 *RxCaps, const u8* Rtx,
-	const u8 *TxCaps, const u8 *Km, u8 *HPrime)
+	const u8 *TxCaps, const u8 *Km, u8 *HPrime, XHdcp22Cmn_HmacSha256Ctx *KdCtx)
 {
 	u8 HashInput[XHDCP22_RX_RTX_SIZE + XHDCP22_RX_RXCAPS_SIZE + XHDCP22_RX_TXCAPS_SIZE];
 	int Idx = 0;
@@ -1061,6 +1059,7 @@ void XHdcp22Rx_ComputeHPrime(const u8* Rrx, const u8 *RxCaps, const u8* Rtx,
 	Xil_AssertVoid(TxCaps != NULL);
 	Xil_AssertVoid(Km != NULL);
 	Xil_AssertVoid(HPrime != NULL);
+	Xil_AssertVoid(KdCtx != NULL);
 
 	/* Generate derived keys dkey0 and dkey1
 	   HashKey Kd = dkey0 || dkey1 */
@@ -1075,7 +1074,9 @@ void XHdcp22Rx_ComputeHPrime(const u8* Rrx, const u8 *RxCaps, const u8* Rtx,
 	memcpy(&HashInput[Idx], TxCaps, XHDCP22_RX_TXCAPS_SIZE);
 
 	/* Compute H' = HMAC-SHA256(HashInput, Kd) */
-	XHdcp22Cmn_HmacSha256Hash(HashInput, sizeof(HashInput), Kd, XHDCP22_RX_KD_SIZE, HPrime);
+	XHdcp22Cmn_HmacSha256Init(KdCtx, Kd, XHDCP22_RX_KD_SIZE);
+	XHdcp22Cmn_HmacSha256Compute(KdCtx, HashInput, sizeof(HashInput), HPrime);
+	memset(Kd, 0, sizeof(Kd));
 }
 
 /*****************************************************************************/
@@ -1208,9 +1209,8 @@ void XHdcp22Rx_ComputeKs(const u8* Rrx, const u8* Rtx, const u8 *Km, const u8 *R
 *         There can be between 1 and 31 devices in the list.
 * @param  RxInfo is the 16-bit field in the RepeaterAuth_Send_ReceiverID_List
 *         message.
-* @param  Km is the 128-bit master key generated by tx.
-* @param  Rrx is the 64-bit pseudo-random number generated by the receiver.
-* @param  Rtx is the 64-bit pseudo-random number generated by the transmitter.
+* @param  KdCtx is the HMAC context keyed with Kd by
+*         XHdcp22Rx_ComputeHPrime during the authentication.
 * @param  VPrime is the 256-bit value generated for repeater authentication.
 *
 * @return None.
@@ -1218,8 +1218,8 @@ void XHdcp22Rx_ComputeKs(const u8* Rrx, const u8* Rtx, const u8 *Km, const u8 *R
 * @note   None.
 ******************************************************************************/
 void XHdcp22Rx_ComputeVPrime(const u8 *ReceiverIdList, u32 ReceiverIdListSize,
-       const u8 *RxInfo, const u8 *SeqNumV, const u8 *Km, const u8 *Rrx,
-       const u8 *Rtx, u8 *VPrime)
+       const u8 *RxInfo, const u8 *SeqNumV,
+       const XHdcp22Cmn_HmacSha256Ctx *KdCtx, u8 *VPrime)
 {
 	int Idx = 0;
 	u8 HashInput[XHDCP22_RX_SEQNUMV_SIZE +
@@ -1227,24 +1227,15 @@ void XHdcp22Rx_ComputeVPrime(const u8 *ReceiverIdList, u32 ReceiverIdListSize,
 					(XHDCP22_RX_MAX_DEVICE_COUNT*XHDCP22_RX_RCVID_SIZE)];
 	int HashInputSize = (ReceiverIdListSize*XHDCP22_RX_RCVID_SIZE) +
 					XHDCP22_RX_SEQNUMV_SIZE + XHDCP22_RX_RXINFO_SIZE;
-	u8 Ctr[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01};
-	u8 Kd[2 * XHDCP22_RX_AES_SIZE]; /* dkey0 || dkey 1 */
 
 	/* Verify arguments */
 	Xil_AssertVoid(ReceiverIdList != NULL);
 	Xil_AssertVoid(ReceiverIdListSize > 0);
 	Xil_AssertVoid(RxInfo != NULL);
 	Xil_AssertVoid(SeqNumV != NULL);
-	Xil_AssertVoid(Km != NULL);
-	Xil_AssertVoid(Rrx != NULL);
-	Xil_AssertVoid(Rtx != NULL);
+	Xil_AssertVoid(KdCtx != NULL);
 	Xil_AssertVoid(VPrime != NULL);
 
-	/* Generate derived keys dkey0 and dkey1
-	   HashKey Kd = dkey0 || dkey1 */
-	XHdcp22Rx_ComputeDKey(Rrx, Rtx, Km, NULL, NULL, Kd);
-	XHdcp22Rx_ComputeDKey(Rrx, Rtx, Km, NULL, Ctr, Kd+XHDCP22_RX_AES_SIZE);
-
 	/* HashInput = ReceiverIdList || RxInfo || SeqNumV */
 	memcpy(HashInput, ReceiverIdList, ReceiverIdListSize*XHDCP22_RX_RCVID_SIZE);
 	Idx += ReceiverIdListSize*XHDCP22_RX_RCVID_SIZE;
@@ -1253,7 +1244,7 @@ void XHdcp22Rx_ComputeVPrime(const u8 *ReceiverIdList, u32 ReceiverIdListSize,
 	memcpy(&HashInput[Idx], SeqNumV, XHDCP22_RX_SEQNUMV_SIZE);
 
 	/* VPrime = HMAC-SHA256(HashInput, Kd) */
-	XHdcp22Cmn_HmacSha256Hash(HashInput, HashInputSize, Kd, XHDCP22_RX_KD_SIZE, VPrime);
+	XHdcp22Cmn_HmacSha256Compute(KdCtx, HashInput, HashInputSize, VPrime);
 }
 
 /*****************************************************************************/
@@ -426,14 +426,15 @@ int  XHdcp22Rx_RsaesOaepEncrypt(const XHdcp22_Rx_KpubRx *KpubRx, const u8 *Messa
 int  XHdcp22Rx_RsaesOaepDecrypt(XHdcp22_Rx *InstancePtr, const XHdcp22_Rx_KprivRx *KprivRx,
 			 u8 *EncryptedMessage, u8 *Message, int *MessageLen);
 void XHdcp22Rx_ComputeHPrime(const u8* Rrx, const u8 *RxCaps, const u8* Rtx,
-	     const u8 *TxCaps, const u8 *Km, u8 *HPrime);
+	     const u8 *TxCaps, const u8 *Km, u8 *HPrime,
+	     XHdcp22Cmn_HmacSha256Ctx *KdCtx);
 void XHdcp22Rx_ComputeEkh(const u8 *KprivRx, const u8 *Km, const u8 *M, u8 *Ekh);
 void XHdcp22Rx_ComputeLPrime(const u8 *Rn, const u8 *Km, const u8 *Rrx, const u8 *Rtx, u8 *LPrime);
 void XHdcp22Rx_ComputeKs(const u8* Rrx, const u8* Rtx, const u8 *Km, const u8 *Rn,
 			 const u8 *Eks, u8 * Ks);
 void XHdcp22Rx_ComputeVPrime(const u8 *ReceiverIdList, u32 ReceiverIdListSize,
-       const u8 *RxInfo, const u8 *SeqNumV, const u8 *Km, const u8 *Rrx,
-       const u8 *Rtx, u8 *VPrime);
+       const u8 *RxInfo, const u8 *SeqNumV,
+       const XHdcp22Cmn_HmacSha256Ctx *KdCtx, u8 *VPrime);
 void XHdcp22Rx_ComputeMPrime(const u8 *StreamIdType, const u8 *SeqNumM,
        const u8 *Km, const u8 *Rrx, const u8 *Rtx, u8 *MPrime);
 
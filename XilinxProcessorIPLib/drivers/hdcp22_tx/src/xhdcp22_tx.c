@@ -52,6 +52,8 @@
 *                          RxStatus register.
 * 2.31  YB     03/28/19 Moved the reading of the DDC status from
 *                          XHdcp22Tx_TimerHandler to XHdcp22Tx_Poll.
+* 2.32  ag     10/18/26 Key the L' HMAC context once per locality check
+*                       sequence and reuse it for the retries.
 * </pre>
 *
 ******************************************************************************/
@@ -2056,11 +2058,19 @@ static XHdcp22_Tx_StateType Xhdcp22Tx_StateA1_Sk0(XHdcp22_Tx *InstancePtr)
 static XHdcp22_Tx_StateType XHdcp22Tx_StateA2(XHdcp22_Tx *InstancePtr)
 {
 	int Result;
+	XHdcp22_Tx_PairingInfo *PairingInfoPtr =
+	                       (XHdcp22_Tx_PairingInfo *)InstancePtr->Info.StateContext;
 
 	/* Log but don't clutter our log buffer, check on counter */
 	if (InstancePtr->Info.LocalityCheckCounter == 0) {
 		XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_STATE,
 		                (u16)XHDCP22_TX_STATE_A2);
+
+		/* Km, Rrx and Rtx do not change during the retries, so the
+		 * L' key is derived once and only Rn is hashed per check */
+		XHdcp22Tx_ComputeLPrimeKey(PairingInfoPtr->Km,
+		                           InstancePtr->Info.Rrx, InstancePtr->Info.Rtx,
+		                           &InstancePtr->Info.LPrimeCtx);
 	}
 
 	/* It is allowed to retry locality check until it has been
@@ -2113,8 +2123,6 @@ static XHdcp22_Tx_StateType XHdcp22Tx_StateA2_1(XHdcp22_Tx *InstancePtr)
 	int Result = XST_SUCCESS;
 	u8 LPrime[XHDCP22_TX_H_PRIME_SIZE];
 
-	XHdcp22_Tx_PairingInfo *PairingInfoPtr =
-	                       (XHdcp22_Tx_PairingInfo *)InstancePtr->Info.StateContext;
 	XHdcp22_Tx_DDCMessage *MsgPtr =
 	                      (XHdcp22_Tx_DDCMessage *)InstancePtr->MessageBuffer;
 
@@ -2150,8 +2158,7 @@ static XHdcp22_Tx_StateType XHdcp22Tx_StateA2_1(XHdcp22_Tx *InstancePtr)
 	/* Verify the received L' */
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
 	XHDCP22_TX_LOG_DBG_COMPUTE_L);
-	XHdcp22Tx_ComputeLPrime(InstancePtr->Info.Rn, PairingInfoPtr->Km,
-	                        InstancePtr->Info.Rrx, InstancePtr->Info.Rtx,
+	XHdcp22Tx_ComputeLPrime(InstancePtr->Info.Rn, &InstancePtr->Info.LPrimeCtx,
 	                        LPrime);
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
 		XHDCP22_TX_LOG_DBG_COMPUTE_L_DONE);
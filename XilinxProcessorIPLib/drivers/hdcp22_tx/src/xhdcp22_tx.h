@@ -61,6 +61,7 @@
 * 2.01  MH     02/28/17 Fixed compiler warnings.
 * 2.20  MH     04/12/17 Added function XHdcp22Tx_IsDwnstrmCapable.
 * 2.30  MH     07/06/17 Changed default polling value to 10 ms.
+* 2.32  ag     10/18/26 Added the L' keyed HMAC context to the info.
 * </pre>
 *
 ******************************************************************************/
@@ -83,6 +84,7 @@ extern "C" {
 #include "xtmrctr.h"
 #include "xhdcp22_cipher.h"
 #include "xhdcp22_rng.h"
+#include "xhdcp22_common.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -323,6 +325,7 @@ typedef struct
 	u8 Rn[8];                           /**< Internal used Rn. */
 	void *StateContext;                 /**< Context used internally by the state machine. */
 	u16  LocalityCheckCounter;          /**< Locality may attempt 1024 times. */
+	XHdcp22Cmn_HmacSha256Ctx LPrimeCtx; /**< HMAC-SHA256 keyed for L', reused by the locality check retries. */
 	u8 MsgAvailable;                    /**< Message is available for reading. */
 
 	XHdcp22_Tx_PairingInfo PairingInfo[XHDCP22_TX_MAX_STORED_PAIRINGINFO];
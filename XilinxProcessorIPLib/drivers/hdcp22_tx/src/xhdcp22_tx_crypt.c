@@ -28,6 +28,9 @@
 *                       Signature verification has been updated to
 *                       check entire encoded message EM including
 *                       padding PS.
+* 2.32  ag     10/18/26 Split the L' key derivation into
+*                       XHdcp22Tx_ComputeLPrimeKey so that the keyed HMAC
+*                       context is reused by the locality check retries.
 * </pre>
 *
 ******************************************************************************/
@@ -647,31 +650,29 @@ void XHdcp22Tx_ComputeEdkeyKs(const u8* Rn, const u8* Km,
 /*****************************************************************************/
 /**
 *
-* This function computes LPrime. Kd is calculated as in
-* #XHdcp22Tx_ComputeHPrime, but could also be stored the first time.
-* This could save some computing time.
-* According protocol however, only Rrx and Rtx are supposed to be stored.
+* This function derives the LPrime hash key and keys the HMAC-SHA256 context
+* with it. Kd is calculated as in #XHdcp22Tx_ComputeHPrime. The key only
+* depends on Km, Rrx and Rtx, so the context is set up once per locality
+* check sequence and reused by #XHdcp22Tx_ComputeLPrime for every Rn.
 *
-* @param  Rn is a pseudo-random nonce.
 * @param  Km is the master key generated by tx and previouslyd stored.
 * @param  Rrx is the random value generated by rx.
 * @param  Rtx is the random value generated by tx.
-* @param  LPrime is a pointer to the computed LPrime hash.
+* @param  LPrimeCtx is the HMAC context keyed with Kd XOR Rrx on return.
 *
 * @return None.
 *
 * @note   None.
 ******************************************************************************/
-void XHdcp22Tx_ComputeLPrime(const u8* Rn, const u8 *Km,
-                             const u8 *Rrx, const u8 *Rtx,
-                             u8 *LPrime)
+void XHdcp22Tx_ComputeLPrimeKey(const u8 *Km, const u8 *Rrx,
+                                const u8 *Rtx,
+                                XHdcp22Cmn_HmacSha256Ctx *LPrimeCtx)
 {
 	/* Verify arguments */
-	Xil_AssertVoid(Rn != NULL);
 	Xil_AssertVoid(Km != NULL);
 	Xil_AssertVoid(Rrx != NULL);
 	Xil_AssertVoid(Rtx != NULL);
-	Xil_AssertVoid(LPrime != NULL);
+	Xil_AssertVoid(LPrimeCtx != NULL);
 
 	u8 Aes_Iv[XHDCP22_TX_AES128_SIZE];
 	u8 Aes_Key[XHDCP22_TX_AES128_SIZE];
@@ -698,15 +699,41 @@ void XHdcp22Tx_ComputeLPrime(const u8* Rn, const u8 *Km,
 	XHdcp22Cmn_Aes128Encrypt(Aes_Iv, Aes_Key, &Kd[XHDCP22_TX_KM_SIZE]);
 
 
-	/* Create hash with HMAC-SHA256. */
-	/* Input: Rn. */
 	/* Key:	Kd XOR Rrx (least sign. 64 bits). */
 	memset(HashKey, 0x00, XHDCP22_TX_SHA256_HASH_SIZE);
 	memcpy(&HashKey[XHDCP22_TX_SHA256_HASH_SIZE-XHDCP22_TX_RRX_SIZE], Rrx,
          XHDCP22_TX_RRX_SIZE);
 	XHdcp22Tx_MemXor(HashKey, HashKey, Kd, XHDCP22_TX_SHA256_HASH_SIZE);
-	XHdcp22Cmn_HmacSha256Hash(Rn, XHDCP22_TX_RN_SIZE, HashKey,
-                           XHDCP22_TX_SHA256_HASH_SIZE, LPrime);
+	XHdcp22Cmn_HmacSha256Init(LPrimeCtx, HashKey,
+	                          XHDCP22_TX_SHA256_HASH_SIZE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function computes LPrime with the HMAC context keyed by
+* #XHdcp22Tx_ComputeLPrimeKey.
+*
+* @param  Rn is a pseudo-random nonce.
+* @param  LPrimeCtx is the HMAC context keyed with Kd XOR Rrx.
+* @param  LPrime is a pointer to the computed LPrime hash.
+*
+* @return None.
+*
+* @note   None.
+******************************************************************************/
+void XHdcp22Tx_ComputeLPrime(const u8* Rn,
+                             const XHdcp22Cmn_HmacSha256Ctx *LPrimeCtx,
+                             u8 *LPrime)
+{
+	/* Verify arguments */
+	Xil_AssertVoid(Rn != NULL);
+	Xil_AssertVoid(LPrimeCtx != NULL);
+	Xil_AssertVoid(LPrime != NULL);
+
+	/* Create hash with HMAC-SHA256. */
+	/* Input: Rn. */
+	XHdcp22Cmn_HmacSha256Compute(LPrimeCtx, Rn, XHDCP22_TX_RN_SIZE, LPrime);
 }
 
 /*****************************************************************************/
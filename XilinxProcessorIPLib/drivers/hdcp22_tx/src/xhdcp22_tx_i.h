@@ -27,6 +27,8 @@
 * 2.01  MH     02/13/17 1. Updated maximum locality check count
 *                       from 128 to 8 to avoid delays in re-auth.
 *                       2. Added log events for failures.
+* 2.32  ag     10/18/26 Split the L' key derivation into
+*                       XHdcp22Tx_ComputeLPrimeKey.
 * </pre>
 *
 ******************************************************************************/
@@ -475,8 +477,11 @@ int XHdcp22Tx_VerifySRM(const u8* SrmPtr, int SrmSize,
 void XHdcp22Tx_ComputeHPrime(const u8 *Rrx, const u8 *RxCaps,
                              const u8* Rtx,  const u8 *TxCaps,
                              const u8 *Km, u8 *HPrime);
-void XHdcp22Tx_ComputeLPrime(const u8* Rn, const u8 *Km,
-                             const u8 *Rrx, const u8 *Rtx,
+void XHdcp22Tx_ComputeLPrimeKey(const u8 *Km, const u8 *Rrx,
+                                const u8 *Rtx,
+                                XHdcp22Cmn_HmacSha256Ctx *LPrimeCtx);
+void XHdcp22Tx_ComputeLPrime(const u8* Rn,
+                             const XHdcp22Cmn_HmacSha256Ctx *LPrimeCtx,
                              u8 *LPrime);
 void XHdcp22Tx_ComputeV(const u8* Rn, const u8* Rrx, const u8* RxInfo,
 	                    const u8* Rtx, const u8* RecvIDList, const u8 RecvIDCount,
@@ -0,0 +1,14 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+* Host replacement of the generated bspconfig.h for the LDPC code table
+* test. No BSP options are used by the SD-FEC driver.
+*/
+
+#ifndef BSPCONFIG_H
+#define BSPCONFIG_H
+
+#endif /* BSPCONFIG_H */
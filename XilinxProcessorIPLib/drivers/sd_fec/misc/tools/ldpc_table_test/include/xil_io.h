@@ -0,0 +1,47 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_io.h
+*
+* Host replacement of the standalone BSP register access functions. The
+* LDPC code table test points the SD-FEC base address at a register map in
+* host memory and counts the register writes.
+*
+******************************************************************************/
+
+#ifndef XIL_IO_H
+#define XIL_IO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+#include "xil_printf.h"
+
+/************************** Variable Definitions *****************************/
+extern u32 XSdFecTest_RegWrites;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+static inline u32 Xil_In32(UINTPTR Addr)
+{
+	return *(volatile u32 *)Addr;
+}
+
+static inline void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	XSdFecTest_RegWrites++;
+	*(volatile u32 *)Addr = Value;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_IO_H */
@@ -0,0 +1,533 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsdfec_ldpc_table_test.c
+*
+* Host test of the SD-FEC LDPC code table manager (XSdFecLdpcTable* in
+* xsdfec.c). The driver runs against a register map in host memory, see
+* include/xil_io.h, which also counts the register writes.
+*
+* The random test stages random LDPC code sets built from a library of code
+* shapes. Some shapes have identical SC, LA or QC tables stored in different
+* arrays. Each set is committed to the table manager and, when the tables fit
+* with the old per-code offsets, also written with XSdFecAddLdpcParams()
+* using consecutive offsets from XSdFecShareTableSize(), as applications did
+* before. It checks:
+*  - The commit succeeds exactly when the distinct tables of every share
+*    table memory fit into its depth.
+*  - LDPC_CODE_REG0-2 of every code match the old per-code write and the
+*    tables read through the LDPC_CODE_REG3 offsets match the code tables.
+*    The offsets of the XSdFec instance match LDPC_CODE_REG3.
+*  - Codes with identical tables share one region, regions of different
+*    tables do not overlap, and the manager never uses more of a share table
+*    than the old per-code offsets.
+*  - A failed commit writes no register and an immediate recommit writes
+*    nothing.
+*
+* The fragmentation test fills the QC table exactly, frees two regions and checks
+* that a new table is placed into a large enough gap without moving or
+* rewriting the regions in use. A table that fits only into the combined
+* free space compacts the table. A table larger than the free space fails
+* without writing to the device.
+*
+* Usage: xsdfec_ldpc_table_test [-n sets] [-s seed]
+*
+*  -n  Number of random code sets, 500 by default.
+*  -s  Seed of the random code sets, 1 by default.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ag   10/18/2026 Initial release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include "xsdfec.h"
+
+/************************** Constant Definitions *****************************/
+#define XSDFEC_TEST_DEF_SETS    500U
+#define XSDFEC_TEST_SHAPES      16U
+#define XSDFEC_TEST_MAX_CODES   40U
+#define XSDFEC_TEST_MAX_LAYERS  64U
+#define XSDFEC_TEST_MAX_QC      2400U
+#define XSDFEC_TEST_REG_WORDS   ((XSDFEC_LDPC_QC_TABLE_ADDR_HIGH + 4U) / 4U)
+
+/**************************** Type Definitions *******************************/
+// Code shape: table lengths and contents shared by the codes using it
+typedef struct {
+  u32 NLayers;
+  u32 NQC;
+  u32 SCTable[(XSDFEC_TEST_MAX_LAYERS + 3U) / 4U];
+  u32 LATable[XSDFEC_TEST_MAX_LAYERS];
+  u32 QCTable[XSDFEC_TEST_MAX_QC];
+} XSdFecTestShape;
+
+/************************** Variable Definitions *****************************/
+u32 XSdFecTest_RegWrites;
+
+static u32 Errors;
+static u32 RegMapNew[XSDFEC_TEST_REG_WORDS];
+static u32 RegMapOld[XSDFEC_TEST_REG_WORDS];
+static XSdFecTestShape Shapes[XSDFEC_TEST_SHAPES];
+static XSdFecLdpcParameters Params[XSDFEC_LDPC_CODE_NUM];
+static XSdFecLdpcTable Table;
+static XSdFecLdpcTable Fresh;
+
+/*
+ * Standalone BSP functions used by xsdfec.c
+ */
+u32 Xil_AssertStatus;
+s32 Xil_AssertWait = 0;
+
+void Xil_Assert(const char8 *File, s32 Line) {
+  fprintf(stderr, "Assert %s:%d\n", File, (int)Line);
+  Xil_AssertStatus = XIL_ASSERT_OCCURRED;
+  Errors++;
+}
+
+static void XSdFecTestFail(const char *What, u32 CodeId) {
+  if (Errors < 20U) {
+    fprintf(stderr, "FAIL %s, code %u\n", What, CodeId);
+  }
+  Errors++;
+}
+
+static void XSdFecTestInitDevice(XSdFec *InstancePtr, u32 *RegMap) {
+  memset(RegMap, 0, XSDFEC_TEST_REG_WORDS * sizeof(u32));
+  memset(InstancePtr, 0, sizeof(*InstancePtr));
+  InstancePtr->BaseAddress = (UINTPTR)RegMap;
+  InstancePtr->IsReady     = XIL_COMPONENT_IS_READY;
+  InstancePtr->Standard    = XSDFEC_STANDARD_OTHER;
+}
+
+static void XSdFecTestFillTable(u32 *TablePtr, u32 Len) {
+  for (u32 i = 0; i < Len; i++) {
+    TablePtr[i] = ((u32)rand() << 16) ^ (u32)rand();
+  }
+}
+
+// Random shapes, every third one with copies of the tables of the previous shape
+static void XSdFecTestInitShapes(void) {
+  XSdFecTestShape *shape;
+
+  for (u32 s = 0; s < XSDFEC_TEST_SHAPES; s++) {
+    shape = &Shapes[s];
+    shape->NLayers = 1U + (u32)rand() % XSDFEC_TEST_MAX_LAYERS;
+    shape->NQC     = 1U + (u32)rand() % XSDFEC_TEST_MAX_QC;
+    XSdFecTestFillTable(shape->SCTable, (shape->NLayers + 3U) >> 2);
+    XSdFecTestFillTable(shape->LATable, shape->NLayers);
+    XSdFecTestFillTable(shape->QCTable, shape->NQC);
+    if (s % 3U == 2U) {
+      // Same LA and SC contents as the previous shape, in different arrays
+      shape->NLayers = Shapes[s - 1U].NLayers;
+      memcpy(shape->SCTable, Shapes[s - 1U].SCTable, sizeof(shape->SCTable));
+      memcpy(shape->LATable, Shapes[s - 1U].LATable, sizeof(shape->LATable));
+    }
+    if (s % 3U == 1U) {
+      shape->NQC = Shapes[s - 1U].NQC;
+      memcpy(shape->QCTable, Shapes[s - 1U].QCTable, sizeof(shape->QCTable));
+    }
+  }
+}
+
+static void XSdFecTestSetParams(XSdFecLdpcParameters *ParamsPtr, XSdFecTestShape *Shape) {
+  memset(ParamsPtr, 0, sizeof(*ParamsPtr));
+  ParamsPtr->N             = 1U + (u32)rand() % 0xFFFFU;
+  ParamsPtr->K             = 1U + (u32)rand() % 0xFFFFU;
+  ParamsPtr->PSize         = 1U + (u32)rand() % 0x1FFU;
+  ParamsPtr->NM            = (u32)rand() % 0x1FFU;
+  ParamsPtr->NMQC          = (u32)rand() % 0x3FFU;
+  ParamsPtr->NormType      = (u32)rand() & 1U;
+  ParamsPtr->NoPacking     = (u32)rand() & 1U;
+  ParamsPtr->SpecialQC     = (u32)rand() & 1U;
+  ParamsPtr->NoFinalParity = (u32)rand() & 1U;
+  ParamsPtr->MaxSchedule   = (u32)rand() & 3U;
+  ParamsPtr->NLayers       = Shape->NLayers;
+  ParamsPtr->NQC           = Shape->NQC;
+  ParamsPtr->SCTable       = Shape->SCTable;
+  ParamsPtr->LATable       = Shape->LATable;
+  ParamsPtr->QCTable       = Shape->QCTable;
+}
+
+static u32 XSdFecTestReg(const u32 *RegMap, u32 Reg, u32 CodeId) {
+  return RegMap[(XSDFEC_LDPC_CODE_REG0_ADDR_BASE + CodeId * XSDFEC_LDPC_CODE_REG0_STEP) / 4U + Reg];
+}
+
+static int XSdFecTestSameTable(const u32 *A, u32 ALen, const u32 *B, u32 BLen) {
+  return (ALen == BLen) && (memcmp(A, B, ALen * sizeof(u32)) == 0);
+}
+
+// Check the tables a code register set points at against the code tables
+static void XSdFecTestCheckCode(const char *Dev, const u32 *RegMap, u32 CodeId,
+                                const XSdFecLdpcParameters *ParamsPtr) {
+  u32 reg3 = XSdFecTestReg(RegMap, 3, CodeId);
+  u32 sc   = (reg3 & XSDFEC_LDPC_CODE_REG3_SC_OFF_MASK) >> XSDFEC_LDPC_CODE_REG3_SC_OFF_LSB;
+  u32 la   = (reg3 & XSDFEC_LDPC_CODE_REG3_LA_OFF_MASK) >> XSDFEC_LDPC_CODE_REG3_LA_OFF_LSB;
+  u32 qc   = (reg3 & XSDFEC_LDPC_CODE_REG3_QC_OFF_MASK) >> XSDFEC_LDPC_CODE_REG3_QC_OFF_LSB;
+  const u32 *sc_ptr = &RegMap[XSDFEC_LDPC_SC_TABLE_ADDR_BASE / 4U + sc * XSDFEC_LDPC_SC_UNIT_WORDS];
+  const u32 *la_ptr = &RegMap[XSDFEC_LDPC_LA_TABLE_ADDR_BASE / 4U + la * XSDFEC_LDPC_LA_UNIT_WORDS];
+  const u32 *qc_ptr = &RegMap[XSDFEC_LDPC_QC_TABLE_ADDR_BASE / 4U + qc * XSDFEC_LDPC_QC_UNIT_WORDS];
+  u32 sc_len = (ParamsPtr->NLayers + 3U) >> 2;
+
+  if (memcmp(sc_ptr, ParamsPtr->SCTable, sc_len * sizeof(u32)) != 0 ||
+      memcmp(la_ptr, ParamsPtr->LATable, ParamsPtr->NLayers * sizeof(u32)) != 0 ||
+      memcmp(qc_ptr, ParamsPtr->QCTable, ParamsPtr->NQC * sizeof(u32)) != 0) {
+    XSdFecTestFail(Dev, CodeId);
+  }
+}
+
+// Share table usage of a pool in offset units: regions must match or not overlap
+static u32 XSdFecTestCheckPool(const char *Pool, u32 CodeNum, const u32 *Ids, const u32 *Offset,
+                               const u32 *Size, const u32 * const *Data, const u32 *Len) {
+  u32 end = 0;
+
+  for (u32 a = 0; a < CodeNum; a++) {
+    if (Offset[a] + Size[a] > end) {
+      end = Offset[a] + Size[a];
+    }
+    for (u32 b = a + 1U; b < CodeNum; b++) {
+      int same    = XSdFecTestSameTable(Data[a], Len[a], Data[b], Len[b]);
+      int overlap = Offset[a] < Offset[b] + Size[b] && Offset[b] < Offset[a] + Size[a];
+      if (same && Offset[a] != Offset[b]) {
+        XSdFecTestFail(Pool, Ids[b]);  // identical table not shared
+      }
+      if (!same && overlap) {
+        XSdFecTestFail(Pool, Ids[b]);  // different tables overlap
+      }
+    }
+  }
+  return end;
+}
+
+// Check every staged code on the device, returns the used units of each pool
+static void XSdFecTestCheckSet(const XSdFec *InstancePtr, const XSdFecLdpcTable *TablePtr,
+                               const u32 *RegMap, u32 *Used) {
+  static u32 ids[XSDFEC_LDPC_CODE_NUM];
+  static u32 off[3][XSDFEC_LDPC_CODE_NUM];
+  static u32 size[3][XSDFEC_LDPC_CODE_NUM];
+  static u32 len[3][XSDFEC_LDPC_CODE_NUM];
+  static const u32 *data[3][XSDFEC_LDPC_CODE_NUM];
+  const XSdFecLdpcParameters *params;
+  u32 n = 0;
+  u32 reg3;
+
+  for (u32 c = 0; c < XSDFEC_LDPC_CODE_NUM; c++) {
+    params = TablePtr->Params[c];
+    if (params == NULL) {
+      continue;
+    }
+    XSdFecTestCheckCode("table content", RegMap, c, params);
+    reg3 = XSdFecTestReg(RegMap, 3, c);
+    ids[n]    = c;
+    off[0][n] = (reg3 & XSDFEC_LDPC_CODE_REG3_SC_OFF_MASK) >> XSDFEC_LDPC_CODE_REG3_SC_OFF_LSB;
+    off[1][n] = (reg3 & XSDFEC_LDPC_CODE_REG3_LA_OFF_MASK) >> XSDFEC_LDPC_CODE_REG3_LA_OFF_LSB;
+    off[2][n] = (reg3 & XSDFEC_LDPC_CODE_REG3_QC_OFF_MASK) >> XSDFEC_LDPC_CODE_REG3_QC_OFF_LSB;
+    if (InstancePtr->SCOffset[c] != off[0][n] || InstancePtr->LAOffset[c] != off[1][n] ||
+        InstancePtr->QCOffset[c] != off[2][n]) {
+      XSdFecTestFail("instance offsets", c);
+    }
+    XSdFecShareTableSize(params, &size[0][n], &size[1][n], &size[2][n]);
+    data[0][n] = params->SCTable;
+    len[0][n]  = size[0][n];
+    data[1][n] = params->LATable;
+    len[1][n]  = params->NLayers;
+    data[2][n] = params->QCTable;
+    len[2][n]  = params->NQC;
+    n++;
+  }
+  Used[0] = XSdFecTestCheckPool("SC regions", n, ids, off[0], size[0], data[0], len[0]);
+  Used[1] = XSdFecTestCheckPool("LA regions", n, ids, off[1], size[1], data[1], len[1]);
+  Used[2] = XSdFecTestCheckPool("QC regions", n, ids, off[2], size[2], data[2], len[2]);
+}
+
+// Units needed by the distinct tables of a pool, counted independently of the driver
+static u32 XSdFecTestNeed(u32 Pool) {
+  const XSdFecLdpcParameters *a, *b;
+  const u32 *da, *db;
+  u32 la, lb, sa, sizes[3];
+  u32 need = 0;
+  u32 i, j;
+
+  for (i = 0; i < XSDFEC_LDPC_CODE_NUM; i++) {
+    a = Table.Params[i];
+    if (a == NULL) {
+      continue;
+    }
+    XSdFecShareTableSize(a, &sizes[0], &sizes[1], &sizes[2]);
+    sa = sizes[Pool];
+    da = (Pool == 0) ? a->SCTable : (Pool == 1) ? a->LATable : a->QCTable;
+    la = (Pool == 0) ? sizes[0] : (Pool == 1) ? a->NLayers : a->NQC;
+    for (j = 0; j < i; j++) {
+      b = Table.Params[j];
+      if (b == NULL) {
+        continue;
+      }
+      XSdFecShareTableSize(b, &sizes[0], &sizes[1], &sizes[2]);
+      db = (Pool == 0) ? b->SCTable : (Pool == 1) ? b->LATable : b->QCTable;
+      lb = (Pool == 0) ? sizes[0] : (Pool == 1) ? b->NLayers : b->NQC;
+      if (XSdFecTestSameTable(da, la, db, lb)) {
+        break;
+      }
+    }
+    if (j == i) {
+      need += sa;
+    }
+  }
+  return need;
+}
+
+static void XSdFecTestRandom(u32 Sets) {
+  static const u32 depth[3] = {
+    XSDFEC_LDPC_SC_TABLE_DEPTH / XSDFEC_LDPC_SC_UNIT_WORDS,
+    XSDFEC_LDPC_LA_TABLE_DEPTH / XSDFEC_LDPC_LA_UNIT_WORDS,
+    XSDFEC_LDPC_QC_TABLE_DEPTH / XSDFEC_LDPC_QC_UNIT_WORDS,
+  };
+  XSdFec dev_new, dev_old;
+  u32 used[3], old_off[3], sizes[3];
+  u32 fits, old_fits, ok = 0, failed = 0, compared = 0;
+  u32 c, p, codes;
+  int status;
+
+  XSdFecTestInitDevice(&dev_new, RegMapNew);
+  XSdFecLdpcTableInit(&Table);
+
+  for (u32 set = 0; set < Sets; set++) {
+    // Change, add or remove a few codes, or start over with a new set
+    if ((u32)rand() % 8U == 0U) {
+      for (c = 0; c < XSDFEC_LDPC_CODE_NUM; c++) {
+        XSdFecLdpcTableSetCode(&Table, c, NULL);
+      }
+    }
+    codes = 1U + (u32)rand() % 6U;
+    for (u32 i = 0; i < codes; i++) {
+      c = (u32)rand() % XSDFEC_TEST_MAX_CODES;
+      if ((u32)rand() % 4U == 0U) {
+        XSdFecLdpcTableSetCode(&Table, c, NULL);
+      } else {
+        XSdFecTestSetParams(&Params[c], &Shapes[(u32)rand() % XSDFEC_TEST_SHAPES]);
+        XSdFecLdpcTableSetCode(&Table, c, &Params[c]);
+      }
+    }
+
+    fits = 1;
+    for (p = 0; p < 3; p++) {
+      if (XSdFecTestNeed(p) > depth[p]) {
+        fits = 0;
+      }
+    }
+
+    XSdFecTest_RegWrites = 0;
+    status = XSdFecLdpcTableCommit(&dev_new, &Table);
+    if ((status == XST_SUCCESS) != (fits != 0)) {
+      XSdFecTestFail(fits ? "commit failed although the tables fit" :
+                            "commit succeeded although the tables do not fit", set);
+    }
+    if (status != XST_SUCCESS) {
+      if (XSdFecTest_RegWrites != 0U) {
+        XSdFecTestFail("failed commit wrote registers", set);
+      }
+      failed++;
+      continue;
+    }
+    ok++;
+    XSdFecTestCheckSet(&dev_new, &Table, RegMapNew, used);
+
+    XSdFecTest_RegWrites = 0;
+    XSdFecLdpcTableCommit(&dev_new, &Table);
+    if (XSdFecTest_RegWrites != 0U) {
+      XSdFecTestFail("recommit wrote registers", set);
+    }
+
+    // Old per-code offsets, if the set fits that way
+    old_off[0] = old_off[1] = old_off[2] = 0;
+    old_fits = 1;
+    for (c = 0; c < XSDFEC_LDPC_CODE_NUM; c++) {
+      if (Table.Params[c] != NULL) {
+        XSdFecShareTableSize(Table.Params[c], &sizes[0], &sizes[1], &sizes[2]);
+        for (p = 0; p < 3; p++) {
+          old_off[p] += sizes[p];
+          if (old_off[p] > depth[p]) {
+            old_fits = 0;
+          }
+        }
+      }
+    }
+    if (!old_fits) {
+      continue;
+    }
+    compared++;
+
+    // The incremental table keeps regions in place, a fresh one is packed
+    XSdFecTestInitDevice(&dev_old, RegMapOld);
+    XSdFecLdpcTableInit(&Fresh);
+    for (c = 0; c < XSDFEC_LDPC_CODE_NUM; c++) {
+      XSdFecLdpcTableSetCode(&Fresh, c, Table.Params[c]);
+    }
+    if (XSdFecLdpcTableCommit(&dev_old, &Fresh) != XST_SUCCESS) {
+      XSdFecTestFail("fresh commit", set);
+    }
+    XSdFecTestCheckSet(&dev_old, &Fresh, RegMapOld, used);
+    for (p = 0; p < 3; p++) {
+      if (used[p] > old_off[p]) {
+        XSdFecTestFail("more share table used than with per-code offsets", set);
+      }
+    }
+    XSdFecTestInitDevice(&dev_old, RegMapOld);
+    old_off[0] = old_off[1] = old_off[2] = 0;
+    for (c = 0; c < XSDFEC_LDPC_CODE_NUM; c++) {
+      if (Table.Params[c] == NULL) {
+        continue;
+      }
+      XSdFecAddLdpcParams(&dev_old, c, old_off[0], old_off[1], old_off[2], Table.Params[c]);
+      XSdFecShareTableSize(Table.Params[c], &sizes[0], &sizes[1], &sizes[2]);
+      for (p = 0; p < 3; p++) {
+        old_off[p] += sizes[p];
+      }
+      XSdFecTestCheckCode("per-code offsets content", RegMapOld, c, Table.Params[c]);
+      for (u32 r = 0; r < 3; r++) {
+        if (XSdFecTestReg(RegMapOld, r, c) != XSdFecTestReg(RegMapNew, r, c)) {
+          XSdFecTestFail("code register differs from per-code write", c);
+        }
+      }
+    }
+  }
+  printf("random: %u sets committed, %u rejected, %u compared with per-code offsets\n",
+         ok, failed, compared);
+}
+
+static void XSdFecTestSetQcShape(XSdFecTestShape *Shape, u32 QcUnits) {
+  Shape->NLayers = 8;
+  Shape->NQC     = QcUnits * XSDFEC_LDPC_QC_UNIT_WORDS;
+  XSdFecTestFillTable(Shape->SCTable, 2);
+  XSdFecTestFillTable(Shape->LATable, 8);
+  XSdFecTestFillTable(Shape->QCTable, Shape->NQC);
+}
+
+static void XSdFecTestFragmentation(void) {
+  static XSdFecTestShape frag[7];
+  XSdFec dev;
+  u32 used[3];
+  u32 qc_off[4];
+  u32 c;
+
+  XSdFecTestInitDevice(&dev, RegMapNew);
+  XSdFecLdpcTableInit(&Table);
+
+  // Four 512 unit QC tables fill all 2048 units exactly
+  for (c = 0; c < 4; c++) {
+    XSdFecTestSetQcShape(&frag[c], 512);
+    XSdFecTestSetParams(&Params[c], &frag[c]);
+    XSdFecLdpcTableSetCode(&Table, c, &Params[c]);
+  }
+  XSdFecTest_RegWrites = 0;
+  if (XSdFecLdpcTableCommit(&dev, &Table) != XST_SUCCESS) {
+    XSdFecTestFail("fragmentation fill", 0);
+    return;
+  }
+  // Every table and code register is written once, in one pass
+  if (XSdFecTest_RegWrites != 4U * (2U + 8U + 2048U + 4U)) {
+    XSdFecTestFail("fragmentation fill write count", XSdFecTest_RegWrites);
+  }
+  XSdFecTestCheckSet(&dev, &Table, RegMapNew, used);
+  for (c = 0; c < 4; c++) {
+    qc_off[c] = dev.QCOffset[c];
+  }
+
+  // Free codes 1 and 3, leaving two 512 unit gaps. A 500 unit table fits
+  // into the first one and only the new code and its tables are written.
+  XSdFecLdpcTableSetCode(&Table, 1, NULL);
+  XSdFecLdpcTableSetCode(&Table, 3, NULL);
+  XSdFecTestSetQcShape(&frag[4], 500);
+  XSdFecTestSetParams(&Params[4], &frag[4]);
+  XSdFecLdpcTableSetCode(&Table, 4, &Params[4]);
+  XSdFecTest_RegWrites = 0;
+  if (XSdFecLdpcTableCommit(&dev, &Table) != XST_SUCCESS) {
+    XSdFecTestFail("fragmentation gap fit", 4);
+    return;
+  }
+  XSdFecTestCheckSet(&dev, &Table, RegMapNew, used);
+  if (dev.QCOffset[0] != qc_off[0] || dev.QCOffset[2] != qc_off[2]) {
+    XSdFecTestFail("region moved although the new table fits a gap", 4);
+  }
+  if (XSdFecTest_RegWrites != 2U + 8U + 2000U + 4U) {
+    XSdFecTestFail("gap fit write count", XSdFecTest_RegWrites);
+  }
+
+  // 524 units are free in two gaps of 12 and 512. A 520 unit table needs
+  // the table to be compacted.
+  XSdFecTestSetQcShape(&frag[5], 520);
+  XSdFecTestSetParams(&Params[5], &frag[5]);
+  XSdFecLdpcTableSetCode(&Table, 5, &Params[5]);
+  if (XSdFecLdpcTableCommit(&dev, &Table) != XST_SUCCESS) {
+    XSdFecTestFail("compaction", 5);
+    return;
+  }
+  XSdFecTestCheckSet(&dev, &Table, RegMapNew, used);
+  if (used[2] != 2044U) {
+    XSdFecTestFail("compacted QC table not dense", used[2]);
+  }
+
+  // 4 units are left, a 100 unit table fails and nothing is written
+  XSdFecTestSetQcShape(&frag[6], 100);
+  XSdFecTestSetParams(&Params[6], &frag[6]);
+  XSdFecLdpcTableSetCode(&Table, 6, &Params[6]);
+  XSdFecTest_RegWrites = 0;
+  if (XSdFecLdpcTableCommit(&dev, &Table) == XST_SUCCESS ||
+      XSdFecTest_RegWrites != 0U) {
+    XSdFecTestFail("overfull QC table", 6);
+  }
+
+  // Removing it again restores a consistent device without rewriting it
+  XSdFecLdpcTableSetCode(&Table, 6, NULL);
+  XSdFecTest_RegWrites = 0;
+  if (XSdFecLdpcTableCommit(&dev, &Table) != XST_SUCCESS || XSdFecTest_RegWrites != 0U) {
+    XSdFecTestFail("recommit after failure", 6);
+  }
+  XSdFecTestCheckSet(&dev, &Table, RegMapNew, used);
+
+  if (XSdFecLdpcTableSetCode(&Table, XSDFEC_LDPC_CODE_NUM, &Params[0]) != XST_INVALID_PARAM) {
+    XSdFecTestFail("code ID out of range accepted", XSDFEC_LDPC_CODE_NUM);
+  }
+}
+
+int main(int argc, char **argv) {
+  u32 sets = XSDFEC_TEST_DEF_SETS;
+  unsigned int seed = 1U;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+    switch (opt) {
+    case 'n':
+      sets = (u32)strtoul(optarg, NULL, 0);
+      break;
+    case 's':
+      seed = (unsigned int)strtoul(optarg, NULL, 0);
+      break;
+    default:
+      fprintf(stderr, "Usage: %s [-n sets] [-s seed]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  srand(seed);
+  XSdFecTestInitShapes();
+  XSdFecTestFragmentation();
+  XSdFecTestRandom(sets);
+
+  printf("%s: %u errors\n", (Errors == 0U) ? "PASS" : "FAIL", Errors);
+  return (Errors == 0U) ? 0 : 1;
+}
@@ -25,36 +25,45 @@ int XSdFecCfgInitialize(XSdFec *InstancePtr, XSdFec_Config *ConfigPtr) {
     return XST_SUCCESS;
 }
 
+// Compute the LDPC_CODE_REG0-3 values of a code
+static void XSdFecLdpcCodeRegs(const XSdFecLdpcParameters* ParamsPtr, u32 SCOffset, u32 LAOffset, u32 QCOffset, u32* Regs) {
+  u32 wr_data = 0;
+  wr_data |= (XSDFEC_LDPC_CODE_REG0_N_MASK & (ParamsPtr->N << XSDFEC_LDPC_CODE_REG0_N_LSB));
+  wr_data |= (XSDFEC_LDPC_CODE_REG0_K_MASK & (ParamsPtr->K << XSDFEC_LDPC_CODE_REG0_K_LSB));
+  Regs[0] = wr_data;
+  wr_data = 0;
+  wr_data |= (XSDFEC_LDPC_CODE_REG1_PSIZE_MASK       & (ParamsPtr->PSize      << XSDFEC_LDPC_CODE_REG1_PSIZE_LSB));
+  wr_data |= (XSDFEC_LDPC_CODE_REG1_NO_PACKING_MASK  & (ParamsPtr->NoPacking  << XSDFEC_LDPC_CODE_REG1_NO_PACKING_LSB));
+  wr_data |= (XSDFEC_LDPC_CODE_REG1_NM_MASK          & (ParamsPtr->NM         << XSDFEC_LDPC_CODE_REG1_NM_LSB));
+  Regs[1] = wr_data;
+  wr_data = 0;
+  wr_data |= (XSDFEC_LDPC_CODE_REG2_NLAYERS_MASK               & (ParamsPtr->NLayers        << XSDFEC_LDPC_CODE_REG2_NLAYERS_LSB));
+  wr_data |= (XSDFEC_LDPC_CODE_REG2_NMQC_MASK                  & (ParamsPtr->NMQC           << XSDFEC_LDPC_CODE_REG2_NMQC_LSB));
+  wr_data |= (XSDFEC_LDPC_CODE_REG2_NORM_TYPE_MASK             & (ParamsPtr->NormType       << XSDFEC_LDPC_CODE_REG2_NORM_TYPE_LSB));
+  wr_data |= (XSDFEC_LDPC_CODE_REG2_SPECIAL_QC_MASK            & (ParamsPtr->SpecialQC      << XSDFEC_LDPC_CODE_REG2_SPECIAL_QC_LSB));
+  wr_data |= (XSDFEC_LDPC_CODE_REG2_NO_FINAL_PARITY_CHECK_MASK & (ParamsPtr->NoFinalParity  << XSDFEC_LDPC_CODE_REG2_NO_FINAL_PARITY_CHECK_LSB));
+  wr_data |= (XSDFEC_LDPC_CODE_REG2_MAX_SCHEDULE_MASK          & (ParamsPtr->MaxSchedule    << XSDFEC_LDPC_CODE_REG2_MAX_SCHEDULE_LSB));
+  Regs[2] = wr_data;
+  wr_data = 0;
+  wr_data |= (XSDFEC_LDPC_CODE_REG3_SC_OFF_MASK & (SCOffset << XSDFEC_LDPC_CODE_REG3_SC_OFF_LSB));
+  wr_data |= (XSDFEC_LDPC_CODE_REG3_LA_OFF_MASK & (LAOffset << XSDFEC_LDPC_CODE_REG3_LA_OFF_LSB));
+  wr_data |= (XSDFEC_LDPC_CODE_REG3_QC_OFF_MASK & (QCOffset << XSDFEC_LDPC_CODE_REG3_QC_OFF_LSB));
+  Regs[3] = wr_data;
+}
+
 void XSdFecAddLdpcParams(XSdFec *InstancePtr, u32 CodeId, u32 SCOffset, u32 LAOffset, u32 QCOffset, const XSdFecLdpcParameters* ParamsPtr) {
   Xil_AssertVoid(InstancePtr != NULL);
   Xil_AssertVoid(ParamsPtr   != NULL);
   Xil_AssertVoid(InstancePtr->IsReady  == XIL_COMPONENT_IS_READY);
   Xil_AssertVoid(InstancePtr->Standard == XSDFEC_STANDARD_OTHER);
 
-  u32 wr_data = 0;
-  if (CodeId < 128) {
-    wr_data = 0;
-    wr_data |= (XSDFEC_LDPC_CODE_REG0_N_MASK & (ParamsPtr->N << XSDFEC_LDPC_CODE_REG0_N_LSB));
-    wr_data |= (XSDFEC_LDPC_CODE_REG0_K_MASK & (ParamsPtr->K << XSDFEC_LDPC_CODE_REG0_K_LSB));
-    XSdFecWrite_LDPC_CODE_REG0_Words(InstancePtr->BaseAddress,CodeId,&wr_data,1);
-    wr_data = 0;
-    wr_data |= (XSDFEC_LDPC_CODE_REG1_PSIZE_MASK       & (ParamsPtr->PSize      << XSDFEC_LDPC_CODE_REG1_PSIZE_LSB));
-    wr_data |= (XSDFEC_LDPC_CODE_REG1_NO_PACKING_MASK  & (ParamsPtr->NoPacking  << XSDFEC_LDPC_CODE_REG1_NO_PACKING_LSB));
-    wr_data |= (XSDFEC_LDPC_CODE_REG1_NM_MASK          & (ParamsPtr->NM         << XSDFEC_LDPC_CODE_REG1_NM_LSB));
-    XSdFecWrite_LDPC_CODE_REG1_Words(InstancePtr->BaseAddress,CodeId,&wr_data,1);
-    wr_data = 0;
-    wr_data |= (XSDFEC_LDPC_CODE_REG2_NLAYERS_MASK               & (ParamsPtr->NLayers        << XSDFEC_LDPC_CODE_REG2_NLAYERS_LSB));
-    wr_data |= (XSDFEC_LDPC_CODE_REG2_NMQC_MASK                  & (ParamsPtr->NMQC           << XSDFEC_LDPC_CODE_REG2_NMQC_LSB));
-    wr_data |= (XSDFEC_LDPC_CODE_REG2_NORM_TYPE_MASK             & (ParamsPtr->NormType       << XSDFEC_LDPC_CODE_REG2_NORM_TYPE_LSB));
-    wr_data |= (XSDFEC_LDPC_CODE_REG2_SPECIAL_QC_MASK            & (ParamsPtr->SpecialQC      << XSDFEC_LDPC_CODE_REG2_SPECIAL_QC_LSB));
-    wr_data |= (XSDFEC_LDPC_CODE_REG2_NO_FINAL_PARITY_CHECK_MASK & (ParamsPtr->NoFinalParity  << XSDFEC_LDPC_CODE_REG2_NO_FINAL_PARITY_CHECK_LSB));
-    wr_data |= (XSDFEC_LDPC_CODE_REG2_MAX_SCHEDULE_MASK          & (ParamsPtr->MaxSchedule    << XSDFEC_LDPC_CODE_REG2_MAX_SCHEDULE_LSB));
-    XSdFecWrite_LDPC_CODE_REG2_Words(InstancePtr->BaseAddress,CodeId,&wr_data,1);
-    wr_data = 0;
-    wr_data |= (XSDFEC_LDPC_CODE_REG3_SC_OFF_MASK & (SCOffset << XSDFEC_LDPC_CODE_REG3_SC_OFF_LSB));
-    wr_data |= (XSDFEC_LDPC_CODE_REG3_LA_OFF_MASK & (LAOffset << XSDFEC_LDPC_CODE_REG3_LA_OFF_LSB));
-    wr_data |= (XSDFEC_LDPC_CODE_REG3_QC_OFF_MASK & (QCOffset << XSDFEC_LDPC_CODE_REG3_QC_OFF_LSB));
-    XSdFecWrite_LDPC_CODE_REG3_Words(InstancePtr->BaseAddress,CodeId,&wr_data,1);
+  u32 regs[4];
+  if (CodeId < XSDFEC_LDPC_CODE_NUM) {
+    XSdFecLdpcCodeRegs(ParamsPtr, SCOffset, LAOffset, QCOffset, regs);
+    XSdFecWrite_LDPC_CODE_REG0_Words(InstancePtr->BaseAddress,CodeId,&regs[0],1);
+    XSdFecWrite_LDPC_CODE_REG1_Words(InstancePtr->BaseAddress,CodeId,&regs[1],1);
+    XSdFecWrite_LDPC_CODE_REG2_Words(InstancePtr->BaseAddress,CodeId,&regs[2],1);
+    XSdFecWrite_LDPC_CODE_REG3_Words(InstancePtr->BaseAddress,CodeId,&regs[3],1);
 
     XSdFecWrite_LDPC_SC_TABLE_Words(InstancePtr->BaseAddress,SCOffset  , ParamsPtr->SCTable,(ParamsPtr->NLayers+3)>>2); // Scale is packed, 4 per reg
     XSdFecWrite_LDPC_LA_TABLE_Words(InstancePtr->BaseAddress,LAOffset*4, ParamsPtr->LATable,ParamsPtr->NLayers); // Further 4x applied to offset in function
@@ -129,6 +138,317 @@ XSdFecInterruptClass XSdFecInterruptClassifier(XSdFec *InstancePtr) {
   return IntClass;
 }
 
+/************************** LDPC Code Table Manager *************************/
+static void XSdFecLdpcPoolInit(XSdFecLdpcTablePool* PoolPtr, u32 DepthWords, u32 UnitWords) {
+  for (u32 i = 0; i < XSDFEC_LDPC_CODE_NUM; i++) {
+    PoolPtr->Region[i].InUse  = 0;
+    PoolPtr->Region[i].Placed = 0;
+    PoolPtr->Region[i].Dirty  = 0;
+    PoolPtr->Region[i].RefCnt = 0;
+  }
+  PoolPtr->Depth     = DepthWords / UnitWords;
+  PoolPtr->UnitWords = UnitWords;
+  PoolPtr->Used      = 0;
+}
+
+// FNV-1a hash of a table, used to find identical tables quickly
+static u32 XSdFecLdpcTableHash(const u32* DataPtr, u32 Len) {
+  u32 hash = 0x811C9DC5U;
+  for (u32 i = 0; i < Len; i++) {
+    hash ^= DataPtr[i];
+    hash *= 0x01000193U;
+  }
+  return hash;
+}
+
+// Find a region holding an identical table or allocate a new one, returns the region index
+static u8 XSdFecLdpcPoolRef(XSdFecLdpcTablePool* PoolPtr, const u32* DataPtr, u32 Len, u32 Size) {
+  XSdFecLdpcTableRegion* reg;
+  u32 hash;
+  u32 i, j;
+  u32 free_idx  = XSDFEC_LDPC_REGION_NONE;
+  u32 stale_idx = XSDFEC_LDPC_REGION_NONE;
+
+  if (Len == 0 || DataPtr == NULL) {
+    return XSDFEC_LDPC_REGION_NONE;
+  }
+
+  hash = XSdFecLdpcTableHash(DataPtr, Len);
+  for (i = 0; i < XSDFEC_LDPC_CODE_NUM; i++) {
+    reg = &PoolPtr->Region[i];
+    if (!reg->InUse) {
+      if (free_idx == XSDFEC_LDPC_REGION_NONE) {
+        free_idx = i;
+      }
+      continue;
+    }
+    if (reg->RefCnt == 0 && stale_idx == XSDFEC_LDPC_REGION_NONE) {
+      stale_idx = i;
+    }
+    if (reg->Len != Len || reg->Hash != hash) {
+      continue;
+    }
+    if (reg->DataPtr != DataPtr) {
+      for (j = 0; j < Len && reg->DataPtr[j] == DataPtr[j]; j++);
+      if (j != Len) {
+        continue;
+      }
+      // Identical contents, follow the most recently staged copy
+      reg->DataPtr = DataPtr;
+    }
+    reg->RefCnt++;
+    return (u8)i;
+  }
+
+  // At most one region per code is referenced, so if all slots are in use
+  // one of them is left over from the previous code set
+  if (free_idx == XSDFEC_LDPC_REGION_NONE) {
+    free_idx = stale_idx;
+    if (PoolPtr->Region[free_idx].Placed) {
+      PoolPtr->Used -= PoolPtr->Region[free_idx].Size;
+    }
+  }
+  reg = &PoolPtr->Region[free_idx];
+  reg->DataPtr = DataPtr;
+  reg->Len     = Len;
+  reg->Size    = Size;
+  reg->Offset  = 0;
+  reg->Hash    = hash;
+  reg->RefCnt  = 1;
+  reg->InUse   = 1;
+  reg->Placed  = 0;
+  reg->Dirty   = 1;
+  return (u8)free_idx;
+}
+
+// Place the unplaced regions of a pool, largest first, into the lowest free gap that fits
+static int XSdFecLdpcPoolPlace(XSdFecLdpcTablePool* PoolPtr) {
+  XSdFecLdpcTableRegion* reg;
+  XSdFecLdpcTableRegion* big;
+  u32 i, end, gap_start, next;
+
+  for (;;) {
+    // Largest unplaced region
+    big = NULL;
+    for (i = 0; i < XSDFEC_LDPC_CODE_NUM; i++) {
+      reg = &PoolPtr->Region[i];
+      if (reg->InUse && !reg->Placed && (big == NULL || reg->Size > big->Size)) {
+        big = reg;
+      }
+    }
+    if (big == NULL) {
+      return XST_SUCCESS;
+    }
+
+    // Walk the gaps between placed regions in offset order
+    gap_start = 0;
+    for (;;) {
+      next = PoolPtr->Depth;
+      end  = gap_start;
+      for (i = 0; i < XSDFEC_LDPC_CODE_NUM; i++) {
+        reg = &PoolPtr->Region[i];
+        if (reg->InUse && reg->Placed && reg->Offset + reg->Size > gap_start && reg->Offset < next) {
+          next = reg->Offset;
+          end  = reg->Offset + reg->Size;
+        }
+      }
+      if (next >= gap_start && next - gap_start >= big->Size) {
+        break;
+      }
+      if (next == PoolPtr->Depth) {
+        return XST_FAILURE;
+      }
+      gap_start = end;
+    }
+
+    big->Offset    = gap_start;
+    big->Placed    = 1;
+    big->Dirty     = 1;
+    PoolPtr->Used += big->Size;
+  }
+}
+
+// Drop unreferenced regions and place new ones, compacting the pool if they do not fit
+static int XSdFecLdpcPoolPack(XSdFecLdpcTablePool* PoolPtr) {
+  XSdFecLdpcTableRegion* reg;
+  u32 need = 0;
+  u32 i;
+
+  for (i = 0; i < XSDFEC_LDPC_CODE_NUM; i++) {
+    reg = &PoolPtr->Region[i];
+    if (reg->InUse && reg->RefCnt == 0) {
+      if (reg->Placed) {
+        PoolPtr->Used -= reg->Size;
+      }
+      reg->InUse  = 0;
+      reg->Placed = 0;
+      reg->Dirty  = 0;
+    }
+    if (reg->InUse) {
+      need += reg->Size;
+    }
+  }
+  if (need > PoolPtr->Depth) {
+    return XST_FAILURE;
+  }
+
+  if (XSdFecLdpcPoolPlace(PoolPtr) == XST_SUCCESS) {
+    return XST_SUCCESS;
+  }
+
+  // Fragmented, place everything again from offset 0
+  for (i = 0; i < XSDFEC_LDPC_CODE_NUM; i++) {
+    PoolPtr->Region[i].Placed = 0;
+  }
+  PoolPtr->Used = 0;
+  return XSdFecLdpcPoolPlace(PoolPtr);
+}
+
+static u32 XSdFecLdpcRegionOffset(const XSdFecLdpcTablePool* PoolPtr, u8 Index) {
+  if (Index == XSDFEC_LDPC_REGION_NONE) {
+    return 0;
+  }
+  return PoolPtr->Region[Index].Offset;
+}
+
+void XSdFecLdpcTableInit(XSdFecLdpcTable* TablePtr) {
+  Xil_AssertVoid(TablePtr != NULL);
+
+  for (u32 i = 0; i < XSDFEC_LDPC_CODE_NUM; i++) {
+    TablePtr->Params[i]    = NULL;
+    TablePtr->CodeValid[i] = 0;
+    for (u32 j = 0; j < 4; j++) {
+      TablePtr->CodeReg[j][i] = 0;
+    }
+    TablePtr->SCRegion[i]  = XSDFEC_LDPC_REGION_NONE;
+    TablePtr->LARegion[i]  = XSDFEC_LDPC_REGION_NONE;
+    TablePtr->QCRegion[i]  = XSDFEC_LDPC_REGION_NONE;
+  }
+  XSdFecLdpcPoolInit(&TablePtr->SC, XSDFEC_LDPC_SC_TABLE_DEPTH, XSDFEC_LDPC_SC_UNIT_WORDS);
+  XSdFecLdpcPoolInit(&TablePtr->LA, XSDFEC_LDPC_LA_TABLE_DEPTH, XSDFEC_LDPC_LA_UNIT_WORDS);
+  XSdFecLdpcPoolInit(&TablePtr->QC, XSDFEC_LDPC_QC_TABLE_DEPTH, XSDFEC_LDPC_QC_UNIT_WORDS);
+}
+
+int XSdFecLdpcTableSetCode(XSdFecLdpcTable* TablePtr, u32 CodeId, const XSdFecLdpcParameters* ParamsPtr) {
+  Xil_AssertNonvoid(TablePtr != NULL);
+
+  if (CodeId >= XSDFEC_LDPC_CODE_NUM) {
+    return XST_INVALID_PARAM;
+  }
+  TablePtr->Params[CodeId] = ParamsPtr;
+  return XST_SUCCESS;
+}
+
+int XSdFecLdpcTablePack(XSdFecLdpcTable* TablePtr) {
+  const XSdFecLdpcParameters* params;
+  u32 sc_size, la_size, qc_size;
+  u32 regs[4];
+  u32 i, j;
+
+  Xil_AssertNonvoid(TablePtr != NULL);
+
+  for (i = 0; i < XSDFEC_LDPC_CODE_NUM; i++) {
+    TablePtr->SC.Region[i].RefCnt = 0;
+    TablePtr->LA.Region[i].RefCnt = 0;
+    TablePtr->QC.Region[i].RefCnt = 0;
+  }
+
+  // Reference the tables of the staged codes, sharing identical ones
+  for (i = 0; i < XSDFEC_LDPC_CODE_NUM; i++) {
+    params = TablePtr->Params[i];
+    if (params == NULL) {
+      TablePtr->SCRegion[i] = XSDFEC_LDPC_REGION_NONE;
+      TablePtr->LARegion[i] = XSDFEC_LDPC_REGION_NONE;
+      TablePtr->QCRegion[i] = XSDFEC_LDPC_REGION_NONE;
+      continue;
+    }
+    XSdFecShareTableSize(params, &sc_size, &la_size, &qc_size);
+    TablePtr->SCRegion[i] = XSdFecLdpcPoolRef(&TablePtr->SC, params->SCTable, sc_size, sc_size);
+    TablePtr->LARegion[i] = XSdFecLdpcPoolRef(&TablePtr->LA, params->LATable, params->NLayers, la_size);
+    TablePtr->QCRegion[i] = XSdFecLdpcPoolRef(&TablePtr->QC, params->QCTable, params->NQC, qc_size);
+  }
+
+  if (XSdFecLdpcPoolPack(&TablePtr->SC) != XST_SUCCESS ||
+      XSdFecLdpcPoolPack(&TablePtr->LA) != XST_SUCCESS ||
+      XSdFecLdpcPoolPack(&TablePtr->QC) != XST_SUCCESS) {
+    return XST_FAILURE;
+  }
+
+  // Code registers are rewritten only if a value differs from the device
+  for (i = 0; i < XSDFEC_LDPC_CODE_NUM; i++) {
+    params = TablePtr->Params[i];
+    if (params == NULL) {
+      continue;
+    }
+    XSdFecLdpcCodeRegs(params,
+                       XSdFecLdpcRegionOffset(&TablePtr->SC, TablePtr->SCRegion[i]),
+                       XSdFecLdpcRegionOffset(&TablePtr->LA, TablePtr->LARegion[i]),
+                       XSdFecLdpcRegionOffset(&TablePtr->QC, TablePtr->QCRegion[i]),
+                       regs);
+    for (j = 0; j < 4; j++) {
+      if (TablePtr->CodeReg[j][i] != regs[j]) {
+        TablePtr->CodeReg[j][i] = regs[j];
+        TablePtr->CodeValid[i]  = 0;
+      }
+    }
+  }
+  return XST_SUCCESS;
+}
+
+// Write the dirty regions of a pool, one burst per region
+static void XSdFecLdpcPoolCommit(XSdFecLdpcTablePool* PoolPtr, UINTPTR BaseAddress,
+                                 u32 (*WriteWords)(UINTPTR, u32, const u32*, u32)) {
+  XSdFecLdpcTableRegion* reg;
+
+  for (u32 i = 0; i < XSDFEC_LDPC_CODE_NUM; i++) {
+    reg = &PoolPtr->Region[i];
+    if (reg->InUse && reg->Dirty) {
+      WriteWords(BaseAddress, reg->Offset * PoolPtr->UnitWords, reg->DataPtr, reg->Len);
+      reg->Dirty = 0;
+    }
+  }
+}
+
+int XSdFecLdpcTableCommit(XSdFec* InstancePtr, XSdFecLdpcTable* TablePtr) {
+  u32 first, last;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(TablePtr    != NULL);
+  Xil_AssertNonvoid(InstancePtr->IsReady  == XIL_COMPONENT_IS_READY);
+  Xil_AssertNonvoid(InstancePtr->Standard == XSDFEC_STANDARD_OTHER);
+
+  if (XSdFecLdpcTablePack(TablePtr) != XST_SUCCESS) {
+    return XST_FAILURE;
+  }
+
+  // Tables first, so that no code points at a table before it is loaded
+  XSdFecLdpcPoolCommit(&TablePtr->SC, InstancePtr->BaseAddress, XSdFecWrite_LDPC_SC_TABLE_Words);
+  XSdFecLdpcPoolCommit(&TablePtr->LA, InstancePtr->BaseAddress, XSdFecWrite_LDPC_LA_TABLE_Words);
+  XSdFecLdpcPoolCommit(&TablePtr->QC, InstancePtr->BaseAddress, XSdFecWrite_LDPC_QC_TABLE_Words);
+
+  // Code registers, one burst per register for each run of consecutive changed codes
+  for (first = 0; first < XSDFEC_LDPC_CODE_NUM; first = last) {
+    if (TablePtr->Params[first] == NULL || TablePtr->CodeValid[first]) {
+      last = first + 1;
+      continue;
+    }
+    for (last = first; last < XSDFEC_LDPC_CODE_NUM &&
+         TablePtr->Params[last] != NULL && !TablePtr->CodeValid[last]; last++) {
+      TablePtr->CodeValid[last] = 1;
+
+      // Store offsets
+      InstancePtr->SCOffset[last] = XSdFecLdpcRegionOffset(&TablePtr->SC, TablePtr->SCRegion[last]);
+      InstancePtr->LAOffset[last] = XSdFecLdpcRegionOffset(&TablePtr->LA, TablePtr->LARegion[last]);
+      InstancePtr->QCOffset[last] = XSdFecLdpcRegionOffset(&TablePtr->QC, TablePtr->QCRegion[last]);
+    }
+    XSdFecWrite_LDPC_CODE_REG0_Words(InstancePtr->BaseAddress, first, &TablePtr->CodeReg[0][first], last - first);
+    XSdFecWrite_LDPC_CODE_REG1_Words(InstancePtr->BaseAddress, first, &TablePtr->CodeReg[1][first], last - first);
+    XSdFecWrite_LDPC_CODE_REG2_Words(InstancePtr->BaseAddress, first, &TablePtr->CodeReg[2][first], last - first);
+    XSdFecWrite_LDPC_CODE_REG3_Words(InstancePtr->BaseAddress, first, &TablePtr->CodeReg[3][first], last - first);
+  }
+  return XST_SUCCESS;
+}
+
 /************************** Base API Function Implementation *************************/
 void XSdFecSet_CORE_AXI_WR_PROTECT(UINTPTR BaseAddress, u32 Data) {
   XSdFecWriteReg(BaseAddress, XSDFEC_CORE_AXI_WR_PROTECT_ADDR, Data);
@@ -34,6 +34,16 @@
  * - XSdFecShareTableSize(ParamsPtr, SCSizePtr, LASizePtr, QCSizePtr)                    - Calculate share table size for a LDPC code
  * - XSdFecInterruptClassifier(InstancePtr)                                              - Classify interrupts
  *
+ * \section sec_table LDPC Code Table Manager
+ * As an alternative to XSdFecAddLdpcParams with hand computed offsets, a set of LDPC codes can be staged in an
+ * XSdFecLdpcTable and committed in one call. The manager packs the SC, LA and QC tables of all codes into the shared
+ * table memories, shares identical tables between codes and, on subsequent commits, only rewrites the code registers
+ * and tables that changed:
+ * - XSdFecLdpcTableInit(TablePtr)                      - Initialize an empty code table set
+ * - XSdFecLdpcTableSetCode(TablePtr, CodeId, ParamsPtr) - Stage (or remove, with NULL) the LDPC code for a code ID
+ * - XSdFecLdpcTablePack(TablePtr)                      - Assign share table offsets to the staged codes
+ * - XSdFecLdpcTableCommit(InstancePtr, TablePtr)       - Pack and write the changed registers and tables to a device
+ *
  * In addition, the driver provides set and get functions for all the individual registers defined for the SD-FEC.
  *
  * \section sec_ex Example
@@ -60,6 +70,13 @@ extern "C" {
 #define XSDFEC_STANDARD_OTHER 0
 #define XSDFEC_STANDARD_5G    1
 
+// LDPC code table manager constants
+#define XSDFEC_LDPC_CODE_NUM        128  // Number of LDPC code IDs
+#define XSDFEC_LDPC_SC_UNIT_WORDS     1  // SC table words per offset unit
+#define XSDFEC_LDPC_LA_UNIT_WORDS     4  // LA table words per offset unit
+#define XSDFEC_LDPC_QC_UNIT_WORDS     4  // QC table words per offset unit
+#define XSDFEC_LDPC_REGION_NONE    0xFF  // Code has no region in a share table
+
 // Type Definitions
 
 /** \brief Device configuration
@@ -112,6 +129,48 @@ typedef struct {
   u32* QCTable;
 } XSdFecLdpcParameters;
 
+/** \brief Region of a share table memory
+ *
+ * A region holds one table which may be referenced by several LDPC codes with identical tables.
+ */
+typedef struct {
+  const u32* DataPtr; /**< Table contents, must stay valid while referenced */
+  u32 Len;            /**< Table length in words */
+  u32 Size;           /**< Region size in offset units */
+  u32 Offset;         /**< Region offset in offset units */
+  u32 Hash;           /**< Hash of the table contents */
+  u32 RefCnt;         /**< Number of codes referencing the region */
+  u8  InUse;          /**< Region slot is allocated */
+  u8  Placed;         /**< Region has a valid offset */
+  u8  Dirty;          /**< Region contents must be written to the device */
+} XSdFecLdpcTableRegion;
+
+/** \brief Share table memory (SC, LA or QC) of the LDPC code table manager
+ */
+typedef struct {
+  XSdFecLdpcTableRegion Region[XSDFEC_LDPC_CODE_NUM];
+  u32 Depth;     /**< Table depth in offset units */
+  u32 UnitWords; /**< Table words per offset unit */
+  u32 Used;      /**< Offset units occupied by placed regions */
+} XSdFecLdpcTablePool;
+
+/** \brief LDPC code table manager
+ *
+ * Tracks the LDPC codes staged for a device, their share table placement and what has already been written to the
+ * device so that a commit only rewrites what changed.
+ */
+typedef struct {
+  const XSdFecLdpcParameters* Params[XSDFEC_LDPC_CODE_NUM]; /**< Staged code per code ID, NULL if unused */
+  u32 CodeReg[4][XSDFEC_LDPC_CODE_NUM];                       /**< LDPC_CODE_REG0-3 values of each code */
+  u8  CodeValid[XSDFEC_LDPC_CODE_NUM];                        /**< CodeReg holds the values on the device */
+  u8  SCRegion[XSDFEC_LDPC_CODE_NUM];                         /**< SC region index per code ID */
+  u8  LARegion[XSDFEC_LDPC_CODE_NUM];                         /**< LA region index per code ID */
+  u8  QCRegion[XSDFEC_LDPC_CODE_NUM];                         /**< QC region index per code ID */
+  XSdFecLdpcTablePool SC;
+  XSdFecLdpcTablePool LA;
+  XSdFecLdpcTablePool QC;
+} XSdFecLdpcTable;
+
 /** \brief Struct defining Turbo Decode parameters
  *
  * Member values defined in device specific header x<ipinst_name>_turbo_params.h as per IP GUI configuration
@@ -202,6 +261,54 @@ void XSdFecSetTurboParams(XSdFec *InstancePtr, const XSdFecTurboParameters* Para
  */
 void XSdFecShareTableSize(const XSdFecLdpcParameters* ParamsPtr, u32* SCSizePtr, u32* LASizePtr, u32* QCSizePtr);
 
+/**\brief Initialize an LDPC code table manager
+ *
+ * Initializes an empty code table set. Nothing is assumed to be on the device, so the first commit writes every
+ * staged code.
+ *
+ * @param TablePtr    Pointer to the code table manager
+ */
+void XSdFecLdpcTableInit(XSdFecLdpcTable* TablePtr);
+
+/**\brief Stage an LDPC code in a code table set
+ *
+ * Stages the LDPC code to be used for CodeId on the next commit. The parameters and tables are referenced, not
+ * copied, and must stay valid until the code is replaced and the set committed again.
+ *
+ * @param TablePtr    Pointer to the code table manager
+ * @param CodeId      Code number to be used for the specified LDPC code
+ * @param ParamsPtr   Pointer to parameters struct for the LDPC code, NULL to remove the code from the set
+ *
+ * @returns XST_SUCCESS if staged, XST_INVALID_PARAM if CodeId is out of range
+ */
+int XSdFecLdpcTableSetCode(XSdFecLdpcTable* TablePtr, u32 CodeId, const XSdFecLdpcParameters* ParamsPtr);
+
+/**\brief Pack the share tables of a code table set
+ *
+ * Assigns SC, LA and QC offsets to the staged codes. Codes with identical tables share one table region. Regions
+ * that are still used keep their offsets, new regions are placed first fit into the free space, largest first. If
+ * they do not fit the share tables are compacted, which moves (and rewrites) all regions.
+ * This function does not access the device.
+ *
+ * @param TablePtr    Pointer to the code table manager
+ *
+ * @returns XST_SUCCESS if packed, XST_FAILURE if the tables do not fit into the share table memories
+ */
+int XSdFecLdpcTablePack(XSdFecLdpcTable* TablePtr);
+
+/**\brief Commit a code table set to a device
+ *
+ * Packs the code table set and writes the changed share table regions and code registers to the device, using
+ * one _Words burst per table region and per run of consecutive changed code IDs. The offsets arrays in the given
+ * XSdFec instance structure are updated for the staged codes. The device must not be decoding while committing.
+ *
+ * @param InstancePtr Pointer to device instance struct
+ * @param TablePtr    Pointer to the code table manager
+ *
+ * @returns XST_SUCCESS if committed, XST_FAILURE if the tables do not fit into the share table memories
+ */
+int XSdFecLdpcTableCommit(XSdFec* InstancePtr, XSdFecLdpcTable* TablePtr);
+
 /**\brief Classify interrupts
  * 
  * Queries interrupt status registers and classifies interrupt and reports recovery action
@@ -26,6 +26,7 @@
 * 3.2   sk   11/10/15 Used UINTPTR instead of u32 for Baseaddress CR# 867425.
 *                     Changed the prototypes of XUartLite_SendByte,
 *                     XUartLite_RecvByte APIs.
+* 3.10  ag   10/18/26 Added XUartLite_TrySendByte function.
 * </pre>
 *
 ******************************************************************************/
@@ -71,6 +72,34 @@ void XUartLite_SendByte(UINTPTR BaseAddress, u8 Data)
 	XUartLite_WriteReg(BaseAddress, XUL_TX_FIFO_OFFSET, Data);
 }
 
+/****************************************************************************/
+/**
+*
+* This functions sends a single byte using the UART if the transmitter is not
+* full. Unlike XUartLite_SendByte it does not wait, so it can be used to drain
+* a software buffer from the interrupt handler or an idle loop.
+*
+* @param	BaseAddress is the base address of the device
+* @param	Data is the byte of data to send
+*
+* @return	TRUE if the byte was written to the transmit FIFO, FALSE if
+*		the transmit FIFO is full.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XUartLite_TrySendByte(UINTPTR BaseAddress, u8 Data)
+{
+	u32 Status = (u32)FALSE;
+
+	if (!XUartLite_IsTransmitFull(BaseAddress)) {
+		XUartLite_WriteReg(BaseAddress, XUL_TX_FIFO_OFFSET, Data);
+		Status = (u32)TRUE;
+	}
+
+	return Status;
+}
+
 
 /****************************************************************************/
 /**
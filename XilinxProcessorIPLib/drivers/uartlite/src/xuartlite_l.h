@@ -30,6 +30,7 @@
 * 3.2   sk   11/10/15 Used UINTPTR instead of u32 for Baseaddress CR# 867425.
 *                     Changed the prototypes of XUartLite_SendByte,
 *                     XUartLite_RecvByte APIs.
+* 3.10  ag   10/18/26 Added XUartLite_TrySendByte prototype.
 * </pre>
 *
 *****************************************************************************/
@@ -299,6 +300,7 @@ extern "C" {
 /************************** Function Prototypes *****************************/
 
 void XUartLite_SendByte(UINTPTR BaseAddress, u8 Data);
+u32 XUartLite_TrySendByte(UINTPTR BaseAddress, u8 Data);
 u8 XUartLite_RecvByte(UINTPTR BaseAddress);
 
 #ifdef __cplusplus
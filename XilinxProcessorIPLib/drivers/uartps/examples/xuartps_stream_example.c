@@ -0,0 +1,368 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+*
+* @file		xuartps_stream_example.c
+*
+* This example shows the streaming mode of the XUartPs driver. It streams a
+* block of data through the device in local loopback mode, while the driver
+* moves the data between its ring buffers and the FIFOs from the interrupt
+* handler.
+*
+* The example reports the throughput and the CPU load of the transfer. The
+* CPU load is measured by counting the iterations of an idle loop during the
+* transfer, compared with the iterations of the same loop while the UART is
+* quiet.
+*
+* @note
+* The example contains an infinite loop such that if interrupts are not
+* working it may hang.
+*
+* MODIFICATION HISTORY:
+* <pre>
+* Ver   Who    Date     Changes
+* ----- ------ -------- ----------------------------------------------
+* 3.14  ag     10/18/26 First Release
+*
+* </pre>
+****************************************************************************/
+
+/***************************** Include Files *******************************/
+
+#include "xparameters.h"
+#include "xplatform_info.h"
+#include "xuartps.h"
+#include "xil_exception.h"
+#include "xil_printf.h"
+#include "xtime_l.h"
+#ifdef SDT
+#include "xinterrupt_wrap.h"
+#else
+#include "xscugic.h"
+#endif
+
+/************************** Constant Definitions **************************/
+
+/*
+ * The following constants map to the XPAR parameters created in the
+ * xparameters.h file. They are defined here such that a user can easily
+ * change all the needed parameters in one place.
+ */
+#ifndef SDT
+#define UART_DEVICE_ID		XPAR_XUARTPS_0_DEVICE_ID
+#define INTC_DEVICE_ID		XPAR_SCUGIC_SINGLE_DEVICE_ID
+#define UART_INT_IRQ_ID		XPAR_XUARTPS_0_INTR
+#else
+#define	XUARTPS_BASEADDRESS	XPAR_XUARTPS_0_BASEADDR
+#endif
+
+/*
+ * The following constants control the size of the driver ring buffers, which
+ * must be a power of 2, and the amount of data streamed through the UART.
+ */
+#define TX_RING_SIZE		1024U
+#define RX_RING_SIZE		1024U
+#define TEST_STREAM_SIZE	16384U
+
+/* Baud rate used for the transfer */
+#define TEST_BAUD_RATE		921600U
+
+/* Time the idle loop is calibrated for */
+#define CALIBRATION_MS		100U
+
+/**************************** Type Definitions ******************************/
+
+/************************** Function Prototypes *****************************/
+
+#ifndef SDT
+int UartPsStreamExample(XScuGic *IntcInstPtr, XUartPs *UartInstPtr,
+			u16 DeviceId, u16 UartIntrId);
+static int SetupInterruptSystem(XScuGic *IntcInstancePtr,
+				XUartPs *UartInstancePtr, u16 UartIntrId);
+#else
+int UartPsStreamExample(XUartPs *UartInstPtr, UINTPTR BaseAddress);
+#endif
+
+static void Handler(void *CallBackRef, u32 Event, u32 EventData);
+
+/************************** Variable Definitions ***************************/
+
+XUartPs UartPs;			/* Instance of the UART Device */
+#ifndef SDT
+XScuGic InterruptController;	/* Instance of the Interrupt Controller */
+#endif
+
+/* Storage of the driver ring buffers */
+static u8 TxRing[TX_RING_SIZE];
+static u8 RxRing[RX_RING_SIZE];
+
+/* Number of data and receive errors */
+static volatile u32 TotalErrorCount;
+
+/**************************************************************************/
+/**
+*
+* Main function to call the Uart streaming example.
+*
+* @return	XST_SUCCESS if successful, XST_FAILURE if unsuccessful
+*
+* @note		None
+*
+**************************************************************************/
+#ifndef TESTAPP_GEN
+int main(void)
+{
+	int Status;
+
+#ifndef SDT
+	Status = UartPsStreamExample(&InterruptController, &UartPs,
+				     UART_DEVICE_ID, UART_INT_IRQ_ID);
+#else
+	Status = UartPsStreamExample(&UartPs, XUARTPS_BASEADDRESS);
+#endif
+	if (Status != XST_SUCCESS) {
+		xil_printf("UART Stream Example Test Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran UART Stream Example Test\r\n");
+	return XST_SUCCESS;
+}
+#endif
+
+/**************************************************************************/
+/**
+*
+* This function streams TEST_STREAM_SIZE bytes through the device in local
+* loopback mode using the streaming mode of the driver, checks the received
+* data and reports the throughput and the CPU load.
+*
+* @param	IntcInstPtr is a pointer to the instance of the Scu Gic driver.
+* @param	UartInstPtr is a pointer to the instance of the UART driver.
+* @param	DeviceId is the device Id of the UART device.
+* @param	UartIntrId is the interrupt Id of the UART device.
+*
+* @return	XST_SUCCESS if successful, otherwise XST_FAILURE.
+*
+* @note		This function contains an infinite loop such that if
+*		interrupts are not working it may never return.
+*
+**************************************************************************/
+#ifndef SDT
+int UartPsStreamExample(XScuGic *IntcInstPtr, XUartPs *UartInstPtr,
+			u16 DeviceId, u16 UartIntrId)
+#else
+int UartPsStreamExample(XUartPs *UartInstPtr, UINTPTR BaseAddress)
+#endif
+{
+	int Status;
+	XUartPs_Config *Config;
+	XUartPsStreamStats Stats;
+	XTime Start;
+	XTime End;
+	XTime Now;
+	u64 CalibCount = 0U;
+	u64 IdleCount = 0U;
+	u64 ElapsedUs;
+	u64 IdleExpected;
+	u32 Load;
+	u32 Sent = 0U;
+	u32 Received = 0U;
+	u32 Index;
+	u32 Len;
+	u8 *SpanPtr;
+
+#ifndef SDT
+	Config = XUartPs_LookupConfig(DeviceId);
+#else
+	Config = XUartPs_LookupConfig(BaseAddress);
+#endif
+	if (NULL == Config) {
+		return XST_FAILURE;
+	}
+
+	Status = XUartPs_CfgInitialize(UartInstPtr, Config, Config->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = XUartPs_SetBaudRate(UartInstPtr, TEST_BAUD_RATE);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+#ifndef SDT
+	Status = SetupInterruptSystem(IntcInstPtr, UartInstPtr, UartIntrId);
+#else
+	Status = XSetupInterruptSystem(UartInstPtr, &XUartPs_InterruptHandler,
+				       Config->IntrId, Config->IntrParent,
+				       XINTERRUPT_DEFAULT_PRIORITY);
+#endif
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	XUartPs_SetHandler(UartInstPtr, (XUartPs_Handler)Handler, UartInstPtr);
+	XUartPs_SetOperMode(UartInstPtr, XUARTPS_OPER_MODE_LOCAL_LOOP);
+
+	Status = XUartPs_StreamInit(UartInstPtr, TxRing, TX_RING_SIZE,
+				    RxRing, RX_RING_SIZE);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/* Calibrate the idle loop while the UART is quiet */
+	XTime_GetTime(&Start);
+	do {
+		CalibCount++;
+		XTime_GetTime(&Now);
+	} while ((Now - Start) < ((XTime)COUNTS_PER_SECOND / 1000U *
+				  CALIBRATION_MS));
+
+	/*
+	 * Stream the data. The pattern is produced in place in the TX ring
+	 * and checked in place in the RX ring. The remaining time of the loop
+	 * is idle time.
+	 */
+	XTime_GetTime(&Start);
+	while (Received < TEST_STREAM_SIZE) {
+		if (Sent < TEST_STREAM_SIZE) {
+			Len = XUartPs_StreamGetTxSpan(UartInstPtr, &SpanPtr);
+			if (Len > (TEST_STREAM_SIZE - Sent)) {
+				Len = TEST_STREAM_SIZE - Sent;
+			}
+			for (Index = 0U; Index < Len; Index++) {
+				SpanPtr[Index] = (u8)(Sent + Index);
+			}
+			XUartPs_StreamCommitTx(UartInstPtr, Len);
+			Sent += Len;
+		}
+
+		Len = XUartPs_StreamGetRxSpan(UartInstPtr, &SpanPtr);
+		for (Index = 0U; Index < Len; Index++) {
+			if (SpanPtr[Index] != (u8)(Received + Index)) {
+				TotalErrorCount++;
+			}
+		}
+		XUartPs_StreamReleaseRx(UartInstPtr, Len);
+		Received += Len;
+
+		IdleCount++;
+		XTime_GetTime(&Now);
+	}
+	XTime_GetTime(&End);
+
+	XUartPs_StreamGetStats(UartInstPtr, &Stats);
+	XUartPs_StreamStop(UartInstPtr);
+	XUartPs_SetOperMode(UartInstPtr, XUARTPS_OPER_MODE_NORMAL);
+
+	/*
+	 * The idle loop runs CalibCount times in CALIBRATION_MS on a quiet
+	 * CPU, whatever is missing was spent in the driver.
+	 */
+	ElapsedUs = ((u64)(End - Start) * 1000000U) / COUNTS_PER_SECOND;
+	IdleExpected = (CalibCount * ElapsedUs) / (CALIBRATION_MS * 1000U);
+	if ((IdleExpected == 0U) || (IdleCount >= IdleExpected)) {
+		Load = 0U;
+	} else {
+		Load = (u32)(100U - ((IdleCount * 100U) / IdleExpected));
+	}
+
+	xil_printf("Streamed %d bytes in %d us, %d bytes/s\r\n",
+		   TEST_STREAM_SIZE, (u32)ElapsedUs,
+		   (u32)(((u64)TEST_STREAM_SIZE * 1000000U) / ElapsedUs));
+	xil_printf("CPU load %d%%, %d interrupts, %d bytes dropped\r\n",
+		   Load, Stats.IntrCount, Stats.RxDropped);
+
+	if ((TotalErrorCount != 0U) || (Stats.RxDropped != 0U) ||
+	    (Stats.RxBytes != TEST_STREAM_SIZE)) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/**************************************************************************/
+/**
+*
+* This function is the handler of the streaming mode events. It is called
+* from the interrupt context. The data itself is taken from the RX ring by
+* the main loop, so only the errors are counted here.
+*
+* @param	CallBackRef contains a callback reference from the driver,
+*		in this case it is the instance pointer for the XUartPs driver.
+* @param	Event contains the specific kind of event that has occurred.
+* @param	EventData contains the data of the event.
+*
+* @return	None.
+*
+* @note		None.
+*
+***************************************************************************/
+static void Handler(void *CallBackRef, u32 Event, u32 EventData)
+{
+	(void)CallBackRef;
+	(void)EventData;
+
+	if ((Event == XUARTPS_EVENT_RECV_ERROR) ||
+	    (Event == XUARTPS_EVENT_RECV_ORERR)) {
+		TotalErrorCount++;
+	}
+}
+
+#ifndef SDT
+/*****************************************************************************/
+/**
+*
+* This function sets up the interrupt system so interrupts can occur for the
+* Uart. This function is application-specific.
+*
+* @param	IntcInstancePtr is a pointer to the instance of the INTC.
+* @param	UartInstancePtr contains a pointer to the instance of the UART
+*		driver which is going to be connected to the interrupt
+*		controller.
+* @param	UartIntrId is the interrupt Id of the UART device.
+*
+* @return	XST_SUCCESS if successful, otherwise XST_FAILURE.
+*
+* @note		None.
+*
+****************************************************************************/
+static int SetupInterruptSystem(XScuGic *IntcInstancePtr,
+				XUartPs *UartInstancePtr, u16 UartIntrId)
+{
+	int Status;
+	XScuGic_Config *IntcConfig;
+
+	IntcConfig = XScuGic_LookupConfig(INTC_DEVICE_ID);
+	if (NULL == IntcConfig) {
+		return XST_FAILURE;
+	}
+
+	Status = XScuGic_CfgInitialize(IntcInstancePtr, IntcConfig,
+				       IntcConfig->CpuBaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT,
+				     (Xil_ExceptionHandler) XScuGic_InterruptHandler,
+				     IntcInstancePtr);
+
+	Status = XScuGic_Connect(IntcInstancePtr, UartIntrId,
+				 (Xil_ExceptionHandler) XUartPs_InterruptHandler,
+				 (void *) UartInstancePtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	XScuGic_Enable(IntcInstancePtr, UartIntrId);
+	Xil_ExceptionEnable();
+
+	return XST_SUCCESS;
+}
+#endif
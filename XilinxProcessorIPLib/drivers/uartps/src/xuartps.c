@@ -27,6 +27,7 @@
 * 3.5	NK     09/26/17 Fix the RX Buffer Overflow issue.
 * 3.7   aru    08/17/18 Resolved MISRA-C mandatory violations.(CR#1007755)
 * 3.9   sd     02/06/20 Added clock support
+* 3.14  ag     10/18/26 Initialize streaming mode state
 * </pre>
 *
 *****************************************************************************/
@@ -145,6 +146,11 @@ s32 XUartPs_CfgInitialize(XUartPs *InstancePtr,
 
 	InstancePtr->is_rxbs_error = 0U;
 
+	/* Streaming mode is started with XUartPs_StreamInit() */
+	InstancePtr->IsStreaming = (u32)FALSE;
+	InstancePtr->TxRing.BufPtr = NULL;
+	InstancePtr->RxRing.BufPtr = NULL;
+
 	/* Flag that the driver instance is ready to use */
 	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
@@ -86,6 +86,18 @@
 * driver to allow data to be sent and received. They can be used in either
 * polled or interrupt mode.
 *
+* <b>Streaming Mode</b>
+*
+* For continuous high rate traffic, XUartPs_StreamInit() switches the driver
+* to a streaming mode where the driver owns a TX and an RX ring buffer. The
+* RX FIFO threshold and RX timeout interrupts move received bytes into the RX
+* ring in bursts, and the TX empty interrupt refills the whole TX FIFO from
+* the TX ring. XUartPs_StreamWrite() and XUartPs_StreamRead() copy data in and
+* out of the rings. XUartPs_StreamGetRxSpan() and XUartPs_StreamGetTxSpan()
+* return contiguous regions of the rings, so that data can be consumed or
+* produced in place without a copy. XUartPs_Send() and XUartPs_Recv() must not
+* be used while streaming.
+*
 * @note
 *
 * The default configuration for the UART after initialization is:
@@ -150,6 +162,7 @@
 * 3.9   sd     02/06/20 Added clock support
 * 3.12	gm     11/04/22 Added timeout support using Xil_WaitForEvent
 * 3.13	adk    14/04/23 Added support for system device-tree flow.
+* 3.14	ag     10/18/26 Added streaming mode with driver owned ring buffers.
 *
 * </pre>
 *
@@ -267,6 +280,22 @@ extern "C" {
 
 #define TIMEOUT_VAL				1000000U /**< Wait for 1 sec in worst case */
 
+#define XUARTPS_FIFO_DEPTH		64U /**< Depth of the TX and RX FIFOs */
+
+/** @name Streaming mode settings
+ * @{
+ */
+#ifndef XUARTPS_STREAM_RX_TRIGGER
+#define XUARTPS_STREAM_RX_TRIGGER	48U /**< RX FIFO level which raises a
+					      *  burst, leaves 16 bytes of
+					      *  interrupt latency margin */
+#endif
+#ifndef XUARTPS_STREAM_RX_TIMEOUT
+#define XUARTPS_STREAM_RX_TIMEOUT	2U /**< RX timeout, in units of 4
+					     *  character times */
+#endif
+/*@}*/
+
 /**************************** Type Definitions ******************************/
 
 /**
@@ -300,6 +329,28 @@ typedef struct {
 	u32 RemainingBytes;
 } XUartPsBuffer;
 
+/**
+ * Ring buffer used by the streaming mode. Head and Tail are free running
+ * byte counters, Head is only written by the producer and Tail only by the
+ * consumer of the ring.
+ */
+typedef struct {
+	u8 *BufPtr;		/**< Storage of the ring */
+	u32 Mask;		/**< Size of the ring - 1 */
+	volatile u32 Head;	/**< Bytes added to the ring */
+	volatile u32 Tail;	/**< Bytes removed from the ring */
+} XUartPsRing;
+
+/**
+ * Statistics of the streaming mode.
+ */
+typedef struct {
+	u32 TxBytes;	/**< Bytes written to the TX FIFO */
+	u32 RxBytes;	/**< Bytes read from the RX FIFO into the RX ring */
+	u32 RxDropped;	/**< Bytes dropped because the RX ring was full */
+	u32 IntrCount;	/**< Interrupts handled in streaming mode */
+} XUartPsStreamStats;
+
 /**
  * Keep track of data format setting of a device.
  */
@@ -347,6 +398,11 @@ typedef struct {
 	void *CallBackRef;	/* Callback reference for event handler */
 	u32 Platform;
 	u8 is_rxbs_error;
+
+	u32 IsStreaming;	/* Streaming mode is active */
+	XUartPsRing TxRing;	/* TX ring of the streaming mode */
+	XUartPsRing RxRing;	/* RX ring of the streaming mode */
+	XUartPsStreamStats StreamStats; /* Streaming mode statistics */
 } XUartPs;
 
 
@@ -515,6 +571,31 @@ void XUartPs_SetHandler(XUartPs *InstancePtr, XUartPs_Handler FuncPtr,
 /* self-test functions in xuartps_selftest.c */
 s32 XUartPs_SelfTest(XUartPs *InstancePtr);
 
+/* streaming mode functions in xuartps_stream.c */
+s32 XUartPs_StreamInit(XUartPs *InstancePtr, u8 *TxBufPtr, u32 TxSize,
+		       u8 *RxBufPtr, u32 RxSize);
+
+void XUartPs_StreamStop(XUartPs *InstancePtr);
+
+u32 XUartPs_StreamWrite(XUartPs *InstancePtr, const u8 *BufferPtr,
+			u32 NumBytes);
+
+u32 XUartPs_StreamRead(XUartPs *InstancePtr, u8 *BufferPtr, u32 NumBytes);
+
+u32 XUartPs_StreamGetTxSpan(XUartPs *InstancePtr, u8 **SpanPtr);
+
+void XUartPs_StreamCommitTx(XUartPs *InstancePtr, u32 NumBytes);
+
+u32 XUartPs_StreamGetRxSpan(XUartPs *InstancePtr, u8 **SpanPtr);
+
+void XUartPs_StreamReleaseRx(XUartPs *InstancePtr, u32 NumBytes);
+
+u32 XUartPs_StreamGetRxAvailable(XUartPs *InstancePtr);
+
+u32 XUartPs_StreamGetTxPending(XUartPs *InstancePtr);
+
+void XUartPs_StreamGetStats(XUartPs *InstancePtr, XUartPsStreamStats *StatsPtr);
+
 #ifdef __cplusplus
 }
 #endif
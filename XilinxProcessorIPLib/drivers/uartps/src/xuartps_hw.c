@@ -21,6 +21,7 @@
 * 1.05a hk     08/22/13 Added reset function
 * 3.00  kvn    02/13/15 Modified code for MISRA-C:2012 compliance.
 * 4.00  sd     02/02/24 Added wait for transmission done function
+* 3.14  ag     10/18/26 Added XUartPs_TrySendByte function
 * </pre>
 *
 *****************************************************************************/
@@ -64,6 +65,34 @@ void XUartPs_SendByte(u32 BaseAddress, u8 Data)
 	XUartPs_WriteReg(BaseAddress, XUARTPS_FIFO_OFFSET, (u32)Data);
 }
 
+/****************************************************************************/
+/**
+*
+* This function sends one byte using the device if there is space in the TX
+* FIFO. Unlike XUartPs_SendByte, it does not wait, so it can be used to drain
+* a software buffer from the TX empty interrupt handler or an idle loop.
+*
+* @param	BaseAddress contains the base address of the device.
+* @param	Data contains the byte to be sent.
+*
+* @return	TRUE if the byte was written to the TX FIFO, FALSE if the TX
+*		FIFO is full.
+*
+* @note		None.
+*
+*****************************************************************************/
+u32 XUartPs_TrySendByte(UINTPTR BaseAddress, u8 Data)
+{
+	u32 Status = (u32)FALSE;
+
+	if (!XUartPs_IsTransmitFull(BaseAddress)) {
+		XUartPs_WriteReg(BaseAddress, XUARTPS_FIFO_OFFSET, (u32)Data);
+		Status = (u32)TRUE;
+	}
+
+	return Status;
+}
+
 /****************************************************************************/
 /**
 *
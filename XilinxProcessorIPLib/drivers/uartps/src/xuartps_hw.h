@@ -34,6 +34,7 @@
 *			modem control register.
 * 4.0   sd     02/02/24 Added macros for transmission FIFO empty check
 *                       and transmission active state check
+* 3.14  ag     10/18/26 Added XUartPs_TrySendByte prototype
 *
 * </pre>
 *
@@ -445,6 +446,8 @@ extern "C" {
 
 void XUartPs_SendByte(u32 BaseAddress, u8 Data);
 
+u32 XUartPs_TrySendByte(UINTPTR BaseAddress, u8 Data);
+
 u8 XUartPs_RecvByte(u32 BaseAddress);
 
 void XUartPs_ResetHw(u32 BaseAddress);
@@ -22,6 +22,7 @@
 * 3.00  kvn    02/13/15 Modified code for MISRA-C:2012 compliance.
 * 3.1	kvn    04/10/15 Modified code for latest RTL changes.
 * 3.7   aru    08/17/18 Resolved MISRA-C mandatory violations.(CR#1007755)
+* 3.14  ag     10/18/26 Hand interrupts over to the streaming mode handler.
 * </pre>
 *
 *****************************************************************************/
@@ -44,6 +45,8 @@ static void ReceiveErrorHandler(XUartPs *InstancePtr, u32 IsrStatus);
 static void ReceiveTimeoutHandler(XUartPs *InstancePtr);
 static void ModemHandler(XUartPs *InstancePtr);
 
+void XUartPs_StreamHandler(XUartPs *InstancePtr, u32 IsrStatus);
+
 
 /* Internal function prototypes implemented in xuartps.c */
 extern u32 XUartPs_ReceiveBuffer(XUartPs *InstancePtr);
@@ -174,40 +177,52 @@ void XUartPs_InterruptHandler(XUartPs *InstancePtr)
 	IsrStatus &= XUartPs_ReadReg(InstancePtr->Config.BaseAddress,
 				   XUARTPS_ISR_OFFSET);
 
-	/* Dispatch an appropriate handler. */
-	if((IsrStatus & ((u32)XUARTPS_IXR_RXOVR | (u32)XUARTPS_IXR_RXEMPTY |
-			(u32)XUARTPS_IXR_RXFULL)) != (u32)0) {
-		/* Received data interrupt */
-		ReceiveDataHandler(InstancePtr);
-	}
-
-	if((IsrStatus & ((u32)XUARTPS_IXR_TXEMPTY | (u32)XUARTPS_IXR_TXFULL))
-									 != (u32)0) {
-		/* Transmit data interrupt */
-		SendDataHandler(InstancePtr, IsrStatus);
-	}
-
-	/* XUARTPS_IXR_RBRK is applicable only for Zynq Ultrascale+ MP */
-	if ((IsrStatus & ((u32)XUARTPS_IXR_OVER | (u32)XUARTPS_IXR_FRAMING |
-			(u32)XUARTPS_IXR_PARITY | (u32)XUARTPS_IXR_RBRK)) != (u32)0) {
-		/* Received Error Status interrupt */
-		ReceiveErrorHandler(InstancePtr, IsrStatus);
-	}
-
-	if((IsrStatus & ((u32)XUARTPS_IXR_TOUT)) != (u32)0) {
-		/* Received Timeout interrupt */
-		ReceiveTimeoutHandler(InstancePtr);
-	}
-
-	if((IsrStatus & ((u32)XUARTPS_IXR_DMS)) != (u32)0) {
-		/* Modem status interrupt */
-		ModemHandler(InstancePtr);
+	if (InstancePtr->IsStreaming == (u32)TRUE) {
+		/*
+		 * Clear the interrupt status first, the streaming handler
+		 * empties the RX FIFO so any new event is raised again.
+		 */
+		XUartPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 XUARTPS_ISR_OFFSET, IsrStatus);
+		XUartPs_StreamHandler(InstancePtr, IsrStatus);
+	} else {
+		/* Dispatch an appropriate handler. */
+		if((IsrStatus & ((u32)XUARTPS_IXR_RXOVR |
+				(u32)XUARTPS_IXR_RXEMPTY |
+				(u32)XUARTPS_IXR_RXFULL)) != (u32)0) {
+			/* Received data interrupt */
+			ReceiveDataHandler(InstancePtr);
+		}
+
+		if((IsrStatus & ((u32)XUARTPS_IXR_TXEMPTY |
+				(u32)XUARTPS_IXR_TXFULL)) != (u32)0) {
+			/* Transmit data interrupt */
+			SendDataHandler(InstancePtr, IsrStatus);
+		}
+
+		/* XUARTPS_IXR_RBRK is applicable only for Zynq Ultrascale+ MP */
+		if ((IsrStatus & ((u32)XUARTPS_IXR_OVER |
+				(u32)XUARTPS_IXR_FRAMING |
+				(u32)XUARTPS_IXR_PARITY |
+				(u32)XUARTPS_IXR_RBRK)) != (u32)0) {
+			/* Received Error Status interrupt */
+			ReceiveErrorHandler(InstancePtr, IsrStatus);
+		}
+
+		if((IsrStatus & ((u32)XUARTPS_IXR_TOUT)) != (u32)0) {
+			/* Received Timeout interrupt */
+			ReceiveTimeoutHandler(InstancePtr);
+		}
+
+		if((IsrStatus & ((u32)XUARTPS_IXR_DMS)) != (u32)0) {
+			/* Modem status interrupt */
+			ModemHandler(InstancePtr);
+		}
+
+		/* Clear the interrupt status. */
+		XUartPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 XUARTPS_ISR_OFFSET, IsrStatus);
 	}
-
-	/* Clear the interrupt status. */
-	XUartPs_WriteReg(InstancePtr->Config.BaseAddress, XUARTPS_ISR_OFFSET,
-		IsrStatus);
-
 }
 
 /****************************************************************************/
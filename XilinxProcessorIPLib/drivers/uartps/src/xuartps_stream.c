@@ -0,0 +1,720 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+*
+* @file xuartps_stream.c
+* @addtogroup uartps Overview
+* @{
+*
+* This file contains the streaming mode of the driver. In streaming mode the
+* driver owns a TX and an RX ring buffer, and moves data between the rings and
+* the FIFOs from the interrupt handler in bursts:
+*
+* - The RX FIFO threshold interrupt fires once XUARTPS_STREAM_RX_TRIGGER bytes
+*   are in the RX FIFO, which are read in one burst until the status register
+*   reports the FIFO empty. The RX timeout interrupt collects the remaining
+*   bytes once the line goes idle.
+* - The TX empty interrupt refills the whole TX FIFO from the TX ring, again
+*   without polling the status register for every byte.
+*
+* The application side of the rings is lock free. The RX ring is filled by
+* the interrupt handler and emptied by XUartPs_StreamRead() or
+* XUartPs_StreamReleaseRx(). The TX ring is filled by XUartPs_StreamWrite()
+* or XUartPs_StreamCommitTx() and emptied by the interrupt handler. Each side
+* of a ring must be used from one context only.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date	Changes
+* ----- ------ -------- -----------------------------------------------
+* 3.14  ag     10/18/26 First Release
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include <string.h>
+#include "xuartps.h"
+
+/************************** Constant Definitions ****************************/
+
+/* Interrupts used in streaming mode, TX empty is enabled when needed */
+#define XUARTPS_STREAM_RX_IXR	((u32)XUARTPS_IXR_RXOVR | \
+				 (u32)XUARTPS_IXR_RXFULL | \
+				 (u32)XUARTPS_IXR_TOUT)
+
+#define XUARTPS_STREAM_ERR_IXR	((u32)XUARTPS_IXR_OVER | \
+				 (u32)XUARTPS_IXR_FRAMING | \
+				 (u32)XUARTPS_IXR_PARITY | \
+				 (u32)XUARTPS_IXR_RBRK)
+
+/**************************** Type Definitions ******************************/
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/*
+ * Keeps the compiler from moving ring data accesses across the update of the
+ * Head and Tail counters, which publishes them to the other side of the ring.
+ */
+#if defined (__GNUC__)
+#define XUARTPS_STREAM_BARRIER()	__asm__ __volatile__ ("" : : : "memory")
+#else
+#define XUARTPS_STREAM_BARRIER()
+#endif
+
+/************************** Function Prototypes *****************************/
+
+static void XUartPs_StreamRingInit(XUartPsRing *RingPtr, u8 *BufPtr,
+				   u32 Size);
+static u32 XUartPs_StreamFillFifo(XUartPs *InstancePtr, u32 MaxBytes);
+static void XUartPs_StreamKickTx(XUartPs *InstancePtr);
+static u32 XUartPs_StreamDrainFifo(XUartPs *InstancePtr);
+
+void XUartPs_StreamHandler(XUartPs *InstancePtr, u32 IsrStatus);
+
+/************************** Variable Definitions ****************************/
+
+/****************************************************************************/
+/**
+*
+* This function switches the driver to streaming mode. Any transfer of
+* XUartPs_Send() or XUartPs_Recv() which is in progress is stopped. The RX
+* FIFO threshold and RX timeout are programmed for bursts and the receive
+* interrupts are enabled. The handler set with XUartPs_SetHandler() is called
+* from the interrupt context with the following events:
+*
+* - XUARTPS_EVENT_RECV_DATA after a burst was moved into the RX ring
+* - XUARTPS_EVENT_RECV_TOUT after the RX line went idle
+* - XUARTPS_EVENT_SENT_DATA when the TX ring became empty
+* - XUARTPS_EVENT_RECV_ORERR when received bytes were dropped because the RX
+*   ring was full
+* - XUARTPS_EVENT_RECV_ERROR on overrun, framing, parity or break errors
+*
+* For the receive events EventData is the number of bytes available in the
+* RX ring. For XUARTPS_EVENT_RECV_ORERR it is the total number of dropped
+* bytes, and for XUARTPS_EVENT_RECV_ERROR the error bits of the interrupt
+* status.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+* @param	TxBufPtr is the storage of the TX ring.
+* @param	TxSize is the size of the TX ring, which must be a power of 2.
+* @param	RxBufPtr is the storage of the RX ring.
+* @param	RxSize is the size of the RX ring, which must be a power of 2.
+*
+* @return
+*		- XST_SUCCESS if streaming mode is started
+*		- XST_INVALID_PARAM if a ring size is not a power of 2
+*
+* @note		The interrupt handler of the driver must be connected to the
+*		interrupt system and the application handler set before this
+*		function is called.
+*
+*****************************************************************************/
+s32 XUartPs_StreamInit(XUartPs *InstancePtr, u8 *TxBufPtr, u32 TxSize,
+		       u8 *RxBufPtr, u32 RxSize)
+{
+	s32 Status = (s32)XST_INVALID_PARAM;
+	u32 IntrMask;
+
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(TxBufPtr != NULL);
+	Xil_AssertNonvoid(RxBufPtr != NULL);
+
+	if ((TxSize == 0U) || ((TxSize & (TxSize - 1U)) != 0U) ||
+	    (RxSize == 0U) || ((RxSize & (RxSize - 1U)) != 0U)) {
+		goto END;
+	}
+
+	/* Stop the interrupts and any buffer transfer in progress */
+	XUartPs_WriteReg(InstancePtr->Config.BaseAddress, XUARTPS_IDR_OFFSET,
+			 XUARTPS_IXR_MASK);
+	InstancePtr->SendBuffer.RemainingBytes = 0U;
+	InstancePtr->ReceiveBuffer.RemainingBytes = 0U;
+
+	XUartPs_StreamRingInit(&InstancePtr->TxRing, TxBufPtr, TxSize);
+	XUartPs_StreamRingInit(&InstancePtr->RxRing, RxBufPtr, RxSize);
+	InstancePtr->StreamStats.TxBytes = 0U;
+	InstancePtr->StreamStats.RxBytes = 0U;
+	InstancePtr->StreamStats.RxDropped = 0U;
+	InstancePtr->StreamStats.IntrCount = 0U;
+
+	/* Program the RX FIFO threshold and timeout for bursts */
+	XUartPs_SetFifoThreshold(InstancePtr, (u8)XUARTPS_STREAM_RX_TRIGGER);
+	XUartPs_SetRecvTimeout(InstancePtr, (u8)XUARTPS_STREAM_RX_TIMEOUT);
+
+	InstancePtr->IsStreaming = (u32)TRUE;
+
+	/* Clear stale events and enable the receive interrupts */
+	XUartPs_WriteReg(InstancePtr->Config.BaseAddress, XUARTPS_ISR_OFFSET,
+			 XUARTPS_IXR_MASK);
+	IntrMask = XUARTPS_STREAM_RX_IXR | XUARTPS_STREAM_ERR_IXR;
+	if (InstancePtr->Platform != XPLAT_ZYNQ_ULTRA_MP) {
+		/* Break detect interrupt is available only on Zynq UltraScale+ MP */
+		IntrMask &= ~(u32)XUARTPS_IXR_RBRK;
+	}
+	XUartPs_WriteReg(InstancePtr->Config.BaseAddress, XUARTPS_IER_OFFSET,
+			 IntrMask);
+
+	Status = (s32)XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* This function stops streaming mode. All interrupts of the device are
+* disabled. Bytes which are still in the TX ring are not sent, bytes which are
+* still in the RX ring remain readable until streaming mode is started again.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XUartPs_StreamStop(XUartPs *InstancePtr)
+{
+	/* Assert validates the input arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	XUartPs_WriteReg(InstancePtr->Config.BaseAddress, XUARTPS_IDR_OFFSET,
+			 XUARTPS_IXR_MASK);
+	InstancePtr->IsStreaming = (u32)FALSE;
+}
+
+/****************************************************************************/
+/**
+*
+* This function copies data into the TX ring and starts the transmission. It
+* does not wait, the data is sent from the interrupt handler.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+* @param	BufferPtr is a pointer to the data to be sent.
+* @param	NumBytes is the number of bytes to be sent.
+*
+* @return	The number of bytes copied into the TX ring, which is less than
+*		NumBytes if the ring is full.
+*
+* @note		None.
+*
+*****************************************************************************/
+u32 XUartPs_StreamWrite(XUartPs *InstancePtr, const u8 *BufferPtr,
+			u32 NumBytes)
+{
+	XUartPsRing *RingPtr;
+	u8 *SpanPtr;
+	u32 SpanLen;
+	u32 Copied = 0U;
+
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsStreaming == (u32)TRUE);
+	Xil_AssertNonvoid(BufferPtr != NULL);
+
+	RingPtr = &InstancePtr->TxRing;
+
+	/* The free space may wrap around the end of the ring */
+	while (Copied < NumBytes) {
+		SpanLen = XUartPs_StreamGetTxSpan(InstancePtr, &SpanPtr);
+		if (SpanLen == 0U) {
+			break;
+		}
+		if (SpanLen > (NumBytes - Copied)) {
+			SpanLen = NumBytes - Copied;
+		}
+		(void)memcpy(SpanPtr, &BufferPtr[Copied], SpanLen);
+		XUARTPS_STREAM_BARRIER();
+		RingPtr->Head += SpanLen;
+		Copied += SpanLen;
+	}
+
+	if (Copied != 0U) {
+		XUartPs_StreamKickTx(InstancePtr);
+	}
+
+	return Copied;
+}
+
+/****************************************************************************/
+/**
+*
+* This function copies received data out of the RX ring. It does not wait.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+* @param	BufferPtr is a pointer to the buffer for the received data.
+* @param	NumBytes is the size of the buffer.
+*
+* @return	The number of bytes copied, which is less than NumBytes if the
+*		RX ring holds fewer bytes.
+*
+* @note		None.
+*
+*****************************************************************************/
+u32 XUartPs_StreamRead(XUartPs *InstancePtr, u8 *BufferPtr, u32 NumBytes)
+{
+	u8 *SpanPtr;
+	u32 SpanLen;
+	u32 Copied = 0U;
+
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->RxRing.BufPtr != NULL);
+	Xil_AssertNonvoid(BufferPtr != NULL);
+
+	/* The received data may wrap around the end of the ring */
+	while (Copied < NumBytes) {
+		SpanLen = XUartPs_StreamGetRxSpan(InstancePtr, &SpanPtr);
+		if (SpanLen == 0U) {
+			break;
+		}
+		if (SpanLen > (NumBytes - Copied)) {
+			SpanLen = NumBytes - Copied;
+		}
+		(void)memcpy(&BufferPtr[Copied], SpanPtr, SpanLen);
+		XUartPs_StreamReleaseRx(InstancePtr, SpanLen);
+		Copied += SpanLen;
+	}
+
+	return Copied;
+}
+
+/****************************************************************************/
+/**
+*
+* This function returns the largest contiguous free region of the TX ring, so
+* that data can be produced in place. The data is sent once it is committed
+* with XUartPs_StreamCommitTx().
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+* @param	SpanPtr is updated with the start of the free region.
+*
+* @return	The size of the free region in bytes.
+*
+* @note		None.
+*
+*****************************************************************************/
+u32 XUartPs_StreamGetTxSpan(XUartPs *InstancePtr, u8 **SpanPtr)
+{
+	XUartPsRing *RingPtr;
+	u32 Head;
+	u32 Offset;
+	u32 Free;
+
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->TxRing.BufPtr != NULL);
+	Xil_AssertNonvoid(SpanPtr != NULL);
+
+	RingPtr = &InstancePtr->TxRing;
+	Head = RingPtr->Head;
+	Free = RingPtr->Mask + 1U - (Head - RingPtr->Tail);
+	Offset = Head & RingPtr->Mask;
+	if (Free > (RingPtr->Mask + 1U - Offset)) {
+		Free = RingPtr->Mask + 1U - Offset;
+	}
+	XUARTPS_STREAM_BARRIER();
+
+	*SpanPtr = &RingPtr->BufPtr[Offset];
+
+	return Free;
+}
+
+/****************************************************************************/
+/**
+*
+* This function commits data produced in the region returned by
+* XUartPs_StreamGetTxSpan() and starts the transmission.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+* @param	NumBytes is the number of bytes written into the region. It
+*		must not exceed the size returned by XUartPs_StreamGetTxSpan().
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XUartPs_StreamCommitTx(XUartPs *InstancePtr, u32 NumBytes)
+{
+	XUartPsRing *RingPtr;
+
+	/* Assert validates the input arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsStreaming == (u32)TRUE);
+
+	RingPtr = &InstancePtr->TxRing;
+	Xil_AssertVoid(NumBytes <=
+		       (RingPtr->Mask + 1U - (RingPtr->Head - RingPtr->Tail)));
+
+	if (NumBytes != 0U) {
+		XUARTPS_STREAM_BARRIER();
+		RingPtr->Head += NumBytes;
+		XUartPs_StreamKickTx(InstancePtr);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* This function returns the largest contiguous region of received data in
+* the RX ring, so that it can be consumed in place. The region stays valid
+* until it is released with XUartPs_StreamReleaseRx().
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+* @param	SpanPtr is updated with the start of the received data.
+*
+* @return	The size of the region in bytes.
+*
+* @note		None.
+*
+*****************************************************************************/
+u32 XUartPs_StreamGetRxSpan(XUartPs *InstancePtr, u8 **SpanPtr)
+{
+	XUartPsRing *RingPtr;
+	u32 Tail;
+	u32 Offset;
+	u32 Avail;
+
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->RxRing.BufPtr != NULL);
+	Xil_AssertNonvoid(SpanPtr != NULL);
+
+	RingPtr = &InstancePtr->RxRing;
+	Tail = RingPtr->Tail;
+	Avail = RingPtr->Head - Tail;
+	Offset = Tail & RingPtr->Mask;
+	if (Avail > (RingPtr->Mask + 1U - Offset)) {
+		Avail = RingPtr->Mask + 1U - Offset;
+	}
+	XUARTPS_STREAM_BARRIER();
+
+	*SpanPtr = &RingPtr->BufPtr[Offset];
+
+	return Avail;
+}
+
+/****************************************************************************/
+/**
+*
+* This function releases received data which has been consumed, so that the
+* space can be reused by the interrupt handler.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+* @param	NumBytes is the number of bytes consumed. It must not exceed
+*		the number of bytes in the RX ring.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XUartPs_StreamReleaseRx(XUartPs *InstancePtr, u32 NumBytes)
+{
+	XUartPsRing *RingPtr;
+
+	/* Assert validates the input arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->RxRing.BufPtr != NULL);
+
+	RingPtr = &InstancePtr->RxRing;
+	Xil_AssertVoid(NumBytes <= (RingPtr->Head - RingPtr->Tail));
+
+	XUARTPS_STREAM_BARRIER();
+	RingPtr->Tail += NumBytes;
+}
+
+/****************************************************************************/
+/**
+*
+* This function returns the number of received bytes in the RX ring.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+*
+* @return	The number of bytes which can be read.
+*
+* @note		None.
+*
+*****************************************************************************/
+u32 XUartPs_StreamGetRxAvailable(XUartPs *InstancePtr)
+{
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	return InstancePtr->RxRing.Head - InstancePtr->RxRing.Tail;
+}
+
+/****************************************************************************/
+/**
+*
+* This function returns the number of bytes in the TX ring which are not yet
+* written to the TX FIFO.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+*
+* @return	The number of bytes waiting to be sent.
+*
+* @note		Bytes already in the TX FIFO are not included. Use
+*		XUartPs_IsTransmitEmpty() to wait for them.
+*
+*****************************************************************************/
+u32 XUartPs_StreamGetTxPending(XUartPs *InstancePtr)
+{
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	return InstancePtr->TxRing.Head - InstancePtr->TxRing.Tail;
+}
+
+/****************************************************************************/
+/**
+*
+* This function returns the statistics of the streaming mode.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+* @param	StatsPtr is a pointer to the structure to be filled.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XUartPs_StreamGetStats(XUartPs *InstancePtr, XUartPsStreamStats *StatsPtr)
+{
+	/* Assert validates the input arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(StatsPtr != NULL);
+
+	StatsPtr->TxBytes = InstancePtr->StreamStats.TxBytes;
+	StatsPtr->RxBytes = InstancePtr->StreamStats.RxBytes;
+	StatsPtr->RxDropped = InstancePtr->StreamStats.RxDropped;
+	StatsPtr->IntrCount = InstancePtr->StreamStats.IntrCount;
+}
+
+/****************************************************************************/
+/*
+*
+* This function handles the interrupts in streaming mode. It is called by
+* XUartPs_InterruptHandler() with the pending and enabled interrupts, which
+* have already been cleared.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+* @param	IsrStatus is the interrupt status to be handled.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XUartPs_StreamHandler(XUartPs *InstancePtr, u32 IsrStatus)
+{
+	u32 Dropped = InstancePtr->StreamStats.RxDropped;
+	u32 Event;
+
+	InstancePtr->StreamStats.IntrCount++;
+
+	/* Report receive errors before the data they belong to */
+	if ((IsrStatus & XUARTPS_STREAM_ERR_IXR) != (u32)0) {
+		InstancePtr->Handler(InstancePtr->CallBackRef,
+				     XUARTPS_EVENT_RECV_ERROR,
+				     IsrStatus & XUARTPS_STREAM_ERR_IXR);
+	}
+
+	if ((IsrStatus & XUARTPS_STREAM_RX_IXR) != (u32)0) {
+		(void)XUartPs_StreamDrainFifo(InstancePtr);
+
+		if (InstancePtr->StreamStats.RxDropped != Dropped) {
+			InstancePtr->Handler(InstancePtr->CallBackRef,
+					     XUARTPS_EVENT_RECV_ORERR,
+					     InstancePtr->StreamStats.RxDropped);
+		}
+
+		if ((IsrStatus & (u32)XUARTPS_IXR_TOUT) != (u32)0) {
+			Event = XUARTPS_EVENT_RECV_TOUT;
+		} else {
+			Event = XUARTPS_EVENT_RECV_DATA;
+		}
+		InstancePtr->Handler(InstancePtr->CallBackRef, Event,
+				     InstancePtr->RxRing.Head -
+				     InstancePtr->RxRing.Tail);
+	}
+
+	if ((IsrStatus & (u32)XUARTPS_IXR_TXEMPTY) != (u32)0) {
+		if (InstancePtr->TxRing.Head == InstancePtr->TxRing.Tail) {
+			/* Nothing more to send, stop the TX empty interrupt */
+			XUartPs_WriteReg(InstancePtr->Config.BaseAddress,
+					 XUARTPS_IDR_OFFSET,
+					 (u32)XUARTPS_IXR_TXEMPTY);
+			InstancePtr->Handler(InstancePtr->CallBackRef,
+					     XUARTPS_EVENT_SENT_DATA,
+					     InstancePtr->StreamStats.TxBytes);
+		} else {
+			/* The TX FIFO is empty, fill it in one burst */
+			(void)XUartPs_StreamFillFifo(InstancePtr,
+						     XUARTPS_FIFO_DEPTH);
+		}
+	}
+}
+
+/****************************************************************************/
+/*
+*
+* This function initializes a ring of the streaming mode.
+*
+* @param	RingPtr is a pointer to the ring.
+* @param	BufPtr is the storage of the ring.
+* @param	Size is the size of the ring, a power of 2.
+*
+* @return	None.
+*
+*****************************************************************************/
+static void XUartPs_StreamRingInit(XUartPsRing *RingPtr, u8 *BufPtr,
+				   u32 Size)
+{
+	RingPtr->BufPtr = BufPtr;
+	RingPtr->Mask = Size - 1U;
+	RingPtr->Head = 0U;
+	RingPtr->Tail = 0U;
+}
+
+/****************************************************************************/
+/*
+*
+* This function writes bytes from the TX ring into the TX FIFO. Up to MaxBytes
+* bytes are written without checking the FIFO status, the remaining ones only
+* while the FIFO is not full.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+* @param	MaxBytes is the number of bytes known to fit into the TX FIFO.
+*
+* @return	The number of bytes written.
+*
+*****************************************************************************/
+static u32 XUartPs_StreamFillFifo(XUartPs *InstancePtr, u32 MaxBytes)
+{
+	XUartPsRing *RingPtr = &InstancePtr->TxRing;
+	u32 Tail = RingPtr->Tail;
+	u32 Pending = RingPtr->Head - Tail;
+	u32 Count = 0U;
+
+	XUARTPS_STREAM_BARRIER();
+
+	/* Burst the bytes which are known to fit */
+	while ((Count < Pending) && (Count < MaxBytes)) {
+		XUartPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 XUARTPS_FIFO_OFFSET,
+				 (u32)RingPtr->BufPtr[(Tail + Count) &
+						     RingPtr->Mask]);
+		Count++;
+	}
+
+	/* Top up the FIFO while it has space */
+	while ((Count < Pending) &&
+	       (!XUartPs_IsTransmitFull(InstancePtr->Config.BaseAddress))) {
+		XUartPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 XUARTPS_FIFO_OFFSET,
+				 (u32)RingPtr->BufPtr[(Tail + Count) &
+						     RingPtr->Mask]);
+		Count++;
+	}
+
+	XUARTPS_STREAM_BARRIER();
+	RingPtr->Tail = Tail + Count;
+	InstancePtr->StreamStats.TxBytes += Count;
+
+	return Count;
+}
+
+/****************************************************************************/
+/*
+*
+* This function starts sending the TX ring from the application context. The
+* TX empty interrupt is disabled while the FIFO is filled, so that the
+* interrupt handler does not write to the FIFO at the same time, and enabled
+* again afterwards so that the interrupt handler continues sending.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+*
+* @return	None.
+*
+*****************************************************************************/
+static void XUartPs_StreamKickTx(XUartPs *InstancePtr)
+{
+	u32 BaseAddress = InstancePtr->Config.BaseAddress;
+	u32 IsEmpty;
+
+	XUartPs_WriteReg(BaseAddress, XUARTPS_IDR_OFFSET,
+			 (u32)XUARTPS_IXR_TXEMPTY);
+
+	do {
+		(void)XUartPs_StreamFillFifo(InstancePtr, 0U);
+		XUartPs_WriteReg(BaseAddress, XUARTPS_ISR_OFFSET,
+				 (u32)XUARTPS_IXR_TXEMPTY);
+		/*
+		 * If the FIFO ran empty before the event was cleared, the
+		 * event is lost, so fill it again.
+		 */
+		IsEmpty = (u32)XUartPs_IsTransmitEmpty(InstancePtr);
+	} while ((IsEmpty != (u32)FALSE) &&
+		 (InstancePtr->TxRing.Head != InstancePtr->TxRing.Tail));
+
+	if (IsEmpty == (u32)FALSE) {
+		XUartPs_WriteReg(BaseAddress, XUARTPS_IER_OFFSET,
+				 (u32)XUARTPS_IXR_TXEMPTY);
+	}
+}
+
+/****************************************************************************/
+/*
+*
+* This function reads the RX FIFO into the RX ring until the FIFO is empty.
+* The status register is checked before every byte, since the interrupt
+* status does not tell how many bytes are still in the FIFO when the handler
+* runs. Bytes which do not fit into the RX ring are dropped and counted.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+*
+* @return	The number of bytes added to the RX ring.
+*
+*****************************************************************************/
+static u32 XUartPs_StreamDrainFifo(XUartPs *InstancePtr)
+{
+	XUartPsRing *RingPtr = &InstancePtr->RxRing;
+	u32 BaseAddress = InstancePtr->Config.BaseAddress;
+	u32 Head = RingPtr->Head;
+	u32 Free = RingPtr->Mask + 1U - (Head - RingPtr->Tail);
+	u32 Count = 0U;
+	u32 Dropped = 0U;
+	u8 Data;
+
+	while ((XUartPs_ReadReg(BaseAddress, XUARTPS_SR_OFFSET) &
+		(u32)XUARTPS_SR_RXEMPTY) == (u32)0) {
+		Data = (u8)XUartPs_ReadReg(BaseAddress, XUARTPS_FIFO_OFFSET);
+		if (Count < Free) {
+			RingPtr->BufPtr[(Head + Count) & RingPtr->Mask] = Data;
+			Count++;
+		} else {
+			Dropped++;
+		}
+	}
+
+	XUARTPS_STREAM_BARRIER();
+	RingPtr->Head = Head + Count;
+	InstancePtr->StreamStats.RxBytes += Count;
+	InstancePtr->StreamStats.RxDropped += Dropped;
+
+	return Count;
+}
+/** @} */
@@ -17,6 +17,7 @@
 * Ver  Who  Date      Changes
 * ---  ---  --------- -----------------------------------------------
 * 1.0  sg   09/18/17  First Release
+* 1.10 ag   10/18/26  Added XUartPsv_TrySendByte function
 *
 * </pre>
 *
@@ -59,6 +60,34 @@ void XUartPsv_SendByte(UINTPTR BaseAddress, u8 Data)
 	XUartPsv_WriteReg(BaseAddress, XUARTPSV_UARTDR_OFFSET, (u32)Data);
 }
 
+/*****************************************************************************/
+/**
+*
+* This function sends one byte using the device if there is space in the TX
+* FIFO. Unlike XUartPsv_SendByte, it does not wait, so it can be used to drain
+* a software buffer from the TX empty interrupt handler or an idle loop.
+*
+* @param	BaseAddress contains the base address of the device.
+* @param	Data contains the byte to be sent.
+*
+* @return	TRUE if the byte was written to the TX FIFO, FALSE if the TX
+*		FIFO is full.
+*
+* @note 	None.
+*
+******************************************************************************/
+u32 XUartPsv_TrySendByte(UINTPTR BaseAddress, u8 Data)
+{
+	u32 Status = (u32)FALSE;
+
+	if (!XUartPsv_IsTransmitFull(BaseAddress)) {
+		XUartPsv_WriteReg(BaseAddress, XUARTPSV_UARTDR_OFFSET, (u32)Data);
+		Status = (u32)TRUE;
+	}
+
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 *
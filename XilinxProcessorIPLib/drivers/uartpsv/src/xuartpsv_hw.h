@@ -21,6 +21,7 @@
 * ---  ---  --------- -----------------------------------------------
 * 1.0  sg   09/18/17  First Release
 * 1.2  rna  01/20/20  Add UARTRSR register bit
+* 1.10 ag   10/18/26  Added XUartPsv_TrySendByte prototype
 * </pre>
 *
 ******************************************************************************/
@@ -559,6 +560,8 @@ extern "C" {
 
 void XUartPsv_SendByte(UINTPTR BaseAddress, u8 Data);
 
+u32 XUartPsv_TrySendByte(UINTPTR BaseAddress, u8 Data);
+
 u8 XUartPsv_RecvByte(UINTPTR BaseAddress);
 
 void XUartPsv_ResetHw(UINTPTR BaseAddress);
@@ -100,6 +100,7 @@
 * 4.50  kp    13/07/21   Added new 3 planar video format Y_U_V8
 * 4.60  kp    12/03/21   Added new 3 planar video format Y_U_V10
 * 4.70  pg    05/23/23   Added new 3 planar video format Y_U_V8_420.
+* 4.80  ag    10/18/26   Added frame buffer pool support.
 * </pre>
 *
 ******************************************************************************/
@@ -112,6 +113,7 @@ extern "C" {
 
 #include "xvidc.h"
 #include "xv_frmbufrd.h"
+#include "xvidc_fbpool.h"
 
 /************************** Constant Definitions *****************************/
 #define XVFRMBUFRD_IRQ_DONE_MASK            (0x01)
@@ -172,6 +174,8 @@ typedef struct {
                                 callback */
 
     XVidC_VideoStream Stream;    /**< Output AXIS */
+
+    XVidC_FbPool *Pool;          /**< Buffer pool advanced on ap_ready */
 }XV_FrmbufRd_l2;
 
 /************************** Macros Definitions *******************************/
@@ -711,6 +715,7 @@ int XVFrmbufRd_SetCallback(XV_FrmbufRd_l2 *InstancePtr,
                            void *CallbackRef);
 void XVFrmbufRd_InterruptEnable(XV_FrmbufRd_l2 *InstancePtr, u32 IrqMask);
 void XVFrmbufRd_InterruptDisable(XV_FrmbufRd_l2 *InstancePtr, u32 IrqMask);
+int XVFrmbufRd_SetBufferPool(XV_FrmbufRd_l2 *InstancePtr, XVidC_FbPool *Pool);
 
 #ifdef __cplusplus
 }
@@ -24,6 +24,8 @@
 * 4.20  pg    01/31/20   Removed Frmbuf start function from Interrupt handler.
 * 4.50  pg    01/07/21   Added new registers to support fid_out interlace solution.
 *						Interrupt count support for throughput measurement.
+* 4.80  ag    10/18/26   Program the next pool buffer on ap_ready
+*       ag    10/18/26   Check the pool buffer before taking it on attach
 * </pre>
 *
 ******************************************************************************/
@@ -31,6 +33,10 @@
 /***************************** Include Files *********************************/
 #include "xv_frmbufrd_l2.h"
 
+/************************** Function Prototypes ******************************/
+static int XVFrmbufRd_SetPoolBuffer(XV_FrmbufRd_l2 *InstancePtr,
+		const XVidC_FbBuffer *BufPtr);
+
 
 /*****************************************************************************/
 /**
@@ -112,6 +118,7 @@ int XVFrmbufRd_SetCallback(XV_FrmbufRd_l2 *InstancePtr, u32 HandlerType,
 void XVFrmbufRd_InterruptHandler(void *InstancePtr)
 {
 	XV_FrmbufRd_l2 *FrmbufRdPtr = (XV_FrmbufRd_l2 *)InstancePtr;
+	const XVidC_FbBuffer *BufPtr;
 	u32 Status;
 
 	/* Verify arguments */
@@ -135,10 +142,105 @@ void XVFrmbufRd_InterruptHandler(void *InstancePtr)
 	if(Status & XVFRMBUFRD_IRQ_READY_MASK) {
 		/* Clear the interrupt */
 		XV_frmbufrd_InterruptClear(&FrmbufRdPtr->FrmbufRd, XVFRMBUFRD_IRQ_READY_MASK);
+		/* Release the frame read last and program the next pool buffer */
+		if(FrmbufRdPtr->Pool) {
+			BufPtr = XVidC_FbPoolConsumerNext(FrmbufRdPtr->Pool);
+			if(BufPtr) {
+				XVFrmbufRd_SetPoolBuffer(FrmbufRdPtr, BufPtr);
+			}
+		}
 		//Call user registered callback function, if any
 		if(FrmbufRdPtr->FrameReadyCallback) {
 			FrmbufRdPtr->FrameReadyCallback(FrmbufRdPtr->CallbackReadyRef);
 		}
 	}
 }
+
+/*****************************************************************************/
+/**
+ *
+ * This function attaches a frame buffer pool to the core. If the producer
+ * already completed a frame, the frame is taken from the pool with
+ * XVidC_FbPoolConsumerNext() and programmed right away. From then on the
+ * interrupt handler releases the frame read last and programs the next
+ * buffer of the pool on ap_ready, before the ready callback is invoked.
+ *
+ * @param    InstancePtr is a pointer to the Frame Buffer Read core instance.
+ * @param    Pool is a pointer to a pool initialized for the current memory
+ *           format, or NULL to detach the current pool.
+ *
+ * @return
+ *           - XST_SUCCESS if the pool was attached or detached.
+ *           - XVFRMBUFRD_ERR_MEM_ADDR_MISALIGNED if a pool buffer does not
+ *             meet the core alignment. The pool is not attached and is left
+ *             unchanged.
+ *
+ * @note     The core must be stopped when a pool is attached. Taking the
+ *           frame advances the consumer side of the pool: the frame leaves
+ *           the queue, is counted as consumed and with DROP_OLDEST older
+ *           queued frames are dropped. Until the producer completes a frame
+ *           the current buffer address is kept. The ap_ready interrupt must
+ *           be enabled for the pool to advance.
+ *
+ ******************************************************************************/
+int XVFrmbufRd_SetBufferPool(XV_FrmbufRd_l2 *InstancePtr, XVidC_FbPool *Pool)
+{
+	const XVidC_FbBuffer *BufPtr;
+	int Status = XST_SUCCESS;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	InstancePtr->Pool = NULL;
+
+	if (Pool != NULL) {
+		/* Check the alignment before the pool is advanced */
+		BufPtr = XVidC_FbPoolConsumerPeek(Pool);
+		if (BufPtr != NULL) {
+			Status = XVFrmbufRd_SetPoolBuffer(InstancePtr, BufPtr);
+		}
+		if (Status == XST_SUCCESS) {
+			/* Take the frame so the producer cannot reuse it */
+			BufPtr = XVidC_FbPoolConsumerNext(Pool);
+			if (BufPtr != NULL) {
+				Status = XVFrmbufRd_SetPoolBuffer(InstancePtr,
+						BufPtr);
+			}
+		}
+		if (Status == XST_SUCCESS) {
+			InstancePtr->Pool = Pool;
+		}
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function programs the plane addresses of a pool buffer.
+ *
+ * @param    InstancePtr is a pointer to the Frame Buffer Read core instance.
+ * @param    BufPtr is a pointer to the pool buffer.
+ *
+ * @return   XST_SUCCESS or the error of the failing address setter.
+ *
+ * @note     None.
+ *
+ ******************************************************************************/
+static int XVFrmbufRd_SetPoolBuffer(XV_FrmbufRd_l2 *InstancePtr,
+		const XVidC_FbBuffer *BufPtr)
+{
+	int Status;
+
+	Status = XVFrmbufRd_SetBufferAddr(InstancePtr, BufPtr->Addr[0]);
+	if ((Status == XST_SUCCESS) && (BufPtr->Addr[1] != 0)) {
+		Status = XVFrmbufRd_SetChromaBufferAddr(InstancePtr, BufPtr->Addr[1]);
+	}
+	if ((Status == XST_SUCCESS) && (BufPtr->Addr[2] != 0)) {
+		Status = XVFrmbufRd_SetVChromaBufferAddr(InstancePtr, BufPtr->Addr[2]);
+	}
+
+	return Status;
+}
 /** @} */
@@ -100,6 +100,7 @@
 * 4.50  kp    12/07/21   Added new 3 planar video format Y_U_V8.
 * 4.60  kp    10/27/21   Added new 3 planar video format Y_U_V10.
 * 4.70  pg    05/23/23   Added new 3 planar video format Y_U_V8_420.
+* 4.80  ag    10/18/26   Added frame buffer pool support.
 * </pre>
 *
 ******************************************************************************/
@@ -112,6 +113,7 @@ extern "C" {
 
 #include "xvidc.h"
 #include "xv_frmbufwr.h"
+#include "xvidc_fbpool.h"
 
 /************************** Constant Definitions *****************************/
 #define XVFRMBUFWR_IRQ_DONE_MASK            (0x01)
@@ -172,6 +174,8 @@ typedef struct {
                                 callback */
 
     XVidC_VideoStream Stream;    /**< Input AXIS */
+
+    XVidC_FbPool *Pool;          /**< Buffer pool advanced on ap_ready */
 }XV_FrmbufWr_l2;
 
 /************************** Macros Definitions *******************************/
@@ -659,6 +663,7 @@ int XVFrmbufWr_SetCallback(XV_FrmbufWr_l2 *InstancePtr,
                            void *CallbackRef);
 void XVFrmbufWr_InterruptEnable(XV_FrmbufWr_l2 *InstancePtr, u32 IrqMask);
 void XVFrmbufWr_InterruptDisable(XV_FrmbufWr_l2 *InstancePtr, u32 IrqMask);
+int XVFrmbufWr_SetBufferPool(XV_FrmbufWr_l2 *InstancePtr, XVidC_FbPool *Pool);
 
 #ifdef __cplusplus
 }
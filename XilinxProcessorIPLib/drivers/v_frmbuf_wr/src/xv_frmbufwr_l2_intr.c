@@ -22,6 +22,7 @@
 * 1.00  vyc   04/05/17   Initial Release
 * 3.00  vyc   04/04/18   Add interrupt handler for ap_ready
 * 4.20  pg    01/31/20   Removed Frmbufwr_start function from Interrupt handler
+* 4.80  ag    10/18/26   Program the next pool buffer on ap_ready
 * </pre>
 *
 ******************************************************************************/
@@ -29,6 +30,10 @@
 /***************************** Include Files *********************************/
 #include "xv_frmbufwr_l2.h"
 
+/************************** Function Prototypes ******************************/
+static int XVFrmbufWr_SetPoolBuffer(XV_FrmbufWr_l2 *InstancePtr,
+                                    const XVidC_FbBuffer *BufPtr);
+
 
 /*****************************************************************************/
 /**
@@ -134,10 +139,90 @@ void XVFrmbufWr_InterruptHandler(void *InstancePtr)
   if(Status & XVFRMBUFWR_IRQ_READY_MASK) {
     /* Clear the interrupt */
     XV_frmbufwr_InterruptClear(&FrmbufWrPtr->FrmbufWr, XVFRMBUFWR_IRQ_READY_MASK);
+    /* Queue the completed frame and program the next pool buffer */
+    if(FrmbufWrPtr->Pool) {
+      XVFrmbufWr_SetPoolBuffer(FrmbufWrPtr,
+                               XVidC_FbPoolProducerNext(FrmbufWrPtr->Pool));
+    }
     //Call user registered callback function, if any
     if(FrmbufWrPtr->FrameReadyCallback) {
           FrmbufWrPtr->FrameReadyCallback(FrmbufWrPtr->CallbackReadyRef);
     }
   }
 }
+
+/*****************************************************************************/
+/**
+*
+* This function attaches a frame buffer pool to the core. The first producer
+* buffer of the pool is programmed right away. From then on the interrupt
+* handler hands every completed frame to the pool and programs the next
+* buffer on ap_ready, before the ready callback is invoked.
+*
+* @param    InstancePtr is a pointer to the Frame Buffer Write core instance.
+* @param    Pool is a pointer to a pool initialized for the current memory
+*           format, or NULL to detach the current pool.
+*
+* @return
+*           - XST_SUCCESS if the pool was attached or detached.
+*           - XVFRMBUFWR_ERR_MEM_ADDR_MISALIGNED if a pool buffer does not
+*             meet the core alignment. The pool is not attached and is
+*             reset.
+*
+* @note     The core must be stopped when a pool is attached. Programming
+*           the first buffer advances the producer side of the pool with
+*           XVidC_FbPoolProducerNext(). The ap_ready interrupt must be
+*           enabled for the pool to advance.
+*
+******************************************************************************/
+int XVFrmbufWr_SetBufferPool(XV_FrmbufWr_l2 *InstancePtr, XVidC_FbPool *Pool)
+{
+  int Status = XST_SUCCESS;
+
+  /* Verify arguments. */
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  InstancePtr->Pool = NULL;
+
+  if (Pool != NULL) {
+    Status = XVFrmbufWr_SetPoolBuffer(InstancePtr,
+                                      XVidC_FbPoolProducerNext(Pool));
+    if (Status == XST_SUCCESS) {
+      InstancePtr->Pool = Pool;
+    } else {
+      XVidC_FbPoolReset(Pool);
+    }
+  }
+
+  return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function programs the plane addresses of a pool buffer.
+*
+* @param    InstancePtr is a pointer to the Frame Buffer Write core instance.
+* @param    BufPtr is a pointer to the pool buffer.
+*
+* @return   XST_SUCCESS or the error of the failing address setter.
+*
+* @note     None.
+*
+******************************************************************************/
+static int XVFrmbufWr_SetPoolBuffer(XV_FrmbufWr_l2 *InstancePtr,
+                                    const XVidC_FbBuffer *BufPtr)
+{
+  int Status;
+
+  Status = XVFrmbufWr_SetBufferAddr(InstancePtr, BufPtr->Addr[0]);
+  if ((Status == XST_SUCCESS) && (BufPtr->Addr[1] != 0)) {
+    Status = XVFrmbufWr_SetChromaBufferAddr(InstancePtr, BufPtr->Addr[1]);
+  }
+  if ((Status == XST_SUCCESS) && (BufPtr->Addr[2] != 0)) {
+    Status = XVFrmbufWr_SetVChromaBufferAddr(InstancePtr, BufPtr->Addr[2]);
+  }
+
+  return Status;
+}
 /** @} */
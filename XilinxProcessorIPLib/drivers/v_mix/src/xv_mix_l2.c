@@ -49,6 +49,9 @@
 * 6.00  pg    01/10/20   Add Colorimetry feature.
 *                        Program Mixer CSC registers to do color conversion
 *                        from YUV to RGB and RGB to YUV.
+* 6.50  ag    10/18/26   Add shadow state layer update transactions. Staged
+*                        layer settings are validated once and only changed
+*                        registers are written, optionally on frame done.
 * </pre>
 *
 ******************************************************************************/
@@ -94,6 +97,10 @@ static void SetPowerOnDefaultState(XV_Mix_l2 *InstancePtr);
 static int IsWindowValid(XVidC_VideoStream *Strm,
                          XVidC_VideoWindow *Win,
                          XVMix_Scalefactor ScaleFactor);
+static u32 ShadowSlot(u32 LayerId);
+static void ReadShadowFromHw(XV_Mix_l2 *InstancePtr, XVMix_Shadow *Shadow);
+static int ValidateStagedLayer(XV_Mix_l2 *InstancePtr, u32 LayerId);
+static void WriteStagedLayers(XV_Mix_l2 *InstancePtr);
 
 /*****************************************************************************/
 /**
@@ -374,6 +381,9 @@ int XVMix_LayerEnable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
   Xil_AssertNonvoid((LayerId >= XVMIX_LAYER_MASTER) &&
                     (LayerId < XVMIX_LAYER_LAST));
 
+  /* Registers written outside of a transaction */
+  InstancePtr->Committed.Synced = FALSE;
+
   MixPtr = &InstancePtr->Mix;
   NumLayers = XVMix_GetNumLayers(InstancePtr);
 
@@ -416,6 +426,9 @@ int XVMix_LayerDisable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
   Xil_AssertNonvoid((LayerId >= XVMIX_LAYER_MASTER) &&
                     (LayerId < XVMIX_LAYER_LAST));
 
+  /* Registers written outside of a transaction */
+  InstancePtr->Committed.Synced = FALSE;
+
   MixPtr = &InstancePtr->Mix;
   NumLayers = XVMix_GetNumLayers(InstancePtr);
 
@@ -550,6 +563,9 @@ int XVMix_SetLayerWindow(XV_Mix_l2 *InstancePtr,
       return(XVMIX_ERR_LAYER_WINDOW_INVALID);
   }
 
+  /* Registers written outside of a transaction */
+  InstancePtr->Committed.Synced = FALSE;
+
   MixPtr = &InstancePtr->Mix;
 
   switch(LayerId) {
@@ -766,6 +782,9 @@ int XVMix_MoveLayerWindow(XV_Mix_l2 *InstancePtr,
       return(XVMIX_ERR_LAYER_WINDOW_INVALID);
   }
 
+  /* Registers written outside of a transaction */
+  InstancePtr->Committed.Synced = FALSE;
+
   MixPtr = &InstancePtr->Mix;
 
   switch(LayerId) {
@@ -842,6 +861,9 @@ int XVMix_SetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
       return(XVMIX_ERR_LAYER_WINDOW_INVALID);
   }
 
+  /* Registers written outside of a transaction */
+  InstancePtr->Committed.Synced = FALSE;
+
   MixPtr = &InstancePtr->Mix;
 
   switch(LayerId) {
@@ -938,6 +960,9 @@ int XVMix_SetLayerAlpha(XV_Mix_l2 *InstancePtr,
                     (LayerId <= XVMIX_LAYER_LOGO));
   Xil_AssertNonvoid(Alpha <= XVMIX_ALPHA_MAX);
 
+  /* Registers written outside of a transaction */
+  InstancePtr->Committed.Synced = FALSE;
+
   MixPtr = &InstancePtr->Mix;
 
   switch(LayerId) {
@@ -1136,6 +1161,9 @@ int XVMix_SetLayerBufferAddr(XV_Mix_l2 *InstancePtr,
                     (LayerId < XVMIX_LAYER_LOGO));
   Xil_AssertNonvoid(Addr != 0);
 
+  /* Registers written outside of a transaction */
+  InstancePtr->Committed.Synced = FALSE;
+
   MixPtr = &InstancePtr->Mix;
 
   if(LayerId < XVMix_GetNumLayers(InstancePtr)) {
@@ -1222,6 +1250,9 @@ int XVMix_SetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
                     (LayerId < XVMIX_LAYER_LOGO));
   Xil_AssertNonvoid(Addr != 0);
 
+  /* Registers written outside of a transaction */
+  InstancePtr->Committed.Synced = FALSE;
+
   MixPtr = &InstancePtr->Mix;
 
   if(LayerId < XVMix_GetNumLayers(InstancePtr)) {
@@ -1490,6 +1521,584 @@ int XVMix_LoadLogoPixelAlpha(XV_Mix_l2 *InstancePtr,
   return(Status);
 }
 
+/*****************************************************************************/
+/**
+* This function returns the shadow slot used for the specified layer
+*
+* @param  LayerId is the layer id
+*
+* @return Index into XVMix_Shadow Layer array
+*
+******************************************************************************/
+static u32 ShadowSlot(u32 LayerId)
+{
+  return((LayerId == XVMIX_LAYER_LOGO) ? XVMIX_SHADOW_LOGO : LayerId);
+}
+
+/*****************************************************************************/
+/**
+* This function reads the layer registers of the core into a shadow
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Shadow is the shadow to be filled
+*
+* @return None
+*
+* @note   Registers of features not present in the IP are left as 0
+*
+******************************************************************************/
+static void ReadShadowFromHw(XV_Mix_l2 *InstancePtr, XVMix_Shadow *Shadow)
+{
+  XV_mix *MixPtr;
+  XVMix_LayerShadow *Slot;
+  UINTPTR Base;
+  u32 LayerId, Offset;
+
+  MixPtr = &InstancePtr->Mix;
+  Base   = MixPtr->Config.BaseAddress;
+
+  memset(Shadow, 0, sizeof(XVMix_Shadow));
+  Shadow->LayerEnable = XV_mix_Get_HwReg_layerEnable(MixPtr);
+
+  for(LayerId=XVMIX_LAYER_1; LayerId<XVMix_GetNumLayers(InstancePtr); ++LayerId) {
+    Slot   = &Shadow->Layer[LayerId];
+    Offset = LayerId*XVMIX_REG_OFFSET;
+
+    Slot->Win.StartX = XV_mix_ReadReg(Base,
+                        (XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTX_0_DATA+Offset));
+    Slot->Win.StartY = XV_mix_ReadReg(Base,
+                        (XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTY_0_DATA+Offset));
+    Slot->Win.Width  = XV_mix_ReadReg(Base,
+                        (XV_MIX_CTRL_ADDR_HWREG_LAYERWIDTH_0_DATA+Offset));
+    Slot->Win.Height = XV_mix_ReadReg(Base,
+                        (XV_MIX_CTRL_ADDR_HWREG_LAYERHEIGHT_0_DATA+Offset));
+
+    if(XVMix_IsAlphaEnabled(InstancePtr, LayerId)) {
+      Slot->Alpha = XV_mix_ReadReg(Base,
+                        (XV_MIX_CTRL_ADDR_HWREG_LAYERALPHA_0_DATA+Offset));
+    }
+    if(XVMix_IsScalingEnabled(InstancePtr, LayerId)) {
+      Slot->Scale = XV_mix_ReadReg(Base,
+                        (XV_MIX_CTRL_ADDR_HWREG_LAYERSCALEFACTOR_0_DATA+Offset));
+    }
+    if(!XVMix_IsLayerInterfaceStream(InstancePtr, LayerId)) {
+      Slot->Stride = XV_mix_ReadReg(Base,
+                        (XV_MIX_CTRL_ADDR_HWREG_LAYERSTRIDE_0_DATA+Offset));
+      Offset = (LayerId-1)*XVMIX_REG_OFFSET;
+      Slot->BufAddr = XV_mix_ReadReg(Base,
+                        (XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA+Offset));
+      Slot->ChromaBufAddr = XV_mix_ReadReg(Base,
+                        (XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA+Offset));
+    }
+  }
+
+  if(XVMix_IsLogoEnabled(InstancePtr)) {
+    Slot = &Shadow->Layer[XVMIX_SHADOW_LOGO];
+
+    Slot->Win.StartX = XV_mix_Get_HwReg_logoStartX(MixPtr);
+    Slot->Win.StartY = XV_mix_Get_HwReg_logoStartY(MixPtr);
+    Slot->Win.Width  = XV_mix_Get_HwReg_logoWidth(MixPtr);
+    Slot->Win.Height = XV_mix_Get_HwReg_logoHeight(MixPtr);
+    Slot->Alpha      = XV_mix_Get_HwReg_logoAlpha(MixPtr);
+    Slot->Scale      = XV_mix_Get_HwReg_logoScaleFactor(MixPtr);
+  }
+  Shadow->Synced = TRUE;
+}
+
+/*****************************************************************************/
+/**
+* This function starts a layer update transaction. The staging shadow is
+* loaded with the last committed layer settings and subsequent
+* XVMix_StageLayer*() calls modify it without accessing the core.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return None
+*
+* @note   If a frame synchronous commit is still pending it is not applied
+*         by the interrupt handler anymore. Its staged settings are kept and
+*         become part of the new transaction.
+*
+******************************************************************************/
+void XVMix_BeginUpdate(XV_Mix_l2 *InstancePtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  if(InstancePtr->UpdatePending) {
+    InstancePtr->UpdatePending = FALSE;
+    return;
+  }
+
+  if(!InstancePtr->Committed.Synced) {
+    ReadShadowFromHw(InstancePtr, &InstancePtr->Committed);
+  }
+  InstancePtr->Staged = InstancePtr->Committed;
+  InstancePtr->Staged.Dirty = 0;
+}
+
+/*****************************************************************************/
+/**
+* This function stages the enable state of the specified layer
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer to be updated. To stage all layers use layer id
+*         XVMIX_LAYER_ALL
+* @param  Enable is TRUE to enable and FALSE to disable the layer
+*
+* @return None
+*
+******************************************************************************/
+void XVMix_StageLayerEnable(XV_Mix_l2 *InstancePtr,
+                            XVMix_LayerId LayerId,
+                            u32 Enable)
+{
+  XVMix_Shadow *Staged;
+
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid((LayerId >= XVMIX_LAYER_MASTER) &&
+                 (LayerId < XVMIX_LAYER_LAST));
+
+  Staged = &InstancePtr->Staged;
+
+  if(LayerId == XVMIX_LAYER_ALL) {
+    Staged->LayerEnable = (Enable ? XVMIX_MASK_ENABLE_ALL_LAYERS :
+                                    XVMIX_MASK_DISABLE_ALL_LAYERS);
+  } else {
+    if(Enable) {
+      Staged->LayerEnable |= (1<<LayerId);
+    } else {
+      Staged->LayerEnable &= ~(1<<LayerId);
+    }
+    Staged->Dirty |= (1<<LayerId);
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function stages the window coordinates of the specified layer
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer for which window coordinates are to be set
+* @param  Win is the window coordinates in pixels
+* @param  StrideInBytes is the stride of the requested window
+*         (Applicable only when layer type is Memory)
+*
+* @return None
+*
+* @note   Applicable only for Layer1-16 and Logo Layer. See
+*         XVMix_SetLayerWindow() for the stride requirements
+*
+******************************************************************************/
+void XVMix_StageLayerWindow(XV_Mix_l2 *InstancePtr,
+                            XVMix_LayerId LayerId,
+                            XVidC_VideoWindow *Win,
+                            u32 StrideInBytes)
+{
+  XVMix_LayerShadow *Slot;
+
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid(Win != NULL);
+  Xil_AssertVoid(((LayerId > XVMIX_LAYER_MASTER) &&
+                  (LayerId <= XVMIX_LAYER_16)) ||
+                 (LayerId == XVMIX_LAYER_LOGO));
+  Xil_AssertVoid((Win->StartX % InstancePtr->Mix.Config.PixPerClk) == 0);
+  Xil_AssertVoid((Win->Width  % InstancePtr->Mix.Config.PixPerClk) == 0);
+
+  Slot = &InstancePtr->Staged.Layer[ShadowSlot(LayerId)];
+  Slot->Win = *Win;
+  if(LayerId != XVMIX_LAYER_LOGO) {
+    Slot->Stride = StrideInBytes;
+  }
+  InstancePtr->Staged.Dirty |= (1<<LayerId);
+}
+
+/*****************************************************************************/
+/**
+* This function stages the scaling factor of the specified layer
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer to be updated
+* @param  Scale is the scale factor
+*
+* @return None
+*
+* @note   Applicable only for Layer1-16 and Logo Layer
+*
+******************************************************************************/
+void XVMix_StageLayerScaleFactor(XV_Mix_l2 *InstancePtr,
+                                 XVMix_LayerId LayerId,
+                                 XVMix_Scalefactor Scale)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid(((LayerId > XVMIX_LAYER_MASTER) &&
+                  (LayerId <= XVMIX_LAYER_16)) ||
+                 (LayerId == XVMIX_LAYER_LOGO));
+  Xil_AssertVoid((Scale >= XVMIX_SCALE_FACTOR_1X) &&
+                 (Scale <= XVMIX_SCALE_FACTOR_4X));
+
+  InstancePtr->Staged.Layer[ShadowSlot(LayerId)].Scale = Scale;
+  InstancePtr->Staged.Dirty |= (1<<LayerId);
+}
+
+/*****************************************************************************/
+/**
+* This function stages the Alpha level of the specified layer
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer to be updated
+* @param  Alpha is the new value
+*
+* @return None
+*
+* @note   Applicable only for Layer1-16 and Logo Layer
+*
+******************************************************************************/
+void XVMix_StageLayerAlpha(XV_Mix_l2 *InstancePtr,
+                           XVMix_LayerId LayerId,
+                           u16 Alpha)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid(((LayerId > XVMIX_LAYER_MASTER) &&
+                  (LayerId <= XVMIX_LAYER_16)) ||
+                 (LayerId == XVMIX_LAYER_LOGO));
+  Xil_AssertVoid(Alpha <= XVMIX_ALPHA_MAX);
+
+  InstancePtr->Staged.Layer[ShadowSlot(LayerId)].Alpha = Alpha;
+  InstancePtr->Staged.Dirty |= (1<<LayerId);
+}
+
+/*****************************************************************************/
+/**
+* This function stages the buffer address of the specified layer
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer to be updated
+* @param  Addr is the absolute address of buffer in memory
+*
+* @return None
+*
+* @note   Applicable only for Layer1-16
+*
+******************************************************************************/
+void XVMix_StageLayerBufferAddr(XV_Mix_l2 *InstancePtr,
+                                XVMix_LayerId LayerId,
+                                UINTPTR Addr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid((LayerId > XVMIX_LAYER_MASTER) &&
+                 (LayerId <= XVMIX_LAYER_16));
+  Xil_AssertVoid(Addr != 0);
+
+  InstancePtr->Staged.Layer[LayerId].BufAddr = Addr;
+  InstancePtr->Staged.Dirty |= (1<<LayerId);
+}
+
+/*****************************************************************************/
+/**
+* This function stages the buffer address of the specified layer
+* for the UV plane for semi-planar formats
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer to be updated
+* @param  Addr is the absolute address of second buffer in memory
+*
+* @return None
+*
+* @note   Applicable only for Layer1-16
+*
+******************************************************************************/
+void XVMix_StageLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
+                                      XVMix_LayerId LayerId,
+                                      UINTPTR Addr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid((LayerId > XVMIX_LAYER_MASTER) &&
+                 (LayerId <= XVMIX_LAYER_16));
+  Xil_AssertVoid(Addr != 0);
+
+  InstancePtr->Staged.Layer[LayerId].ChromaBufAddr = Addr;
+  InstancePtr->Staged.Dirty |= (1<<LayerId);
+}
+
+/*****************************************************************************/
+/**
+* This function validates the staged settings of the specified layer that
+* differ from the committed settings
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer to be validated
+*
+* @return XST_SUCCESS if staged settings are valid else error code with reason
+*
+******************************************************************************/
+static int ValidateStagedLayer(XV_Mix_l2 *InstancePtr, u32 LayerId)
+{
+  XV_mix *MixPtr;
+  XVMix_LayerShadow *New, *Old;
+  UINTPTR Align;
+  u32 WinResInRange, IsStream;
+
+  MixPtr = &InstancePtr->Mix;
+
+  if(LayerId == XVMIX_LAYER_MASTER) {
+    return(XST_SUCCESS);
+  }
+
+  if(LayerId == XVMIX_LAYER_LOGO) {
+    if(!XVMix_IsLogoEnabled(InstancePtr)) {
+      return(XVMIX_ERR_DISABLED_IN_HW);
+    }
+  } else if(LayerId >= XVMix_GetNumLayers(InstancePtr)) {
+    return(XVMIX_ERR_DISABLED_IN_HW);
+  }
+
+  New = &InstancePtr->Staged.Layer[ShadowSlot(LayerId)];
+  Old = &InstancePtr->Committed.Layer[ShadowSlot(LayerId)];
+  Align = 2 * MixPtr->Config.PixPerClk * 4;
+
+  if(LayerId == XVMIX_LAYER_LOGO) {
+    IsStream = TRUE;
+  } else {
+    IsStream = XVMix_IsLayerInterfaceStream(InstancePtr, LayerId);
+
+    if((New->Alpha != Old->Alpha) &&
+       (!XVMix_IsAlphaEnabled(InstancePtr, LayerId))) {
+      return(XVMIX_ERR_DISABLED_IN_HW);
+    }
+    if((New->Scale != Old->Scale) &&
+       (!XVMix_IsScalingEnabled(InstancePtr, LayerId))) {
+      return(XVMIX_ERR_DISABLED_IN_HW);
+    }
+  }
+
+  /* Window, stride and scale factor together define the layer footprint */
+  if((New->Win.StartX != Old->Win.StartX) ||
+     (New->Win.StartY != Old->Win.StartY) ||
+     (New->Win.Width  != Old->Win.Width)  ||
+     (New->Win.Height != Old->Win.Height) ||
+     (New->Stride     != Old->Stride)     ||
+     (New->Scale      != Old->Scale)) {
+
+    if(LayerId == XVMIX_LAYER_LOGO) {
+      WinResInRange = ((New->Win.Width  > (XVMIX_MIN_LOGO_WIDTH-1))  &&
+                       (New->Win.Height > (XVMIX_MIN_LOGO_HEIGHT-1)) &&
+                       (New->Win.Width  <= MixPtr->Config.MaxLogoWidth) &&
+                       (New->Win.Height <= MixPtr->Config.MaxLogoHeight));
+    } else {
+      WinResInRange = ((New->Win.Width  > (XVMIX_MIN_STRM_WIDTH-1)) &&
+                       (New->Win.Height > (XVMIX_MIN_STRM_HEIGHT-1)) &&
+                       (New->Win.Width  <= MixPtr->Config.LayerMaxWidth[LayerId-1]) &&
+                       (New->Win.Height <= MixPtr->Config.MaxHeight));
+    }
+    if((!WinResInRange) ||
+       (!IsWindowValid(&InstancePtr->Stream, &New->Win,
+                       (XVMix_Scalefactor)New->Scale))) {
+      return(XVMIX_ERR_LAYER_WINDOW_INVALID);
+    }
+
+    /* Check if stride is aligned to aximm width (2*PPC*32-bits) */
+    if((!IsStream) && ((New->Stride % Align) != 0)) {
+      return(XVMIX_ERR_WIN_STRIDE_MISALIGNED);
+    }
+  }
+
+  if((New->BufAddr != Old->BufAddr) ||
+     (New->ChromaBufAddr != Old->ChromaBufAddr)) {
+    if(IsStream) {
+      return(XVMIX_ERR_LAYER_INTF_TYPE_MISMATCH);
+    }
+    /* Check if addr is aligned to aximm width (2*PPC*32-bits (4Bytes)) */
+    if(((New->BufAddr % Align) != 0) ||
+       ((New->ChromaBufAddr % Align) != 0)) {
+      return(XVMIX_ERR_MEM_ADDR_MISALIGNED);
+    }
+  }
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function writes the staged layer settings that differ from the
+* committed settings to the core and makes them the committed settings
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return None
+*
+* @note   Layer registers are written before the layer enable register so a
+*         layer enabled by the same transaction starts with its new settings
+*
+******************************************************************************/
+static void WriteStagedLayers(XV_Mix_l2 *InstancePtr)
+{
+  XV_mix *MixPtr;
+  XVMix_LayerShadow *New, *Old;
+  UINTPTR Base;
+  u32 Dirty, LayerId, Offset;
+
+  MixPtr = &InstancePtr->Mix;
+  Base   = MixPtr->Config.BaseAddress;
+  Dirty  = InstancePtr->Staged.Dirty & ~(1<<XVMIX_LAYER_MASTER);
+
+  for(LayerId=XVMIX_LAYER_MASTER; Dirty != 0; ++LayerId, Dirty >>= 1) {
+    if(!(Dirty & 1)) {
+      continue;
+    }
+
+    New = &InstancePtr->Staged.Layer[ShadowSlot(LayerId)];
+    Old = &InstancePtr->Committed.Layer[ShadowSlot(LayerId)];
+
+    if(LayerId == XVMIX_LAYER_LOGO) {
+      if(New->Win.StartX != Old->Win.StartX) {
+        XV_mix_Set_HwReg_logoStartX(MixPtr, New->Win.StartX);
+      }
+      if(New->Win.StartY != Old->Win.StartY) {
+        XV_mix_Set_HwReg_logoStartY(MixPtr, New->Win.StartY);
+      }
+      if(New->Win.Width != Old->Win.Width) {
+        XV_mix_Set_HwReg_logoWidth(MixPtr, New->Win.Width);
+      }
+      if(New->Win.Height != Old->Win.Height) {
+        XV_mix_Set_HwReg_logoHeight(MixPtr, New->Win.Height);
+      }
+      if(New->Alpha != Old->Alpha) {
+        XV_mix_Set_HwReg_logoAlpha(MixPtr, New->Alpha);
+      }
+      if(New->Scale != Old->Scale) {
+        XV_mix_Set_HwReg_logoScaleFactor(MixPtr, New->Scale);
+      }
+      *Old = *New;
+      continue;
+    }
+
+    Offset = LayerId*XVMIX_REG_OFFSET;
+
+    if(New->Win.StartX != Old->Win.StartX) {
+      XV_mix_WriteReg(Base, (XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTX_0_DATA+Offset),
+                      New->Win.StartX);
+    }
+    if(New->Win.StartY != Old->Win.StartY) {
+      XV_mix_WriteReg(Base, (XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTY_0_DATA+Offset),
+                      New->Win.StartY);
+    }
+    if(New->Win.Width != Old->Win.Width) {
+      XV_mix_WriteReg(Base, (XV_MIX_CTRL_ADDR_HWREG_LAYERWIDTH_0_DATA+Offset),
+                      New->Win.Width);
+    }
+    if(New->Win.Height != Old->Win.Height) {
+      XV_mix_WriteReg(Base, (XV_MIX_CTRL_ADDR_HWREG_LAYERHEIGHT_0_DATA+Offset),
+                      New->Win.Height);
+    }
+    if(New->Alpha != Old->Alpha) {
+      XV_mix_WriteReg(Base, (XV_MIX_CTRL_ADDR_HWREG_LAYERALPHA_0_DATA+Offset),
+                      New->Alpha);
+    }
+    if(New->Scale != Old->Scale) {
+      XV_mix_WriteReg(Base,
+                      (XV_MIX_CTRL_ADDR_HWREG_LAYERSCALEFACTOR_0_DATA+Offset),
+                      New->Scale);
+    }
+    if(!XVMix_IsLayerInterfaceStream(InstancePtr, LayerId)) {
+      if(New->Stride != Old->Stride) {
+        XV_mix_WriteReg(Base,
+                        (XV_MIX_CTRL_ADDR_HWREG_LAYERSTRIDE_0_DATA+Offset),
+                        New->Stride);
+      }
+
+      Offset = (LayerId-1)*XVMIX_REG_OFFSET;
+      if(New->BufAddr != Old->BufAddr) {
+        XV_mix_WriteReg(Base,
+                        (XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA+Offset),
+                        New->BufAddr);
+      }
+      if(New->ChromaBufAddr != Old->ChromaBufAddr) {
+        XV_mix_WriteReg(Base,
+                        (XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA+Offset),
+                        New->ChromaBufAddr);
+      }
+    }
+    *Old = *New;
+  }
+
+  if(InstancePtr->Staged.LayerEnable != InstancePtr->Committed.LayerEnable) {
+    XV_mix_Set_HwReg_layerEnable(MixPtr, InstancePtr->Staged.LayerEnable);
+    InstancePtr->Committed.LayerEnable = InstancePtr->Staged.LayerEnable;
+  }
+  InstancePtr->Staged.Dirty = 0;
+}
+
+/*****************************************************************************/
+/**
+* This function commits the staged layer settings. All staged layers are
+* validated first and, only if all of them are valid, the registers that
+* differ from the committed settings are written to the core.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  SyncToFrame is TRUE to defer the register writes to the next frame
+*         done interrupt. Ignored if interrupts are disabled (polling mode)
+*
+* @return XST_SUCCESS if command is successful else error code with reason.
+*         On error no register is written and the transaction stays open
+*
+* @note   With SyncToFrame the registers are written by
+*         XVMix_InterruptHandler() between the frame done callback and the
+*         start of the next frame. Layer registers must not be written
+*         through XVMix_SetLayer*() while a commit is pending.
+*
+******************************************************************************/
+int XVMix_CommitUpdate(XV_Mix_l2 *InstancePtr, u32 SyncToFrame)
+{
+  u32 Dirty, LayerId;
+  int Status;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  if(!InstancePtr->Committed.Synced) {
+    ReadShadowFromHw(InstancePtr, &InstancePtr->Committed);
+  }
+
+  Dirty = InstancePtr->Staged.Dirty;
+  for(LayerId=XVMIX_LAYER_MASTER; Dirty != 0; ++LayerId, Dirty >>= 1) {
+    if(Dirty & 1) {
+      Status = ValidateStagedLayer(InstancePtr, LayerId);
+      if(Status != XST_SUCCESS) {
+        return(Status);
+      }
+    }
+  }
+
+  if(SyncToFrame &&
+     (XV_mix_InterruptGetEnabled(&InstancePtr->Mix) & XVMIX_IRQ_DONE_MASK)) {
+    InstancePtr->UpdatePending = TRUE;
+  } else {
+    WriteStagedLayers(InstancePtr);
+  }
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function writes a pending frame synchronous commit to the core
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return None
+*
+* @note   Called by XVMix_InterruptHandler(). Applications servicing the
+*         frame done event by other means must call it before restarting
+*         the core.
+*
+******************************************************************************/
+void XVMix_ApplyPendingUpdate(XV_Mix_l2 *InstancePtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  if(InstancePtr->UpdatePending) {
+    WriteStagedLayers(InstancePtr);
+    InstancePtr->UpdatePending = FALSE;
+  }
+}
+
 /*****************************************************************************/
 /**
 * This function reports the mixer status
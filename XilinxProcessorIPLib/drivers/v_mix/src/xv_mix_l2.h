@@ -80,6 +80,25 @@
 *     will configure the IP to keep processing frames without sw intervention.
 *   - Polling mode is the default configuration set during driver initialization
 *
+* <b> Layer Update Transactions </b>
+*
+* Each XVMix_SetLayer*() call validates its arguments and writes the registers
+* immediately. When several layers change at once (e.g. an OSD update) the
+* settings can instead be staged and applied together
+*   - XVMix_BeginUpdate() starts a transaction from the last committed state
+*   - XVMix_StageLayer*() record the new settings in the staging shadow. No
+*     register is accessed
+*   - XVMix_CommitUpdate() validates all staged layers once and then writes
+*     only the registers whose value differs from the committed shadow. If
+*     any layer is invalid nothing is written
+* If interrupts are enabled and the commit is requested to be frame
+* synchronous, the registers are written by XVMix_InterruptHandler() after the
+* frame done callback and before the next frame is started. The whole update
+* therefore takes effect on the same frame. In polling mode the registers are
+* written at commit time.
+* Settings written through XVMix_SetLayer*() or the layer enable/disable API's
+* invalidate the committed shadow and the next transaction re-reads it from HW.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -107,6 +126,7 @@
 * 4.00  vyc   04/04/18   Add 8th overlayer
 *                        Move logo layer enable from bit 8 to bit 15
 * 6.00  pg    01/10/20   Add Colorimetry Feature
+* 6.50  ag    10/18/26   Add shadow state layer update transactions
 * </pre>
 *
 ******************************************************************************/
@@ -128,6 +148,10 @@ extern "C" {
 #define XVMIX_IRQ_DONE_MASK              (0x01)
 #define XVMIX_IRQ_READY_MASK             (0x02)
 
+/* Shadow slots: Master, Layer1-16 and Logo */
+#define XVMIX_SHADOW_LOGO                (XVMIX_MAX_SUPPORTED_LAYERS + 1)
+#define XVMIX_SHADOW_NUM_LAYERS          (XVMIX_MAX_SUPPORTED_LAYERS + 2)
+
 #define XVMIX_CSC_COEFF_FRACTIONAL_BITS	(12)
 #define XVMIX_CSC_COEFF_DIVISOR	(10000)
 #define XVMIX_CSC_MAX_ROWS		(3)
@@ -281,6 +305,28 @@ typedef struct {
     };
 }XVMix_Layer;
 
+/**
+ * This typedef contains the shadow copy of the registers of a given layer
+ */
+typedef struct {
+    XVidC_VideoWindow Win;    /**< Window coordinates */
+    u32 Stride;               /**< Stride in bytes (memory layers) */
+    u16 Alpha;                /**< Layer alpha */
+    u8 Scale;                 /**< Scale factor */
+    UINTPTR BufAddr;          /**< Luma/packed buffer (memory layers) */
+    UINTPTR ChromaBufAddr;    /**< Chroma buffer (memory layers) */
+}XVMix_LayerShadow;
+
+/**
+ * This typedef contains the shadow copy of the layer registers of the core
+ */
+typedef struct {
+    u32 LayerEnable;          /**< Layer enable mask */
+    u32 Dirty;                /**< Staged layers, bit position is layer id */
+    u32 Synced;               /**< Shadow reflects the HW registers */
+    XVMix_LayerShadow Layer[XVMIX_SHADOW_NUM_LAYERS]; /**< Per layer state */
+}XVMix_Shadow;
+
 /**
 * Callback type for interrupt.
 *
@@ -313,6 +359,10 @@ typedef struct {
     XVMix_BackgroundId BkgndColor;
 
     XVidC_VideoStream Stream;    /**< Input AXIS */
+
+    XVMix_Shadow Staged;         /**< Settings staged by XVMix_StageLayer* */
+    XVMix_Shadow Committed;      /**< Settings last written to HW */
+    volatile u32 UpdatePending;  /**< Staged settings wait for frame done */
 }XV_Mix_l2;
 
 /************************** Macros Definitions *******************************/
@@ -538,6 +588,29 @@ int XVMix_LoadLogoPixelAlpha(XV_Mix_l2 *InstancePtr,
                              XVidC_VideoWindow *Win,
                              u8 *ABuffer);
 
+void XVMix_BeginUpdate(XV_Mix_l2 *InstancePtr);
+void XVMix_StageLayerEnable(XV_Mix_l2 *InstancePtr,
+                            XVMix_LayerId LayerId,
+                            u32 Enable);
+void XVMix_StageLayerWindow(XV_Mix_l2 *InstancePtr,
+                            XVMix_LayerId LayerId,
+                            XVidC_VideoWindow *Win,
+                            u32 StrideInBytes);
+void XVMix_StageLayerScaleFactor(XV_Mix_l2 *InstancePtr,
+                                 XVMix_LayerId LayerId,
+                                 XVMix_Scalefactor Scale);
+void XVMix_StageLayerAlpha(XV_Mix_l2 *InstancePtr,
+                           XVMix_LayerId LayerId,
+                           u16 Alpha);
+void XVMix_StageLayerBufferAddr(XV_Mix_l2 *InstancePtr,
+                                XVMix_LayerId LayerId,
+                                UINTPTR Addr);
+void XVMix_StageLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
+                                      XVMix_LayerId LayerId,
+                                      UINTPTR Addr);
+int XVMix_CommitUpdate(XV_Mix_l2 *InstancePtr, u32 SyncToFrame);
+void XVMix_ApplyPendingUpdate(XV_Mix_l2 *InstancePtr);
+
 void XVMix_DbgReportStatus(XV_Mix_l2 *InstancePtr);
 void XVMix_DbgLayerInfo(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId);
 
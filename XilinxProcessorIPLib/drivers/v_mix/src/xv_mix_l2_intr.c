@@ -21,6 +21,7 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  rco   12/14/15   Initial Release
 *             02/12/16   Move user call back before frame start trigger
+* 6.50  ag    10/18/26   Apply pending layer update before frame start trigger
 *
 * </pre>
 *
@@ -66,8 +67,8 @@ int XVMix_SetCallback(XV_Mix_l2 *InstancePtr, void *CallbackFunc, void *Callback
 * This function is the interrupt handler for the mixer core driver.
 *
 * This handler clears the pending interrupt and determined if the source is
-* frame done signal. If yes, starts the next frame processing and calls the
-* registered callback function
+* frame done signal. If yes, calls the registered callback function, writes a
+* pending frame synchronous layer update and starts the next frame processing
 *
 * The application is responsible for connecting this function to the interrupt
 * system. Application beyond this driver is also responsible for providing
@@ -103,6 +104,8 @@ void XVMix_InterruptHandler(void *InstancePtr)
     if(MixPtr->FrameDoneCallback) {
 	      MixPtr->FrameDoneCallback(MixPtr->CallbackRef);
     }
+    //Core is idle, layer update takes effect from the next frame
+    XVMix_ApplyPendingUpdate(MixPtr);
     XV_mix_Start(&MixPtr->Mix);
   }
 }
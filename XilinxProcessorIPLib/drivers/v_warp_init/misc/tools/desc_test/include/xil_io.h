@@ -0,0 +1,43 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_io.h
+*
+* Host replacement of the standalone BSP register access functions. The
+* descriptor test points the core registers at host memory, so accesses
+* are plain memory accesses.
+*
+******************************************************************************/
+
+#ifndef XIL_IO_H
+#define XIL_IO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+#include "xil_printf.h"
+
+/***************** Macros (Inline Functions) Definitions *********************/
+static inline u32 Xil_In32(UINTPTR Addr)
+{
+	return *(volatile u32 *)Addr;
+}
+
+static inline void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	*(volatile u32 *)Addr = Value;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_IO_H */
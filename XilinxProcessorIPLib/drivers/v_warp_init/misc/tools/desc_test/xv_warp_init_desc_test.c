@@ -0,0 +1,927 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_warp_init_desc_test.c
+*
+* Host test and benchmark of the descriptor programming of the warp init
+* driver (xv_warp_init_l2.c).
+*
+* The test applies a random sequence of configuration changes to the
+* descriptors of one driver instance, which recomputes them incrementally.
+* After every change the programmed descriptor is compared bit for bit with
+* a descriptor programmed from scratch. The comparison covers the hardware
+* descriptor and the source control points, tangents and intermediate
+* vectors it points to. Changes include moved control points, changed
+* source points, lens and projective transform parameters, pixel format,
+* frame size, grid size and warp type. Meshes with a destination or a
+* source point moved too far must be rejected.
+*
+* When built with LEGACY_L2 set to an earlier xv_warp_init_l2.c, e.g.
+*   git show <rev>:XilinxProcessorIPLib/drivers/v_warp_init/src/xv_warp_init_l2.c > legacy_l2.c
+*   make LEGACY_L2=legacy_l2.c
+* every valid configuration is also programmed with that implementation and
+* compared. Descriptor fields that the legacy implementation leaves
+* uninitialized for a warp type, e.g. the lens parameters of an arbitrary
+* warp, are not compared. The legacy implementation never frees its
+* arbitrary warp buffers, so the test grows by a few hundred KB per change.
+*
+* The benchmark reports the time per XVWarpInit_ProgramDescriptor call for
+* a full computation, a moved control point, a changed lens parameter and
+* an unchanged configuration.
+*
+* Usage: xv_warp_init_desc_test [-n changes] [-s seed] [-b] [-v]
+*
+*  -n  Number of random configuration changes, 2000 by default.
+*  -s  Seed of the random sequence, 1 by default.
+*  -b  Runs the benchmark instead of the test.
+*  -v  Prints the driver messages, e.g. for rejected meshes.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ag   10/18/2026 Initial release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <getopt.h>
+#include "xv_warp_init_l2.h"
+
+/************************** Constant Definitions *****************************/
+#define XV_TEST_NUM_DESC		4U
+#define XV_TEST_MIN_GRID		2U
+#define XV_TEST_MAX_GRID		32U
+#define XV_TEST_MAX_PTS			((XV_TEST_MAX_GRID + 1U) * \
+					 (XV_TEST_MAX_GRID + 1U))
+#define XV_TEST_NUM_REGS		64U
+#define XV_TEST_DEF_CHANGES		2000U
+#define XV_TEST_BENCH_CALLS		200U
+#define XV_TEST_CHECKSUM_WORDS		53U
+#define XV_TEST_LENS_SHIFT		12 /* Fixed point of k_pre/k_post */
+#ifdef XV_TEST_LEGACY
+#define XV_TEST_ARB_FRAMES		4U
+#else
+#define XV_TEST_ARB_FRAMES		5U
+#endif
+
+/**************************** Type Definitions *******************************/
+typedef enum {
+	XV_TEST_MOVE_POINT = 0,	/* One destination point moved */
+	XV_TEST_MOVE_POINTS,	/* Several destination points moved */
+	XV_TEST_MOVE_SRC,	/* Source points changed, still valid */
+	XV_TEST_BAD_DST,	/* Destination point moved too far */
+	XV_TEST_BAD_SRC,	/* Source point moved too far */
+	XV_TEST_GRID,		/* New grid size */
+	XV_TEST_LENS_K,		/* New pre or post lens coefficient */
+	XV_TEST_LENS_H,		/* New projective transform */
+	XV_TEST_FORMAT,		/* New pixel size and filter tables */
+	XV_TEST_FRAME,		/* New frame size */
+	XV_TEST_WARP_TYPE,	/* Switch between lens and arbitrary warp */
+	XV_TEST_NO_CHANGE,	/* Same configuration again */
+	XV_TEST_NUM_CHANGES
+} XVWarpInitTest_Change;
+
+typedef struct {
+	u16 width;
+	u16 height;
+} XVWarpInitTest_Size;
+
+/* Configuration of one descriptor together with its mesh */
+typedef struct {
+	XVWarpInit_InputConfigs cfg;
+	XVWarpInit_ArbParam_MeshInfo mesh[XV_TEST_MAX_PTS];
+	u8 programmed;	/* Last programming of the descriptor succeeded */
+} XVWarpInitTest_Desc;
+
+typedef struct {
+	u64 changes[XV_TEST_NUM_CHANGES];
+	u64 rejected;
+	u64 compared;
+	u64 legacy_compared;
+	u64 errors;
+} XVWarpInitTest_Stats;
+
+/************************** Function Prototypes ******************************/
+#ifdef XV_TEST_LEGACY
+/* Earlier xv_warp_init_l2.c built with renamed entry points */
+int XLegacy_SetNumOfDescriptors(XV_warp_init *InstancePtr, u32 num_desc);
+int XLegacy_ProgramDescriptor(XV_warp_init *InstancePtr, u32 Descnum,
+		XVWarpInit_InputConfigs *ConfigPtr);
+#endif
+
+/************************** Variable Definitions *****************************/
+/*
+ * Arbitrary warp uses the first XV_TEST_ARB_FRAMES sizes. The legacy
+ * implementation sizes its scratch row for the frame width and overflows
+ * it for portrait frames, which are left out when comparing with it.
+ */
+static const XVWarpInitTest_Size frame_sizes[] = {
+	{ 320, 240 }, { 640, 480 }, { 1280, 720 }, { 1920, 1080 },
+	{ 1080, 1920 }, { 3840, 2160 }
+};
+
+static const char *change_names[XV_TEST_NUM_CHANGES] = {
+	"move point", "move points", "move source", "bad destination",
+	"bad source", "grid", "lens k", "lens h", "format", "frame",
+	"warp type", "no change"
+};
+
+static XV_warp_init_Config test_config = {
+	.max_width = 3840,
+	.max_height = 2160,
+	.warp_type = DISTORTION_ARBITARY,
+	.axi_mm_data_width = 128,
+	.bpc = 8,
+	.max_control_pts = XV_TEST_MAX_GRID,
+};
+
+static u32 test_regs[XV_TEST_NUM_REGS];
+static u8 verbose;
+
+/*
+ * Standalone BSP functions used by the driver
+ */
+u32 Xil_AssertStatus;
+s32 Xil_AssertWait = 0;
+
+void Xil_Assert(const char8 *File, s32 Line)
+{
+	fprintf(stderr, "Assert %s:%d\n", File, (int)Line);
+	Xil_AssertStatus = XIL_ASSERT_OCCURRED;
+}
+
+void xil_printf(const char8 *ctrl1, ...)
+{
+	va_list args;
+
+	if (verbose) {
+		va_start(args, ctrl1);
+		vprintf(ctrl1, args);
+		va_end(args);
+	}
+}
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+* This function returns a random value in the given range.
+*
+* @param	min is the smallest value returned.
+* @param	max is the largest value returned.
+*
+* @return	Random value
+*
+******************************************************************************/
+static s32 XVWarpInitTest_Rand(s32 min, s32 max)
+{
+	return min + (s32)((u32)rand() % (u32)(max - min + 1));
+}
+
+/*****************************************************************************/
+/**
+* This function returns the current host time.
+*
+* @return	Time in ns
+*
+******************************************************************************/
+static u64 XVWarpInitTest_TimeNs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((u64)ts.tv_sec * 1000000000U) + (u64)ts.tv_nsec;
+}
+
+/*****************************************************************************/
+/**
+* This function initializes a driver instance with descriptors in host
+* memory.
+*
+* @param	inst is the instance to be initialized.
+* @param	num_desc is the number of descriptors.
+* @param	set_desc is the function creating the descriptors.
+*
+* @return	XST_SUCCESS if the descriptors are created
+* 			XST_FAILURE otherwise
+*
+******************************************************************************/
+static int XVWarpInitTest_InitInstance(XV_warp_init *inst, u32 num_desc,
+		int (*set_desc)(XV_warp_init *, u32))
+{
+	memset(inst, 0, sizeof(XV_warp_init));
+	inst->config = &test_config;
+	inst->Ctrl_BaseAddress = (UINTPTR)test_regs;
+	inst->IsReady = XIL_COMPONENT_IS_READY;
+
+	return set_desc(inst, num_desc);
+}
+
+/*****************************************************************************/
+/**
+* This function returns the hardware descriptor of a descriptor number.
+*
+* @param	inst is the driver instance.
+* @param	descnum is the descriptor number.
+*
+* @return	Pointer to the hardware descriptor
+*
+******************************************************************************/
+static const XVWarpInitVector_Hw_Aligned *XVWarpInitTest_GetDesc(
+		XV_warp_init *inst, u32 descnum)
+{
+	const XVWarpInitVector_Hw_Aligned *descptr;
+
+	descptr = (const XVWarpInitVector_Hw_Aligned *)inst->RemapVectorDesc_BaseAddr;
+	while (descnum-- > 0U)
+		descptr = (const XVWarpInitVector_Hw_Aligned *)(UINTPTR)
+				descptr->remap_nextaddr;
+
+	return descptr;
+}
+
+/*****************************************************************************/
+/**
+* This function moves the destination of a control point by up to half of
+* the grid spacing, staying inside the frame.
+*
+* @param	d is the descriptor configuration.
+* @param	index is the control point index.
+*
+* @return	None
+*
+******************************************************************************/
+static void XVWarpInitTest_MovePoint(XVWarpInitTest_Desc *d, u32 index)
+{
+	XVWarpInit_ArbParam_MeshInfo *pt = &d->mesh[index];
+	s32 max_x = (s32)(d->cfg.width / d->cfg.num_ctrl_pts) / 2;
+	s32 max_y = (s32)(d->cfg.height / d->cfg.num_ctrl_pts) / 2;
+
+	pt->d_x = pt->s_x + XVWarpInitTest_Rand(-max_x, max_x);
+	pt->d_y = pt->s_y + XVWarpInitTest_Rand(-max_y, max_y);
+	if (pt->d_x < 0)
+		pt->d_x = 0;
+	if (pt->d_x > d->cfg.width)
+		pt->d_x = d->cfg.width;
+	if (pt->d_y < 0)
+		pt->d_y = 0;
+	if (pt->d_y > d->cfg.height)
+		pt->d_y = d->cfg.height;
+}
+
+/*****************************************************************************/
+/**
+* This function creates a random mesh on a regular source grid.
+*
+* @param	d is the descriptor configuration.
+*
+* @return	None
+*
+******************************************************************************/
+static void XVWarpInitTest_NewMesh(XVWarpInitTest_Desc *d)
+{
+	u32 n = d->cfg.num_ctrl_pts;
+	u32 row, col, i = 0;
+
+	for (row = 0; row <= n; row++) {
+		for (col = 0; col <= n; col++) {
+			d->mesh[i].s_x = (s32)((col * d->cfg.width) / n);
+			d->mesh[i].s_y = (s32)((row * d->cfg.height) / n);
+			XVWarpInitTest_MovePoint(d, i);
+			i++;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function sets random lens coefficients.
+*
+* @param	d is the descriptor configuration.
+*
+* @return	None
+*
+******************************************************************************/
+static void XVWarpInitTest_NewLensK(XVWarpInitTest_Desc *d)
+{
+	if (rand() & 1)
+		d->cfg.k_pre = (s16)XVWarpInitTest_Rand(-4 << XV_TEST_LENS_SHIFT,
+				4 << XV_TEST_LENS_SHIFT);
+	else
+		d->cfg.k_post = (s16)XVWarpInitTest_Rand(-4 << XV_TEST_LENS_SHIFT,
+				4 << XV_TEST_LENS_SHIFT);
+}
+
+/*****************************************************************************/
+/**
+* This function sets a random projective transform close to identity, in
+* the fixed point format used by the example application.
+*
+* @param	d is the descriptor configuration.
+*
+* @return	None
+*
+******************************************************************************/
+static void XVWarpInitTest_NewLensH(XVWarpInitTest_Desc *d)
+{
+	d->cfg.h[0] = (1 << 24) + XVWarpInitTest_Rand(-(1 << 22), 1 << 22);
+	d->cfg.h[1] = XVWarpInitTest_Rand(-(1 << 21), 1 << 21);
+	d->cfg.h[2] = XVWarpInitTest_Rand(-(200 << 12), 200 << 12);
+	d->cfg.h[3] = XVWarpInitTest_Rand(-(1 << 21), 1 << 21);
+	d->cfg.h[4] = (1 << 24) + XVWarpInitTest_Rand(-(1 << 22), 1 << 22);
+	d->cfg.h[5] = XVWarpInitTest_Rand(-(200 << 12), 200 << 12);
+	d->cfg.h[6] = XVWarpInitTest_Rand(-1000, 1000);
+	d->cfg.h[7] = XVWarpInitTest_Rand(-1000, 1000);
+	d->cfg.h[8] = 1 << 16;
+}
+
+/*****************************************************************************/
+/**
+* This function sets a random frame size. Arbitrary warp is limited to
+* 1080p so that the legacy implementation, which leaks its buffers, can
+* run long sequences.
+*
+* @param	d is the descriptor configuration.
+*
+* @return	None
+*
+******************************************************************************/
+static void XVWarpInitTest_NewFrame(XVWarpInitTest_Desc *d)
+{
+	u32 num = sizeof(frame_sizes) / sizeof(frame_sizes[0]);
+	const XVWarpInitTest_Size *size;
+
+	if (d->cfg.warp_type == DISTORTION_ARBITARY)
+		num = XV_TEST_ARB_FRAMES;
+	size = &frame_sizes[XVWarpInitTest_Rand(0, (s32)num - 1)];
+	d->cfg.width = size->width;
+	d->cfg.height = size->height;
+}
+
+/*****************************************************************************/
+/**
+* This function creates a random configuration of the given warp type.
+*
+* @param	d is the descriptor configuration.
+* @param	warp_type is the warp type.
+*
+* @return	None
+*
+******************************************************************************/
+static void XVWarpInitTest_NewConfig(XVWarpInitTest_Desc *d, u8 warp_type)
+{
+	memset(&d->cfg, 0, sizeof(d->cfg));
+	d->cfg.warp_type = warp_type;
+	d->cfg.bytes_per_pixel = 3;
+	d->cfg.filter_table_addr_0 = 0x10000000U / 4U;
+	d->cfg.filter_table_addr_1 = 0x10100000U / 4U;
+	d->cfg.ctr_pts = d->mesh;
+	XVWarpInitTest_NewFrame(d);
+	d->cfg.num_ctrl_pts = (u32)XVWarpInitTest_Rand(XV_TEST_MIN_GRID,
+			XV_TEST_MAX_GRID);
+	if (warp_type == DISTORTION_ARBITARY) {
+		XVWarpInitTest_NewMesh(d);
+	} else {
+		d->cfg.k_pre = 0;
+		d->cfg.k_post = 2 << XV_TEST_LENS_SHIFT;
+		XVWarpInitTest_NewLensH(d);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function applies a change to a descriptor configuration.
+*
+* @param	d is the descriptor configuration.
+* @param	change is the change to be applied.
+*
+* @return	1 if the driver must reject the new configuration, 0 otherwise
+*
+******************************************************************************/
+static u8 XVWarpInitTest_Apply(XVWarpInitTest_Desc *d,
+		XVWarpInitTest_Change change)
+{
+	u32 num_pts = (d->cfg.num_ctrl_pts + 1) * (d->cfg.num_ctrl_pts + 1);
+	u32 index = (u32)XVWarpInitTest_Rand(0, (s32)num_pts - 1);
+	XVWarpInit_ArbParam_MeshInfo *pt = &d->mesh[index];
+	s32 seg_w = (s32)(d->cfg.width / d->cfg.num_ctrl_pts);
+	u32 i, count;
+
+	switch (change) {
+	case XV_TEST_MOVE_POINT:
+		XVWarpInitTest_MovePoint(d, index);
+		break;
+	case XV_TEST_MOVE_POINTS:
+		count = (u32)XVWarpInitTest_Rand(2, 8);
+		for (i = 0; i < count; i++)
+			XVWarpInitTest_MovePoint(d,
+				(u32)XVWarpInitTest_Rand(0, (s32)num_pts - 1));
+		break;
+	case XV_TEST_MOVE_SRC:
+		pt->s_x = pt->d_x + XVWarpInitTest_Rand(-seg_w / 2, seg_w / 2);
+		break;
+	case XV_TEST_BAD_DST:
+		pt->d_x = pt->s_x + seg_w + 1;
+		return 1;
+	case XV_TEST_BAD_SRC:
+		pt->s_x = pt->d_x - seg_w - 1;
+		return 1;
+	case XV_TEST_GRID:
+		d->cfg.num_ctrl_pts = (u32)XVWarpInitTest_Rand(XV_TEST_MIN_GRID,
+				XV_TEST_MAX_GRID);
+		XVWarpInitTest_NewMesh(d);
+		break;
+	case XV_TEST_LENS_K:
+		XVWarpInitTest_NewLensK(d);
+		break;
+	case XV_TEST_LENS_H:
+		XVWarpInitTest_NewLensH(d);
+		break;
+	case XV_TEST_FORMAT:
+		d->cfg.bytes_per_pixel = (u16)XVWarpInitTest_Rand(1, 4);
+		d->cfg.filter_table_addr_0 = (u64)XVWarpInitTest_Rand(0,
+				0x3FFFFFFF);
+		d->cfg.filter_table_addr_1 = (u64)XVWarpInitTest_Rand(0,
+				0x3FFFFFFF);
+		break;
+	case XV_TEST_FRAME:
+		XVWarpInitTest_NewFrame(d);
+		if (d->cfg.warp_type == DISTORTION_ARBITARY)
+			XVWarpInitTest_NewMesh(d);
+		break;
+	case XV_TEST_WARP_TYPE:
+		XVWarpInitTest_NewConfig(d, (d->cfg.warp_type ==
+				DISTORTION_ARBITARY) ? DISTORTION_LENS :
+				DISTORTION_ARBITARY);
+		break;
+	default:
+		break;
+	}
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+* This function picks a random change applicable to a configuration.
+*
+* @param	d is the descriptor configuration.
+*
+* @return	Change to be applied
+*
+******************************************************************************/
+static XVWarpInitTest_Change XVWarpInitTest_PickChange(
+		const XVWarpInitTest_Desc *d)
+{
+	static const XVWarpInitTest_Change arb_changes[] = {
+		XV_TEST_MOVE_POINT, XV_TEST_MOVE_POINT, XV_TEST_MOVE_POINT,
+		XV_TEST_MOVE_POINTS, XV_TEST_MOVE_SRC, XV_TEST_BAD_DST,
+		XV_TEST_BAD_SRC, XV_TEST_GRID, XV_TEST_FORMAT, XV_TEST_FRAME,
+		XV_TEST_WARP_TYPE, XV_TEST_NO_CHANGE
+	};
+	static const XVWarpInitTest_Change lens_changes[] = {
+		XV_TEST_LENS_K, XV_TEST_LENS_K, XV_TEST_LENS_H,
+		XV_TEST_FORMAT, XV_TEST_FRAME, XV_TEST_WARP_TYPE,
+		XV_TEST_NO_CHANGE
+	};
+
+	if (d->cfg.warp_type == DISTORTION_ARBITARY)
+		return arb_changes[XVWarpInitTest_Rand(0,
+			(s32)(sizeof(arb_changes) / sizeof(arb_changes[0])) - 1)];
+
+	return lens_changes[XVWarpInitTest_Rand(0,
+		(s32)(sizeof(lens_changes) / sizeof(lens_changes[0])) - 1)];
+}
+
+/*****************************************************************************/
+/**
+* This function compares a buffer the descriptors point to.
+*
+* @param	name is the name of the buffer.
+* @param	addr is the buffer address in the descriptor (byte address / 4).
+* @param	ref_addr is the buffer address in the reference descriptor.
+* @param	size is the buffer size in bytes.
+*
+* @return	0 if the buffers match, 1 otherwise
+*
+******************************************************************************/
+static int XVWarpInitTest_CompareBuf(const char *name, u64 addr, u64 ref_addr,
+		size_t size)
+{
+	const u8 *buf = (const u8 *)(UINTPTR)(addr * 4U);
+	const u8 *ref = (const u8 *)(UINTPTR)(ref_addr * 4U);
+	size_t i;
+
+	if ((addr == 0U) || (ref_addr == 0U)) {
+		printf("  %s: missing buffer\n", name);
+		return 1;
+	}
+
+	for (i = 0; i < size; i++) {
+		if (buf[i] != ref[i]) {
+			printf("  %s: byte %zu differs\n", name, i);
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+* This function compares a programmed descriptor with a reference
+* descriptor. Buffer addresses are not compared, the buffers they point to
+* are.
+*
+* @param	desc is the programmed descriptor.
+* @param	ref is the reference descriptor.
+* @param	legacy is non zero if the reference was programmed by the legacy
+* 			implementation.
+*
+* @return	0 if the descriptors match, 1 otherwise
+*
+******************************************************************************/
+static int XVWarpInitTest_Compare(const XVWarpInitVector_Hw_Aligned *desc,
+		const XVWarpInitVector_Hw_Aligned *ref, u8 legacy)
+{
+	XVWarpInitVector_Hw_Aligned a, b;
+	const u32 *words = (const u32 *)desc;
+	u32 checksum = 0, i, n_pts;
+	int diff = 0;
+
+	memcpy((void *)&a, (const void *)desc, sizeof(a));
+	memcpy((void *)&b, (const void *)ref, sizeof(b));
+
+	/* The checksum covers the buffer addresses, so check it separately */
+	for (i = 0; i < XV_TEST_CHECKSUM_WORDS; i++)
+		checksum ^= words[i];
+	if (checksum != desc->driver_checksum) {
+		printf("  driver_checksum mismatch\n");
+		diff = 1;
+	}
+
+	a.src_ctrl_x_pts = b.src_ctrl_x_pts = 0;
+	a.src_ctrl_y_pts = b.src_ctrl_y_pts = 0;
+	a.src_tangents_x = b.src_tangents_x = 0;
+	a.src_tangents_y = b.src_tangents_y = 0;
+	a.interm_x = b.interm_x = 0;
+	a.interm_y = b.interm_y = 0;
+	a.driver_checksum = b.driver_checksum = 0;
+	a.remap_nextaddr = b.remap_nextaddr = 0;
+
+	if (legacy) {
+		/* Fields the legacy implementation leaves uninitialized */
+		if (desc->warp_type == DISTORTION_ARBITARY) {
+			memset((void *)&a.k_pre, 0, offsetof(XVWarpInitVector_Hw_Aligned,
+					width_Q4) - offsetof(XVWarpInitVector_Hw_Aligned, k_pre));
+			memset((void *)&b.k_pre, 0, offsetof(XVWarpInitVector_Hw_Aligned,
+					width_Q4) - offsetof(XVWarpInitVector_Hw_Aligned, k_pre));
+			memset((void *)a.h, 0, sizeof(a.h) + sizeof(a.h_Qbits) +
+					sizeof(a.h_trans));
+			memset((void *)b.h, 0, sizeof(b.h) + sizeof(b.h_Qbits) +
+					sizeof(b.h_trans));
+		} else {
+			a.num_ctrl_pts = b.num_ctrl_pts = 0;
+		}
+	}
+
+	for (i = 0; i < (sizeof(a) / sizeof(u32)); i++) {
+		if (((const u32 *)&a)[i] != ((const u32 *)&b)[i]) {
+			printf("  descriptor word %u: 0x%08x, expected 0x%08x\n", i,
+				((const u32 *)&a)[i], ((const u32 *)&b)[i]);
+			diff = 1;
+		}
+	}
+
+	if ((diff == 0) && (desc->warp_type == DISTORTION_ARBITARY)) {
+		n_pts = desc->num_ctrl_pts + 1;
+		diff |= XVWarpInitTest_CompareBuf("src_ctrl_x_pts",
+				desc->src_ctrl_x_pts, ref->src_ctrl_x_pts,
+				sizeof(u16) * n_pts);
+		diff |= XVWarpInitTest_CompareBuf("src_ctrl_y_pts",
+				desc->src_ctrl_y_pts, ref->src_ctrl_y_pts,
+				sizeof(u16) * n_pts);
+		diff |= XVWarpInitTest_CompareBuf("src_tangents_x",
+				desc->src_tangents_x, ref->src_tangents_x,
+				sizeof(s32) * 3 * desc->num_ctrl_pts);
+		diff |= XVWarpInitTest_CompareBuf("src_tangents_y",
+				desc->src_tangents_y, ref->src_tangents_y,
+				sizeof(s32) * 3 * desc->num_ctrl_pts);
+		diff |= XVWarpInitTest_CompareBuf("interm_x", desc->interm_x,
+				ref->interm_x, sizeof(s32) * desc->width * n_pts);
+		diff |= XVWarpInitTest_CompareBuf("interm_y", desc->interm_y,
+				ref->interm_y, sizeof(s32) * desc->height * n_pts);
+	}
+
+	return diff;
+}
+
+/*****************************************************************************/
+/**
+* This function programs a configuration from scratch and compares it with
+* the descriptor programmed incrementally.
+*
+* @param	inst is the instance programmed incrementally.
+* @param	descnum is the descriptor number.
+* @param	d is the configuration of the descriptor.
+* @param	stats is the test statistics.
+*
+* @return	0 if the descriptors match, 1 otherwise
+*
+******************************************************************************/
+static int XVWarpInitTest_Check(XV_warp_init *inst, u32 descnum,
+		XVWarpInitTest_Desc *d, XVWarpInitTest_Stats *stats)
+{
+	XV_warp_init ref;
+	int diff;
+
+	if (XVWarpInitTest_InitInstance(&ref, 1,
+			XVWarpInit_SetNumOfDescriptors) != XST_SUCCESS) {
+		printf("Descriptor allocation failed\n");
+		exit(1);
+	}
+	if (XVWarpInit_ProgramDescriptor(&ref, 0, &d->cfg) != XST_SUCCESS) {
+		printf("  reference programming failed\n");
+		diff = 1;
+	} else {
+		diff = XVWarpInitTest_Compare(XVWarpInitTest_GetDesc(inst, descnum),
+				XVWarpInitTest_GetDesc(&ref, 0), 0);
+	}
+	XVWarpInit_ClearNumOfDescriptors(&ref);
+	stats->compared++;
+
+#ifdef XV_TEST_LEGACY
+	if (diff == 0) {
+		static XV_warp_init legacy;
+		static u8 legacy_init;
+
+		if (!legacy_init) {
+			if (XVWarpInitTest_InitInstance(&legacy, 1,
+					XLegacy_SetNumOfDescriptors) != XST_SUCCESS) {
+				printf("Descriptor allocation failed\n");
+				exit(1);
+			}
+			legacy_init = 1;
+		}
+		XLegacy_ProgramDescriptor(&legacy, 0, &d->cfg);
+		diff = XVWarpInitTest_Compare(XVWarpInitTest_GetDesc(inst, descnum),
+				XVWarpInitTest_GetDesc(&legacy, 0), 1);
+		stats->legacy_compared++;
+	}
+#endif
+
+	return diff;
+}
+
+/*****************************************************************************/
+/**
+* This function runs the randomized test.
+*
+* @param	num_changes is the number of configuration changes.
+*
+* @return	0 if all checks passed, 1 otherwise
+*
+******************************************************************************/
+static int XVWarpInitTest_Run(u32 num_changes)
+{
+	static XVWarpInitTest_Desc descs[XV_TEST_NUM_DESC];
+	XVWarpInitTest_Stats stats;
+	XVWarpInitTest_Desc *d;
+	XVWarpInitTest_Change change;
+	XV_warp_init inst;
+	u32 step, descnum;
+	u8 reject;
+	int status;
+
+	memset(&stats, 0, sizeof(stats));
+	if (XVWarpInitTest_InitInstance(&inst, XV_TEST_NUM_DESC,
+			XVWarpInit_SetNumOfDescriptors) != XST_SUCCESS) {
+		printf("Descriptor allocation failed\n");
+		return 1;
+	}
+
+	for (descnum = 0; descnum < XV_TEST_NUM_DESC; descnum++) {
+		d = &descs[descnum];
+		XVWarpInitTest_NewConfig(d, (descnum & 1) ? DISTORTION_LENS :
+				DISTORTION_ARBITARY);
+		d->programmed = (XVWarpInit_ProgramDescriptor(&inst, descnum,
+				&d->cfg) == XST_SUCCESS);
+		if (!d->programmed ||
+				XVWarpInitTest_Check(&inst, descnum, d, &stats)) {
+			printf("Initial descriptor %u failed\n", descnum);
+			stats.errors++;
+		}
+	}
+
+	for (step = 0; step < num_changes; step++) {
+		XVWarpInitTest_Desc next;
+
+		descnum = (u32)XVWarpInitTest_Rand(0, XV_TEST_NUM_DESC - 1);
+		d = &descs[descnum];
+		next = *d;
+		next.cfg.ctr_pts = next.mesh;
+		change = XVWarpInitTest_PickChange(d);
+		reject = XVWarpInitTest_Apply(&next, change);
+		stats.changes[change]++;
+
+		status = XVWarpInit_ProgramDescriptor(&inst, descnum, &next.cfg);
+		if (reject) {
+			/* The descriptor stays invalid until reprogrammed */
+			if (status == XST_SUCCESS) {
+				printf("Step %u, descriptor %u: %s accepted\n", step,
+						descnum, change_names[change]);
+				stats.errors++;
+			}
+			d->programmed = 0;
+			stats.rejected++;
+			continue;
+		}
+
+		*d = next;
+		d->cfg.ctr_pts = d->mesh;
+		d->programmed = (status == XST_SUCCESS);
+		if (!d->programmed ||
+				XVWarpInitTest_Check(&inst, descnum, d, &stats)) {
+			printf("Step %u, descriptor %u: %s (%s %ux%u grid %u) failed\n",
+					step, descnum, change_names[change],
+					(d->cfg.warp_type == DISTORTION_ARBITARY) ?
+					"arbitrary" : "lens", d->cfg.width,
+					d->cfg.height, d->cfg.num_ctrl_pts);
+			stats.errors++;
+		}
+	}
+
+	/* Descriptors not programmed last must be unaffected */
+	for (descnum = 0; descnum < XV_TEST_NUM_DESC; descnum++) {
+		d = &descs[descnum];
+		if (d->programmed &&
+				XVWarpInitTest_Check(&inst, descnum, d, &stats)) {
+			printf("Final descriptor %u failed\n", descnum);
+			stats.errors++;
+		}
+	}
+	XVWarpInit_ClearNumOfDescriptors(&inst);
+
+	for (change = XV_TEST_MOVE_POINT; change < XV_TEST_NUM_CHANGES; change++)
+		printf("%-16s %8llu\n", change_names[change],
+				(unsigned long long)stats.changes[change]);
+	printf("rejected         %8llu\n", (unsigned long long)stats.rejected);
+	printf("compared         %8llu\n", (unsigned long long)stats.compared);
+#ifdef XV_TEST_LEGACY
+	printf("legacy compared  %8llu\n",
+			(unsigned long long)stats.legacy_compared);
+#endif
+	printf("%s: %llu errors\n", (stats.errors == 0U) ? "PASS" : "FAIL",
+			(unsigned long long)stats.errors);
+
+	return (stats.errors == 0U) ? 0 : 1;
+}
+
+/*****************************************************************************/
+/**
+* This function measures XVWarpInit_ProgramDescriptor for one kind of
+* change.
+*
+* @param	d is the configuration, already programmed into descriptor 0.
+* @param	inst is the driver instance.
+* @param	change is the change applied before every call.
+* @param	calls is the number of timed calls.
+*
+* @return	Average time per call in ns
+*
+******************************************************************************/
+static u64 XVWarpInitTest_Time(XVWarpInitTest_Desc *d, XV_warp_init *inst,
+		XVWarpInitTest_Change change, u32 calls)
+{
+	u64 total = 0, start;
+	u32 i;
+
+	for (i = 0; i < calls; i++) {
+		if (change == XV_TEST_WARP_TYPE) {
+			/* Full computation of a new descriptor */
+			XVWarpInit_ClearNumOfDescriptors(inst);
+			XVWarpInit_SetNumOfDescriptors(inst, 1);
+		} else {
+			(void)XVWarpInitTest_Apply(d, change);
+		}
+		start = XVWarpInitTest_TimeNs();
+		if (XVWarpInit_ProgramDescriptor(inst, 0, &d->cfg) != XST_SUCCESS) {
+			printf("Programming failed\n");
+			exit(1);
+		}
+		total += XVWarpInitTest_TimeNs() - start;
+	}
+
+	return total / calls;
+}
+
+/*****************************************************************************/
+/**
+* This function runs the per descriptor benchmark.
+*
+* @param	calls is the number of timed calls per measurement.
+*
+* @return	0
+*
+******************************************************************************/
+static int XVWarpInitTest_Bench(u32 calls)
+{
+	static const struct {
+		u16 width;
+		u16 height;
+		u8 warp_type;
+		u32 grid;
+	} cases[] = {
+		{ 1920, 1080, DISTORTION_ARBITARY, 8 },
+		{ 1920, 1080, DISTORTION_ARBITARY, 16 },
+		{ 1920, 1080, DISTORTION_ARBITARY, 32 },
+		{ 3840, 2160, DISTORTION_ARBITARY, 16 },
+		{ 1920, 1080, DISTORTION_LENS, 0 },
+		{ 3840, 2160, DISTORTION_LENS, 0 },
+	};
+	static XVWarpInitTest_Desc d;
+	XV_warp_init inst;
+	u32 i;
+
+	printf("%-10s %-9s %4s %12s %12s %12s\n", "frame", "warp", "grid",
+			"full(us)", "change(us)", "same(us)");
+	for (i = 0; i < (sizeof(cases) / sizeof(cases[0])); i++) {
+		u64 full, change, same;
+
+		XVWarpInitTest_NewConfig(&d, cases[i].warp_type);
+		d.cfg.width = cases[i].width;
+		d.cfg.height = cases[i].height;
+		if (cases[i].warp_type == DISTORTION_ARBITARY) {
+			d.cfg.num_ctrl_pts = cases[i].grid;
+			XVWarpInitTest_NewMesh(&d);
+		}
+		if (XVWarpInitTest_InitInstance(&inst, 1,
+				XVWarpInit_SetNumOfDescriptors) != XST_SUCCESS) {
+			printf("Descriptor allocation failed\n");
+			return 1;
+		}
+
+		full = XVWarpInitTest_Time(&d, &inst, XV_TEST_WARP_TYPE, calls);
+		change = XVWarpInitTest_Time(&d, &inst,
+				(cases[i].warp_type == DISTORTION_ARBITARY) ?
+				XV_TEST_MOVE_POINT : XV_TEST_LENS_K, calls);
+		same = XVWarpInitTest_Time(&d, &inst, XV_TEST_NO_CHANGE, calls);
+		XVWarpInit_ClearNumOfDescriptors(&inst);
+
+		printf("%4ux%-5u %-9s %4u %12.2f %12.2f %12.2f\n",
+				cases[i].width, cases[i].height,
+				(cases[i].warp_type == DISTORTION_ARBITARY) ?
+				"arbitrary" : "lens", cases[i].grid,
+				full / 1000.0, change / 1000.0, same / 1000.0);
+	}
+
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	u32 num_changes = XV_TEST_DEF_CHANGES;
+	unsigned int seed = 1;
+	u8 bench = 0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "n:s:bv")) != -1) {
+		switch (opt) {
+		case 'n':
+			num_changes = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			seed = (unsigned int)strtoul(optarg, NULL, 0);
+			break;
+		case 'b':
+			bench = 1;
+			break;
+		case 'v':
+			verbose = 1;
+			break;
+		default:
+			fprintf(stderr, "Usage: %s [-n changes] [-s seed] [-b] [-v]\n",
+					argv[0]);
+			return 2;
+		}
+	}
+	srand(seed);
+
+	if (bench)
+		return XVWarpInitTest_Bench(XV_TEST_BENCH_CALLS);
+
+	return XVWarpInitTest_Run(num_changes);
+}
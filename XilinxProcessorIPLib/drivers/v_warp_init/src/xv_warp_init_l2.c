@@ -10,6 +10,7 @@
 #include "sleep.h"
 #include "xdebug.h"
 #include <stdlib.h>
+#include <string.h>
 
 /************************** Constant Definitions *****************************/
 #define PTR_OFFSET_SZ sizeof(u16)
@@ -24,17 +25,43 @@ typedef u16 offset_t;
 #define REMAP_ADDR_WIDTH				32
 #define XV_WAIT_FOR_FLUSH_DONE		    (25)
 #define XV_WAIT_FOR_FLUSH_DONE_TIMEOUT	(2000)
+#define XV_ARB_MEM_ALIGN				8
+#define XV_ARB_ALL_LINES				(~(u64)0)
+
+/**************************** Type Definitions *******************************/
+/*
+ * Each descriptor is allocated together with the state needed to recompute
+ * it incrementally. The IP only reads the hardware descriptor at the start
+ * of the node, the rest is driver private.
+ */
+typedef struct {
+	XVWarpInitVector_Hw_Aligned hw;	/* Descriptor read by the IP */
+	XVWarpInitVector_Hw desc;		/* Last programmed descriptor */
+	s32 h[9];						/* Last programmed projective transform */
+	XVWarpInit_ArbParam arbit_param;/* Persistent arbitrary warp buffers */
+	void *arb_mem;					/* Arena backing arbit_param buffers */
+	u8 valid;						/* desc matches the programmed descriptor */
+} XVWarpInit_DescNode;
 
 /************************** Function Prototypes ******************************/
 static void *XVWarpInit_aligned_malloc(size_t align, size_t size);
 static void XVWarpInit_aligned_free(void * ptr);
-static void XVWarpInit_OneTimeCalcs(XVWarpInitVector_Hw *initvector_hw, int *h);
+static void estimate_projtrans_Qbits(int *proj_trans, short *h, int *h_trans,
+		unsigned char *h_Qbits);
+static void XVWarpInit_CalcNormFactor(XVWarpInitVector_Hw *initvector_hw);
+static void XVWarpInit_CalcKParams(s16 k, u16 *k0, u16 *k1, u32 *Q_fact,
+		s8 *k0_Q_bits, s8 *k1_Q_bits);
 static void XVWarpInit_OnetimeCalcsArbt(XVWarpInit_ArbParam *arbitrary_param,
-					unsigned short fr_width, unsigned short fr_height);
+		unsigned short fr_width, unsigned short fr_height,
+		u64 col_mask, u64 row_mask, u8 tangents);
 static void XVWarpInit_SetDescriptor(XVWarpInitVector_Hw_Aligned *descptr,
 		XVWarpInitVector_Hw *initvector_hw);
-static void XVWarpInit_AllocArbMem(XVWarpInit_ArbParam *arbitrary_param,
+static int XVWarpInit_AllocArbMem(XVWarpInit_DescNode *node,
 		int grid_size, u16 fr_width, u16 fr_height);
+static void XVWarpInit_FreeArbMem(XVWarpInit_DescNode *node);
+static void XVWarpInit_DiffMeshInfo(XVWarpInit_ArbParam *arbitrary_param,
+		XVWarpInit_ArbParam_MeshInfo *ctrl_pts,
+		u64 *col_mask, u64 *row_mask);
 static int XVWarpInit_ParseMeshInfo(XVWarpInit_ArbParam *arbitrary_param,
 		XVWarpInit_ArbParam_MeshInfo *ctrl_pts,
 		short fr_width, short fr_height);
@@ -83,10 +110,10 @@ int XVWarpInit_SetNumOfDescriptors(XV_warp_init *InstancePtr,
 	for (descnum = 0; descnum < num_desc; descnum++)
 	{
 		currptr = XVWarpInit_aligned_malloc(InstancePtr->config->axi_mm_data_width/8,
-				sizeof(XVWarpInitVector_Hw_Aligned));
+				sizeof(XVWarpInit_DescNode));
 		if (currptr == NULL)
 			return XST_FAILURE;
-		memset((u32 *)currptr, 0, sizeof(XVWarpInitVector_Hw_Aligned));
+		memset((u32 *)currptr, 0, sizeof(XVWarpInit_DescNode));
 
 		if (descnum == 0)
 			descptr = currptr;
@@ -123,10 +150,12 @@ void XVWarpInit_ClearNumOfDescriptors(XV_warp_init *InstancePtr)
 
 	while(head->remap_nextaddr) {
 		tmpptr = (XVWarpInitVector_Hw_Aligned *)head->remap_nextaddr;
+		XVWarpInit_FreeArbMem((XVWarpInit_DescNode *)head);
 		XVWarpInit_aligned_free(head);
 		head = tmpptr;
 	}
 
+	XVWarpInit_FreeArbMem((XVWarpInit_DescNode *)head);
 	XVWarpInit_aligned_free(head);
 	InstancePtr->RemapVectorDesc_BaseAddr = 0;
 	InstancePtr->NumDescriptors = 0;
@@ -136,21 +165,31 @@ void XVWarpInit_ClearNumOfDescriptors(XV_warp_init *InstancePtr)
 /**
 * This function programs a descriptor with given configurations.
 *
+* The configuration last programmed into each descriptor is remembered and
+* only the parts affected by a change are recomputed. Reprogramming a
+* descriptor with unchanged configurations does not touch the descriptor
+* memory. For arbitrary warp only the spline lines passing through moved
+* control points are recomputed, and the arbitrary warp buffers are kept
+* per descriptor and reused until the grid or frame size changes.
+*
 * @param  InstancePtr is a pointer to core instance to be worked upon
 * @param  Descnum is the descriptor number which to be configured
 * @param  ConfigPtr is the input configuration pointer which to be configured
 * 					into the descriptor
 *
 * @return XST_SUCCESS if programming descriptor is successful
-*         XST_FAILURE if input configurations are not valid.
+*         XST_FAILURE if input configurations are not valid or memory for
+*                     the arbitrary warp buffers could not be allocated.
 *
 ******************************************************************************/
 int XVWarpInit_ProgramDescriptor(XV_warp_init *InstancePtr,
 		u32 Descnum, XVWarpInit_InputConfigs *ConfigPtr)
 {
-	XVWarpInitVector_Hw desc;
-	XVWarpInit_ArbParam arbit_param;
-	XVWarpInitVector_Hw_Aligned *descptr;
+	XVWarpInitVector_Hw *desc;
+	XVWarpInit_ArbParam *arbit_param;
+	XVWarpInit_DescNode *node;
+	u64 col_mask = XV_ARB_ALL_LINES, row_mask = XV_ARB_ALL_LINES;
+	u8 full, changed;
 
 	Xil_AssertNonvoid(InstancePtr);
 
@@ -162,42 +201,109 @@ int XVWarpInit_ProgramDescriptor(XV_warp_init *InstancePtr,
 	if (XVWarpInit_ValidateInputConfigs(InstancePtr, ConfigPtr) != XST_SUCCESS)
 		return XST_FAILURE;
 
-	descptr = (XVWarpInitVector_Hw_Aligned *)InstancePtr->RemapVectorDesc_BaseAddr;
+	node = (XVWarpInit_DescNode *)InstancePtr->RemapVectorDesc_BaseAddr;
 	for (u32 i = 0; i < Descnum; i++) {
-		descptr = (XVWarpInitVector_Hw_Aligned *)descptr->remap_nextaddr;
+		node = (XVWarpInit_DescNode *)node->hw.remap_nextaddr;
+	}
+	desc = &node->desc;
+	arbit_param = &node->arbit_param;
+
+	/* Frame size and warp type changes invalidate every derived value */
+	full = !node->valid || (desc->width != ConfigPtr->width) ||
+		(desc->height != ConfigPtr->height) ||
+		(desc->warp_type != ConfigPtr->warp_type);
+	if ((ConfigPtr->warp_type == DISTORTION_ARBITARY) &&
+			(desc->num_ctrl_pts != ConfigPtr->num_ctrl_pts))
+		full = 1;
+
+	changed = full || (desc->bytes_per_pixel != ConfigPtr->bytes_per_pixel) ||
+		(desc->filter_table_addr_0 != ConfigPtr->filter_table_addr_0) ||
+		(desc->filter_table_addr_1 != ConfigPtr->filter_table_addr_1);
+
+	if (full) {
+		node->valid = 0;
+		memset(desc, 0, sizeof(XVWarpInitVector_Hw));
+		desc->width	= ConfigPtr->width;
+		desc->height	= ConfigPtr->height;
+		desc->warp_type = ConfigPtr->warp_type;
+		desc->width_Q4 = desc->width << REMAP_FIX_ACC;
+		desc->height_Q4 = desc->height << REMAP_FIX_ACC;
 	}
+	desc->bytes_per_pixel = ConfigPtr->bytes_per_pixel;
+	desc->filter_table_addr_0 = ConfigPtr->filter_table_addr_0;
+	desc->filter_table_addr_1 = ConfigPtr->filter_table_addr_1;
+
+	if (desc->warp_type == DISTORTION_ARBITARY) {
+		if (full) {
+			if (XVWarpInit_AllocArbMem(node, ConfigPtr->num_ctrl_pts,
+					desc->width, desc->height) != XST_SUCCESS)
+				return XST_FAILURE;
+		} else {
+			XVWarpInit_DiffMeshInfo(arbit_param, ConfigPtr->ctr_pts,
+					&col_mask, &row_mask);
+			if (col_mask || row_mask)
+				changed = 1;
+		}
+
+		/*
+		 * Every mesh is validated, also when only its source points
+		 * changed. The cached mesh is overwritten while parsing.
+		 */
+		node->valid = 0;
+		if (XVWarpInit_ParseMeshInfo(arbit_param, ConfigPtr->ctr_pts,
+				desc->width, desc->height) != XST_SUCCESS)
+			return XST_FAILURE;
 
-	desc.width	= ConfigPtr->width;
-	desc.height	= ConfigPtr->height;
-	desc.bytes_per_pixel = ConfigPtr->bytes_per_pixel;
-	desc.warp_type = ConfigPtr->warp_type;
-	desc.filter_table_addr_0 = ConfigPtr->filter_table_addr_0;
-	desc.filter_table_addr_1 = ConfigPtr->filter_table_addr_1;
-	desc.width_Q4 = desc.width << REMAP_FIX_ACC;
-	desc.height_Q4 = desc.height << REMAP_FIX_ACC;
-
-	if (desc.warp_type == DISTORTION_ARBITARY) {
-		XVWarpInit_AllocArbMem(&arbit_param, ConfigPtr->num_ctrl_pts,
-				desc.width, desc.height);
-		XVWarpInit_ParseMeshInfo(&arbit_param, ConfigPtr->ctr_pts,
-				desc.width, desc.height);
-		desc.src_ctrl_x_pts	= ((u64)arbit_param.src_ctrl_x_pts)/4;
-		desc.src_ctrl_y_pts	= ((u64)arbit_param.src_ctrl_y_pts)/4;
-		desc.src_tangents_x	= ((u64)arbit_param.src_tangents_x)/4;
-		desc.src_tangents_y	= ((u64)arbit_param.src_tangents_y)/4;
-		desc.interm_x			= ((u64)arbit_param.interm_x)/4;
-		desc.interm_y 		= ((u64)arbit_param.interm_y)/4;
-		desc.num_ctrl_pts 	= ConfigPtr->num_ctrl_pts;
-
-		XVWarpInit_OnetimeCalcsArbt(&arbit_param,
-				desc.width, desc.height);
+		if (!changed) {
+			node->valid = 1;
+			return XST_SUCCESS;
+		}
+
+		desc->src_ctrl_x_pts	= ((u64)arbit_param->src_ctrl_x_pts)/4;
+		desc->src_ctrl_y_pts	= ((u64)arbit_param->src_ctrl_y_pts)/4;
+		desc->src_tangents_x	= ((u64)arbit_param->src_tangents_x)/4;
+		desc->src_tangents_y	= ((u64)arbit_param->src_tangents_y)/4;
+		desc->interm_x		= ((u64)arbit_param->interm_x)/4;
+		desc->interm_y		= ((u64)arbit_param->interm_y)/4;
+		desc->num_ctrl_pts	= ConfigPtr->num_ctrl_pts;
+
+		XVWarpInit_OnetimeCalcsArbt(arbit_param, desc->width, desc->height,
+				col_mask, row_mask, full);
 	} else {
-		desc.k_pre	= ConfigPtr->k_pre;
-		desc.k_post	= ConfigPtr->k_post;
-		XVWarpInit_OneTimeCalcs(&desc, ConfigPtr->h);
+		XVWarpInit_FreeArbMem(node);
+
+		if (full)
+			XVWarpInit_CalcNormFactor(desc);
+
+		if (full || memcmp(node->h, ConfigPtr->h, sizeof(node->h))) {
+			estimate_projtrans_Qbits(ConfigPtr->h, desc->h,
+					desc->h_trans, desc->h_Qbits);
+			memcpy(node->h, ConfigPtr->h, sizeof(node->h));
+			changed = 1;
+		}
+
+		if (full || (desc->k_pre != ConfigPtr->k_pre)) {
+			desc->k_pre = ConfigPtr->k_pre;
+			XVWarpInit_CalcKParams(desc->k_pre, &desc->k0_pre,
+					&desc->k1_pre, &desc->Q_fact_pre,
+					&desc->k0_pre_Q_bits, &desc->k1_pre_Q_bits);
+			changed = 1;
+		}
+
+		if (full || (desc->k_post != ConfigPtr->k_post)) {
+			desc->k_post = ConfigPtr->k_post;
+			XVWarpInit_CalcKParams(desc->k_post, &desc->k0_post,
+					&desc->k1_post, &desc->Q_fact_post,
+					&desc->k0_post_Q_bits, &desc->k1_post_Q_bits);
+			changed = 1;
+		}
+
+		if (!changed)
+			return XST_SUCCESS;
 	}
 
-	XVWarpInit_SetDescriptor(descptr, &desc);
+	XVWarpInit_SetDescriptor(&node->hw, desc);
+	node->valid = 1;
 
 	return XST_SUCCESS;
 }
@@ -492,115 +598,87 @@ static void estimate_projtrans_Qbits(int *proj_trans, short *h, int *h_trans,
 
 /*****************************************************************************/
 /**
-* This function does all the ontime calculation for lens distortion which to
-* be done for each input configs change.
+* This function calculates the lens distortion center and normalization
+* factor which depend only on the frame size.
 *
 * @param	initvector_hw is the pointer to initialization vector.
-* @param	proj_trans is the pointer to projective transformation input.
 *
 * @return	None
 *
 ******************************************************************************/
-static void XVWarpInit_OneTimeCalcs(XVWarpInitVector_Hw *initvector_hw,
-		int *proj_trans)
+static void XVWarpInit_CalcNormFactor(XVWarpInitVector_Hw *initvector_hw)
 {
-	unsigned char int_bits;
-	unsigned int tempx, tempy;
-	unsigned int Q22_one, Q31_one;
 	int cenX = initvector_hw->width >> 1;
 	int cenY = initvector_hw->height >> 1;
 	unsigned int Radius2 = (cenX * cenX) + (cenY * cenY);
 
 	initvector_hw->normfactor = (unsigned int)(4294967295 / Radius2);
 
-	initvector_hw->cenX = cenX << 4;;
+	initvector_hw->cenX = cenX << 4;
 	initvector_hw->cenY = cenY << 4;
+}
 
-	Q22_one = ((unsigned int)1) << 22;
-	Q31_one = ((unsigned int)1) << 31;
-
-	estimate_projtrans_Qbits(proj_trans, initvector_hw->h,
-			initvector_hw->h_trans, initvector_hw->h_Qbits);
-
-	initvector_hw->k1_pre = 0;
-	initvector_hw->k0_pre = 0;
-	initvector_hw->Q_fact_pre = 0;
-	initvector_hw->k0_pre_Q_bits = 0;
-	initvector_hw->k1_pre_Q_bits = 0;
-	if (initvector_hw->k_pre)
-	{
-		if (initvector_hw->k_pre < 0) {
-			initvector_hw->k1_pre = (unsigned short)(-initvector_hw->k_pre);
-			tempx = XVWarpInit_ExponentialPos(initvector_hw->k1_pre);
-			tempy = tempx - Q22_one;
-
-			initvector_hw->Q_fact_pre = Q22_one;
-		}
-		else {
-			initvector_hw->k1_pre = initvector_hw->k_pre;
-
-			tempx = XVWarpInit_ExponentialNeg(initvector_hw->k1_pre);
-			tempx >>= 9;
-			tempy = Q22_one - tempx;
-
-			initvector_hw->Q_fact_pre = Q31_one;
-		}
-
-		int_bits = XVWarpInit_DominantBit(initvector_hw->k1_pre >> 12);
-		initvector_hw->k1_pre >>= int_bits;
-		initvector_hw->k1_pre_Q_bits = 4 - int_bits;
-
-		int_bits = XVWarpInit_DominantBit(tempy >> 22);
-
-		tempx = (unsigned short)((tempy) >> (int_bits + 6));
-
-		initvector_hw->k0_pre = XVWarpInit_Inverse(tempx, int_bits,
-				&initvector_hw->k0_pre_Q_bits);
-
-		initvector_hw->k0_pre >>= 2;
-		initvector_hw->k0_pre *= 3;
-		initvector_hw->k0_pre_Q_bits -= 2;
+/*****************************************************************************/
+/**
+* This function calculates the fixed point parameters of one lens distortion
+* coefficient. It is used for both the pre and post distortion coefficients.
+*
+* @param	k is the lens distortion coefficient.
+* @param	k0 is the pointer to the k0 parameter to be calculated.
+* @param	k1 is the pointer to the k1 parameter to be calculated.
+* @param	Q_fact is the pointer to the Q factor to be calculated.
+* @param	k0_Q_bits is the pointer to the fraction bits of k0.
+* @param	k1_Q_bits is the pointer to the fraction bits of k1.
+*
+* @return	None
+*
+******************************************************************************/
+static void XVWarpInit_CalcKParams(s16 k, u16 *k0, u16 *k1, u32 *Q_fact,
+		s8 *k0_Q_bits, s8 *k1_Q_bits)
+{
+	unsigned char int_bits;
+	unsigned int tempx, tempy;
+	unsigned int Q22_one = ((unsigned int)1) << 22;
+	unsigned int Q31_one = ((unsigned int)1) << 31;
+
+	*k1 = 0;
+	*k0 = 0;
+	*Q_fact = 0;
+	*k0_Q_bits = 0;
+	*k1_Q_bits = 0;
+	if (!k)
+		return;
+
+	if (k < 0) {
+		*k1 = (unsigned short)(-k);
+		tempx = XVWarpInit_ExponentialPos(*k1);
+		tempy = tempx - Q22_one;
+
+		*Q_fact = Q22_one;
 	}
+	else {
+		*k1 = k;
 
-	initvector_hw->k1_post = 0;
-	initvector_hw->k0_post = 0;
-	initvector_hw->k0_post_Q_bits = 0;
-	initvector_hw->Q_fact_post = 0;
-	initvector_hw->k1_post_Q_bits = 0;
-	if (initvector_hw->k_post)
-	{
-		if (initvector_hw->k_post < 0) {
-			initvector_hw->k1_post = (unsigned short)(-initvector_hw->k_post);
-			tempx = XVWarpInit_ExponentialPos(initvector_hw->k1_post);
-			tempy = tempx - Q22_one;
-
-			initvector_hw->Q_fact_post = Q22_one;
-		}
-		else {
-			initvector_hw->k1_post = initvector_hw->k_post;
-
-			tempx = XVWarpInit_ExponentialNeg(initvector_hw->k1_post);
-			tempx >>= 9;
-			tempy = Q22_one - tempx;
+		tempx = XVWarpInit_ExponentialNeg(*k1);
+		tempx >>= 9;
+		tempy = Q22_one - tempx;
 
-			initvector_hw->Q_fact_post = Q31_one;
-		}
+		*Q_fact = Q31_one;
+	}
 
-		int_bits = XVWarpInit_DominantBit(initvector_hw->k1_post >> 12);
-		initvector_hw->k1_post >>= int_bits;
-		initvector_hw->k1_post_Q_bits = 4 - int_bits;
+	int_bits = XVWarpInit_DominantBit(*k1 >> 12);
+	*k1 >>= int_bits;
+	*k1_Q_bits = 4 - int_bits;
 
-		int_bits = XVWarpInit_DominantBit(tempy >> 22);
+	int_bits = XVWarpInit_DominantBit(tempy >> 22);
 
-		tempx = (unsigned short)((tempy) >> (int_bits + 6));
+	tempx = (unsigned short)((tempy) >> (int_bits + 6));
 
-		initvector_hw->k0_post = XVWarpInit_Inverse(tempx, int_bits,
-				&initvector_hw->k0_post_Q_bits);
+	*k0 = XVWarpInit_Inverse(tempx, int_bits, (char *)k0_Q_bits);
 
-		initvector_hw->k0_post >>= 2;
-		initvector_hw->k0_post *= 3;
-		initvector_hw->k0_post_Q_bits -= 2;
-	}
+	*k0 >>= 2;
+	*k0 *= 3;
+	*k0_Q_bits -= 2;
 }
 
 /*****************************************************************************/
@@ -626,7 +704,7 @@ static void apply_arbt_warp_line(short *knots_x, short *knots_y,
 	char n_bits, diff_bits, x0_bits;
 	unsigned char integerbits;
 	int dx0, dx1, dx2, t, x2;
-	int dy0, dy1, dy2;
+	int dy0, dy1, dy2 = 0;
 	long long ll_tmp;
 	int a1x1, a2x2, a3x3;
 
@@ -650,14 +728,22 @@ static void apply_arbt_warp_line(short *knots_x, short *knots_y,
 			dy0 *= dx0;
 			dy0 >>= (x0_bits - 16);
 
-			diff = (unsigned short)(p3 - knots_x[j1]);
-			integerbits = XVWarpInit_DominantBit(diff);
-			diff_bits = 16 - integerbits;
-			diff <<= diff_bits;
-			dx1 = XVWarpInit_Inverse(diff, integerbits, &n_bits);
-			dy1 = knots_y[j + 1] - knots_y[j1];
-			dy1 *= dx1;
-			dy1 >>= (n_bits - 16);
+			if (j > 1) {
+				/*
+				 * Chord j-1..j+1 of this segment is the chord j..j+2
+				 * of the previous one, reuse its slope
+				 */
+				dy1 = dy2;
+			} else {
+				diff = (unsigned short)(p3 - knots_x[j1]);
+				integerbits = XVWarpInit_DominantBit(diff);
+				diff_bits = 16 - integerbits;
+				diff <<= diff_bits;
+				dx1 = XVWarpInit_Inverse(diff, integerbits, &n_bits);
+				dy1 = knots_y[j + 1] - knots_y[j1];
+				dy1 *= dx1;
+				dy1 >>= (n_bits - 16);
+			}
 
 			diff = (unsigned short)(knots_x[j2] - p1);
 			integerbits = XVWarpInit_DominantBit(diff);
@@ -828,128 +914,276 @@ static void creat_src_tangents(unsigned short *src_ctrl_pts, int *src_tangents,
 
 /*****************************************************************************/
 /**
-* This function does all the ontime calculation for Arbitary distortion which
-* to be done for each input configs change.
+* This function applies the splines to one column of the control point grid.
 *
 * @param	arbitrary_param is the pointer to input Arbitary parameters.
-* @param	fr_width is the frame width.
+* @param	col is the column index in the control point grid.
 * @param	fr_height is the frame height.
 *
 * @return	None
 *
 ******************************************************************************/
-static void XVWarpInit_OnetimeCalcsArbt(XVWarpInit_ArbParam *arbitrary_param,
-	unsigned short fr_width, unsigned short fr_height) {
-	u32 i, j, l;
+static void XVWarpInit_ArbtColSpline(XVWarpInit_ArbParam *arbitrary_param,
+		u32 col, unsigned short fr_height)
+{
+	u32 i, l;
 	short *knots_x, *knots_y;
 	int *t_data, *int_ptr;
-	u32 grid_size;
 	unsigned short *sh_ptr_x, *sh_ptr_y, num_pts;
 
-	grid_size = arbitrary_param->grid_size;
-
-	num_pts = grid_size + 1;
+	num_pts = arbitrary_param->grid_size + 1;
 	knots_x = arbitrary_param->knots_x;
 	knots_y = arbitrary_param->knots_y;
 
-	//Col wise applying splines
-	for (j = 0; j <= grid_size; j++) {
-		sh_ptr_x = arbitrary_param->dst_ctrl_x_pts + j;
-		sh_ptr_y = arbitrary_param->dst_ctrl_y_pts + j;
-		l = 1;
-		for (i = 0; i < arbitrary_param->num_ctrl_pts; i += num_pts) {
-			knots_x[l] = sh_ptr_x[i];
-			knots_y[l++] = sh_ptr_y[i];
-		}
+	sh_ptr_x = arbitrary_param->dst_ctrl_x_pts + col;
+	sh_ptr_y = arbitrary_param->dst_ctrl_y_pts + col;
+	l = 1;
+	for (i = 0; i < arbitrary_param->num_ctrl_pts; i += num_pts) {
+		knots_x[l] = sh_ptr_x[i];
+		knots_y[l++] = sh_ptr_y[i];
+	}
 
-		knots_x[0] = knots_x[1];
-		knots_y[0] = knots_y[1];
-		knots_x[l] = knots_x[l - 1];
-		knots_y[l] = knots_y[l - 1];
+	knots_x[0] = knots_x[1];
+	knots_y[0] = knots_y[1];
+	knots_x[l] = knots_x[l - 1];
+	knots_y[l] = knots_y[l - 1];
 
-		apply_arbt_warp_line(knots_y, knots_x, grid_size,
-				fr_height, arbitrary_param->temp_row);
+	apply_arbt_warp_line(knots_y, knots_x, arbitrary_param->grid_size,
+			fr_height, arbitrary_param->temp_row);
 
-		t_data = arbitrary_param->interm_y + j;
-		int_ptr = arbitrary_param->temp_row;
-		for (i = 0; i < fr_height; i++) {
-			*t_data = *int_ptr;
-			t_data += num_pts;
-			int_ptr++;
-		}
+	t_data = arbitrary_param->interm_y + col;
+	int_ptr = arbitrary_param->temp_row;
+	for (i = 0; i < fr_height; i++) {
+		*t_data = *int_ptr;
+		t_data += num_pts;
+		int_ptr++;
 	}
+}
 
-	//Row wise applying splines
-	for (j = 0; j <= grid_size; j++) {
-		sh_ptr_x = arbitrary_param->dst_ctrl_x_pts + j * num_pts;
-		sh_ptr_y = arbitrary_param->dst_ctrl_y_pts + j * num_pts;
-		l = 1;
-		for (i = 0; i < num_pts; i++) {
-			knots_x[l] = sh_ptr_x[i];
-			knots_y[l++] = sh_ptr_y[i];
-		}
+/*****************************************************************************/
+/**
+* This function applies the splines to one row of the control point grid.
+*
+* @param	arbitrary_param is the pointer to input Arbitary parameters.
+* @param	row is the row index in the control point grid.
+* @param	fr_width is the frame width.
+*
+* @return	None
+*
+******************************************************************************/
+static void XVWarpInit_ArbtRowSpline(XVWarpInit_ArbParam *arbitrary_param,
+		u32 row, unsigned short fr_width)
+{
+	u32 i, l;
+	short *knots_x, *knots_y;
+	int *t_data, *int_ptr;
+	unsigned short *sh_ptr_x, *sh_ptr_y, num_pts;
 
-		knots_x[0] = knots_x[1];
-		knots_y[0] = knots_y[1];
-		knots_x[l] = knots_x[l - 1];
-		knots_y[l] = knots_y[l - 1];
+	num_pts = arbitrary_param->grid_size + 1;
+	knots_x = arbitrary_param->knots_x;
+	knots_y = arbitrary_param->knots_y;
 
-		apply_arbt_warp_line(knots_x, knots_y, grid_size,
-				fr_width, arbitrary_param->temp_row);
+	sh_ptr_x = arbitrary_param->dst_ctrl_x_pts + row * num_pts;
+	sh_ptr_y = arbitrary_param->dst_ctrl_y_pts + row * num_pts;
+	l = 1;
+	for (i = 0; i < num_pts; i++) {
+		knots_x[l] = sh_ptr_x[i];
+		knots_y[l++] = sh_ptr_y[i];
+	}
 
-		t_data = arbitrary_param->interm_x + j;
-		int_ptr = arbitrary_param->temp_row;
-		for (i = 0; i < fr_width; i++) {
-			*t_data = *int_ptr;
-			t_data += num_pts;
-			int_ptr++;
-		}
+	knots_x[0] = knots_x[1];
+	knots_y[0] = knots_y[1];
+	knots_x[l] = knots_x[l - 1];
+	knots_y[l] = knots_y[l - 1];
+
+	apply_arbt_warp_line(knots_x, knots_y, arbitrary_param->grid_size,
+			fr_width, arbitrary_param->temp_row);
+
+	t_data = arbitrary_param->interm_x + row;
+	int_ptr = arbitrary_param->temp_row;
+	for (i = 0; i < fr_width; i++) {
+		*t_data = *int_ptr;
+		t_data += num_pts;
+		int_ptr++;
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function does the ontime calculation for Arbitary distortion which
+* to be done for each input configs change. Only the grid columns and rows
+* selected by the masks are recomputed.
+*
+* @param	arbitrary_param is the pointer to input Arbitary parameters.
+* @param	fr_width is the frame width.
+* @param	fr_height is the frame height.
+* @param	col_mask is the mask of grid columns to be recomputed.
+* @param	row_mask is the mask of grid rows to be recomputed.
+* @param	tangents is non zero if the source tangents to be recomputed.
+*
+* @return	None
+*
+******************************************************************************/
+static void XVWarpInit_OnetimeCalcsArbt(XVWarpInit_ArbParam *arbitrary_param,
+	unsigned short fr_width, unsigned short fr_height,
+	u64 col_mask, u64 row_mask, u8 tangents) {
+	u32 j;
+	u32 grid_size = arbitrary_param->grid_size;
+
+	//Col wise applying splines
+	for (j = 0; j <= grid_size; j++) {
+		if (col_mask & ((u64)1 << j))
+			XVWarpInit_ArbtColSpline(arbitrary_param, j, fr_height);
+	}
+
+	//Row wise applying splines
+	for (j = 0; j <= grid_size; j++) {
+		if (row_mask & ((u64)1 << j))
+			XVWarpInit_ArbtRowSpline(arbitrary_param, j, fr_width);
 	}
 
-	creat_src_tangents(arbitrary_param->src_ctrl_x_pts,
-			arbitrary_param->src_tangents_x, fr_width, grid_size);
+	/* Source grid depends only on the frame and grid size */
+	if (tangents) {
+		creat_src_tangents(arbitrary_param->src_ctrl_x_pts,
+				arbitrary_param->src_tangents_x, fr_width, grid_size);
 
-	creat_src_tangents(arbitrary_param->src_ctrl_y_pts,
-			arbitrary_param->src_tangents_y, fr_height, grid_size);
+		creat_src_tangents(arbitrary_param->src_ctrl_y_pts,
+				arbitrary_param->src_tangents_y, fr_height, grid_size);
+	}
 }
 
 /*****************************************************************************/
 /**
 * This function allocates the required memory for intermediate arbitary
-* variables/calculation.
+* variables/calculation. All the buffers are carved from one arena which
+* is kept with the descriptor, as the IP reads the source control points,
+* tangents and intermediate vectors for as long as the descriptor is used.
+* A previously allocated arena of the descriptor is released first.
 *
-* @param	arbitrary_param is the pointer to input Arbitary parameters.
+* @param	node is the pointer to the descriptor node.
 * @param	grid_size is the grid size for the arbitary distortion.
 * @param	fr_width is the frame width.
 * @param	fr_height is the frame height.
 *
-* @return	None
+* @return	XST_SUCCESS if the memory is allocated
+* 			XST_FAILURE if the memory allocation failed
 *
 ******************************************************************************/
-static void XVWarpInit_AllocArbMem(XVWarpInit_ArbParam *arbitrary_param,
+static int XVWarpInit_AllocArbMem(XVWarpInit_DescNode *node,
 		int grid_size, u16 fr_width, u16 fr_height)
 {
+	XVWarpInit_ArbParam *arbitrary_param = &node->arbit_param;
+	size_t size_ctrl, size_src, size_tan, size_knots, size_row;
+	size_t size_x, size_y;
+	u8 *mem;
 	int n_pts;
 	int num_ctrl_pts;
 
+	XVWarpInit_FreeArbMem(node);
+
 	n_pts = grid_size + 1;
 	num_ctrl_pts = n_pts * n_pts;
 
+	size_ctrl = align_up(sizeof(unsigned short) * num_ctrl_pts, XV_ARB_MEM_ALIGN);
+	size_src = align_up(sizeof(unsigned short) * n_pts, XV_ARB_MEM_ALIGN);
+	size_tan = align_up(sizeof(int) * grid_size * 3, XV_ARB_MEM_ALIGN);
+	size_knots = align_up(sizeof(short) * (n_pts + 2), XV_ARB_MEM_ALIGN);
+	size_x = sizeof(int) * fr_width * n_pts;
+	size_y = sizeof(int) * fr_height * n_pts;
+	/* Used for both the column and the row splines */
+	size_row = sizeof(int) * ((fr_width > fr_height) ? fr_width : fr_height);
+
+	mem = malloc((2 * size_ctrl) + (2 * size_src) + (2 * size_tan) +
+			(2 * size_knots) + size_x + size_y + size_row);
+	if (mem == NULL) {
+		xil_printf("Arbitrary warp memory allocation failed\n\r");
+		return XST_FAILURE;
+	}
+	node->arb_mem = mem;
+
 	arbitrary_param->grid_size = grid_size;
 	arbitrary_param->num_ctrl_pts = num_ctrl_pts;
 
-	arbitrary_param->dst_ctrl_x_pts = (unsigned short *)malloc(sizeof(unsigned short) * num_ctrl_pts);
-	arbitrary_param->dst_ctrl_y_pts = (unsigned short *)malloc(sizeof(unsigned short) * num_ctrl_pts);
-	arbitrary_param->src_ctrl_x_pts = (unsigned short *)malloc(sizeof(unsigned short) * n_pts);
-	arbitrary_param->src_ctrl_y_pts = (unsigned short *)malloc(sizeof(unsigned short) * n_pts);
-
-	arbitrary_param->src_tangents_x = (int *)malloc(sizeof(int) * grid_size * 3);
-	arbitrary_param->src_tangents_y = (int *)malloc(sizeof(int) * grid_size * 3);
-	arbitrary_param->knots_x = (short *)malloc(sizeof(short) * (n_pts+2));
-	arbitrary_param->knots_y = (short *)malloc(sizeof(short) * (n_pts+2));
-	arbitrary_param->interm_x = (int *)malloc(sizeof(int) * fr_width * n_pts);
-	arbitrary_param->interm_y = (int *)malloc(sizeof(int) * fr_height * n_pts);
-	arbitrary_param->temp_row = (int *)malloc(sizeof(int) * fr_width);
+	/* Word aligned buffers first */
+	arbitrary_param->interm_x = (int *)mem;
+	mem += size_x;
+	arbitrary_param->interm_y = (int *)mem;
+	mem += size_y;
+	arbitrary_param->src_tangents_x = (int *)mem;
+	mem += size_tan;
+	arbitrary_param->src_tangents_y = (int *)mem;
+	mem += size_tan;
+	arbitrary_param->temp_row = (int *)mem;
+	mem += size_row;
+	arbitrary_param->dst_ctrl_x_pts = (unsigned short *)mem;
+	mem += size_ctrl;
+	arbitrary_param->dst_ctrl_y_pts = (unsigned short *)mem;
+	mem += size_ctrl;
+	arbitrary_param->src_ctrl_x_pts = (unsigned short *)mem;
+	mem += size_src;
+	arbitrary_param->src_ctrl_y_pts = (unsigned short *)mem;
+	mem += size_src;
+	arbitrary_param->knots_x = (short *)mem;
+	mem += size_knots;
+	arbitrary_param->knots_y = (short *)mem;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function releases the arbitary warp memory of a descriptor.
+*
+* @param	node is the pointer to the descriptor node.
+*
+* @return	None
+*
+******************************************************************************/
+static void XVWarpInit_FreeArbMem(XVWarpInit_DescNode *node)
+{
+	if (node->arb_mem != NULL) {
+		free(node->arb_mem);
+		node->arb_mem = NULL;
+		memset(&node->arbit_param, 0, sizeof(XVWarpInit_ArbParam));
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function finds the grid columns and rows whose splines are affected
+* by the moved control points of the new mesh information. Only the
+* destination points enter the descriptor, the source points of the mesh
+* are checked by XVWarpInit_ParseMeshInfo.
+*
+* @param	arbitrary_param is the pointer to input Arbitary parameters
+* 			holding the previously parsed mesh.
+* @param	ctrl_pts is the pointer to the input mesh information.
+* @param	col_mask is the mask of grid columns to be recomputed.
+* @param	row_mask is the mask of grid rows to be recomputed.
+*
+* @return	None
+*
+******************************************************************************/
+static void XVWarpInit_DiffMeshInfo(XVWarpInit_ArbParam *arbitrary_param,
+		XVWarpInit_ArbParam_MeshInfo *ctrl_pts,
+		u64 *col_mask, u64 *row_mask)
+{
+	u32 num_pts = arbitrary_param->grid_size + 1;
+	u32 i, row = 0, col = 0;
+
+	*col_mask = 0;
+	*row_mask = 0;
+	for (i = 0; i < arbitrary_param->num_ctrl_pts; i++) {
+		if ((arbitrary_param->dst_ctrl_x_pts[i] != (u16)ctrl_pts[i].d_x) ||
+			(arbitrary_param->dst_ctrl_y_pts[i] != (u16)ctrl_pts[i].d_y)) {
+			*col_mask |= (u64)1 << col;
+			*row_mask |= (u64)1 << row;
+		}
+		if (++col == num_pts) {
+			col = 0;
+			row++;
+		}
+	}
 }
 
 /*****************************************************************************/
@@ -0,0 +1,589 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xvidc_fbpool_test.c
+*
+* Host test of the frame buffer pool (xvidc_fbpool.c).
+*
+* The layout test carves pools for planar, semi-planar and packed memory
+* formats and checks the stride, plane addresses and size checks of
+* XVidC_FbPoolInit().
+*
+* The rate test runs a frame buffer writer and a frame buffer reader model
+* against one pool for every producer:consumer rate ratio of a table, every
+* buffer count from 2 to XVIDC_FBPOOL_MAX_BUFFERS and both policies. Each
+* model latches the programmed buffer on ap_ready and then programs the
+* buffer returned by the pool, as the frame buffer drivers do. The reader is
+* attached after a random number of producer frames, the same way
+* XVFrmbufRd_SetBufferPool() does it. Interrupts due at the same time are
+* serviced in random order. After every pool call the test checks:
+*  - Every buffer is in exactly one state. The buffers latched and
+*    programmed by the writer are PRODUCER, those of the reader are
+*    CONSUMER, the queued ones are QUEUED and all others are FREE.
+*  - The writer never latches or is programmed with a buffer the reader
+*    has latched or programmed, so no frame is written while it is read.
+*  - The reader shows frames in production order and a frame does not
+*    change while it is read.
+*  - XVidC_FbPoolConsumerPeek() returns the buffer XVidC_FbPoolConsumerNext()
+*    returns next.
+*  - Produced = consumed + dropped + queued frames, and every reader
+*    ap_ready with a frame is either a consumed or a repeated frame.
+*  - With DROP_OLDEST the reader takes the newest frame, so no frame is
+*    left queued. With REPEAT_LAST queued frames are never dropped.
+*  - With REPEAT_LAST no frame is dropped when the reader is attached
+*    before the first frame, at least 5 buffers are used and the reader is
+*    not slower than the writer. DROP_OLDEST skips a frame whenever two
+*    frames complete between reader interrupts, which tie order jitter
+*    causes even at equal rates.
+*
+* Usage: xvidc_fbpool_test [-n frames] [-s seed] [-v]
+*
+*  -n  Producer frames per run, 2000 by default.
+*  -s  Seed of the attach delay and interrupt order, 1 by default.
+*  -v  Reports the pool statistics of every run.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ag   10/18/2026 Initial release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <getopt.h>
+#include "xstatus.h"
+#include "xil_assert.h"
+#include "xvidc_fbpool.h"
+
+/************************** Constant Definitions *****************************/
+#define XVIDC_TEST_DEF_FRAMES		2000U
+#define XVIDC_TEST_MAX_ATTACH_DELAY	4U
+#define XVIDC_TEST_MIN_DROP_FREE	5U
+#define XVIDC_TEST_NONE			(-1)
+
+/**************************** Type Definitions *******************************/
+/* Frame buffer core model, buffers are pool indexes or XVIDC_TEST_NONE */
+typedef struct {
+	int Latched;	/* Buffer being written or read */
+	int Programmed;	/* Buffer latched on the next ap_ready */
+	u32 Period;	/* ap_ready period in ticks */
+	u32 Next;	/* Tick of the next ap_ready */
+} XVidC_TestCore;
+
+/* Producer and consumer periods, in ticks */
+typedef struct {
+	u32 Producer;
+	u32 Consumer;
+} XVidC_TestRate;
+
+/************************** Variable Definitions *****************************/
+static const XVidC_TestRate Rates[] = {
+	{1, 1}, {1, 2}, {2, 1}, {2, 3}, {3, 2}, {4, 5}, {5, 4},
+	{2, 5}, {5, 2}, {1001, 1000}, {1000, 1001}, {1, 7}, {7, 1},
+};
+
+static u32 Errors;
+static u32 Verbose;
+
+/* Frame number held by each buffer of the pool, 0 if never written */
+static u32 BufFrame[XVIDC_FBPOOL_MAX_BUFFERS];
+
+/*
+ * Standalone BSP functions used by xvidc_fbpool.c
+ */
+u32 Xil_AssertStatus;
+s32 Xil_AssertWait = 0;
+
+void Xil_Assert(const char8 *File, s32 Line)
+{
+	fprintf(stderr, "Assert %s:%d\n", File, (int)Line);
+	Xil_AssertStatus = XIL_ASSERT_OCCURRED;
+	Errors++;
+}
+
+void xil_printf(const char8 *ctrl1, ...)
+{
+	va_list Args;
+
+	va_start(Args, ctrl1);
+	vprintf(ctrl1, Args);
+	va_end(Args);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reports a failed check.
+*
+******************************************************************************/
+static void XVidC_TestFail(const char *Run, const char *Fmt, ...)
+{
+	va_list Args;
+
+	if (Errors < 20U) {
+		fprintf(stderr, "FAIL %s: ", Run);
+		va_start(Args, Fmt);
+		vfprintf(stderr, Fmt, Args);
+		va_end(Args);
+		fputc('\n', stderr);
+	}
+	Errors++;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks the layout of one pool.
+*
+******************************************************************************/
+static void XVidC_TestLayoutOne(XVidC_ColorFormat MemFmt, u32 Width,
+		u32 Height, u32 Align, u8 NumPlanes, u32 Stride, u32 ChromaLines)
+{
+	XVidC_FbPool Pool;
+	XVidC_VideoStream Stream;
+	UINTPTR Base = 0x10000000;
+	u32 FrameSize;
+	u32 Plane;
+	u8 Index;
+	char Run[64];
+
+	snprintf(Run, sizeof(Run), "layout fmt %d %ux%u", (int)MemFmt,
+			Width, Height);
+
+	memset(&Stream, 0, sizeof(Stream));
+	Stream.Timing.HActive = Width;
+	Stream.Timing.VActive = Height;
+
+	FrameSize = Stride * (Height + (NumPlanes - 1U) * ChromaLines);
+
+	/* One byte short of the ring fails, the exact size fits */
+	if (XVidC_FbPoolInit(&Pool, Base, FrameSize * 3U - 1U, 3, MemFmt,
+			&Stream, Align, XVIDC_FBPOOL_DROP_OLDEST) == XST_SUCCESS) {
+		XVidC_TestFail(Run, "region too small accepted");
+	}
+	if (XVidC_FbPoolInit(&Pool, Base + 1U, FrameSize * 3U, 3, MemFmt,
+			&Stream, Align, XVIDC_FBPOOL_DROP_OLDEST) == XST_SUCCESS) {
+		XVidC_TestFail(Run, "misaligned base accepted");
+	}
+	if (XVidC_FbPoolInit(&Pool, Base, FrameSize * 3U, 3, MemFmt,
+			&Stream, Align, XVIDC_FBPOOL_DROP_OLDEST) != XST_SUCCESS) {
+		XVidC_TestFail(Run, "init failed");
+		return;
+	}
+
+	if ((Pool.NumPlanes != NumPlanes) || (Pool.Stride != Stride) ||
+			(Pool.FrameSize != FrameSize)) {
+		XVidC_TestFail(Run, "planes %u stride %u size %u, expected "
+				"%u %u %u", Pool.NumPlanes, Pool.Stride,
+				Pool.FrameSize, NumPlanes, Stride, FrameSize);
+	}
+
+	for (Index = 0; Index < Pool.NumBuffers; Index++) {
+		for (Plane = 0; Plane < XVIDC_FBPOOL_MAX_PLANES; Plane++) {
+			UINTPTR Expected = 0;
+
+			if (Plane < NumPlanes) {
+				Expected = Base + (UINTPTR)Index * FrameSize +
+					(UINTPTR)Stride * ((Plane == 0U) ? 0U :
+					Height + (Plane - 1U) * ChromaLines);
+				if ((Expected % Align) != 0U) {
+					XVidC_TestFail(Run, "plane misaligned");
+				}
+			}
+			if (Pool.Buf[Index].Addr[Plane] != Expected) {
+				XVidC_TestFail(Run, "buffer %u plane %u at "
+						"0x%lx, expected 0x%lx", Index,
+						Plane, (unsigned long)
+						Pool.Buf[Index].Addr[Plane],
+						(unsigned long)Expected);
+			}
+		}
+		if (Pool.Buf[Index].State != XVIDC_FBPOOL_FREE) {
+			XVidC_TestFail(Run, "buffer %u not free", Index);
+		}
+	}
+
+	if (XVidC_FbPoolConsumerPeek(&Pool) != NULL) {
+		XVidC_TestFail(Run, "frame before the first producer frame");
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs the layout test.
+*
+******************************************************************************/
+static void XVidC_TestLayout(void)
+{
+	/* Semi-planar 4:2:0 and 4:2:2, 10-bit packs 3 pixels in 4 bytes */
+	XVidC_TestLayoutOne(XVIDC_CSF_MEM_Y_UV8_420, 1920, 1080, 16, 2,
+			1920, 540);
+	XVidC_TestLayoutOne(XVIDC_CSF_MEM_Y_UV8, 1920, 1080, 32, 2,
+			1920, 1080);
+	XVidC_TestLayoutOne(XVIDC_CSF_MEM_Y_UV10_420, 1280, 720, 64, 2,
+			1728, 360);
+	XVidC_TestLayoutOne(XVIDC_CSF_MEM_Y_UV12, 720, 480, 16, 2,
+			1088, 480);
+	/* Planar */
+	XVidC_TestLayoutOne(XVIDC_CSF_MEM_Y_U_V8_420, 1920, 1080, 32, 3,
+			1920, 540);
+	XVidC_TestLayoutOne(XVIDC_CSF_MEM_R_G_B8, 642, 480, 8, 3, 648, 480);
+	/* Packed */
+	XVidC_TestLayoutOne(XVIDC_CSF_MEM_RGB8, 1280, 720, 32, 1, 3840, 0);
+	XVidC_TestLayoutOne(XVIDC_CSF_MEM_RGBX8, 1366, 768, 64, 1, 5504, 0);
+	XVidC_TestLayoutOne(XVIDC_CSF_MEM_YUYV8, 3840, 2160, 64, 1, 7680, 0);
+	XVidC_TestLayoutOne(XVIDC_CSF_MEM_RGB16, 1920, 1080, 16, 1, 11520, 0);
+	XVidC_TestLayoutOne(XVIDC_CSF_MEM_Y8, 100, 100, 8, 1, 104, 0);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the pool index of a buffer or XVIDC_TEST_NONE.
+*
+******************************************************************************/
+static int XVidC_TestIndex(const XVidC_FbPool *Pool,
+		const XVidC_FbBuffer *BufPtr)
+{
+	return (BufPtr != NULL) ? (int)(BufPtr - Pool->Buf) : XVIDC_TEST_NONE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns 1 if a buffer is latched or programmed by a core.
+*
+******************************************************************************/
+static int XVidC_TestShared(int Buf, const XVidC_TestCore *Core)
+{
+	return (Buf != XVIDC_TEST_NONE) &&
+		((Buf == Core->Latched) || (Buf == Core->Programmed));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks the ownership invariants of the pool against the
+* core models.
+*
+******************************************************************************/
+static void XVidC_TestCheck(const char *Run, const XVidC_FbPool *Pool,
+		const XVidC_TestCore *Wr, const XVidC_TestCore *Rd)
+{
+	u8 Expected[XVIDC_FBPOOL_MAX_BUFFERS];
+	u8 Index;
+	u8 Pos;
+	int Buf;
+
+	memset(Expected, XVIDC_FBPOOL_FREE, sizeof(Expected));
+
+	/* The pool tracks what the cores latched and were programmed with */
+	if ((Pool->WrActive != (u8)Wr->Latched) ||
+			(Pool->WrPending != (u8)Wr->Programmed) ||
+			(Pool->RdActive != (u8)Rd->Latched) ||
+			(Pool->RdPending != (u8)Rd->Programmed)) {
+		XVidC_TestFail(Run, "pool wr %d/%d rd %d/%d, cores wr %d/%d "
+				"rd %d/%d", Pool->WrActive, Pool->WrPending,
+				Pool->RdActive, Pool->RdPending, Wr->Latched,
+				Wr->Programmed, Rd->Latched, Rd->Programmed);
+	}
+
+	/* No frame is written while the reader may fetch it */
+	if (XVidC_TestShared(Wr->Latched, Rd) ||
+			XVidC_TestShared(Wr->Programmed, Rd)) {
+		XVidC_TestFail(Run, "writer %d/%d, reader %d/%d",
+				Wr->Latched, Wr->Programmed,
+				Rd->Latched, Rd->Programmed);
+	}
+
+	if (Wr->Latched != XVIDC_TEST_NONE) {
+		Expected[Wr->Latched] = XVIDC_FBPOOL_PRODUCER;
+	}
+	if (Wr->Programmed != XVIDC_TEST_NONE) {
+		Expected[Wr->Programmed] = XVIDC_FBPOOL_PRODUCER;
+	}
+	if (Rd->Latched != XVIDC_TEST_NONE) {
+		Expected[Rd->Latched] = XVIDC_FBPOOL_CONSUMER;
+	}
+	if (Rd->Programmed != XVIDC_TEST_NONE) {
+		Expected[Rd->Programmed] = XVIDC_FBPOOL_CONSUMER;
+	}
+
+	/* Queued frames are owned by neither core and are in order */
+	for (Pos = 0; Pos < Pool->QueueCount; Pos++) {
+		Buf = Pool->Queue[(Pool->QueueHead + Pos) % Pool->NumBuffers];
+		if (Expected[Buf] != XVIDC_FBPOOL_FREE) {
+			XVidC_TestFail(Run, "queued buffer %d also owned by "
+					"state %d", Buf, Expected[Buf]);
+		}
+		Expected[Buf] = XVIDC_FBPOOL_QUEUED;
+		if ((Pos > 0U) && (Pool->Buf[Buf].Seq <= Pool->Buf[
+				Pool->Queue[(Pool->QueueHead + Pos - 1U) %
+				Pool->NumBuffers]].Seq)) {
+			XVidC_TestFail(Run, "queue out of order");
+		}
+	}
+
+	for (Index = 0; Index < Pool->NumBuffers; Index++) {
+		if (Pool->Buf[Index].State != Expected[Index]) {
+			XVidC_TestFail(Run, "buffer %u state %u, expected %u",
+					Index, Pool->Buf[Index].State,
+					Expected[Index]);
+		}
+	}
+
+	if (Pool->ProducedCount != Pool->ConsumedCount + Pool->DroppedCount +
+			Pool->QueueCount) {
+		XVidC_TestFail(Run, "produced %u != consumed %u + dropped %u "
+				"+ queued %u", Pool->ProducedCount,
+				Pool->ConsumedCount, Pool->DroppedCount,
+				Pool->QueueCount);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function services the writer ap_ready: the latched frame is complete,
+* the programmed buffer is latched and the next pool buffer is programmed.
+*
+******************************************************************************/
+static void XVidC_TestProducer(XVidC_FbPool *Pool, XVidC_TestCore *Wr,
+		u32 *Completed)
+{
+	if (Wr->Latched != XVIDC_TEST_NONE) {
+		(*Completed)++;
+		BufFrame[Wr->Latched] = *Completed;
+	}
+	Wr->Latched = Wr->Programmed;
+	Wr->Programmed = XVidC_TestIndex(Pool, XVidC_FbPoolProducerNext(Pool));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function services the reader ap_ready: the programmed buffer is
+* latched and the next pool buffer is programmed, if any.
+*
+******************************************************************************/
+static void XVidC_TestConsumer(const char *Run, XVidC_FbPool *Pool,
+		XVidC_TestCore *Rd, u32 *Shown, u32 *ShownFrame, u32 *Calls)
+{
+	const XVidC_FbBuffer *PeekPtr;
+	const XVidC_FbBuffer *BufPtr;
+	u32 Dropped = Pool->DroppedCount;
+
+	/* The frame read last must not have changed while it was read */
+	if ((Rd->Latched != XVIDC_TEST_NONE) &&
+			(BufFrame[Rd->Latched] != *ShownFrame)) {
+		XVidC_TestFail(Run, "frame %u overwritten by %u while read",
+				*ShownFrame, BufFrame[Rd->Latched]);
+	}
+
+	Rd->Latched = Rd->Programmed;
+	if (Rd->Latched != XVIDC_TEST_NONE) {
+		if (BufFrame[Rd->Latched] < *ShownFrame) {
+			XVidC_TestFail(Run, "frame %u shown after %u",
+					BufFrame[Rd->Latched], *ShownFrame);
+		}
+		if (BufFrame[Rd->Latched] != *ShownFrame) {
+			(*Shown)++;
+		}
+		*ShownFrame = BufFrame[Rd->Latched];
+	}
+
+	PeekPtr = XVidC_FbPoolConsumerPeek(Pool);
+	BufPtr = XVidC_FbPoolConsumerNext(Pool);
+	if (PeekPtr != BufPtr) {
+		XVidC_TestFail(Run, "peek %d, next %d",
+				XVidC_TestIndex(Pool, PeekPtr),
+				XVidC_TestIndex(Pool, BufPtr));
+	}
+	if (BufPtr != NULL) {
+		Rd->Programmed = XVidC_TestIndex(Pool, BufPtr);
+		(*Calls)++;
+	}
+
+	if ((Pool->Policy == XVIDC_FBPOOL_DROP_OLDEST) &&
+			(Pool->QueueCount != 0U)) {
+		XVidC_TestFail(Run, "%u frames newer than the shown one",
+				Pool->QueueCount);
+	}
+	if ((Pool->Policy == XVIDC_FBPOOL_REPEAT_LAST) &&
+			(Pool->DroppedCount != Dropped)) {
+		XVidC_TestFail(Run, "queued frame dropped");
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs the writer and the reader against one pool.
+*
+******************************************************************************/
+static void XVidC_TestRun(const XVidC_TestRate *Rate, u8 NumBuffers,
+		XVidC_FbPoolPolicy Policy, u32 Frames)
+{
+	XVidC_FbPool Pool;
+	XVidC_VideoStream Stream;
+	XVidC_TestCore Wr;
+	XVidC_TestCore Rd;
+	const XVidC_FbBuffer *BufPtr;
+	u32 Delay;
+	u32 Frame = 0;
+	u32 Completed = 0;
+	u32 Shown = 0;
+	u32 ShownFrame = 0;
+	u32 Calls = 0;
+	u32 Tick;
+	int Attached = 0;
+	int RdFirst;
+	char Run[80];
+
+	Delay = (u32)rand() % (XVIDC_TEST_MAX_ATTACH_DELAY + 1U);
+	snprintf(Run, sizeof(Run), "%u:%u %u buffers %s delay %u",
+			Rate->Producer, Rate->Consumer, NumBuffers,
+			(Policy == XVIDC_FBPOOL_DROP_OLDEST) ?
+			"drop oldest" : "repeat last", Delay);
+
+	memset(&Stream, 0, sizeof(Stream));
+	Stream.Timing.HActive = 64;
+	Stream.Timing.VActive = 4;
+	memset(BufFrame, 0, sizeof(BufFrame));
+
+	if (XVidC_FbPoolInit(&Pool, 0x1000, 0x10000, NumBuffers,
+			XVIDC_CSF_MEM_RGBX8, &Stream, 16, Policy) !=
+			XST_SUCCESS) {
+		XVidC_TestFail(Run, "init failed");
+		return;
+	}
+
+	/* The writer is attached and started first, see SetBufferPool */
+	Wr.Latched = XVIDC_TEST_NONE;
+	Wr.Programmed = XVidC_TestIndex(&Pool,
+			XVidC_FbPoolProducerNext(&Pool));
+	Wr.Period = Rate->Producer;
+	Wr.Next = 0;
+	Rd.Latched = XVIDC_TEST_NONE;
+	Rd.Programmed = XVIDC_TEST_NONE;
+	Rd.Period = Rate->Consumer;
+	Rd.Next = 0;
+
+	for (Tick = 0; Frame < Frames; Tick++) {
+		/* Interrupts due on the same tick run in either order */
+		RdFirst = rand() & 1;
+		if (Attached && RdFirst && (Rd.Next == Tick)) {
+			XVidC_TestConsumer(Run, &Pool, &Rd, &Shown,
+					&ShownFrame, &Calls);
+			XVidC_TestCheck(Run, &Pool, &Wr, &Rd);
+			Rd.Next += Rd.Period;
+		}
+		if (Wr.Next == Tick) {
+			XVidC_TestProducer(&Pool, &Wr, &Completed);
+			Frame++;
+			XVidC_TestCheck(Run, &Pool, &Wr, &Rd);
+			Wr.Next += Wr.Period;
+		}
+		if (!Attached && (Frame > Delay)) {
+			/* Attach the reader as XVFrmbufRd_SetBufferPool() */
+			BufPtr = XVidC_FbPoolConsumerPeek(&Pool);
+			if (BufPtr != XVidC_FbPoolConsumerNext(&Pool)) {
+				XVidC_TestFail(Run, "peek differs on attach");
+			}
+			Rd.Programmed = XVidC_TestIndex(&Pool, BufPtr);
+			if (BufPtr != NULL) {
+				Calls++;
+			}
+			Rd.Next = Tick + 1U;
+			Attached = 1;
+			XVidC_TestCheck(Run, &Pool, &Wr, &Rd);
+		}
+		if (Attached && !RdFirst && (Rd.Next == Tick)) {
+			XVidC_TestConsumer(Run, &Pool, &Rd, &Shown,
+					&ShownFrame, &Calls);
+			XVidC_TestCheck(Run, &Pool, &Wr, &Rd);
+			Rd.Next += Rd.Period;
+		}
+	}
+
+	if (Pool.ConsumedCount + Pool.RepeatedCount != Calls) {
+		XVidC_TestFail(Run, "consumed %u + repeated %u != %u frames",
+				Pool.ConsumedCount, Pool.RepeatedCount, Calls);
+	}
+	if (Shown > Pool.ConsumedCount) {
+		XVidC_TestFail(Run, "%u frames shown, %u consumed", Shown,
+				Pool.ConsumedCount);
+	}
+	if ((Policy == XVIDC_FBPOOL_REPEAT_LAST) && (Delay == 0U) &&
+			(NumBuffers >= XVIDC_TEST_MIN_DROP_FREE) &&
+			(Rate->Consumer <= Rate->Producer) &&
+			(Pool.DroppedCount != 0U)) {
+		XVidC_TestFail(Run, "%u frames dropped", Pool.DroppedCount);
+	}
+
+	if (Verbose) {
+		printf("%s\n", Run);
+		XVidC_FbPoolReportStats(&Pool);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	u32 Frames = XVIDC_TEST_DEF_FRAMES;
+	unsigned int Seed = 1U;
+	u32 Runs = 0;
+	u32 Rate;
+	u8 NumBuffers;
+	int Opt;
+
+	while ((Opt = getopt(argc, argv, "n:s:v")) != -1) {
+		switch (Opt) {
+		case 'n':
+			Frames = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			Seed = (unsigned int)strtoul(optarg, NULL, 0);
+			break;
+		case 'v':
+			Verbose = 1;
+			break;
+		default:
+			fprintf(stderr, "Usage: %s [-n frames] [-s seed] "
+					"[-v]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	srand(Seed);
+	XVidC_TestLayout();
+
+	for (Rate = 0; Rate < sizeof(Rates) / sizeof(Rates[0]); Rate++) {
+		for (NumBuffers = 2; NumBuffers <= XVIDC_FBPOOL_MAX_BUFFERS;
+				NumBuffers++) {
+			XVidC_TestRun(&Rates[Rate], NumBuffers,
+					XVIDC_FBPOOL_DROP_OLDEST, Frames);
+			XVidC_TestRun(&Rates[Rate], NumBuffers,
+					XVIDC_FBPOOL_REPEAT_LAST, Frames);
+			Runs += 2U;
+		}
+	}
+
+	printf("%s: layouts, %u rate runs of %u frames, %u errors\n",
+			(Errors == 0U) ? "PASS" : "FAIL", Runs, Frames, Errors);
+
+	return (Errors == 0U) ? 0 : 1;
+}
@@ -42,27 +42,50 @@
  * 4.3   eb   26/01/18 Added API XVidC_GetVideoModeIdExtensive
  *       jsr  02/22/18 Added XVIDC_CSF_YCBCR_420 color space format
  *       vyc  04/04/18 Added BGR8 memory format
+ * 4.15  ag   10/18/26 Added hashed video mode index used by
+ *                     XVidC_GetVideoModeId and XVidC_GetVideoModeIdRb
  * </pre>
  *
 *******************************************************************************/
 
 /******************************* Include Files ********************************/
 
+#include <string.h>
 #include "xil_assert.h"
 #include "xstatus.h"
 #include "xvidc.h"
 
+/************************** Constant Definitions ******************************/
+
+/* Video mode index: open addressing hash over width, height and frame rate.
+ * Each slot holds the table position + 1 (0 = empty) and the reduced
+ * blanking type of the mode. */
+#define XVIDC_VM_INDEX_SIZE		512
+#define XVIDC_VM_INDEX_POS_MASK		0x3FFF
+#define XVIDC_VM_INDEX_RB_SHIFT		14
+#define XVIDC_VM_INDEX_RB_ANY		0xFF
+
+#define XVIDC_VM_INDEX_NOT_BUILT	0
+#define XVIDC_VM_INDEX_BUILT		1
+#define XVIDC_VM_INDEX_UNUSABLE		2
+
 /*************************** Variable Declarations ****************************/
 extern const XVidC_VideoTimingMode XVidC_VideoTimingModes[XVIDC_VM_NUM_SUPPORTED];
 
 const XVidC_VideoTimingMode *XVidC_CustomTimingModes = NULL;
 int XVidC_NumCustomModes = 0;
 
+static u16 XVidC_VmIndex[XVIDC_VM_INDEX_SIZE];
+static u8 XVidC_VmIndexState = XVIDC_VM_INDEX_NOT_BUILT;
+
 /**************************** Function Prototypes *****************************/
 
 static const XVidC_VideoTimingMode *XVidC_GetCustomVideoModeData(
 		XVidC_VideoMode VmId);
 static u8 XVidC_IsVtmRb(const char *VideoModeStr, u8 RbN);
+static u8 XVidC_VmIndexReady(void);
+static XVidC_VideoMode XVidC_VmIndexLookup(u32 Width, u32 Height,
+		u32 FrameRate, u8 IsInterlaced, u8 RbN);
 
 /*************************** Function Definitions *****************************/
 
@@ -105,6 +128,7 @@ u32 XVidC_RegisterCustomTimingModes(const XVidC_VideoTimingMode *CustomTable,
 
 	XVidC_CustomTimingModes = CustomTable;
 	XVidC_NumCustomModes    = NumElems;
+	XVidC_VmIndexState      = XVIDC_VM_INDEX_NOT_BUILT;
 
 	return XST_SUCCESS;
 }
@@ -123,6 +147,7 @@ void XVidC_UnregisterCustomTimingModes(void)
 {
 	XVidC_CustomTimingModes = NULL;
 	XVidC_NumCustomModes    = 0;
+	XVidC_VmIndexState      = XVIDC_VM_INDEX_NOT_BUILT;
 }
 
 /******************************************************************************/
@@ -312,7 +337,8 @@ XVidC_VideoMode XVidC_GetVideoModeIdWBlanking(const XVidC_VideoTiming *Timing,
  *
  * @return	Id of a supported video mode.
  *
- * @note	None.
+ * @note	The lookup uses the video mode index. The table search below is
+ *		only used if the index cannot hold all video modes.
  *
 *******************************************************************************/
 XVidC_VideoMode XVidC_GetVideoModeId(u32 Width, u32 Height, u32 FrameRate,
@@ -328,6 +354,11 @@ XVidC_VideoMode XVidC_GetVideoModeId(u32 Width, u32 Height, u32 FrameRate,
 	XVidC_VideoMode Mode;
 	u16 Index;
 
+	if (XVidC_VmIndexReady()) {
+		return XVidC_VmIndexLookup(Width, Height, FrameRate,
+				IsInterlaced, XVIDC_VM_INDEX_RB_ANY);
+	}
+
 	/* First, attempt a linear search on the custom video timing table. */
 	if(XVidC_CustomTimingModes) {
 	  for (Index = 0; Index < XVidC_NumCustomModes; Index++) {
@@ -615,7 +646,9 @@ XVidC_VideoMode XVidC_GetVideoModeIdExtensive(XVidC_VideoTiming *Timing,
  *
  * @return	ID of a supported video mode.
  *
- * @note	None.
+ * @note	The reduced blanking type is taken from the video mode index.
+ *		The mode name is only parsed here if the index cannot hold all
+ *		video modes.
  *
 *******************************************************************************/
 XVidC_VideoMode XVidC_GetVideoModeIdRb(u32 Width, u32 Height,
@@ -625,6 +658,11 @@ XVidC_VideoMode XVidC_GetVideoModeIdRb(u32 Width, u32 Height,
 	const XVidC_VideoTimingMode *VtmPtr;
 	u8 Found = 0;
 
+	if (XVidC_VmIndexReady()) {
+		return XVidC_VmIndexLookup(Width, Height, FrameRate,
+				IsInterlaced, RbN);
+	}
+
 	VmId = XVidC_GetVideoModeId(Width, Height, FrameRate,
 				IsInterlaced);
 
@@ -1219,4 +1257,171 @@ static u8 XVidC_IsVtmRb(const char *VideoModeStr, u8 RbN)
 	}
 	return 0;
 }
+
+/******************************************************************************/
+/**
+ * This function returns the video mode at the specified position of the video
+ * mode index. Positions beyond the standard video timing table refer to the
+ * custom video mode timing table.
+ *
+ * @param	Pos specifies the position.
+ *
+ * @return	Pointer to XVidC_VideoTimingMode structure.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static const XVidC_VideoTimingMode *XVidC_VmIndexMode(u32 Pos)
+{
+	if (Pos < XVIDC_VM_NUM_SUPPORTED) {
+		return &XVidC_VideoTimingModes[Pos];
+	}
+
+	return &XVidC_CustomTimingModes[Pos - XVIDC_VM_NUM_SUPPORTED];
+}
+
+/******************************************************************************/
+/**
+ * This function returns the home slot of a video mode in the video mode index.
+ *
+ * @param	Width specifies the number pixels per scanline.
+ * @param	Height specifies the number of scanline's.
+ * @param	FrameRate specifies refresh rate in HZ
+ *
+ * @return	Slot number.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XVidC_VmIndexHash(u32 Width, u32 Height, u32 FrameRate)
+{
+	u32 Hash;
+
+	Hash = (Width * 0x9E3779B1U) ^ (Height * 0x85EBCA77U) ^
+		(FrameRate * 0xC2B2AE3DU);
+	Hash ^= Hash >> 16;
+
+	return Hash & (XVIDC_VM_INDEX_SIZE - 1);
+}
+
+/******************************************************************************/
+/**
+ * This function makes sure the video mode index is built. The index covers
+ * the custom video mode timing table followed by the standard video timing
+ * table and is rebuilt after the custom table changes. The reduced blanking
+ * type of each mode is derived from its name once, while building.
+ *
+ * @return
+ *		- 1 if the index can be used.
+ *		- 0 if the index cannot hold all video modes.
+ *
+ * @note	Entries with identical width, height and frame rate are found in
+ *		insertion order, so lookups return the same mode as the table
+ *		search.
+ *
+*******************************************************************************/
+static u8 XVidC_VmIndexReady(void)
+{
+	const XVidC_VideoTimingMode *VmPtr;
+	u32 NumModes;
+	u32 Index;
+	u32 Pos;
+	u32 Slot;
+	u8 RbN;
+
+	if (XVidC_VmIndexState != XVIDC_VM_INDEX_NOT_BUILT) {
+		return (XVidC_VmIndexState == XVIDC_VM_INDEX_BUILT);
+	}
+
+	/* Keep the load factor at or below 3/4 */
+	NumModes = XVIDC_VM_NUM_SUPPORTED + XVidC_NumCustomModes;
+	if ((NumModes * 4) > (XVIDC_VM_INDEX_SIZE * 3)) {
+		XVidC_VmIndexState = XVIDC_VM_INDEX_UNUSABLE;
+		return 0;
+	}
+
+	memset(XVidC_VmIndex, 0, sizeof(XVidC_VmIndex));
+
+	/* Custom modes first, so that they take precedence */
+	for (Index = 0; Index < NumModes; Index++) {
+		if (Index < (u32)XVidC_NumCustomModes) {
+			Pos = XVIDC_VM_NUM_SUPPORTED + Index;
+		}
+		else {
+			Pos = Index - XVidC_NumCustomModes;
+		}
+		VmPtr = XVidC_VmIndexMode(Pos);
+
+		if (XVidC_IsVtmRb(VmPtr->Name, 1)) {
+			RbN = 1;
+		}
+		else if (XVidC_IsVtmRb(VmPtr->Name, 2)) {
+			RbN = 2;
+		}
+		else {
+			RbN = 0;
+		}
+
+		Slot = XVidC_VmIndexHash(VmPtr->Timing.HActive,
+				VmPtr->Timing.VActive, VmPtr->FrameRate);
+		while (XVidC_VmIndex[Slot] != 0) {
+			Slot = (Slot + 1) & (XVIDC_VM_INDEX_SIZE - 1);
+		}
+		XVidC_VmIndex[Slot] = (u16)((Pos + 1) |
+				(RbN << XVIDC_VM_INDEX_RB_SHIFT));
+	}
+
+	XVidC_VmIndexState = XVIDC_VM_INDEX_BUILT;
+
+	return 1;
+}
+
+/******************************************************************************/
+/**
+ * This function looks up a video mode in the video mode index.
+ *
+ * @param	Width specifies the number pixels per scanline.
+ * @param	Height specifies the number of scanline's.
+ * @param	FrameRate specifies refresh rate in HZ
+ * @param	IsInterlaced specifies interlaced or progressive mode. Not
+ *		checked for custom video modes.
+ * @param	RbN specifies the type of reduced blanking or
+ *		XVIDC_VM_INDEX_RB_ANY to accept any type.
+ *
+ * @return	ID of a supported video mode.
+ *
+ * @note	XVidC_VmIndexReady() must have returned 1.
+ *
+*******************************************************************************/
+static XVidC_VideoMode XVidC_VmIndexLookup(u32 Width, u32 Height,
+		u32 FrameRate, u8 IsInterlaced, u8 RbN)
+{
+	const XVidC_VideoTimingMode *VmPtr;
+	u32 Slot;
+	u32 Pos;
+	u16 Entry;
+
+	Slot = XVidC_VmIndexHash(Width, Height, FrameRate);
+
+	while ((Entry = XVidC_VmIndex[Slot]) != 0) {
+		Pos = (Entry & XVIDC_VM_INDEX_POS_MASK) - 1;
+		VmPtr = XVidC_VmIndexMode(Pos);
+
+		if ((VmPtr->Timing.HActive == Width) &&
+		    (VmPtr->Timing.VActive == Height) &&
+		    (VmPtr->FrameRate == FrameRate) &&
+		    ((RbN == XVIDC_VM_INDEX_RB_ANY) ||
+		     ((Entry >> XVIDC_VM_INDEX_RB_SHIFT) == RbN))) {
+			if (Pos >= XVIDC_VM_NUM_SUPPORTED) {
+				return VmPtr->VmId;
+			}
+			if ((Pos <= XVIDC_VM_INTL_END) == (IsInterlaced != 0)) {
+				return (XVidC_VideoMode)Pos;
+			}
+		}
+		Slot = (Slot + 1) & (XVIDC_VM_INDEX_SIZE - 1);
+	}
+
+	return XVIDC_VM_NOT_SUPPORTED;
+}
 /** @} */
@@ -43,6 +43,11 @@ extern "C" {
 #define XVIDC_EDID_BLOCK_SIZE                         (0x80)
 #define XVIDC_EDID_MAX_EXTENSIONS                     (0xFE)
 
+/* Number of sinks remembered by XV_VidC_parse_edid, 0 disables the cache */
+#ifndef XVIDC_EDID_CACHE_SIZE
+#define XVIDC_EDID_CACHE_SIZE                         (2)
+#endif
+
 
 static const u8 XVIDC_EDID_EXT_HEADER[] =
                             { 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00 };
@@ -695,6 +700,9 @@ void
 XV_VidC_parse_edid(const u8 * const data,
                   XV_VidC_EdidCntrlParam *EdidCtrlParam,
                   XV_VidC_Verbose VerboseEn);
+#if XVIDC_EDID_CACHE_SIZE > 0
+void XV_VidC_EdidCacheFlush(void);
+#endif
 
 #ifdef __cplusplus
 }
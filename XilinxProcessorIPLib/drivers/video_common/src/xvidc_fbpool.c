@@ -0,0 +1,558 @@
+/*******************************************************************************
+* Copyright 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_fbpool.c
+ * @addtogroup video_common Overview
+ * @{
+ *
+ * Contains the frame buffer pool shared between frame buffer writer and
+ * reader cores. See xvidc_fbpool.h for a description of the buffer states
+ * and policies.
+ *
+ * @note	None.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.15  ag   10/18/26 Initial release.
+ *       ag   10/18/26 Added XVidC_FbPoolConsumerPeek().
+ * </pre>
+ *
+*******************************************************************************/
+
+/******************************* Include Files ********************************/
+
+#include "xil_assert.h"
+#include "xstatus.h"
+#include "xvidc_fbpool.h"
+
+/**************************** Function Prototypes *****************************/
+
+static void XVidC_FbPoolGetLayout(XVidC_ColorFormat MemFmt, u32 Height,
+		u8 *NumPlanes, u32 *PlaneLines, u32 *BppNum, u32 *BppDen);
+static void XVidC_FbPoolEnqueue(XVidC_FbPool *Pool, u8 Index);
+static u8 XVidC_FbPoolDequeue(XVidC_FbPool *Pool);
+static u8 XVidC_FbPoolGetFree(XVidC_FbPool *Pool);
+
+/*************************** Function Definitions *****************************/
+
+/******************************************************************************/
+/**
+ * This function carves a memory region into a ring of frame buffers for the
+ * given memory format and resets the pool.
+ *
+ * @param	Pool is a pointer to the pool to initialize.
+ * @param	BaseAddr is the start of the memory region. It must be aligned
+ *		to Align.
+ * @param	Size is the size of the memory region in bytes.
+ * @param	NumBuffers is the number of buffers in the ring (2 to
+ *		XVIDC_FBPOOL_MAX_BUFFERS). Passing every frame while producer
+ *		and consumer run at the same rate needs at least 5 buffers.
+ * @param	MemFmt is the video-in-memory color format.
+ * @param	StreamPtr is the video stream whose active area is stored.
+ * @param	Align is the stride and plane alignment in bytes, i.e. the
+ *		AXI-MM data width of the cores divided by 8.
+ * @param	Policy selects what happens when the consumer falls behind.
+ *
+ * @return
+ *		- XST_SUCCESS if the pool was initialized.
+ *		- XST_FAILURE if the region is misaligned or too small.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u32 XVidC_FbPoolInit(XVidC_FbPool *Pool, UINTPTR BaseAddr, u32 Size,
+		u8 NumBuffers, XVidC_ColorFormat MemFmt,
+		const XVidC_VideoStream *StreamPtr, u32 Align,
+		XVidC_FbPoolPolicy Policy)
+{
+	u32 BppNum;
+	u32 BppDen;
+	u32 Plane;
+	u8 Index;
+	UINTPTR Addr;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(Pool != NULL);
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid((NumBuffers >= 2) &&
+			(NumBuffers <= XVIDC_FBPOOL_MAX_BUFFERS));
+	Xil_AssertNonvoid(Align != 0);
+	Xil_AssertNonvoid((Policy == XVIDC_FBPOOL_DROP_OLDEST) ||
+			(Policy == XVIDC_FBPOOL_REPEAT_LAST));
+
+	if ((BaseAddr % Align) != 0) {
+		return XST_FAILURE;
+	}
+
+	XVidC_FbPoolGetLayout(MemFmt, StreamPtr->Timing.VActive,
+			&Pool->NumPlanes, Pool->PlaneLines, &BppNum, &BppDen);
+
+	Pool->Stride = ((StreamPtr->Timing.HActive * BppNum) / BppDen) +
+			Align - 1;
+	Pool->Stride -= Pool->Stride % Align;
+
+	Pool->FrameSize = 0;
+	for (Plane = 0; Plane < Pool->NumPlanes; Plane++) {
+		Pool->FrameSize += Pool->Stride * Pool->PlaneLines[Plane];
+	}
+
+	if ((Pool->FrameSize == 0) ||
+			(((u64)Pool->FrameSize * NumBuffers) > Size)) {
+		return XST_FAILURE;
+	}
+
+	/* Planes of one frame are stored back to back */
+	Addr = BaseAddr;
+	for (Index = 0; Index < NumBuffers; Index++) {
+		Pool->Buf[Index].Index = Index;
+		for (Plane = 0; Plane < XVIDC_FBPOOL_MAX_PLANES; Plane++) {
+			if (Plane < Pool->NumPlanes) {
+				Pool->Buf[Index].Addr[Plane] = Addr;
+				Addr += Pool->Stride * Pool->PlaneLines[Plane];
+			} else {
+				Pool->Buf[Index].Addr[Plane] = 0;
+			}
+		}
+	}
+
+	Pool->NumBuffers = NumBuffers;
+	Pool->Policy = (u8)Policy;
+	XVidC_FbPoolReset(Pool);
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function returns every buffer of the pool to the producer and clears
+ * the statistics. It must be called while both cores are stopped.
+ *
+ * @param	Pool is a pointer to the pool.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_FbPoolReset(XVidC_FbPool *Pool)
+{
+	u8 Index;
+
+	/* Verify arguments. */
+	Xil_AssertVoid(Pool != NULL);
+
+	for (Index = 0; Index < Pool->NumBuffers; Index++) {
+		Pool->Buf[Index].State = XVIDC_FBPOOL_FREE;
+		Pool->Buf[Index].Seq = 0;
+	}
+
+	Pool->QueueHead = 0;
+	Pool->QueueCount = 0;
+	Pool->NextFree = 0;
+	Pool->WrActive = XVIDC_FBPOOL_NONE;
+	Pool->WrPending = XVIDC_FBPOOL_NONE;
+	Pool->RdActive = XVIDC_FBPOOL_NONE;
+	Pool->RdPending = XVIDC_FBPOOL_NONE;
+
+	XVidC_FbPoolClearStats(Pool);
+}
+
+/******************************************************************************/
+/**
+ * This function advances the producer side of the pool. It is called once
+ * before the producer is started and then from the producer's ap_ready
+ * interrupt. The frame completed since the previous call is queued for the
+ * consumer.
+ *
+ * @param	Pool is a pointer to the pool.
+ *
+ * @return	Pointer to the buffer to program as the next producer target.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+const XVidC_FbBuffer *XVidC_FbPoolProducerNext(XVidC_FbPool *Pool)
+{
+	u8 Done;
+	u8 Next;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(Pool != NULL);
+	Xil_AssertNonvoid(Pool->NumBuffers != 0);
+
+	/* The core latched the pending buffer; the active one is complete */
+	Done = Pool->WrActive;
+	Pool->WrActive = Pool->WrPending;
+
+	if (Done != XVIDC_FBPOOL_NONE) {
+		Pool->ProducedCount++;
+		if (Done == Pool->WrActive) {
+			/* The frame was overwritten by the next one */
+			Pool->DroppedCount++;
+		} else {
+			Pool->Buf[Done].Seq = Pool->ProducedCount;
+			Pool->Buf[Done].State = XVIDC_FBPOOL_QUEUED;
+			XVidC_FbPoolEnqueue(Pool, Done);
+		}
+	}
+
+	Next = XVidC_FbPoolGetFree(Pool);
+	if ((Next == XVIDC_FBPOOL_NONE) &&
+			(Pool->Policy == XVIDC_FBPOOL_DROP_OLDEST) &&
+			(Pool->QueueCount > 1)) {
+		/* Recycle the oldest frame, the newest stays queued */
+		Next = XVidC_FbPoolDequeue(Pool);
+		Pool->DroppedCount++;
+	}
+	if (Next == XVIDC_FBPOOL_NONE) {
+		/* Write into the active buffer again */
+		Next = Pool->WrActive;
+	}
+
+	Pool->Buf[Next].State = XVIDC_FBPOOL_PRODUCER;
+	Pool->WrPending = Next;
+
+	return &Pool->Buf[Next];
+}
+
+/******************************************************************************/
+/**
+ * This function advances the consumer side of the pool. It is called before
+ * the consumer is started and then from the consumer's ap_ready interrupt.
+ * The buffer the consumer finished reading is returned to the producer.
+ *
+ * @param	Pool is a pointer to the pool.
+ *
+ * @return	Pointer to the buffer to program as the next consumer source,
+ *		or NULL if the producer has not completed a frame yet.
+ *
+ * @note	If no new frame is queued the last frame is returned again.
+ *
+*******************************************************************************/
+const XVidC_FbBuffer *XVidC_FbPoolConsumerNext(XVidC_FbPool *Pool)
+{
+	u8 Done;
+	u8 Next;
+	u32 Latency;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(Pool != NULL);
+	Xil_AssertNonvoid(Pool->NumBuffers != 0);
+
+	/* The core latched the pending buffer; the active one was read */
+	Done = Pool->RdActive;
+	Pool->RdActive = Pool->RdPending;
+
+	if ((Done != XVIDC_FBPOOL_NONE) && (Done != Pool->RdActive)) {
+		Pool->Buf[Done].State = XVIDC_FBPOOL_FREE;
+	}
+
+	if (Pool->Policy == XVIDC_FBPOOL_DROP_OLDEST) {
+		/* Skip to the newest frame */
+		while (Pool->QueueCount > 1) {
+			Next = XVidC_FbPoolDequeue(Pool);
+			Pool->Buf[Next].State = XVIDC_FBPOOL_FREE;
+			Pool->DroppedCount++;
+		}
+	}
+
+	if (Pool->QueueCount != 0) {
+		Next = XVidC_FbPoolDequeue(Pool);
+		Pool->Buf[Next].State = XVIDC_FBPOOL_CONSUMER;
+		Pool->ConsumedCount++;
+
+		Latency = Pool->ProducedCount - Pool->Buf[Next].Seq;
+		Pool->LatencyLast = Latency;
+		if (Latency > Pool->LatencyMax) {
+			Pool->LatencyMax = Latency;
+		}
+	} else {
+		Next = Pool->RdActive;
+		if (Next != XVIDC_FBPOOL_NONE) {
+			Pool->RepeatedCount++;
+		}
+	}
+
+	Pool->RdPending = Next;
+
+	return (Next != XVIDC_FBPOOL_NONE) ? &Pool->Buf[Next] : NULL;
+}
+
+/******************************************************************************/
+/**
+ * This function returns the buffer the next call of XVidC_FbPoolConsumerNext()
+ * returns, without changing the pool. It can be used to check a buffer before
+ * the consumer takes it.
+ *
+ * @param	Pool is a pointer to the pool.
+ *
+ * @return	Pointer to the buffer XVidC_FbPoolConsumerNext() returns next,
+ *		or NULL if the producer has not completed a frame yet.
+ *
+ * @note	The result is only valid until the producer side is advanced.
+ *
+*******************************************************************************/
+const XVidC_FbBuffer *XVidC_FbPoolConsumerPeek(const XVidC_FbPool *Pool)
+{
+	u8 Next;
+	u8 Pos;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(Pool != NULL);
+	Xil_AssertNonvoid(Pool->NumBuffers != 0);
+
+	if (Pool->QueueCount != 0) {
+		/* The newest frame with DROP_OLDEST, the oldest otherwise */
+		Pos = Pool->QueueHead;
+		if (Pool->Policy == XVIDC_FBPOOL_DROP_OLDEST) {
+			Pos = (Pos + Pool->QueueCount - 1) % Pool->NumBuffers;
+		}
+		Next = Pool->Queue[Pos];
+	} else {
+		/* The pending buffer becomes active and is repeated */
+		Next = Pool->RdPending;
+	}
+
+	return (Next != XVIDC_FBPOOL_NONE) ? &Pool->Buf[Next] : NULL;
+}
+
+/******************************************************************************/
+/**
+ * This function clears the frame and latency counters of the pool.
+ *
+ * @param	Pool is a pointer to the pool.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_FbPoolClearStats(XVidC_FbPool *Pool)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(Pool != NULL);
+
+	Pool->ProducedCount = 0;
+	Pool->ConsumedCount = 0;
+	Pool->DroppedCount = 0;
+	Pool->RepeatedCount = 0;
+	Pool->LatencyLast = 0;
+	Pool->LatencyMax = 0;
+}
+
+/******************************************************************************/
+/**
+ * This function prints the pool configuration and statistics.
+ *
+ * @param	Pool is a pointer to the pool.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_FbPoolReportStats(const XVidC_FbPool *Pool)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(Pool != NULL);
+
+	xil_printf("\tBuffers:                  %d x %d bytes\r\n",
+			Pool->NumBuffers, Pool->FrameSize);
+	xil_printf("\tPlanes:                   %d\r\n", Pool->NumPlanes);
+	xil_printf("\tStride:                   %d\r\n", Pool->Stride);
+	xil_printf("\tPolicy:                   %s\r\n",
+			(Pool->Policy == XVIDC_FBPOOL_DROP_OLDEST) ?
+			"Drop oldest" : "Repeat last");
+	xil_printf("\tQueued:                   %d\r\n", Pool->QueueCount);
+	xil_printf("\tProduced:                 %d\r\n", Pool->ProducedCount);
+	xil_printf("\tConsumed:                 %d\r\n", Pool->ConsumedCount);
+	xil_printf("\tDropped:                  %d\r\n", Pool->DroppedCount);
+	xil_printf("\tRepeated:                 %d\r\n", Pool->RepeatedCount);
+	xil_printf("\tLatency (last/max):       %d/%d frames\r\n",
+			Pool->LatencyLast, Pool->LatencyMax);
+}
+
+/******************************************************************************/
+/**
+ * This function returns the plane layout and the luma plane bytes per pixel
+ * of a video-in-memory color format.
+ *
+ * @param	MemFmt is the video-in-memory color format.
+ * @param	Height is the number of active lines.
+ * @param	NumPlanes returns the number of planes.
+ * @param	PlaneLines returns the number of lines of each plane.
+ * @param	BppNum returns the numerator of the bytes per pixel.
+ * @param	BppDen returns the denominator of the bytes per pixel.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XVidC_FbPoolGetLayout(XVidC_ColorFormat MemFmt, u32 Height,
+		u8 *NumPlanes, u32 *PlaneLines, u32 *BppNum, u32 *BppDen)
+{
+	u32 ChromaLines = Height;
+
+	*BppDen = 1;
+
+	switch (MemFmt) {
+		case XVIDC_CSF_MEM_Y_UV10:
+		case XVIDC_CSF_MEM_Y_UV10_420:
+		case XVIDC_CSF_MEM_Y10:
+			/* 4 bytes per 3 pixels */
+			*BppNum = 4;
+			*BppDen = 3;
+			break;
+		case XVIDC_CSF_MEM_Y_UV8:
+		case XVIDC_CSF_MEM_Y_UV8_420:
+		case XVIDC_CSF_MEM_Y8:
+		case XVIDC_CSF_MEM_R_G_B8:
+		case XVIDC_CSF_MEM_Y_U_V8:
+		case XVIDC_CSF_MEM_Y_U_V8_420:
+		case XVIDC_CSF_MEM_Y_U_V10:
+			*BppNum = 1;
+			break;
+		case XVIDC_CSF_MEM_RGB8:
+		case XVIDC_CSF_MEM_YUV8:
+		case XVIDC_CSF_MEM_BGR8:
+			*BppNum = 3;
+			break;
+		case XVIDC_CSF_MEM_RGBX12:
+		case XVIDC_CSF_MEM_YUVX12:
+			*BppNum = 5;
+			break;
+		case XVIDC_CSF_MEM_Y_UV12:
+		case XVIDC_CSF_MEM_Y_UV12_420:
+		case XVIDC_CSF_MEM_Y12:
+			/* 3 bytes per 2 pixels */
+			*BppNum = 3;
+			*BppDen = 2;
+			break;
+		case XVIDC_CSF_MEM_RGB16:
+		case XVIDC_CSF_MEM_YUV16:
+			*BppNum = 6;
+			break;
+		case XVIDC_CSF_MEM_YUYV8:
+		case XVIDC_CSF_MEM_UYVY8:
+		case XVIDC_CSF_MEM_RGB565:
+		case XVIDC_CSF_MEM_Y_UV16:
+		case XVIDC_CSF_MEM_Y_UV16_420:
+		case XVIDC_CSF_MEM_Y16:
+			*BppNum = 2;
+			break;
+		default:
+			*BppNum = 4;
+			break;
+	}
+
+	switch (MemFmt) {
+		case XVIDC_CSF_MEM_Y_UV8_420:
+		case XVIDC_CSF_MEM_Y_UV10_420:
+		case XVIDC_CSF_MEM_Y_UV12_420:
+		case XVIDC_CSF_MEM_Y_UV16_420:
+			ChromaLines = Height / 2;
+			/* Fall through */
+		case XVIDC_CSF_MEM_Y_UV8:
+		case XVIDC_CSF_MEM_Y_UV10:
+		case XVIDC_CSF_MEM_Y_UV12:
+		case XVIDC_CSF_MEM_Y_UV16:
+			*NumPlanes = 2;
+			break;
+		case XVIDC_CSF_MEM_Y_U_V8_420:
+			ChromaLines = Height / 2;
+			/* Fall through */
+		case XVIDC_CSF_MEM_R_G_B8:
+		case XVIDC_CSF_MEM_Y_U_V8:
+		case XVIDC_CSF_MEM_Y_U_V10:
+			*NumPlanes = 3;
+			break;
+		default:
+			*NumPlanes = 1;
+			break;
+	}
+
+	PlaneLines[0] = Height;
+	PlaneLines[1] = (*NumPlanes > 1) ? ChromaLines : 0;
+	PlaneLines[2] = (*NumPlanes > 2) ? ChromaLines : 0;
+}
+
+/******************************************************************************/
+/**
+ * This function appends a completed buffer to the consumer queue.
+ *
+ * @param	Pool is a pointer to the pool.
+ * @param	Index is the buffer to queue.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XVidC_FbPoolEnqueue(XVidC_FbPool *Pool, u8 Index)
+{
+	u8 Tail;
+
+	Tail = (Pool->QueueHead + Pool->QueueCount) % Pool->NumBuffers;
+	Pool->Queue[Tail] = Index;
+	Pool->QueueCount++;
+}
+
+/******************************************************************************/
+/**
+ * This function removes the oldest buffer from the consumer queue.
+ *
+ * @param	Pool is a pointer to the pool.
+ *
+ * @return	Index of the oldest queued buffer.
+ *
+ * @note	The queue must not be empty.
+ *
+*******************************************************************************/
+static u8 XVidC_FbPoolDequeue(XVidC_FbPool *Pool)
+{
+	u8 Index;
+
+	Index = Pool->Queue[Pool->QueueHead];
+	Pool->QueueHead = (Pool->QueueHead + 1) % Pool->NumBuffers;
+	Pool->QueueCount--;
+
+	return Index;
+}
+
+/******************************************************************************/
+/**
+ * This function finds a free buffer for the producer. Buffers are handed out
+ * round robin so that the freed buffers are reused evenly.
+ *
+ * @param	Pool is a pointer to the pool.
+ *
+ * @return	Index of a free buffer or XVIDC_FBPOOL_NONE.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u8 XVidC_FbPoolGetFree(XVidC_FbPool *Pool)
+{
+	u8 Count;
+	u8 Index = Pool->NextFree;
+
+	for (Count = 0; Count < Pool->NumBuffers; Count++) {
+		if (Pool->Buf[Index].State == XVIDC_FBPOOL_FREE) {
+			Pool->NextFree = (Index + 1) % Pool->NumBuffers;
+			return Index;
+		}
+		Index = (Index + 1) % Pool->NumBuffers;
+	}
+
+	return XVIDC_FBPOOL_NONE;
+}
+/** @} */
@@ -0,0 +1,157 @@
+/*******************************************************************************
+* Copyright 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_fbpool.h
+ * @addtogroup video_common Overview
+ * @{
+ * @details
+ *
+ * Frame buffer pool shared between a frame buffer writer (producer) and a
+ * frame buffer reader (consumer).
+ *
+ * The pool carves a memory region into a ring of frame buffers. Each buffer
+ * holds all planes (luma, chroma and V-chroma) of one frame, laid out with a
+ * common stride aligned to the AXI-MM data width. Every buffer is owned by
+ * exactly one side at a time:
+ *   - XVIDC_FBPOOL_FREE: available to the producer.
+ *   - XVIDC_FBPOOL_PRODUCER: programmed into or being written by the producer.
+ *   - XVIDC_FBPOOL_QUEUED: complete frame waiting for the consumer.
+ *   - XVIDC_FBPOOL_CONSUMER: programmed into or being read by the consumer.
+ *
+ * A buffer is never handed to the producer while the consumer may still read
+ * it, which removes tearing. Both sides advance on their ap_ready interrupt,
+ * at which point the core has latched the previously programmed address and
+ * the address for the following frame can be programmed:
+ *   - XVidC_FbPoolProducerNext() queues the frame the producer just finished
+ *     and returns the buffer to program next.
+ *   - XVidC_FbPoolConsumerNext() releases the frame the consumer just finished
+ *     and returns the buffer to program next.
+ *   - XVidC_FbPoolConsumerPeek() returns the buffer XVidC_FbPoolConsumerNext()
+ *     would return without changing the pool.
+ *
+ * The pool policy decides what happens when the consumer falls behind:
+ *   - XVIDC_FBPOOL_DROP_OLDEST: the consumer skips to the newest queued frame
+ *     and the producer recycles the oldest queued frame when it runs out of
+ *     free buffers. The newest queued frame is never recycled. Latency stays
+ *     minimal.
+ *   - XVIDC_FBPOOL_REPEAT_LAST: every queued frame is shown in order. When
+ *     the producer runs out of free buffers it writes the next frame into its
+ *     last buffer again and that frame is dropped.
+ * In both cases the consumer repeats the last frame when nothing is queued.
+ *
+ * The pool does not access hardware and the frame buffer drivers program the
+ * returned addresses. Producer and consumer calls must not preempt each other,
+ * e.g. both interrupts are serviced at the same priority.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.15  ag   10/18/26 Initial release.
+ *       ag   10/18/26 Added XVidC_FbPoolConsumerPeek().
+ * </pre>
+ *
+*******************************************************************************/
+
+#ifndef XVIDC_FBPOOL_H_  /* Prevent circular inclusions by using protection macros. */
+#define XVIDC_FBPOOL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************* Include Files ********************************/
+
+#include "xil_types.h"
+#include "xvidc.h"
+
+/************************** Constant Definitions ******************************/
+
+#define XVIDC_FBPOOL_MAX_BUFFERS	8
+#define XVIDC_FBPOOL_MAX_PLANES		3
+#define XVIDC_FBPOOL_NONE		0xFF
+
+/**************************** Type Definitions ********************************/
+
+/**
+ * Ownership state of a pool buffer.
+ */
+typedef enum {
+	XVIDC_FBPOOL_FREE = 0,
+	XVIDC_FBPOOL_PRODUCER,
+	XVIDC_FBPOOL_QUEUED,
+	XVIDC_FBPOOL_CONSUMER
+} XVidC_FbState;
+
+/**
+ * Behavior of the pool when the consumer falls behind the producer.
+ */
+typedef enum {
+	XVIDC_FBPOOL_DROP_OLDEST = 0,
+	XVIDC_FBPOOL_REPEAT_LAST
+} XVidC_FbPoolPolicy;
+
+/**
+ * One frame buffer of the pool.
+ */
+typedef struct {
+	UINTPTR Addr[XVIDC_FBPOOL_MAX_PLANES];	/**< Plane base addresses */
+	u32 Seq;	/**< Producer frame number when the frame completed */
+	u8 Index;	/**< Position of the buffer in the pool */
+	u8 State;	/**< XVidC_FbState */
+} XVidC_FbBuffer;
+
+/**
+ * Frame buffer pool and the queue between producer and consumer.
+ */
+typedef struct {
+	XVidC_FbBuffer Buf[XVIDC_FBPOOL_MAX_BUFFERS];	/**< Buffer ring */
+	u8 Queue[XVIDC_FBPOOL_MAX_BUFFERS];	/**< Queued buffers, oldest first */
+	u32 Stride;		/**< Line stride of every plane in bytes */
+	u32 PlaneLines[XVIDC_FBPOOL_MAX_PLANES]; /**< Lines per plane */
+	u32 FrameSize;		/**< Bytes used by one buffer */
+	u8 NumBuffers;		/**< Number of buffers in the ring */
+	u8 NumPlanes;		/**< Planes per buffer */
+	u8 Policy;		/**< XVidC_FbPoolPolicy */
+	u8 QueueHead;		/**< Index of the oldest entry in Queue */
+	u8 QueueCount;		/**< Number of queued frames */
+	u8 NextFree;		/**< Next buffer to try for the producer */
+	u8 WrActive;		/**< Buffer latched by the producer */
+	u8 WrPending;		/**< Buffer programmed into the producer */
+	u8 RdActive;		/**< Buffer latched by the consumer */
+	u8 RdPending;		/**< Buffer programmed into the consumer */
+
+	/* Statistics */
+	u32 ProducedCount;	/**< Frames completed by the producer */
+	u32 ConsumedCount;	/**< New frames handed to the consumer */
+	u32 DroppedCount;	/**< Frames never handed to the consumer */
+	u32 RepeatedCount;	/**< Frames repeated by the consumer */
+	u32 LatencyLast;	/**< Queue latency of the last frame, in frames */
+	u32 LatencyMax;		/**< Largest queue latency, in frames */
+} XVidC_FbPool;
+
+/************************** Function Prototypes *******************************/
+
+u32 XVidC_FbPoolInit(XVidC_FbPool *Pool, UINTPTR BaseAddr, u32 Size,
+		u8 NumBuffers, XVidC_ColorFormat MemFmt,
+		const XVidC_VideoStream *StreamPtr, u32 Align,
+		XVidC_FbPoolPolicy Policy);
+void XVidC_FbPoolReset(XVidC_FbPool *Pool);
+const XVidC_FbBuffer *XVidC_FbPoolProducerNext(XVidC_FbPool *Pool);
+const XVidC_FbBuffer *XVidC_FbPoolConsumerNext(XVidC_FbPool *Pool);
+const XVidC_FbBuffer *XVidC_FbPoolConsumerPeek(const XVidC_FbPool *Pool);
+void XVidC_FbPoolClearStats(XVidC_FbPool *Pool);
+void XVidC_FbPoolReportStats(const XVidC_FbPool *Pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XVIDC_FBPOOL_H_ */
+/** @} */
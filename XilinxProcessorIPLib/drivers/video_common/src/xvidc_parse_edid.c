@@ -42,6 +42,7 @@
  *                            xvidc_edid_extension_handler struct to enhance
  *                            system stability
  * 1.10  eb  03-08-2018   Updated XV_VidC_parse_edid
+ * 1.20  ag  18-10-2026   Added EDID digest cache to XV_VidC_parse_edid
  * </pre>
  *
  ******************************************************************************/
@@ -55,6 +56,22 @@
 
 #include "xvidc_edid_ext.h"
 
+#if XVIDC_EDID_CACHE_SIZE > 0
+/*
+ * Parse results of recently seen sinks, keyed by a digest of all EDID blocks
+ * (checksum bytes included).
+ */
+typedef struct {
+    u32 digest;
+    u8  num_blocks;
+    u8  valid;
+    XV_VidC_EdidCntrlParam EdidCtrlParam;
+} xvidc_edid_cache_entry;
+
+static xvidc_edid_cache_entry xvidc_edid_cache[XVIDC_EDID_CACHE_SIZE];
+static u8 xvidc_edid_cache_next;
+#endif
+
 #if XVIDC_EDID_VERBOSITY > 1
 #define CM_2_MM(cm)                             ((cm) * 10)
 #define CM_2_IN(cm)                             ((cm) * 0.3937)
@@ -1645,6 +1662,50 @@ static const struct xvidc_edid_extension_handler {
 };
 
 
+#if XVIDC_EDID_CACHE_SIZE > 0
+/*****************************************************************************/
+/**
+*
+* This function computes the digest (32-bit FNV-1a) of the EDID blocks
+*
+* @param    data is a pointer to the EDID array.
+* @param    num_blocks is the number of 128 byte EDID blocks.
+*
+* @return Digest of the EDID
+*
+* @note   None.
+*
+******************************************************************************/
+static u32
+xvidc_edid_digest(const u8 * const data, u32 num_blocks) {
+    u32 digest = 0x811C9DC5;
+    u32 i;
+
+    for (i = 0; i < (num_blocks * XVIDC_EDID_BLOCK_SIZE); i++) {
+        digest = (digest ^ data[i]) * 0x01000193;
+    }
+
+    return digest;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function invalidates all entries of the EDID cache used by
+* XV_VidC_parse_edid
+*
+* @return None
+*
+* @note   None.
+*
+******************************************************************************/
+void
+XV_VidC_EdidCacheFlush(void) {
+    (void)memset((void *)xvidc_edid_cache, 0, sizeof(xvidc_edid_cache));
+    xvidc_edid_cache_next = 0;
+}
+#endif
+
 /*****************************************************************************/
 /**
 *
@@ -1656,7 +1717,9 @@ static const struct xvidc_edid_extension_handler {
 *
 * @return None
 *
-* @note   None.
+* @note   When VerboseEn is disabled the result is looked up in, and stored
+*         to, a cache of XVIDC_EDID_CACHE_SIZE entries, so re-plugging a
+*         recently seen sink does not parse its EDID again.
 *
 ******************************************************************************/
 void
@@ -1666,6 +1729,23 @@ XV_VidC_parse_edid(const u8 * const data,
     const struct edid * const edid = (struct edid *) data;
     const struct xvidc_edid_extension * const extensions =
         (struct xvidc_edid_extension *) (data + sizeof(*edid));
+#if XVIDC_EDID_CACHE_SIZE > 0
+    const u8 num_blocks = edid->extensions + 1;
+    u32 digest = 0;
+    u8 c;
+
+    if (!VerboseEn) {
+        digest = xvidc_edid_digest(data, num_blocks);
+        for (c = 0; c < XVIDC_EDID_CACHE_SIZE; c++) {
+            if (xvidc_edid_cache[c].valid &&
+                (xvidc_edid_cache[c].digest == digest) &&
+                (xvidc_edid_cache[c].num_blocks == num_blocks)) {
+                *EdidCtrlParam = xvidc_edid_cache[c].EdidCtrlParam;
+                return;
+            }
+        }
+    }
+#endif
 
     XV_VidC_EdidCtrlParamInit(EdidCtrlParam);
 
@@ -1688,4 +1768,15 @@ XV_VidC_parse_edid(const u8 * const data,
 		(*handler->inf_disp)(extension,EdidCtrlParam,VerboseEn);
         }
     }
+
+#if XVIDC_EDID_CACHE_SIZE > 0
+    if (!VerboseEn) {
+        c = xvidc_edid_cache_next;
+        xvidc_edid_cache[c].digest        = digest;
+        xvidc_edid_cache[c].num_blocks    = num_blocks;
+        xvidc_edid_cache[c].EdidCtrlParam = *EdidCtrlParam;
+        xvidc_edid_cache[c].valid         = 1;
+        xvidc_edid_cache_next = (c + 1) % XVIDC_EDID_CACHE_SIZE;
+    }
+#endif
 }
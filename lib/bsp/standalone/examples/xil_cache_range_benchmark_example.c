@@ -0,0 +1,129 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/**
+*
+* @file xil_cache_range_benchmark_example.c
+*
+* Implements a benchmark for the Data cache range maintenance APIs of
+* CortexA53/A72/A78 64 bit processors. For a set of buffer sizes it measures
+* Xil_DCacheCleanRange, Xil_DCacheFlushRange and the scatter list variant
+* Xil_DCacheFlushRangeList against flushing each buffer separately. It also
+* reports the time taken by one batch of XIL_DCACHE_RANGE_BATCH_LINES
+* cachelines, which is the longest window with IRQ and FIQ masked.
+* Build it with XIL_DCACHE_SETWAY_THRESHOLD defined to compare against set/way
+* maintenance of the entire Data cache for large ranges.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 9.2   ag   10/18/26 First release
+* </pre>
+******************************************************************************/
+#if defined (__aarch64__)
+#include "xil_printf.h"
+#include "xil_cache.h"
+#include "xtime_l.h"
+#include "xstatus.h"
+
+#define BENCH_BUFFER_SIZE	(4U * 1024U * 1024U)
+#define BENCH_LIST_COUNT	16U
+#define BENCH_CACHELINE		64U
+
+static u8 Buffer[BENCH_BUFFER_SIZE] __attribute__ ((aligned (64)));
+static Xil_DCacheRange List[BENCH_LIST_COUNT];
+
+/* Dirty every cacheline of the buffer, so that maintenance has work to do */
+static void DirtyBuffer(u32 Len)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < Len; Index += BENCH_CACHELINE) {
+		Buffer[Index] = (u8)Index;
+	}
+}
+
+/* Converts timer counts to nanoseconds */
+static u64 CountsToNs(XTime Counts)
+{
+	return (Counts * 1000000000U) / COUNTS_PER_SECOND;
+}
+
+static void BenchRange(u32 Len)
+{
+	XTime Start;
+	XTime End;
+	u64 CleanNs;
+	u64 FlushNs;
+	u64 SeparateNs;
+	u64 ListNs;
+	u32 Index;
+	u32 ChunkLen = Len / BENCH_LIST_COUNT;
+
+	DirtyBuffer(Len);
+	XTime_GetTime(&Start);
+	Xil_DCacheCleanRange((INTPTR)Buffer, Len);
+	XTime_GetTime(&End);
+	CleanNs = CountsToNs(End - Start);
+
+	DirtyBuffer(Len);
+	XTime_GetTime(&Start);
+	Xil_DCacheFlushRange((INTPTR)Buffer, Len);
+	XTime_GetTime(&End);
+	FlushNs = CountsToNs(End - Start);
+
+	for (Index = 0U; Index < BENCH_LIST_COUNT; Index++) {
+		List[Index].Addr = (INTPTR)&Buffer[Index * ChunkLen];
+		List[Index].Len = ChunkLen;
+	}
+
+	DirtyBuffer(Len);
+	XTime_GetTime(&Start);
+	for (Index = 0U; Index < BENCH_LIST_COUNT; Index++) {
+		Xil_DCacheFlushRange(List[Index].Addr, List[Index].Len);
+	}
+	XTime_GetTime(&End);
+	SeparateNs = CountsToNs(End - Start);
+
+	DirtyBuffer(Len);
+	XTime_GetTime(&Start);
+	Xil_DCacheFlushRangeList(List, BENCH_LIST_COUNT);
+	XTime_GetTime(&End);
+	ListNs = CountsToNs(End - Start);
+
+	xil_printf("%8d %10d %10d %12d %10d\r\n", Len, (u32)CleanNs,
+		   (u32)FlushNs, (u32)SeparateNs, (u32)ListNs);
+}
+
+int main(void)
+{
+	XTime Start;
+	XTime End;
+	u32 Len;
+	u32 BatchLen = XIL_DCACHE_RANGE_BATCH_LINES * BENCH_CACHELINE;
+
+	xil_printf("Start of cache range benchmark\r\n");
+	xil_printf("Set/way threshold %d bytes (0: disabled), batch %d lines\r\n",
+		   XIL_DCACHE_SETWAY_THRESHOLD, XIL_DCACHE_RANGE_BATCH_LINES);
+
+	/* Longest window with IRQ and FIQ masked */
+	DirtyBuffer(BatchLen);
+	XTime_GetTime(&Start);
+	Xil_DCacheFlushRange((INTPTR)Buffer, BatchLen);
+	XTime_GetTime(&End);
+	xil_printf("IRQ masked window %d ns\r\n", (u32)CountsToNs(End - Start));
+
+	xil_printf("   bytes   clean ns   flush ns  16 flush ns  list ns\r\n");
+	for (Len = 4096U; Len <= BENCH_BUFFER_SIZE; Len <<= 1U) {
+		BenchRange(Len);
+	}
+
+	xil_printf("Successfully ran cache range benchmark\r\n");
+
+	return XST_SUCCESS;
+}
+#endif /* #if defined (__aarch64__) */
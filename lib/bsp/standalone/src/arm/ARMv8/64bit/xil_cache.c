@@ -66,6 +66,11 @@
 *                    VERSAL NET.
 * 9.0 ml   03/03/23  Add description to fix doxygen warnings.
 * 9.1 ml   11/16/23  Fix compilation errors reported with -std=c2x compiler flag
+* 9.2 ag   10/18/26  Added Xil_DCacheCleanRange, Xil_DCacheFlushRange and
+*                    scatter list range APIs. Range operations mask IRQ/FIQ
+*                    only for bounded batches of cachelines and can switch
+*                    to set/way maintenance of entire cache above
+*                    XIL_DCACHE_SETWAY_THRESHOLD, disabled by default.
 * </pre>
 *
 ******************************************************************************/
@@ -82,7 +87,22 @@
 #include "xreg_cortexa53.h"
 #include "xil_exception.h"
 
+/************************** Constant Definitions *****************************/
+#define XIL_DCACHE_OP_CLEAN		0U	/**< Clean to point of coherency */
+#define XIL_DCACHE_OP_CLEAN_INV	1U	/**< Clean and invalidate */
+
+#if defined (VERSAL_NET)
+#define XIL_DCACHE_NUM_LEVELS	3U	/**< Data cache levels */
+#else
+#define XIL_DCACHE_NUM_LEVELS	2U	/**< Data cache levels */
+#endif
+
 /************************** Function Prototypes ******************************/
+static void Xil_DCacheRangeVaOp(INTPTR adr, INTPTR len, u32 Op);
+static void Xil_DCacheRangeOp(INTPTR adr, INTPTR len, u32 Op);
+static void Xil_DCacheRangeListOp(const Xil_DCacheRange *List, u32 Count,
+				u32 Op);
+static void Xil_DCacheSetWayOp(u32 Op);
 
 /************************** Variable Definitions *****************************/
 #define IRQ_FIQ_MASK 0xC0U	/**< Mask IRQ and FIQ interrupts in cpsr */
@@ -479,24 +499,297 @@ void Xil_DCacheInvalidateLine(INTPTR adr)
 * 			crashing because of the loss of essential data. Hence, such
 * 			operations are promoted to clean and invalidate which avoids such
 *			corruption.
+*			IRQ and FIQ are masked only while a batch of
+*			XIL_DCACHE_RANGE_BATCH_LINES cachelines is maintained. Ranges
+*			longer than a non zero XIL_DCACHE_SETWAY_THRESHOLD are maintained
+*			by flushing the entire Data cache with set/way operations.
 *
 ****************************************************************************/
 void Xil_DCacheInvalidateRange(INTPTR  adr, INTPTR len)
+{
+	Xil_DCacheRangeOp(adr, len, XIL_DCACHE_OP_CLEAN_INV);
+}
+
+/****************************************************************************/
+/**
+* @brief	Flush the Data cache for the given address range.
+* 			If the bytes specified by the address range are cached by the
+*			Data cache, the cachelines containing those bytes are
+*			invalidated. If the cachelines are modified (dirty), they are
+*			written to system memory before the lines are invalidated.
+*
+* @param	adr: 64bit start address of the range to be flushed.
+* @param	len: Length of the range to be flushed in bytes.
+*
+* @return	None.
+*
+* @note		IRQ and FIQ are masked only while a batch of
+*			XIL_DCACHE_RANGE_BATCH_LINES cachelines is flushed. Ranges
+*			longer than a non zero XIL_DCACHE_SETWAY_THRESHOLD are maintained
+*			by flushing the entire Data cache with set/way operations.
+*
+****************************************************************************/
+void Xil_DCacheFlushRange(INTPTR  adr, INTPTR len)
+{
+	Xil_DCacheRangeOp(adr, len, XIL_DCACHE_OP_CLEAN_INV);
+}
+
+/****************************************************************************/
+/**
+* @brief	Clean the Data cache for the given address range.
+* 			Modified (dirty) cachelines in the address range are written
+*			to system memory. The cachelines stay valid in the Data cache,
+*			so the CPU can keep accessing the buffer from the cache, e.g.
+*			after preparing a buffer for a DMA read.
+*
+* @param	adr: 64bit start address of the range to be cleaned.
+* @param	len: Length of the range to be cleaned in bytes.
+*
+* @return	None.
+*
+* @note		IRQ and FIQ are masked only while a batch of
+*			XIL_DCACHE_RANGE_BATCH_LINES cachelines is cleaned. Ranges
+*			longer than a non zero XIL_DCACHE_SETWAY_THRESHOLD are maintained
+*			by cleaning the entire Data cache with set/way operations.
+*
+****************************************************************************/
+void Xil_DCacheCleanRange(INTPTR  adr, INTPTR len)
+{
+	Xil_DCacheRangeOp(adr, len, XIL_DCACHE_OP_CLEAN);
+}
+
+/****************************************************************************/
+/**
+* @brief	Flush the Data cache for a list of address ranges. All ranges
+*			are flushed before a single barrier, which makes it cheaper
+*			than flushing each buffer of a scatter gather list separately.
+*
+* @param	List: Pointer to the array of address ranges.
+* @param	Count: Number of address ranges in the array.
+*
+* @return	None.
+*
+* @note		If XIL_DCACHE_SETWAY_THRESHOLD is non zero and the total length
+*			of the ranges exceeds it, the entire Data cache is flushed
+*			with set/way operations.
+*
+****************************************************************************/
+void Xil_DCacheFlushRangeList(const Xil_DCacheRange *List, u32 Count)
+{
+	Xil_DCacheRangeListOp(List, Count, XIL_DCACHE_OP_CLEAN_INV);
+}
+
+/****************************************************************************/
+/**
+* @brief	Clean the Data cache for a list of address ranges. All ranges
+*			are cleaned before a single barrier, which makes it cheaper
+*			than cleaning each buffer of a scatter gather list separately.
+*
+* @param	List: Pointer to the array of address ranges.
+* @param	Count: Number of address ranges in the array.
+*
+* @return	None.
+*
+* @note		If XIL_DCACHE_SETWAY_THRESHOLD is non zero and the total length
+*			of the ranges exceeds it, the entire Data cache is cleaned
+*			with set/way operations.
+*
+****************************************************************************/
+void Xil_DCacheCleanRangeList(const Xil_DCacheRange *List, u32 Count)
+{
+	Xil_DCacheRangeListOp(List, Count, XIL_DCACHE_OP_CLEAN);
+}
+
+/****************************************************************************/
+/**
+* @brief	Maintain the Data cache lines of an address range by virtual
+*			address, without a barrier. IRQ and FIQ are masked for at
+*			most XIL_DCACHE_RANGE_BATCH_LINES cachelines at a time.
+*
+* @param	adr: 64bit start address of the range.
+* @param	len: Length of the range in bytes.
+* @param	Op: XIL_DCACHE_OP_CLEAN or XIL_DCACHE_OP_CLEAN_INV.
+*
+* @return	None.
+*
+****************************************************************************/
+static void Xil_DCacheRangeVaOp(INTPTR adr, INTPTR len, u32 Op)
 {
 	const INTPTR cacheline = 64U;
+	const INTPTR batchlen = cacheline * XIL_DCACHE_RANGE_BATCH_LINES;
 	INTPTR end = adr + len;
-	adr = adr & (~0x3F);
-	u32 currmask = mfcpsr();
-	mtcpsr(currmask | IRQ_FIQ_MASK);
-	if (len != 0U) {
-		while (adr < end) {
-			mtcpdc(CIVAC, adr);
-			adr += cacheline;
+	INTPTR tempadr = adr & (~(cacheline - 1U));
+	INTPTR batchend;
+	u32 currmask;
+
+	while (tempadr < end) {
+		batchend = end;
+		if ((end - tempadr) > batchlen) {
+			batchend = tempadr + batchlen;
 		}
+
+		currmask = mfcpsr();
+		mtcpsr(currmask | IRQ_FIQ_MASK);
+		if (Op == XIL_DCACHE_OP_CLEAN) {
+			while (tempadr < batchend) {
+				mtcpdc(CVAC, tempadr);
+				tempadr += cacheline;
+			}
+		} else {
+			while (tempadr < batchend) {
+				mtcpdc(CIVAC, tempadr);
+				tempadr += cacheline;
+			}
+		}
+		mtcpsr(currmask);
+	}
+}
+
+/****************************************************************************/
+/**
+* @brief	Maintain the Data cache for the given address range by virtual
+*			address. If XIL_DCACHE_SETWAY_THRESHOLD is non zero, longer
+*			ranges are maintained by set/way operations on the entire Data
+*			cache, which is faster than walking the range line by line but
+*			does not reach the caches of other cores.
+*
+* @param	adr: 64bit start address of the range.
+* @param	len: Length of the range in bytes.
+* @param	Op: XIL_DCACHE_OP_CLEAN or XIL_DCACHE_OP_CLEAN_INV.
+*
+* @return	None.
+*
+****************************************************************************/
+static void Xil_DCacheRangeOp(INTPTR adr, INTPTR len, u32 Op)
+{
+	if ((XIL_DCACHE_SETWAY_THRESHOLD != 0U) &&
+	    (len > (INTPTR)XIL_DCACHE_SETWAY_THRESHOLD)) {
+		Xil_DCacheSetWayOp(Op);
+	} else {
+		if (len != 0U) {
+			Xil_DCacheRangeVaOp(adr, len, Op);
+		}
+		/* Wait for cache maintenance to complete */
+		dsb();
+	}
+}
+
+/****************************************************************************/
+/**
+* @brief	Maintain the Data cache for a list of address ranges with a
+*			single barrier at the end.
+*
+* @param	List: Pointer to the array of address ranges.
+* @param	Count: Number of address ranges in the array.
+* @param	Op: XIL_DCACHE_OP_CLEAN or XIL_DCACHE_OP_CLEAN_INV.
+*
+* @return	None.
+*
+****************************************************************************/
+static void Xil_DCacheRangeListOp(const Xil_DCacheRange *List, u32 Count,
+				u32 Op)
+{
+	INTPTR TotalLen = 0U;
+	u32 Index;
+
+	for (Index = 0U; Index < Count; Index++) {
+		TotalLen += List[Index].Len;
+	}
+
+	if ((XIL_DCACHE_SETWAY_THRESHOLD != 0U) &&
+	    (TotalLen > (INTPTR)XIL_DCACHE_SETWAY_THRESHOLD)) {
+		Xil_DCacheSetWayOp(Op);
+	} else {
+		for (Index = 0U; Index < Count; Index++) {
+			if (List[Index].Len != 0U) {
+				Xil_DCacheRangeVaOp(List[Index].Addr,
+						List[Index].Len, Op);
+			}
+		}
+		/* Wait for cache maintenance to complete */
+		dsb();
+	}
+}
+
+/****************************************************************************/
+/**
+* @brief	Clean or clean and invalidate all levels of the Data cache by
+*			set/way. IRQ and FIQ are masked for at most
+*			XIL_DCACHE_RANGE_BATCH_LINES set/way operations at a time.
+*
+* @param	Op: XIL_DCACHE_OP_CLEAN or XIL_DCACHE_OP_CLEAN_INV.
+*
+* @return	None.
+*
+* @note		Like Xil_DCacheFlush, set/way operations maintain only the
+*			caches of the executing core and the shared caches.
+*
+****************************************************************************/
+static void Xil_DCacheSetWayOp(u32 Op)
+{
+	u32 CsidReg, C7Reg;
+	u32 LineSize, NumWays;
+	u32 Way, WayIndex, WayAdjust, Set, SetIndex, NumSet, CacheLevel;
+	u32 Level;
+	u32 Batch;
+	u32 currmask;
+
+	for (Level = 0U; Level < XIL_DCACHE_NUM_LEVELS; Level++) {
+		CacheLevel = Level << 1U;
+
+		currmask = mfcpsr();
+		mtcpsr(currmask | IRQ_FIQ_MASK);
+
+		/* Select cache level and D cache in CSSR */
+		mtcp(CSSELR_EL1, CacheLevel);
+		isb();
+
+		CsidReg = mfcp(CCSIDR_EL1);
+
+		/* Get the cacheline size, way size, index size from csidr */
+		LineSize = (CsidReg & 0x00000007U) + 0x00000004U;
+
+		/* Number of Ways */
+		NumWays = (CsidReg & 0x00001FFFU) >> 3U;
+		NumWays += 0x00000001U;
+
+		/* Number of Sets */
+		NumSet = (CsidReg >> 13U) & 0x00007FFFU;
+		NumSet += 0x00000001U;
+
+		WayAdjust = clz(NumWays) - (u32)0x0000001FU;
+
+		Way = 0U;
+		Set = 0U;
+		Batch = 0U;
+
+		for (WayIndex = 0U; WayIndex < NumWays; WayIndex++) {
+			for (SetIndex = 0U; SetIndex < NumSet; SetIndex++) {
+				C7Reg = Way | Set | CacheLevel;
+				if (Op == XIL_DCACHE_OP_CLEAN) {
+					mtcpdc(CSW, C7Reg);
+				} else {
+					mtcpdc(CISW, C7Reg);
+				}
+				Set += (0x00000001U << LineSize);
+
+				Batch++;
+				if (Batch == XIL_DCACHE_RANGE_BATCH_LINES) {
+					/* Open a window for pending interrupts */
+					Batch = 0U;
+					mtcpsr(currmask);
+					currmask = mfcpsr();
+					mtcpsr(currmask | IRQ_FIQ_MASK);
+				}
+			}
+			Set = 0U;
+			Way += (0x00000001U << WayAdjust);
+		}
+
+		/* Wait for maintenance of this level to complete */
+		dsb();
+		mtcpsr(currmask);
 	}
-	/* Wait for invalidate to complete */
-	dsb();
-	mtcpsr(currmask);
 }
 
 /****************************************************************************/
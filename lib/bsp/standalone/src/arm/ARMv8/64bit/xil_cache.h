@@ -25,6 +25,8 @@
 * ----- ---- -------- -----------------------------------------------
 * 5.00 	pkp  05/29/14 First release
 * 9.00  ml   03/03/23 Add description to fix doxygen warnings.
+* 9.2   ag   10/18/26 Added Xil_DCacheCleanRange, scatter list range APIs
+*                     and made Xil_DCacheFlushRange a function.
 * </pre>
 *
 ******************************************************************************/
@@ -49,8 +51,39 @@ extern "C" {
  *@endcond
  */
 
+#ifndef XIL_DCACHE_RANGE_BATCH_LINES
+/**
+ * Number of cachelines maintained by range APIs with IRQ and FIQ masked,
+ * bounds the interrupt latency added by cache maintenance
+ */
+#define XIL_DCACHE_RANGE_BATCH_LINES	256U
+#endif
+
+#ifndef XIL_DCACHE_SETWAY_THRESHOLD
+/**
+ * Range length in bytes above which range APIs maintain the entire Data
+ * cache by set/way instead of walking the range line by line, 0 disables
+ * it. Set/way operations only act on the caches of the calling core and are
+ * not broadcast to the point of coherency, so only enable it when no other
+ * core or coherent master shares the data.
+ */
+#define XIL_DCACHE_SETWAY_THRESHOLD	0U
+#endif
+
+/**************************** Type Definitions *******************************/
+/**
+ * Address range for the scatter list cache maintenance APIs
+ */
+typedef struct {
+	INTPTR Addr;	/**< Start address of the range */
+	INTPTR Len;	/**< Length of the range in bytes */
+} Xil_DCacheRange;
+
 /***************** Macros (Inline Functions) Definitions *********************/
-#define Xil_DCacheFlushRange Xil_DCacheInvalidateRange /**< DCache range */
+/**
+ * Invalidate is promoted to clean and invalidate, see Xil_DCacheInvalidateRange
+ */
+#define Xil_DCacheInvalidateRangeList Xil_DCacheFlushRangeList
 /************************** Function Prototypes ******************************/
 void Xil_DCacheEnable(void);
 void Xil_DCacheDisable(void);
@@ -58,7 +91,11 @@ void Xil_DCacheInvalidate(void);
 void Xil_DCacheInvalidateRange(INTPTR adr, INTPTR len);
 void Xil_DCacheInvalidateLine(INTPTR adr);
 void Xil_DCacheFlush(void);
+void Xil_DCacheFlushRange(INTPTR adr, INTPTR len);
 void Xil_DCacheFlushLine(INTPTR adr);
+void Xil_DCacheCleanRange(INTPTR adr, INTPTR len);
+void Xil_DCacheFlushRangeList(const Xil_DCacheRange *List, u32 Count);
+void Xil_DCacheCleanRangeList(const Xil_DCacheRange *List, u32 Count);
 
 void Xil_ICacheEnable(void);
 void Xil_ICacheDisable(void);
@@ -90,6 +90,7 @@
  * | ^				| ^	| ^		| ^	 | Note: Deprecated in Versal but supported in ZynqMP			     |
  * | PM_FEATURE_CHECK		| 0x3F	| Both		| 2	 | V1 - The API is used to return supported version of the given API	     |
  * | ^				| ^	| ^		| ^	 | V2 - Added support of bitmask payload functionality			     |
+ * | PM_BATCH			| 0x4A	| Versal	| 1	 | The API is used to execute a list of PM operations in a single request    |
  *
  *****************************************************************************/
 
@@ -262,7 +263,8 @@ typedef enum {
 	PM_FORCE_HOUSECLEAN,				/**< 0x47 */
 	PM_FPGA_GET_VERSION,				/**< 0x48 */
 	PM_FPGA_GET_FEATURE_LIST,			/**< 0x49 */
-	PM_API_MAX					/**< 0x4A */
+	PM_BATCH,					/**< 0x4A */
+	PM_API_MAX					/**< 0x4B */
 } XPm_ApiId;
 
 #endif  /* PM_API_VERSION_H_ */
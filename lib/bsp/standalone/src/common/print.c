@@ -29,7 +29,7 @@ void print(const char8 *ptr)
 #else
 #if defined(STDOUT_BASEADDRESS) || defined(SDT)
   while (*ptr != (char8)0) {
-    outbyte (*ptr);
+    Xil_PrintOutByte (*ptr);
 	ptr++;
   }
 #else
@@ -0,0 +1,351 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+* @file xil_console.c
+* @addtogroup common_console Buffered console APIs
+* @{
+*
+* Contains the buffered console used by xil_printf and print. Head and Tail
+* are free running byte counters; Head is only written by the producer
+* (Xil_ConsolePutChar) and Tail only by the consumer (Xil_ConsoleDrain), so
+* no lock is needed between a print in thread context and a drain in the
+* UART interrupt handler.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 9.2   ag   10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xil_console.h"
+#include "xil_printf.h"
+#include "xstatus.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+typedef struct {
+	u8 *Buf;			/**< Backing store */
+	u32 Mask;			/**< Size of the backing store - 1 */
+	volatile u32 Head;		/**< Bytes added, written by producer */
+	volatile u32 Tail;		/**< Bytes sent, written by consumer */
+	u32 Dropped;			/**< Bytes dropped on overflow */
+	u32 Policy;			/**< Overflow policy */
+	Xil_ConsoleTxFn TxFn;		/**< Non blocking byte send */
+	Xil_ConsoleKickFn KickFn;	/**< TX empty interrupt control */
+	UINTPTR BaseAddress;		/**< UART base address */
+} Xil_Console;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/* Keeps the compiler from reordering the buffer access and the index update */
+#define XIL_CONSOLE_BARRIER()	__asm__ __volatile__ ("" : : : "memory")
+
+/************************** Function Prototypes ******************************/
+
+static void Xil_ConsoleWaitSpace(void);
+
+/************************** Variable Definitions *****************************/
+
+static Xil_Console Console;
+static u32 ConsoleLogLevel = XIL_CONSOLE_LOG_INFO;
+
+/*****************************************************************************/
+/**
+*
+* @brief	Initializes the buffered console and routes xil_printf and print
+*		to it. Until Xil_ConsoleSetTx is called the buffer is drained
+*		with the blocking outbyte routine.
+*
+* @param	Buf is the backing store of the ring buffer.
+* @param	Size is the size of Buf in bytes, which must be a power of 2.
+* @param	Policy is XIL_CONSOLE_DROP_NEW or XIL_CONSOLE_BLOCK.
+*
+* @return
+*		- XST_SUCCESS on success.
+*		- XST_INVALID_PARAM if any argument is invalid.
+*
+******************************************************************************/
+s32 Xil_ConsoleInit(u8 *Buf, u32 Size, u32 Policy)
+{
+	s32 Status = XST_INVALID_PARAM;
+
+	if ((Buf == NULL) || (Size == 0U) || ((Size & (Size - 1U)) != 0U) ||
+	    (Policy > XIL_CONSOLE_BLOCK)) {
+		goto END;
+	}
+
+	xil_set_outbyte(NULL);
+	Console.Buf = Buf;
+	Console.Mask = Size - 1U;
+	Console.Head = 0U;
+	Console.Tail = 0U;
+	Console.Dropped = 0U;
+	Console.Policy = Policy;
+	Console.TxFn = NULL;
+	Console.KickFn = NULL;
+	Console.BaseAddress = 0U;
+	xil_set_outbyte(Xil_ConsolePutChar);
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief	Sets the routines used to drain the console to the UART.
+*
+* @param	TxFn sends one byte without waiting. If NULL, the blocking
+*		outbyte routine is used.
+* @param	KickFn controls the TX empty interrupt of the UART. If NULL,
+*		the application drains the console from an idle hook.
+* @param	BaseAddress is the base address of the UART.
+*
+* @return	None.
+*
+******************************************************************************/
+void Xil_ConsoleSetTx(Xil_ConsoleTxFn TxFn, Xil_ConsoleKickFn KickFn,
+		      UINTPTR BaseAddress)
+{
+	Console.TxFn = TxFn;
+	Console.KickFn = KickFn;
+	Console.BaseAddress = BaseAddress;
+
+	if ((KickFn != NULL) && (Console.Head != Console.Tail)) {
+		KickFn(BaseAddress, (u32)TRUE);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief	Adds a byte to the console. This is the byte output routine
+*		installed for xil_printf and print by Xil_ConsoleInit.
+*
+* @param	c is the byte to be added.
+*
+* @return	None.
+*
+******************************************************************************/
+void Xil_ConsolePutChar(char c)
+{
+	u32 Head = Console.Head;
+
+	if ((Head - Console.Tail) > Console.Mask) {
+		if (Console.Policy == XIL_CONSOLE_BLOCK) {
+			Xil_ConsoleWaitSpace();
+		} else {
+			Console.Dropped++;
+			goto END;
+		}
+	}
+
+	Console.Buf[Head & Console.Mask] = (u8)c;
+	XIL_CONSOLE_BARRIER();
+	Console.Head = Head + 1U;
+	XIL_CONSOLE_BARRIER();
+
+	/*
+	 * Tail is read after Head is published. If this byte is the only one
+	 * pending, the consumer may have already disabled the TX empty
+	 * interrupt, so enable it again.
+	 */
+	if ((Console.KickFn != NULL) && ((Head + 1U - Console.Tail) == 1U)) {
+		Console.KickFn(Console.BaseAddress, (u32)TRUE);
+	}
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief	Sends pending bytes to the UART until the TX FIFO is full or
+*		MaxBytes bytes are sent. Call it from the TX empty interrupt
+*		handler of the UART or from an idle hook.
+*
+* @param	MaxBytes is the maximum number of bytes to be sent.
+*		XIL_CONSOLE_DRAIN_ALL sends as much as the UART accepts.
+*
+* @return	Number of bytes still pending.
+*
+******************************************************************************/
+u32 Xil_ConsoleDrain(u32 MaxBytes)
+{
+	u32 Tail = Console.Tail;
+	u32 Count = 0U;
+	u32 Pending;
+	u8 Data;
+
+	while ((Tail != Console.Head) && (Count < MaxBytes)) {
+		XIL_CONSOLE_BARRIER();
+		Data = Console.Buf[Tail & Console.Mask];
+		if (Console.TxFn == NULL) {
+			outbyte((char)Data);
+		} else if (Console.TxFn(Console.BaseAddress, Data) == (u32)FALSE) {
+			break;
+		} else {
+			/* Byte accepted by the TX FIFO */
+		}
+		XIL_CONSOLE_BARRIER();
+		Tail++;
+		Console.Tail = Tail;
+		Count++;
+	}
+
+	Pending = Console.Head - Tail;
+	if ((Pending == 0U) && (Console.KickFn != NULL)) {
+		Console.KickFn(Console.BaseAddress, (u32)FALSE);
+		/* Catch a byte added while the interrupt was being disabled */
+		XIL_CONSOLE_BARRIER();
+		Pending = Console.Head - Tail;
+		if (Pending != 0U) {
+			Console.KickFn(Console.BaseAddress, (u32)TRUE);
+		}
+	}
+
+	return Pending;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief	Sends all pending bytes to the UART and waits for the TX FIFO
+*		to accept them. Intended for panic and exception paths, where
+*		interrupts may no longer be serviced.
+*
+* @return	None.
+*
+******************************************************************************/
+void Xil_ConsoleFlush(void)
+{
+	if (Console.Buf == NULL) {
+		goto END;
+	}
+
+	while (Xil_ConsoleDrain(XIL_CONSOLE_DRAIN_ALL) != 0U) {
+		;
+	}
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief	Flushes the console and routes xil_printf and print back to
+*		the blocking outbyte routine.
+*
+* @return	None.
+*
+******************************************************************************/
+void Xil_ConsoleStop(void)
+{
+	Xil_ConsoleFlush();
+	xil_set_outbyte(NULL);
+	Console.Buf = NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief	Returns the number of bytes waiting to be sent to the UART.
+*
+* @return	Number of pending bytes.
+*
+******************************************************************************/
+u32 Xil_ConsoleGetPending(void)
+{
+	return Console.Head - Console.Tail;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief	Returns the number of bytes dropped because the buffer was
+*		full with the XIL_CONSOLE_DROP_NEW policy.
+*
+* @return	Number of dropped bytes.
+*
+******************************************************************************/
+u32 Xil_ConsoleGetDropped(void)
+{
+	return Console.Dropped;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief	Sets the log level used by Xil_ConsoleLog.
+*
+* @param	Level is one of XIL_CONSOLE_LOG_*. Messages with a higher
+*		level are discarded without being formatted.
+*
+* @return	None.
+*
+******************************************************************************/
+void Xil_ConsoleSetLogLevel(u32 Level)
+{
+	ConsoleLogLevel = Level;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief	Prints a message if its level is enabled.
+*
+* @param	Level is the level of the message, one of XIL_CONSOLE_LOG_*.
+* @param	Ctrl1 is the format string, as for xil_printf.
+*
+* @return	None.
+*
+******************************************************************************/
+void Xil_ConsoleLog(u32 Level, const char8 *Ctrl1, ...)
+{
+	va_list Args;
+
+	if ((Level == XIL_CONSOLE_LOG_NONE) || (Level > ConsoleLogLevel)) {
+		goto END;
+	}
+
+	va_start(Args, Ctrl1);
+	xil_vprintf(Ctrl1, Args);
+	va_end(Args);
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief	Waits until there is space for one byte in the buffer. Without
+*		an interrupt driven consumer the producer drains the buffer
+*		itself, as it runs in the same context as the idle hook.
+*
+* @return	None.
+*
+******************************************************************************/
+static void Xil_ConsoleWaitSpace(void)
+{
+	while ((Console.Head - Console.Tail) > Console.Mask) {
+		if (Console.KickFn == NULL) {
+			(void)Xil_ConsoleDrain(1U);
+		}
+	}
+}
+/** @} */
@@ -0,0 +1,114 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+* @file xil_console.h
+* @addtogroup common_console Buffered console APIs
+* @{
+* @details
+*
+* The buffered console lets xil_printf and print format into a ring buffer
+* and return without waiting for the UART. The buffer is drained to the UART
+* later, either from the TX empty interrupt handler of the UART or from an
+* idle hook of the application, by calling Xil_ConsoleDrain. Panic and
+* exception paths call Xil_ConsoleFlush to push all pending bytes out
+* synchronously.
+*
+* The backing store is provided by the caller, so any memory region which is
+* otherwise used as a log buffer can be reused for the console.
+*
+* The buffer is lock free for one producer and one consumer. Bytes are added
+* by the context which prints and removed by the context which drains. If
+* prints are issued from more than one context, the caller must serialize
+* them, as it already has to for unbuffered xil_printf to get readable output.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 9.2   ag   10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+#ifndef XIL_CONSOLE_H	/* prevent circular inclusions */
+#define XIL_CONSOLE_H	/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files ********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions ****************************/
+
+/**
+ * @name Overflow policies
+ * @{
+ */
+/**< Drop the bytes which do not fit and count them */
+#define XIL_CONSOLE_DROP_NEW		(0U)
+/**
+ * Wait for the UART to make space in the buffer. With an interrupt driven
+ * drain, do not print from a context which masks the UART interrupt.
+ */
+#define XIL_CONSOLE_BLOCK		(1U)
+/** @} */
+
+/**< Xil_ConsoleDrain limit which sends as much as the UART accepts */
+#define XIL_CONSOLE_DRAIN_ALL		(0xFFFFFFFFU)
+
+/**
+ * @name Log levels for Xil_ConsoleLog
+ * @{
+ */
+#define XIL_CONSOLE_LOG_NONE		(0U) /**< Nothing is printed */
+#define XIL_CONSOLE_LOG_ERROR		(1U) /**< Errors */
+#define XIL_CONSOLE_LOG_WARN		(2U) /**< Warnings */
+#define XIL_CONSOLE_LOG_INFO		(3U) /**< Informational messages */
+#define XIL_CONSOLE_LOG_DEBUG		(4U) /**< Debug messages */
+/** @} */
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Sends one byte to the UART without waiting. Returns TRUE if the byte was
+ * put into the TX FIFO and FALSE if the FIFO is full. XUartPs_TrySendByte,
+ * XUartPsv_TrySendByte and XUartLite_TrySendByte match this prototype.
+ */
+typedef u32 (*Xil_ConsoleTxFn)(UINTPTR BaseAddress, u8 Data);
+
+/**
+ * Enables (Enable is TRUE) or disables the TX empty interrupt of the UART.
+ * It is called with TRUE when bytes are added to an empty buffer and with
+ * FALSE once the buffer has been drained.
+ */
+typedef void (*Xil_ConsoleKickFn)(UINTPTR BaseAddress, u32 Enable);
+
+/************************** Function Prototypes ******************************/
+
+s32 Xil_ConsoleInit(u8 *Buf, u32 Size, u32 Policy);
+void Xil_ConsoleSetTx(Xil_ConsoleTxFn TxFn, Xil_ConsoleKickFn KickFn,
+		      UINTPTR BaseAddress);
+void Xil_ConsolePutChar(char c);
+u32 Xil_ConsoleDrain(u32 MaxBytes);
+void Xil_ConsoleFlush(void);
+void Xil_ConsoleStop(void);
+u32 Xil_ConsoleGetPending(void);
+u32 Xil_ConsoleGetDropped(void);
+void Xil_ConsoleSetLogLevel(u32 Level);
+void Xil_ConsoleLog(u32 Level, const char8 *Ctrl1, ...);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_CONSOLE_H */
+/**
+* @} End of "addtogroup common_console".
+*/
@@ -46,6 +46,13 @@ typedef struct params_s {
 #define SUPPORT_64BIT_PRINT
 #endif
 
+/************************** Variable Definitions *****************************/
+
+#if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
+/**< Routine used by xil_printf and print to emit a byte, outbyte by default */
+Xil_OutByteFn Xil_PrintOutByte = outbyte;
+#endif
+
 /*---------------------------------------------------*/
 /* The purpose of this routine is to output data the */
 /* same as the standard printf function without the  */
@@ -69,7 +76,7 @@ static void padding( const s32 l_flag, const struct params_s *par)
 		i = (par->len);
 		for (; i < (par->num1); i++) {
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-			outbyte( par->pad_character);
+			Xil_PrintOutByte( par->pad_character);
 #endif
 		}
 	}
@@ -93,7 +100,7 @@ static void outs(const charptr lp, struct params_s *par)
 		while (((*LocalPtr) != (char8)0) && ((par->num2) != 0)) {
 			(par->num2)--;
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-			outbyte(*LocalPtr);
+			Xil_PrintOutByte(*LocalPtr);
 #endif
 			LocalPtr += 1;
 		}
@@ -153,7 +160,7 @@ static void outnum( const s32 n, const s32 base, struct params_s *par)
 	padding( !(par->left_flag), par);
 	while (&outbuf[i] >= outbuf) {
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-		outbyte( outbuf[i] );
+		Xil_PrintOutByte( outbuf[i] );
 #endif
 		i--;
 	}
@@ -207,7 +214,9 @@ static void outnum1( const s64 n, const s32 base, params_t *par)
 	par->len = (s32)strlen(outbuf);
 	padding( !(par->left_flag), par);
 	while (&outbuf[i] >= outbuf) {
-		outbyte( outbuf[i] );
+#if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
+		Xil_PrintOutByte( outbuf[i] );
+#endif
 		i--;
 	}
 	padding( par->left_flag, par);
@@ -296,7 +305,7 @@ void xil_vprintf(const char8 *ctrl1, va_list argp)
 		/* format control is found.                    */
 		if (*ctrl != '%') {
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-			outbyte(*ctrl);
+			Xil_PrintOutByte(*ctrl);
 #endif
 			ctrl += 1;
 			continue;
@@ -346,7 +355,7 @@ try_next:
 		switch (tolower(ch)) {
 			case '%':
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-				outbyte( '%');
+				Xil_PrintOutByte( '%');
 #endif
 				Check = 1;
 				break;
@@ -361,7 +370,9 @@ try_next:
 					width = va_arg(argp, u32);
 					string = va_arg(argp, const char *);
 					for (index = 0; index < width && string[index] != '\0' ; index++) {
-						outbyte(string[index]);
+#if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
+						Xil_PrintOutByte(string[index]);
+#endif
 					}
 					ctrl += 2;
 				} else {
@@ -422,7 +433,7 @@ try_next:
 
 			case 'c':
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-				outbyte( (char8)va_arg( argp, s32));
+				Xil_PrintOutByte( (char8)va_arg( argp, s32));
 #endif
 				Check = 1;
 				break;
@@ -431,28 +442,28 @@ try_next:
 				switch (*ctrl) {
 					case 'a':
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-						outbyte( ((char8)0x07));
+						Xil_PrintOutByte( ((char8)0x07));
 #endif
 						break;
 					case 'h':
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-						outbyte( ((char8)0x08));
+						Xil_PrintOutByte( ((char8)0x08));
 #endif
 						break;
 					case 'r':
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-						outbyte( ((char8)0x0D));
+						Xil_PrintOutByte( ((char8)0x0D));
 #endif
 						break;
 					case 'n':
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-						outbyte( ((char8)0x0D));
-						outbyte( ((char8)0x0A));
+						Xil_PrintOutByte( ((char8)0x0D));
+						Xil_PrintOutByte( ((char8)0x0A));
 #endif
 						break;
 					default:
 #if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
-						outbyte( *ctrl);
+						Xil_PrintOutByte( *ctrl);
 #endif
 						break;
 				}
@@ -474,3 +485,25 @@ try_next:
 	}
 }
 /*---------------------------------------------------*/
+
+/*****************************************************************************/
+/**
+* This routine changes the routine which xil_printf and print use to emit
+* each byte. The buffered console installs Xil_ConsolePutChar here so that
+* prints return without waiting for the UART.
+*
+* @param	Fn is the new byte output routine. Passing NULL restores outbyte.
+*
+******************************************************************************/
+void xil_set_outbyte(Xil_OutByteFn Fn)
+{
+#if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
+	if (Fn == NULL) {
+		Xil_PrintOutByte = outbyte;
+	} else {
+		Xil_PrintOutByte = Fn;
+	}
+#else
+	(void)Fn;
+#endif
+}
@@ -40,6 +40,7 @@ struct params_s;
 
 typedef char8* charptr;
 typedef s32 (*func_ptr)(int c);
+typedef void (*Xil_OutByteFn)(char c); /**< Byte output routine */
 
 /************************** Function Prototypes ******************************/
 /**< prints the statement */
@@ -49,6 +50,11 @@ void xil_vprintf(const char8 *ctrl1, va_list argp);
 void print( const char8 *ptr);
 extern void outbyte (char c); /**< To send byte */
 extern char inbyte(void); /**< To receive byte */
+/**< Changes the byte output routine of xil_printf and print */
+void xil_set_outbyte(Xil_OutByteFn Fn);
+#if defined(STDOUT_BASEADDRESS) || defined(VERSAL_PLM) || defined(SDT)
+extern Xil_OutByteFn Xil_PrintOutByte; /**< Current byte output routine */
+#endif
 
 #ifdef __cplusplus
 }
@@ -33,6 +33,7 @@
 * 1.07  bm   07/17/2023 Removed XPlm_InitProc function
 *       rama 08/10/2023 Changed exception handler print to DEBUG_ALWAYS for
 *                       debug level_0 option
+*       ag   10/18/2026 Flush buffered UART prints in exception handler
 *
 * </pre>
 *
@@ -109,6 +110,7 @@ static void XPlm_ExceptionHandler(void *Data)
 		"R14: 0x%08x, R15: 0x%08x, R16: 0x%08x, R17: 0x%08x \n\r",
 		mfmsr(), mfear(), mfedr(), mfesr(),
 		mfgpr(r14), mfgpr(r15), mfgpr(r16), mfgpr(r17));
+	XPlmi_FlushUart();
 
 	(void)XLoader_SecureClear();
 
@@ -39,6 +39,8 @@
 *       bsv  05/03/21 Add provision to load bitstream from OCM with DDR
 *                     present in design
 * 8.0   bsv  07/13/21 Remove unwanted CsuDma initializations
+* 9.0   ag   10/18/26 Use the partition hash calculated during partition
+*                     copy, if available, for partition sign verification
 *
 * </pre>
 *
@@ -245,7 +247,7 @@ END:
  ******************************************************************************/
 static u32 XFsbl_PartitionSignVer(const XFsblPs *FsblInstancePtr, u64 PartitionOffset,
 				u32 PartitionLen, u64 AcOffset,
-				u32 PartitionNum)
+				u32 PartitionNum, const u8 *StreamedHash)
 {
 
 	u8 PartitionHash[XFSBL_HASH_TYPE_SHA3] __attribute__ ((aligned (4))) = {0};
@@ -262,6 +264,15 @@ static u32 XFsbl_PartitionSignVer(const XFsblPs *FsblInstancePtr, u64 PartitionO
 
 	XFsbl_Printf(DEBUG_INFO, "Doing Partition Sign verification\r\n");
 
+	/**
+	 * Partition hash is already calculated while the partition
+	 * was copied, skip reading the partition again
+	 */
+	if (StreamedHash != NULL) {
+		(void)XFsbl_MemCpy(PartitionHash, StreamedHash, HashLen);
+		goto RSA_VERIFY;
+	}
+
 	/**
 	 * total partition length to be hashed except the AC
 	 */
@@ -312,6 +323,7 @@ static u32 XFsbl_PartitionSignVer(const XFsblPs *FsblInstancePtr, u64 PartitionO
 
 	XFsbl_ShaFinish(ShaCtx, (u8 *)PartitionHash, HashLen);
 
+RSA_VERIFY:
 	/* Set SPK pointer */
 	AcPtr += (XFSBL_RSA_AC_ALIGN + XFSBL_PPK_SIZE);
 	SpkModular = AcPtr;
@@ -375,14 +387,21 @@ END:
 /*****************************************************************************/
 /**
  *
- * @param       None
+ * @param       FsblInstancePtr - FSBL Instance Pointer
+ * @param       PartitionOffset - Address of the partition
+ * @param       PartitionLen - Length of the partition including AC
+ * @param       AcOffset - Address of the authentication certificate
+ * @param       PartitionNum - Partition number
+ * @param       StreamedHash - Hash of the partition and AC calculated while
+ *              the partition was copied, NULL if it is to be calculated
  *
- * @return      None
+ * @return      XFSBL_SUCCESS - In case of Success
+ *              Error code - In case of Failure
  *
  ******************************************************************************/
 u32 XFsbl_Authentication(const XFsblPs * FsblInstancePtr, u64 PartitionOffset,
 				u32 PartitionLen, u64 AcOffset,
-				u32 PartitionNum)
+				u32 PartitionNum, const u8 *StreamedHash)
 {
         u32 Status;
         u32 HashLen = XFSBL_HASH_TYPE_SHA3;
@@ -402,7 +421,8 @@ u32 XFsbl_Authentication(const XFsblPs * FsblInstancePtr, u64 PartitionOffset,
 
         /* Do Partition Signature verification using SPK */
         Status = XFsbl_PartitionSignVer(FsblInstancePtr, PartitionOffset,
-					PartitionLen, AcOffset, PartitionNum);
+					PartitionLen, AcOffset, PartitionNum,
+					StreamedHash);
 
         if(XFSBL_SUCCESS != Status)
         {
@@ -28,6 +28,10 @@
 *       bsv  04/01/21 Added TPM support
 *       bsv  05/03/21 Add provision to load bitstream from OCM with DDR
 *                     present in design
+* 6.0   ag   10/18/26 Added XFsbl_ShaUpdateCopy() and partition hash
+*                     calculated during copy to XFsbl_Authentication()
+*       ag   10/18/26 XFsbl_ShaUpdateCopy() is built only with
+*                     XFSBL_SHA_STREAM_COPY
 *
 * </pre>
 *
@@ -106,6 +110,10 @@ void XFsbl_ShaDigest(const u8 *In, const u32 Size, u8 *Out, u32 HashLen);
 void XFsbl_ShaFinish(void * Ctx, u8 * Hash, u32 HashLen);
 void XFsbl_ShaStart(void * Ctx, u32 HashLen);
 void XFsbl_ShaUpdate(void * Ctx, u8 * Data, u32 Size, u32 HashLen);
+#ifdef XFSBL_SHA_STREAM_COPY
+u32 XFsbl_ShaUpdateCopy(void * Ctx, u8 * Data, PTRSIZE DstAddress, u32 Size,
+		u32 HashLen);
+#endif
 #ifdef XFSBL_PL_LOAD_FROM_OCM
 #ifdef XFSBL_BS
 u32 XFsbl_ShaUpdate_DdrLess(const XFsblPs *FsblInstancePtr, void *Ctx,
@@ -116,7 +124,7 @@ u32 XFsbl_ShaUpdate_DdrLess(const XFsblPs *FsblInstancePtr, void *Ctx,
 #ifdef XFSBL_SECURE
 u32 XFsbl_Authentication(const XFsblPs * FsblInstancePtr, u64 PartitionOffset,
 				u32 PartitionLen, u64 AcOffset,
-				u32 PartitionNum);
+				u32 PartitionNum, const u8 *StreamedHash);
 u32 XFsbl_CompareHashs(u8 *Hash1, u8 *Hash2, u32 HashLen);
 u32 XFsbl_Sha3PadSelect(XSecure_Sha3PadType PadType);
 u32 XFsbl_BhAuthentication(const XFsblPs * FsblInstancePtr, u8 *Data,
@@ -30,6 +30,7 @@
 *       bsv  05/15/21 Support to ensure authenticated images boot as
 *                     non-secure when RSA_EN is not programmed is disabled by
 *                     default
+* 5.0   ag   10/18/26 Added FSBL_SHA_STREAM_COPY_EXCLUDE_VAL configuration
 *
 *</pre>
 *
@@ -138,6 +139,10 @@ extern "C" {
  *     - FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE_VAL Code to "load authenticated
  *       partitions as non secure when EFUSEs are not programmed and when boot
  *       header is not authenticated" is excluded
+ *     - FSBL_SHA_STREAM_COPY_EXCLUDE_VAL Code to calculate the SHA3 hash of
+ *       a partition while it is copied, through the secure stream switch
+ *       loop back of CSU DMA, is excluded. When excluded, the partition is
+ *       copied first and hashed from its load address.
  */
 #ifndef FSBL_NAND_EXCLUDE_VAL
 #define FSBL_NAND_EXCLUDE_VAL			(0U)
@@ -211,6 +216,10 @@ extern "C" {
 #define FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE_VAL	(1U)
 #endif
 
+#ifndef FSBL_SHA_STREAM_COPY_EXCLUDE_VAL
+#define FSBL_SHA_STREAM_COPY_EXCLUDE_VAL	(1U)
+#endif
+
 #if (FSBL_NAND_EXCLUDE_VAL) && (!defined(FSBL_NAND_EXCLUDE))
 #define FSBL_NAND_EXCLUDE
 #endif
@@ -286,6 +295,11 @@ extern "C" {
 #define FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE
 #endif
 
+#if (FSBL_SHA_STREAM_COPY_EXCLUDE_VAL == 1U) && \
+	(!defined(FSBL_SHA_STREAM_COPY_EXCLUDE))
+#define FSBL_SHA_STREAM_COPY_EXCLUDE
+#endif
+
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
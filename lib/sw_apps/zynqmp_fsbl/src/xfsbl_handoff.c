@@ -34,6 +34,8 @@
  *                     garbage prints and removed DEBUG_HANDOFF macro
  *       sd   03/01/24 Removed XFsbl_Handoff_Printf macro and added
  *                     uart fifo check function just before handoff
+ * 6.1   ag   10/18/26 Wait for completion of DDR ECC initialization before
+ *                     handoff
  *
  * </pre>
  *
@@ -736,6 +738,12 @@ u32 XFsbl_Handoff (const XFsblPs * FsblInstancePtr, u32 PartitionNum, u32 EarlyH
 	const XFsblPs_PartitionHeader * PartitionHeader;
 	static u32 CpuIndexEarlyHandoff = 0;
 
+	/* DDR ECC initialization must be complete before any CPU is released */
+	Status = XFsbl_DdrEccInitWait();
+	if (XFSBL_SUCCESS != Status) {
+		goto END;
+	}
+
 	/* Restoring the SD card detection signal */
 	XFsbl_Out32(IOU_SLCR_SD_CDN_CTRL, SdCdnRegVal);
 	PartitionHeader =
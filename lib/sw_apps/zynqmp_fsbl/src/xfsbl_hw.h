@@ -595,6 +595,11 @@ extern "C" {
 /* Register: ADMA_CH0 Base Address */
 #define ADMA_CH0_BASEADDR      0XFFA80000U
 
+/* ADMA channels, the registers of channel n are at ADMA_CH0 + n * offset */
+#define ADMA_NUM_CHANNELS      8U
+#define ADMA_CH_OFFSET         0X00010000U
+#define XFSBL_ADMA_CH_REG(Ch, Reg)	((Reg) + ((Ch) * ADMA_CH_OFFSET))
+
 /* Register: ADMA_CH0_ZDMA_CH_STATUS */
 #define ADMA_CH0_ZDMA_CH_STATUS    ( ( ADMA_CH0_BASEADDR ) + 0X0000011CU )
 #define ADMA_CH0_ZDMA_CH_STATUS_STATE_MASK    0X00000003U
@@ -884,6 +889,14 @@ extern "C" {
 #define XFSBL_BS
 #endif
 
+/**
+ * Definition for partition hash calculation during copy to be included.
+ * It uses the bitstream read buffer for the chunks.
+ */
+#if !defined(FSBL_SHA_STREAM_COPY_EXCLUDE) && defined(XFSBL_BS)
+#define XFSBL_SHA_STREAM_COPY
+#endif
+
 
 /**
  * Definition for early handoff feature to be included
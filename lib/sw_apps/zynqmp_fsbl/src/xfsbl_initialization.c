@@ -56,6 +56,9 @@
 * 9.0   bsv  10/15/21 Fixed bug to support secondary boot with non-zero
 *                     multiboot offset
 * 9.1   ng   07/13/23 Added SDT support
+* 9.2   ag   10/18/26 Initialize DDR ECC on all ADMA channels in the
+*                     background and mark DDR as memory as it completes
+*       ag   10/18/26 Updated XFsbl_Authentication() call as per new prototype
 *
 * </pre>
 *
@@ -84,9 +87,43 @@
 #define XFSBL_APU_RESET_MASK			(1U<<16U)
 #define XFSBL_APU_RESET_BIT			16U
 
+/* ECC initialization ranges, the synchronous range has the highest priority */
+#define XFSBL_ECC_RANGE_SYNC		0U
+#define XFSBL_ECC_RANGE_DDR		1U
+#define XFSBL_ECC_RANGE_HI_DDR		2U
+#define XFSBL_ECC_NUM_RANGES		3U
+#define XFSBL_ECC_CH_IDLE		0xFFU
+
+/* Bounds of the length of a chunk initialized by one ADMA transfer */
+#define XFSBL_ECC_INIT_MIN_CHUNK_LEN	(0x200000U)
+#define XFSBL_ECC_INIT_MAX_CHUNK_LEN	(0x20000000U)
+
+/* ADMA channel that only takes chunks of the minimum length */
+#define XFSBL_ECC_PRIO_CH		0U
+
 /**************************** Type Definitions *******************************/
+/**
+ * Memory range being ECC initialized
+ */
+typedef struct {
+	u64 StartAddr; /**< Start address of the range */
+	u64 EndAddr; /**< End address of the range, exclusive */
+	u64 NextAddr; /**< Start address of the next chunk to initialize */
+	u64 MarkedAddr; /**< DDR below this address is marked as Memory */
+} XFsblPs_EccRange;
+
+/**
+ * Chunk in flight on an ADMA channel
+ */
+typedef struct {
+	u64 Addr; /**< Start address of the chunk */
+	u32 Length; /**< Length of the chunk in bytes */
+	u8 Range; /**< Range of the chunk, XFSBL_ECC_CH_IDLE if idle */
+} XFsblPs_EccChannel;
 
 /***************** Macros (Inline Functions) Definitions *********************/
+#define XFSBL_ROUND_UP(Addr, Size)	\
+	(((Addr) + ((u64)(Size) - 1U)) & ~((u64)(Size) - 1U))
 
 /************************** Function Prototypes ******************************/
 static u32 XFsbl_ProcessorInit(XFsblPs * FsblInstancePtr);
@@ -97,6 +134,14 @@ static u32 XFsbl_ValidateHeader(XFsblPs * FsblInstancePtr);
 static u32 XFsbl_SecondaryBootDeviceInit(XFsblPs * FsblInstancePtr);
 static u32 XFsbl_DdrEccInit(void);
 static u32 XFsbl_EccInit(u64 DestAddr, u64 LengthBytes);
+static void XFsbl_EccChannelsSetup(void);
+static void XFsbl_EccChannelsRestore(void);
+static void XFsbl_EccChannelStart(u32 Ch, u8 Range);
+static u64 XFsbl_EccRangeWatermark(u8 Range);
+static void XFsbl_EccMarkDdrRange(u8 Range);
+static void XFsbl_EccRangeStart(u8 Range, u64 DestAddr, u64 LengthBytes);
+static u32 XFsbl_EccRangeWait(u8 Range, u64 EndAddr);
+static void XFsbl_EccEngineStop(void);
 static u32 XFsbl_TcmInit(XFsblPs * FsblInstancePtr);
 static void XFsbl_EnableProgToPL(void);
 static void XFsbl_ClearPendingInterrupts(void);
@@ -120,6 +165,16 @@ void XFsbl_RegisterHandlers(void);
 /************************** Variable Definitions *****************************/
 extern XFsblPs FsblInstance;
 
+static XFsblPs_EccRange EccRanges[XFSBL_ECC_NUM_RANGES];
+static XFsblPs_EccChannel EccChannels[ADMA_NUM_CHANNELS];
+static u32 EccEngineStatus = XFSBL_SUCCESS;
+static u8 EccEngineActive = FALSE;
+static u8 DdrEccInitPending = FALSE;
+#ifdef XFSBL_PERF
+static XTime EccStartTime;
+static XTime EccStallTime;
+#endif
+
 #ifdef __clang__
 extern u8 Image$$DATA_SECTION$$Base;
 extern u8 Image$$DATA_SECTION$$Limit;
@@ -364,7 +419,6 @@ u32 XFsbl_Initialize(XFsblPs * FsblInstancePtr)
 			if (XFSBL_SUCCESS != Status) {
 				goto END;
 			}
-			XFsbl_MarkDdrAsReserved(FALSE);
 		}
 		else {
 			XFsbl_MarkDdrAsReserved(TRUE);
@@ -375,7 +429,6 @@ u32 XFsbl_Initialize(XFsblPs * FsblInstancePtr)
 	if (XFSBL_SUCCESS != Status) {
 		goto END;
 	}
-	XFsbl_MarkDdrAsReserved(FALSE);
 #endif
 
 #if defined(XFSBL_PL_CLEAR) && defined(XFSBL_BS)
@@ -1309,7 +1362,7 @@ static u32 XFsbl_ValidateHeader(XFsblPs * FsblInstancePtr)
 			Status = XFsbl_Authentication(FsblInstancePtr,
 					(PTRSIZE)ImageHdr,
 					Size + XFSBL_AUTH_CERT_MIN_SIZE,
-					(PTRSIZE)(AuthBuffer), 0x00U);
+					(PTRSIZE)(AuthBuffer), 0x00U, NULL);
 			if (Status != XFSBL_SUCCESS) {
 				XFsbl_Printf(DEBUG_GENERAL,
 					"Failure at image header"
@@ -1594,125 +1647,440 @@ END:
 
 /*****************************************************************************/
 /**
- * This function does ECC Initialization of memory
+ * This function programs the write only mode and the ECC init pattern in all
+ * the ADMA channels used for ECC initialization
  *
- * @param	DestAddr is start address from where to calculate ECC
- * @param	LengthBytes is length in bytes from start address to calculate ECC
+ * @param	None
  *
- * @return
- * 		- XFSBL_SUCCESS for successful ECC Initialization
- * 		- errors as mentioned in xfsbl_error.h
+ * @return	None
  *
  *****************************************************************************/
-static u32 XFsbl_EccInit(u64 DestAddr, u64 LengthBytes)
+static void XFsbl_EccChannelsSetup(void)
 {
 	u32 RegVal;
-	u32 Status;
-	u32 Length;
-	u64 StartAddr = DestAddr;
-	u64 NumBytes = LengthBytes;
-
-	Xil_DCacheDisable();
-
-	while (NumBytes > 0U) {
-		if (NumBytes > ZDMA_TRANSFER_MAX_LEN) {
-			Length = ZDMA_TRANSFER_MAX_LEN;
-		} else {
-			Length = (u32)NumBytes;
-		}
+	u32 Ch;
 
+	for (Ch = 0U; Ch < ADMA_NUM_CHANNELS; Ch++) {
 		/* Wait until the DMA is in idle state */
 		do {
-			RegVal = XFsbl_In32(ADMA_CH0_ZDMA_CH_STATUS);
+			RegVal = XFsbl_In32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_STATUS));
 			RegVal &= ADMA_CH0_ZDMA_CH_STATUS_STATE_MASK;
 		} while ((RegVal != ADMA_CH0_ZDMA_CH_STATUS_STATE_DONE) &&
 				(RegVal != ADMA_CH0_ZDMA_CH_STATUS_STATE_ERR));
 
 		/* Enable Simple (Write Only) Mode */
-		RegVal = XFsbl_In32(ADMA_CH0_ZDMA_CH_CTRL0);
+		RegVal = XFsbl_In32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_CTRL0));
 		RegVal &= (ADMA_CH0_ZDMA_CH_CTRL0_POINT_TYPE_MASK |
 				ADMA_CH0_ZDMA_CH_CTRL0_MODE_MASK);
 		RegVal |= (ADMA_CH0_ZDMA_CH_CTRL0_POINT_TYPE_NORMAL |
 				ADMA_CH0_ZDMA_CH_CTRL0_MODE_WR_ONLY);
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_CTRL0, RegVal);
+		XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_CTRL0), RegVal);
 
 		/* Fill in the data to be written */
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_WR_ONLY_WORD0, XFSBL_ECC_INIT_VAL_WORD);
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_WR_ONLY_WORD1, XFSBL_ECC_INIT_VAL_WORD);
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_WR_ONLY_WORD2, XFSBL_ECC_INIT_VAL_WORD);
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_WR_ONLY_WORD3, XFSBL_ECC_INIT_VAL_WORD);
-
-		/* Write Destination Address */
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_DST_DSCR_WORD0,
-				(u32)(StartAddr & ADMA_CH0_ZDMA_CH_DST_DSCR_WORD0_LSB_MASK));
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_DST_DSCR_WORD1,
-				(u32)((StartAddr >> 32U) &
-						ADMA_CH0_ZDMA_CH_DST_DSCR_WORD1_MSB_MASK));
-
-		/* Size to be Transferred. Recommended to set both src and dest sizes */
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_SRC_DSCR_WORD2, Length);
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_DST_DSCR_WORD2, Length);
-
-		/* DMA Enable */
-		RegVal = XFsbl_In32(ADMA_CH0_ZDMA_CH_CTRL2);
-		RegVal |= ADMA_CH0_ZDMA_CH_CTRL2_EN_MASK;
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_CTRL2, RegVal);
-
-		/* Check the status of the transfer by polling on DMA Done */
-		do {
-			RegVal = XFsbl_In32(ADMA_CH0_ZDMA_CH_ISR);
-			RegVal &= ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK;
-		} while (RegVal != ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK);
-
-		/* Clear DMA status */
-		RegVal = XFsbl_In32(ADMA_CH0_ZDMA_CH_ISR);
-		RegVal |= ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK;
-		XFsbl_Out32(ADMA_CH0_ZDMA_CH_ISR, ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK);
-
-		/* Read the channel status for errors */
-		RegVal = XFsbl_In32(ADMA_CH0_ZDMA_CH_STATUS);
-		if (RegVal == ADMA_CH0_ZDMA_CH_STATUS_STATE_ERR) {
-			Status = XFSBL_FAILURE;
-			Xil_DCacheEnable();
-			goto END;
+		XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_WR_ONLY_WORD0),
+				XFSBL_ECC_INIT_VAL_WORD);
+		XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_WR_ONLY_WORD1),
+				XFSBL_ECC_INIT_VAL_WORD);
+		XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_WR_ONLY_WORD2),
+				XFSBL_ECC_INIT_VAL_WORD);
+		XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_WR_ONLY_WORD3),
+				XFSBL_ECC_INIT_VAL_WORD);
+
+		EccChannels[Ch].Range = XFSBL_ECC_CH_IDLE;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function restores the reset values of the ADMA channel registers used
+ * for ECC initialization
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_EccChannelsRestore(void)
+{
+	u32 Ch;
+
+	for (Ch = 0U; Ch < ADMA_NUM_CHANNELS; Ch++) {
+		XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_CTRL0),
+				0x00000080U);
+		XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_WR_ONLY_WORD0),
+				0x00000000U);
+		XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_WR_ONLY_WORD1),
+				0x00000000U);
+		XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_WR_ONLY_WORD2),
+				0x00000000U);
+		XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_WR_ONLY_WORD3),
+				0x00000000U);
+		XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_DST_DSCR_WORD0),
+				0x00000000U);
+		XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_DST_DSCR_WORD1),
+				0x00000000U);
+		XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_SRC_DSCR_WORD2),
+				0x00000000U);
+		XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_DST_DSCR_WORD2),
+				0x00000000U);
+		XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch,
+				ADMA_CH0_ZDMA_CH_CTRL0_TOTAL_BYTE_COUNT), 0x00000000U);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function starts the ECC initialization of the next chunk of a range
+ * on an idle ADMA channel. The chunk length grows with the distance from the
+ * start of the range, so that the start of DDR, where partitions are usually
+ * loaded, is initialized with a fine grained watermark while the rest of DDR
+ * is initialized in large transfers that keep the channels busy between two
+ * calls to XFsbl_DdrEccInitService. Chunks on XFSBL_ECC_PRIO_CH always have
+ * the minimum length, so a synchronous range such as TCM is started within
+ * one short transfer even while the other channels run 512MB DDR chunks.
+ *
+ * @param	Ch is the idle ADMA channel
+ * @param	Range is the index of the range in EccRanges
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_EccChannelStart(u32 Ch, u8 Range)
+{
+	XFsblPs_EccRange *RangePtr = &EccRanges[Range];
+	u64 Length = RangePtr->NextAddr - RangePtr->StartAddr;
+	u32 RegVal;
+
+	if (Length < XFSBL_ECC_INIT_MIN_CHUNK_LEN) {
+		Length = XFSBL_ECC_INIT_MIN_CHUNK_LEN;
+	} else if (Length > XFSBL_ECC_INIT_MAX_CHUNK_LEN) {
+		Length = XFSBL_ECC_INIT_MAX_CHUNK_LEN;
+	}
+	/* The priority channel is free again after one short transfer, so
+	 * the synchronous range never waits for large DDR chunks */
+	if (Ch == XFSBL_ECC_PRIO_CH) {
+		Length = XFSBL_ECC_INIT_MIN_CHUNK_LEN;
+	}
+	if (Length > (RangePtr->EndAddr - RangePtr->NextAddr)) {
+		Length = RangePtr->EndAddr - RangePtr->NextAddr;
+	}
+
+	EccChannels[Ch].Addr = RangePtr->NextAddr;
+	EccChannels[Ch].Length = (u32)Length;
+	EccChannels[Ch].Range = Range;
+	RangePtr->NextAddr += Length;
+
+	/* Write Destination Address */
+	XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_DST_DSCR_WORD0),
+			(u32)(EccChannels[Ch].Addr &
+				ADMA_CH0_ZDMA_CH_DST_DSCR_WORD0_LSB_MASK));
+	XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_DST_DSCR_WORD1),
+			(u32)((EccChannels[Ch].Addr >> 32U) &
+				ADMA_CH0_ZDMA_CH_DST_DSCR_WORD1_MSB_MASK));
+
+	/* Size to be Transferred. Recommended to set both src and dest sizes */
+	XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_SRC_DSCR_WORD2),
+			EccChannels[Ch].Length);
+	XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_DST_DSCR_WORD2),
+			EccChannels[Ch].Length);
+
+	/* DMA Enable */
+	RegVal = XFsbl_In32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_CTRL2));
+	RegVal |= ADMA_CH0_ZDMA_CH_CTRL2_EN_MASK;
+	XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_CTRL2), RegVal);
+}
+
+/*****************************************************************************/
+/**
+ * This function returns the ECC initialization watermark of a range. All the
+ * memory of the range below the watermark is initialized.
+ *
+ * @param	Range is the index of the range in EccRanges
+ *
+ * @return	Watermark address
+ *
+ *****************************************************************************/
+static u64 XFsbl_EccRangeWatermark(u8 Range)
+{
+	u64 Watermark = EccRanges[Range].NextAddr;
+	u32 Ch;
+
+	/* Chunks are handed out in address order, so the lowest chunk still
+	 * in flight limits the watermark */
+	for (Ch = 0U; Ch < ADMA_NUM_CHANNELS; Ch++) {
+		if ((EccChannels[Ch].Range == Range) &&
+				(EccChannels[Ch].Addr < Watermark)) {
+			Watermark = EccChannels[Ch].Addr;
 		}
+	}
 
-		NumBytes -= Length;
-		StartAddr += Length;
+	return Watermark;
+}
+
+/*****************************************************************************/
+/**
+ * This function marks the DDR blocks of a range that are completely below the
+ * ECC initialization watermark as Memory in the MMU translation table. Until
+ * then they stay Reserved so that no speculative access reaches DDR that is
+ * not initialized yet.
+ *
+ * @param	Range is the index of the DDR range in EccRanges
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_EccMarkDdrRange(u8 Range)
+{
+#if (defined (XPAR_PSU_DDR_0_S_AXI_BASEADDR) || defined (XPAR_PSU_DDR_0_BASEADDRESS)) && !defined (ARMR5)
+	XFsblPs_EccRange *RangePtr = &EccRanges[Range];
+	u64 Watermark = XFsbl_EccRangeWatermark(Range);
+#ifdef ARMA53_64
+	u64 BlockSize = (RangePtr->StartAddr < ADDRESS_LIMIT_4GB) ?
+			(u64)BLOCK_SIZE_A53_64 : (u64)BLOCK_SIZE_A53_64_HIGH;
+	u32 Attrib = ATTRIB_MEMORY_A53_64;
+#else
+	u64 BlockSize = BLOCK_SIZE_A53_32;
+	u32 Attrib = ATTRIB_MEMORY_A53_32;
+#endif
+	u8 Marked = FALSE;
+
+#ifndef ARMA53_64
+	/* Only the lower DDR is mapped for A53 32 bit */
+	if (Range != XFSBL_ECC_RANGE_DDR) {
+		goto END;
+	}
+#endif
+
+	while ((RangePtr->MarkedAddr < RangePtr->EndAddr) &&
+		(((RangePtr->MarkedAddr + BlockSize) <= Watermark) ||
+		(Watermark == RangePtr->EndAddr))) {
+		XFsbl_SetTlbAttributes((INTPTR)RangePtr->MarkedAddr, Attrib);
+		RangePtr->MarkedAddr += BlockSize;
+		Marked = TRUE;
+	}
+	if (Marked == TRUE) {
+		Xil_DCacheFlush();
 	}
+#ifndef ARMA53_64
+END:
+	return;
+#endif
+#else
+	(void)Range;
+#endif
+}
+
+/*****************************************************************************/
+/**
+ * This function progresses the ECC initialization. It retires the chunks that
+ * are done, starts the next chunks on the idle channels and marks the newly
+ * initialized DDR blocks as Memory. The synchronous range has priority over
+ * the DDR ranges.
+ *
+ * @param	None
+ *
+ * @return
+ * 		- XFSBL_SUCCESS if no channel reported an error
+ * 		- XFSBL_FAILURE if a channel reported an error
+ *
+ *****************************************************************************/
+u32 XFsbl_DdrEccInitService(void)
+{
+	u32 RegVal;
+	u32 Ch;
+	u8 Range;
+
+	if ((EccEngineActive == FALSE) || (EccEngineStatus != XFSBL_SUCCESS)) {
+		goto END;
+	}
+
+	for (Ch = 0U; Ch < ADMA_NUM_CHANNELS; Ch++) {
+		if (EccChannels[Ch].Range != XFSBL_ECC_CH_IDLE) {
+			RegVal = XFsbl_In32(XFSBL_ADMA_CH_REG(Ch,
+					ADMA_CH0_ZDMA_CH_ISR));
+			if ((RegVal & ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK) == 0U) {
+				continue;
+			}
+
+			/* Clear DMA status */
+			XFsbl_Out32(XFSBL_ADMA_CH_REG(Ch, ADMA_CH0_ZDMA_CH_ISR),
+					ADMA_CH0_ZDMA_CH_ISR_DMA_DONE_MASK);
+
+			/* Read the channel status for errors */
+			RegVal = XFsbl_In32(XFSBL_ADMA_CH_REG(Ch,
+					ADMA_CH0_ZDMA_CH_STATUS));
+			if (RegVal == ADMA_CH0_ZDMA_CH_STATUS_STATE_ERR) {
+				XFsbl_Printf(DEBUG_GENERAL, "ECC init failed on "
+					"ADMA channel %u at 0x%0x%08x\n\r", Ch,
+					(u32)(EccChannels[Ch].Addr >> 32U),
+					(u32)EccChannels[Ch].Addr);
+				EccEngineStatus = XFSBL_FAILURE;
+				goto END;
+			}
+			EccChannels[Ch].Range = XFSBL_ECC_CH_IDLE;
+		}
+
+		for (Range = 0U; Range < XFSBL_ECC_NUM_RANGES; Range++) {
+			if (EccRanges[Range].NextAddr < EccRanges[Range].EndAddr) {
+				XFsbl_EccChannelStart(Ch, Range);
+				break;
+			}
+		}
+	}
+
+	for (Range = XFSBL_ECC_RANGE_DDR; Range < XFSBL_ECC_NUM_RANGES; Range++) {
+		XFsbl_EccMarkDdrRange(Range);
+	}
+
+END:
+	return EccEngineStatus;
+}
+
+/*****************************************************************************/
+/**
+ * This function adds a range to the ECC initialization engine and enables
+ * the engine if it is not running yet
+ *
+ * @param	Range is the index of the range in EccRanges
+ * @param	DestAddr is start address from where to calculate ECC
+ * @param	LengthBytes is length in bytes from start address to calculate ECC
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_EccRangeStart(u8 Range, u64 DestAddr, u64 LengthBytes)
+{
+	EccRanges[Range].StartAddr = DestAddr;
+	EccRanges[Range].EndAddr = DestAddr + LengthBytes;
+	EccRanges[Range].NextAddr = DestAddr;
+	EccRanges[Range].MarkedAddr = DestAddr;
+
+	if (EccEngineActive == FALSE) {
+		XFsbl_EccChannelsSetup();
+		EccEngineStatus = XFSBL_SUCCESS;
+		EccEngineActive = TRUE;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function waits until the ECC of a range is initialized up to an
+ * address, servicing all the channels meanwhile
+ *
+ * @param	Range is the index of the range in EccRanges
+ * @param	EndAddr is the address up to which the range must be initialized
+ *
+ * @return
+ * 		- XFSBL_SUCCESS on success
+ * 		- XFSBL_FAILURE if a channel reported an error
+ *
+ *****************************************************************************/
+static u32 XFsbl_EccRangeWait(u8 Range, u64 EndAddr)
+{
+	u32 Status = XFSBL_SUCCESS;
+#ifdef XFSBL_PERF
+	XTime tStart = 0;
+	XTime tEnd = 0;
+
+	XTime_GetTime(&tStart);
+#endif
+
+	while (XFsbl_EccRangeWatermark(Range) < EndAddr) {
+		Status = XFsbl_DdrEccInitService();
+		if (XFSBL_SUCCESS != Status) {
+			break;
+		}
+	}
+
+#ifdef XFSBL_PERF
+	XTime_GetTime(&tEnd);
+	EccStallTime += tEnd - tStart;
+#endif
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function disables the ECC initialization engine once all the ranges
+ * are done
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_EccEngineStop(void)
+{
+	u8 Range;
+
+	for (Range = 0U; Range < XFSBL_ECC_NUM_RANGES; Range++) {
+		if (XFsbl_EccRangeWatermark(Range) < EccRanges[Range].EndAddr) {
+			goto END;
+		}
+	}
+
+	XFsbl_EccChannelsRestore();
+	EccEngineActive = FALSE;
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+ * This function does ECC Initialization of memory. It uses the synchronous
+ * range of the ECC initialization engine, which has priority over the DDR
+ * ranges that may be initialized in the background, and returns once the
+ * memory is initialized.
+ *
+ * @param	DestAddr is start address from where to calculate ECC
+ * @param	LengthBytes is length in bytes from start address to calculate ECC
+ *
+ * @return
+ * 		- XFSBL_SUCCESS for successful ECC Initialization
+ * 		- errors as mentioned in xfsbl_error.h
+ *
+ *****************************************************************************/
+static u32 XFsbl_EccInit(u64 DestAddr, u64 LengthBytes)
+{
+	u32 Status;
+
+	Xil_DCacheDisable();
+
+	XFsbl_EccRangeStart(XFSBL_ECC_RANGE_SYNC, DestAddr, LengthBytes);
+	Status = XFsbl_EccRangeWait(XFSBL_ECC_RANGE_SYNC, DestAddr + LengthBytes);
 
 	Xil_DCacheEnable();
 
-	/* Restore reset values for the DMA registers used */
-	XFsbl_Out32(ADMA_CH0_ZDMA_CH_CTRL0, 0x00000080U);
-	XFsbl_Out32(ADMA_CH0_ZDMA_CH_WR_ONLY_WORD0, 0x00000000U);
-	XFsbl_Out32(ADMA_CH0_ZDMA_CH_WR_ONLY_WORD1, 0x00000000U);
-	XFsbl_Out32(ADMA_CH0_ZDMA_CH_WR_ONLY_WORD2, 0x00000000U);
-	XFsbl_Out32(ADMA_CH0_ZDMA_CH_WR_ONLY_WORD3, 0x00000000U);
-	XFsbl_Out32(ADMA_CH0_ZDMA_CH_DST_DSCR_WORD0, 0x00000000U);
-	XFsbl_Out32(ADMA_CH0_ZDMA_CH_DST_DSCR_WORD1, 0x00000000U);
-	XFsbl_Out32(ADMA_CH0_ZDMA_CH_SRC_DSCR_WORD2, 0x00000000U);
-	XFsbl_Out32(ADMA_CH0_ZDMA_CH_DST_DSCR_WORD2, 0x00000000U);
-	XFsbl_Out32(ADMA_CH0_ZDMA_CH_CTRL0_TOTAL_BYTE_COUNT,0x00000000U);
+	if (XFSBL_SUCCESS != Status) {
+		goto END;
+	}
+
+	XFsbl_EccEngineStop();
 
 	XFsbl_Printf(DEBUG_INFO,
 		"Address 0x%0x%08x, Length 0x%0x%08x, ECC initialized \r\n",
 		(u32)(DestAddr >> 32U), (u32)DestAddr,
 		(u32)(LengthBytes >> 32U), (u32)LengthBytes);
 
-	Status = XFSBL_SUCCESS;
 END:
 	return Status;
 }
 
 /*****************************************************************************/
 /**
- * This function does ECC Initialization of DDR memory
+ * This function starts the ECC Initialization of DDR memory. The DDR is
+ * initialized in the background on all the ADMA channels while FSBL carries
+ * on. DDR stays Reserved in the MMU translation table and is marked as Memory
+ * block by block as its initialization completes.
+ * XFsbl_DdrEccInitWaitRange must be called before DDR is accessed and
+ * XFsbl_DdrEccInitWait before handoff.
  *
  * @param none
  *
  * @return
- * 		- XFSBL_SUCCESS for successful ECC Initialization
+ * 		- XFSBL_SUCCESS for successful start of ECC Initialization
  * 		-               or ECC is not enabled for DDR
  * 		- errors as mentioned in xfsbl_error.h
  *
@@ -1721,36 +2089,140 @@ static u32 XFsbl_DdrEccInit(void)
 {
 	u32 Status;
 #if ( XPAR_PSU_DDRC_0_HAS_ECC || XPAR_XDDRCPSU_0_HAS_ECC )
-	u64 LengthBytes =
-			(XFSBL_PS_DDR_END_ADDRESS - XFSBL_PS_DDR_INIT_START_ADDRESS) + 1;
-	u64 DestAddr = XFSBL_PS_DDR_INIT_START_ADDRESS;
-
 	XFsbl_Printf(DEBUG_GENERAL,"Initializing DDR ECC\n\r");
 
-	Status = XFsbl_EccInit(DestAddr, LengthBytes);
-	if (XFSBL_SUCCESS != Status) {
-		Status = XFSBL_ERROR_DDR_ECC_INIT;
-		XFsbl_Printf(DEBUG_GENERAL,"XFSBL_ERROR_DDR_ECC_INIT\n\r");
-		goto END;
-	}
+#ifdef XFSBL_PERF
+	XTime_GetTime(&EccStartTime);
+	EccStallTime = 0U;
+#endif
+
+	XFsbl_EccRangeStart(XFSBL_ECC_RANGE_DDR, XFSBL_PS_DDR_INIT_START_ADDRESS,
+		(XFSBL_PS_DDR_END_ADDRESS - XFSBL_PS_DDR_INIT_START_ADDRESS) + 1U);
 
 	/* If there is upper PS DDR, initialize its ECC */
 #ifdef XFSBL_PS_HI_DDR_START_ADDRESS
-	LengthBytes =
-		(XFSBL_PS_HI_DDR_END_ADDRESS - XFSBL_PS_HI_DDR_START_ADDRESS) + 1;
-	DestAddr = XFSBL_PS_HI_DDR_START_ADDRESS;
+	XFsbl_EccRangeStart(XFSBL_ECC_RANGE_HI_DDR, XFSBL_PS_HI_DDR_START_ADDRESS,
+		(XFSBL_PS_HI_DDR_END_ADDRESS - XFSBL_PS_HI_DDR_START_ADDRESS) + 1U);
+#endif
 
-	Status = XFsbl_EccInit(DestAddr, LengthBytes);
+	DdrEccInitPending = TRUE;
+	Status = XFsbl_DdrEccInitService();
 	if (XFSBL_SUCCESS != Status) {
 		Status = XFSBL_ERROR_DDR_ECC_INIT;
 		XFsbl_Printf(DEBUG_GENERAL,"XFSBL_ERROR_DDR_ECC_INIT\n\r");
+	}
+#else
+	XFsbl_MarkDdrAsReserved(FALSE);
+	Status = XFSBL_SUCCESS;
+#endif
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function waits until the ECC of a DDR address range is initialized
+ * and the range is marked as Memory. Addresses outside DDR do not wait.
+ *
+ * @param	Addr is the start address of the range
+ * @param	Length is the length of the range in bytes
+ *
+ * @return
+ * 		- XFSBL_SUCCESS if the range is initialized
+ * 		- XFSBL_ERROR_DDR_ECC_INIT on ECC initialization failure
+ *
+ *****************************************************************************/
+u32 XFsbl_DdrEccInitWaitRange(u64 Addr, u64 Length)
+{
+	u32 Status = XFSBL_SUCCESS;
+	XFsblPs_EccRange *RangePtr;
+	u64 EndAddr;
+	u8 Range;
+
+	if (DdrEccInitPending == FALSE) {
 		goto END;
 	}
+
+	for (Range = XFSBL_ECC_RANGE_DDR; Range < XFSBL_ECC_NUM_RANGES; Range++) {
+		RangePtr = &EccRanges[Range];
+		if ((Addr >= RangePtr->EndAddr) ||
+				((Addr + Length) <= RangePtr->StartAddr)) {
+			continue;
+		}
+
+		/* Wait for the whole MMU blocks covering the range */
+		EndAddr = Addr + Length;
+#ifdef ARMA53_64
+		if (RangePtr->StartAddr < ADDRESS_LIMIT_4GB) {
+			EndAddr = XFSBL_ROUND_UP(EndAddr, BLOCK_SIZE_A53_64);
+		} else {
+			EndAddr = XFSBL_ROUND_UP(EndAddr, BLOCK_SIZE_A53_64_HIGH);
+		}
+#elif !defined(ARMR5)
+		EndAddr = XFSBL_ROUND_UP(EndAddr, BLOCK_SIZE_A53_32);
 #endif
+		if (EndAddr > RangePtr->EndAddr) {
+			EndAddr = RangePtr->EndAddr;
+		}
+
+		Status = XFsbl_EccRangeWait(Range, EndAddr);
+		if (XFSBL_SUCCESS != Status) {
+			Status = XFSBL_ERROR_DDR_ECC_INIT;
+			XFsbl_Printf(DEBUG_GENERAL,"XFSBL_ERROR_DDR_ECC_INIT\n\r");
+			goto END;
+		}
+		XFsbl_EccMarkDdrRange(Range);
+	}
+
 END:
-#else
-	Status = XFSBL_SUCCESS;
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function waits until the ECC Initialization of DDR memory started by
+ * XFsbl_DdrEccInit is complete and marks all of DDR as Memory. With
+ * XFSBL_PERF it reports the DDR ECC initialization time and the time FSBL
+ * was stalled waiting for it.
+ *
+ * @param none
+ *
+ * @return
+ * 		- XFSBL_SUCCESS if DDR ECC is initialized
+ * 		- XFSBL_ERROR_DDR_ECC_INIT on ECC initialization failure
+ *
+ *****************************************************************************/
+u32 XFsbl_DdrEccInitWait(void)
+{
+	u32 Status = XFSBL_SUCCESS;
+	u8 Range;
+
+	if (DdrEccInitPending == FALSE) {
+		goto END;
+	}
+
+	for (Range = XFSBL_ECC_RANGE_DDR; Range < XFSBL_ECC_NUM_RANGES; Range++) {
+		Status = XFsbl_EccRangeWait(Range, EccRanges[Range].EndAddr);
+		if (XFSBL_SUCCESS != Status) {
+			Status = XFSBL_ERROR_DDR_ECC_INIT;
+			XFsbl_Printf(DEBUG_GENERAL,"XFSBL_ERROR_DDR_ECC_INIT\n\r");
+			goto END;
+		}
+	}
+
+	XFsbl_EccEngineStop();
+	XFsbl_MarkDdrAsReserved(FALSE);
+	DdrEccInitPending = FALSE;
+
+	XFsbl_Printf(DEBUG_INFO, "DDR ECC initialized on %u ADMA channels\r\n",
+			ADMA_NUM_CHANNELS);
+#ifdef XFSBL_PERF
+	XFsbl_MeasurePerfTime(EccStartTime);
+	XFsbl_Printf(DEBUG_PRINT_ALWAYS, " : DDR ECC Init Time\n\r");
+	XFsbl_PrintPerfDuration(EccStallTime);
+	XFsbl_Printf(DEBUG_PRINT_ALWAYS, " : DDR ECC Init Stall Time\n\r");
 #endif
+
+END:
 	return Status;
 }
 
@@ -25,6 +25,7 @@
 *       bsv  04/28/21 Added support to ensure authenticated images boot as
 *                     non-secure when RSA_EN is not programmed
 * 3.1   ng   03/09/24 Fixed format specifier for 32bit variables
+* 3.2   ag   10/18/26 Added XFsbl_PrintPerfDuration
 *
 * </pre>
 *
@@ -567,14 +568,28 @@ static void XFsbl_UpdateMultiBoot(u32 MultiBootValue)
 void XFsbl_MeasurePerfTime(XTime tCur)
 {
 	XTime tEnd = 0;
-	XTime tDiff = 0;
+
+	XTime_GetTime(&tEnd);
+	XFsbl_PrintPerfDuration(tEnd - tCur);
+}
+
+/*****************************************************************************/
+/**
+ * This function prints a duration measured for FSBL performance measurement,
+ * e.g. the sum of several intervals
+ *
+ * @param tDiff is the duration in timer counts
+ *
+ * @return none
+ *
+ * @note none
+ *****************************************************************************/
+void XFsbl_PrintPerfDuration(XTime tDiff)
+{
 	u64 tPerfNs;
 	u64 tPerfMs = 0;
 	u64 tPerfMsFrac = 0;
 
-	XTime_GetTime(&tEnd);
-	tDiff = tEnd - tCur;
-
 	/* Convert tPerf into nanoseconds */
 	tPerfNs = ((double)tDiff / (double)COUNTS_PER_SECOND) * 1e9;
 
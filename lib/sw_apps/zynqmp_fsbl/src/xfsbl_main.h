@@ -28,6 +28,7 @@
 * 6.00  skd  02/10/22 SDK release version updated
 * 6.1   ng   07/13/23 Added SDT support
 * 6.2   dd  10/18/23   Updated SDK release year and SDK release quarter
+* 6.3   ag   10/18/26 Added XFsbl_PrintPerfDuration
 *
 * </pre>
 *
@@ -191,6 +192,7 @@ void XFsbl_ErrorLockDown(u32 ErrorStatus);
 
 #if defined(XFSBL_PERF)
 void XFsbl_MeasurePerfTime(XTime tCur);
+void XFsbl_PrintPerfDuration(XTime tDiff);
 #endif
 
 /**
@@ -200,6 +202,9 @@ u32 XFsbl_Initialize(XFsblPs * FsblInstancePtr);
 u32 XFsbl_BootDeviceInitAndValidate(XFsblPs * FsblInstancePtr);
 u32 XFsbl_TcmEccInit(XFsblPs * FsblInstancePtr, u32 CpuId);
 void XFsbl_MarkDdrAsReserved(u8 Cond);
+u32 XFsbl_DdrEccInitService(void);
+u32 XFsbl_DdrEccInitWaitRange(u64 Addr, u64 Length);
+u32 XFsbl_DdrEccInitWait(void);
 
 /**
  * Functions defined in xfsbl_partition_load.c
@@ -52,6 +52,12 @@
 *                     non-secure when RSA_EN is not programmed and boot header
 *                     is not authenticated is disabled by default
 * 6.1   ng   07/13/23 Added SDT support
+* 6.2   ag   10/18/26 Wait for DDR ECC initialization of the load address
+*                     range before partition copy
+*       ag   10/18/26 Calculate the partition hash while the partition is
+*                     copied, instead of reading it again for validation
+*       ag   10/18/26 Hash partitions during copy only if
+*                     FSBL_SHA_STREAM_COPY_EXCLUDE_VAL is set to 0
 *
 * </pre>
 *
@@ -92,6 +98,14 @@
 #define XFSBL_EL2_VAL		(4U)
 #define XFSBL_EL3_VAL		(6U)
 #endif
+#define XFSBL_STREAM_HASH_NONE		(0U)
+#define XFSBL_STREAM_HASH_CHECKSUM	(1U)
+#define XFSBL_STREAM_HASH_AUTH		(2U)
+#ifdef XFSBL_SHA_STREAM_COPY
+/* Chunk size of streamed copy, multiple of SHA3 block length */
+#define XFSBL_STREAM_CHUNK_SIZE	((READ_BUFFER_SIZE / XSECURE_SHA3_BLOCK_LEN) \
+					* XSECURE_SHA3_BLOCK_LEN)
+#endif
 
 /************************** Function Prototypes ******************************/
 static u32 XFsbl_PartitionHeaderValidation(XFsblPs * FsblInstancePtr,
@@ -112,9 +126,18 @@ static u32 XFsbl_ValidateCheckSum(XFsblPs * FsblInstancePtr,
 	PTRSIZE LoadAddress, u32 PartitionNum, u8 * PartitionHash);
 static void XFsbl_CalculateSHA(const XFsblPs * FsblInstancePtr,
 	PTRSIZE LoadAddress, u32 PartitionNum, u8* PartitionHash);
+static u32 XFsbl_IsAuthenticationEnabled(const XFsblPs * FsblInstancePtr,
+	const XFsblPs_PartitionHeader * PartitionHeader);
+static const u8 * XFsbl_GetStreamedHash(u32 PartitionNum, u32 HashType);
 #ifdef XFSBL_BS
 static void XFsbl_SetBSSecureState(u32 State);
 #endif
+#ifdef XFSBL_SHA_STREAM_COPY
+static u32 XFsbl_GetStreamHashType(const XFsblPs * FsblInstancePtr,
+	XFsblPs_PartitionHeader * PartitionHeader);
+static u32 XFsbl_StreamCopy(const XFsblPs * FsblInstancePtr, u32 SrcAddress,
+	PTRSIZE LoadAddress, u32 Length, u32 HashType);
+#endif
 
 #ifdef XFSBL_ENABLE_DDR_SR
 static void XFsbl_PollForDDRReady(void);
@@ -152,6 +175,13 @@ u8 HashsOfChunks[HASH_BUFFER_SIZE] __attribute__((section (".bitstream_buffer"))
 #if defined(XFSBL_BS)
 extern u8 ReadBuffer[READ_BUFFER_SIZE];
 #endif
+
+#ifdef XFSBL_SHA_STREAM_COPY
+/* Hash of the last partition, calculated while it was copied */
+static u32 StreamHashType = XFSBL_STREAM_HASH_NONE;
+static u32 StreamHashPartition;
+static u8 StreamHash[XFSBL_HASH_TYPE_SHA3] __attribute__ ((aligned (4U)));
+#endif
 /*****************************************************************************/
 /**
  * This function loads the partition
@@ -182,6 +212,15 @@ u32 XFsbl_PartitionLoad(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 	XFsbl_PollForDDRReady();
 #endif
 
+	/**
+	 * Keep the DDR ECC initialization running in the background
+	 */
+	Status = XFsbl_DdrEccInitService();
+	if (XFSBL_SUCCESS != Status) {
+		Status = XFSBL_ERROR_DDR_ECC_INIT;
+		goto END;
+	}
+
 	/**
 	 * Load and validate the partition
 	 */
@@ -874,6 +913,10 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 
 	RunningCpu = FsblInstancePtr->ProcessorID;
 
+#ifdef XFSBL_SHA_STREAM_COPY
+	StreamHashType = XFSBL_STREAM_HASH_NONE;
+#endif
+
 	/**
 	 * Check for XIP image
 	 * No need to copy for XIP image
@@ -1103,6 +1146,16 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 		} while (1);
 	}
 
+	/**
+	 * Wait until the ECC of the destination is initialized, in case it
+	 * is in DDR
+	 */
+	Status = XFsbl_DdrEccInitWaitRange((u64)LoadAddress, (u64)Length);
+	if (XFSBL_SUCCESS != Status)
+	{
+		goto END;
+	}
+
 #ifdef XFSBL_PERF
 	XTime tCur = 0;
 	XTime_GetTime(&tCur);
@@ -1110,8 +1163,29 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 	/**
 	 * Copy the partition to PS_DDR/PL_DDR/TCM
 	 */
-	Status = FsblInstancePtr->DeviceOps.DeviceCopy(SrcAddress,
+#ifdef XFSBL_SHA_STREAM_COPY
+	StreamHashType = XFsbl_GetStreamHashType(FsblInstancePtr,
+				PartitionHeader);
+	if (StreamHashType != XFSBL_STREAM_HASH_NONE)
+	{
+		/**
+		 * Calculate the partition hash while it is copied, so that
+		 * validation need not read the partition again
+		 */
+		Status = XFsbl_StreamCopy(FsblInstancePtr, SrcAddress,
+					LoadAddress, Length, StreamHashType);
+		if (XFSBL_SUCCESS != Status)
+		{
+			StreamHashType = XFSBL_STREAM_HASH_NONE;
+		}
+		StreamHashPartition = PartitionNum;
+	}
+	else
+#endif
+	{
+		Status = FsblInstancePtr->DeviceOps.DeviceCopy(SrcAddress,
 					LoadAddress, Length);
+	}
 
 #ifdef XFSBL_PERF
 	XFsbl_MeasurePerfTime(tCur);
@@ -1210,19 +1284,8 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 	/**
 	 * check the authentication status
 	 */
-#ifdef FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE
-	if (XFsbl_IsRsaSignaturePresent(PartitionHeader) ==
-			XIH_PH_ATTRB_RSA_SIGNATURE) {
-#else
-	if ((FsblInstancePtr->AuthEnabled == TRUE) &&
-		(XFsbl_IsRsaSignaturePresent(PartitionHeader) ==
-			XIH_PH_ATTRB_RSA_SIGNATURE)) {
-#endif
-		IsAuthenticationEnabled = TRUE;
-	}
-	else {
-		IsAuthenticationEnabled = FALSE;
-	}
+	IsAuthenticationEnabled = XFsbl_IsAuthenticationEnabled(FsblInstancePtr,
+					PartitionHeader);
 
 	/* check the checksum status */
 	if (XFsbl_GetChecksumType(PartitionHeader) !=
@@ -1362,7 +1425,9 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 			 */
 			Status = XFsbl_Authentication(FsblInstancePtr, LoadAddress,
 					Length, (PTRSIZE)AuthBuffer,
-					PartitionNum);
+					PartitionNum,
+					XFsbl_GetStreamedHash(PartitionNum,
+						XFSBL_STREAM_HASH_AUTH));
 			if (Status != XFSBL_SUCCESS) {
 				goto END;
 			}
@@ -1947,16 +2012,201 @@ static void XFsbl_CalculateSHA(const XFsblPs * FsblInstancePtr,
 {
 	u32 Length;
 	const XFsblPs_PartitionHeader * PartitionHeader;
+	const u8 *StreamedHash;
 
 	PartitionHeader =
 	    &FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum];
 	Length = PartitionHeader->TotalDataWordLength * 4U;
 
-	/* Calculate SHA hash */
-	XFsbl_ShaDigest((u8*)LoadAddress, Length, PartitionHash,
-		XFSBL_HASH_TYPE_SHA3);
+	StreamedHash = XFsbl_GetStreamedHash(PartitionNum,
+				XFSBL_STREAM_HASH_CHECKSUM);
+	if (StreamedHash != NULL) {
+		/* Hash is already calculated while the partition was copied */
+		(void)XFsbl_MemCpy(PartitionHash, StreamedHash,
+			XFSBL_HASH_TYPE_SHA3);
+	}
+	else {
+		/* Calculate SHA hash */
+		XFsbl_ShaDigest((u8*)LoadAddress, Length, PartitionHash,
+			XFSBL_HASH_TYPE_SHA3);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function checks whether the partition is to be authenticated.
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ * @param	PartitionHeader is pointer to the partition header
+ *
+ * @return	TRUE if partition is to be authenticated, FALSE otherwise
+ *
+ *****************************************************************************/
+static u32 XFsbl_IsAuthenticationEnabled(const XFsblPs * FsblInstancePtr,
+	const XFsblPs_PartitionHeader * PartitionHeader)
+{
+	u32 IsAuthenticationEnabled = FALSE;
+
+#ifdef FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE
+	(void)FsblInstancePtr;
+	if (XFsbl_IsRsaSignaturePresent(PartitionHeader) ==
+			XIH_PH_ATTRB_RSA_SIGNATURE) {
+#else
+	if ((FsblInstancePtr->AuthEnabled == TRUE) &&
+		(XFsbl_IsRsaSignaturePresent(PartitionHeader) ==
+			XIH_PH_ATTRB_RSA_SIGNATURE)) {
+#endif
+		IsAuthenticationEnabled = TRUE;
+	}
+
+	return IsAuthenticationEnabled;
+}
+
+/*****************************************************************************/
+/**
+ * This function returns the partition hash calculated while the partition
+ * was copied.
+ *
+ * @param	PartitionNum is the partition number
+ * @param	HashType is XFSBL_STREAM_HASH_CHECKSUM for checksum and
+ *		XFSBL_STREAM_HASH_AUTH for authentication
+ *
+ * @return	Pointer to the hash if available, NULL otherwise
+ *
+ *****************************************************************************/
+static const u8 * XFsbl_GetStreamedHash(u32 PartitionNum, u32 HashType)
+{
+	const u8 *Hash = NULL;
+
+#ifdef XFSBL_SHA_STREAM_COPY
+	if ((StreamHashType == HashType) &&
+		(StreamHashPartition == PartitionNum)) {
+		Hash = StreamHash;
+	}
+#else
+	(void)PartitionNum;
+	(void)HashType;
+#endif
+
+	return Hash;
+}
+
+#ifdef XFSBL_SHA_STREAM_COPY
+/*****************************************************************************/
+/**
+ * This function finds which partition hash can be calculated while the
+ * partition is copied. Bitstream partitions are hashed chunk by chunk during
+ * configuration and are not streamed here. Checksum is streamed only if the
+ * authentication certificate is not part of the hashed data.
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ * @param	PartitionHeader is pointer to the partition header
+ *
+ * @return	XFSBL_STREAM_HASH_AUTH, XFSBL_STREAM_HASH_CHECKSUM or
+ *		XFSBL_STREAM_HASH_NONE
+ *
+ *****************************************************************************/
+static u32 XFsbl_GetStreamHashType(const XFsblPs * FsblInstancePtr,
+	XFsblPs_PartitionHeader * PartitionHeader)
+{
+	u32 HashType = XFSBL_STREAM_HASH_NONE;
+
+	if (XFsbl_GetDestinationDevice(PartitionHeader) ==
+			XIH_PH_ATTRB_DEST_DEVICE_PL) {
+		goto END;
+	}
+
+#ifdef XFSBL_SECURE
+	if (XFsbl_IsAuthenticationEnabled(FsblInstancePtr, PartitionHeader)
+			== TRUE) {
+		HashType = XFSBL_STREAM_HASH_AUTH;
+		goto END;
+	}
+#else
+	(void)FsblInstancePtr;
+#endif
+
+	if ((XFsbl_GetChecksumType(PartitionHeader) ==
+			XIH_PH_ATTRB_HASH_SHA3) &&
+		(XFsbl_IsRsaSignaturePresent(PartitionHeader) !=
+			XIH_PH_ATTRB_RSA_SIGNATURE)) {
+		HashType = XFSBL_STREAM_HASH_CHECKSUM;
+	}
+
+END:
+	return HashType;
 }
 
+/*****************************************************************************/
+/**
+ * This function copies the partition chunk by chunk through OCM and
+ * calculates its SHA3 hash on the way. Each chunk is read from the boot
+ * device to OCM and CSU DMA moves it to the load address through the
+ * secure stream switch, which feeds the same data to SHA3 engine.
+ * For authentication the hash also covers the authentication certificate
+ * except the partition signature.
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ * @param	SrcAddress is the partition offset in the boot device
+ * @param	LoadAddress is the load address of the partition
+ * @param	Length is the length of the partition to be copied
+ * @param	HashType is XFSBL_STREAM_HASH_CHECKSUM or XFSBL_STREAM_HASH_AUTH
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ *		returns the error codes described in xfsbl_error.h on failure
+ *
+ *****************************************************************************/
+static u32 XFsbl_StreamCopy(const XFsblPs * FsblInstancePtr, u32 SrcAddress,
+	PTRSIZE LoadAddress, u32 Length, u32 HashType)
+{
+	u32 Status = XFSBL_FAILURE;
+	u32 ChunkSize;
+	u32 Offset = 0U;
+
+	XFsbl_ShaStart(NULL, XFSBL_HASH_TYPE_SHA3);
+
+	while (Offset < Length) {
+		ChunkSize = Length - Offset;
+		if (ChunkSize > XFSBL_STREAM_CHUNK_SIZE) {
+			ChunkSize = XFSBL_STREAM_CHUNK_SIZE;
+		}
+
+		Status = FsblInstancePtr->DeviceOps.DeviceCopy(
+				SrcAddress + Offset, (PTRSIZE)ReadBuffer, ChunkSize);
+		if (XFSBL_SUCCESS != Status) {
+			goto END;
+		}
+
+		Status = XFsbl_ShaUpdateCopy(NULL, ReadBuffer,
+				LoadAddress + Offset, ChunkSize,
+				XFSBL_HASH_TYPE_SHA3);
+		if (XFSBL_SUCCESS != Status) {
+			XFsbl_Printf(DEBUG_GENERAL,
+				"XFsbl_StreamCopy: CSU DMA copy failed\r\n");
+			goto END;
+		}
+
+		Offset += ChunkSize;
+	}
+
+#ifdef XFSBL_SECURE
+	if (HashType == XFSBL_STREAM_HASH_AUTH) {
+		/* Calculate hash for (AC - signature size) */
+		XFsbl_ShaUpdate(NULL, AuthBuffer,
+			(XFSBL_AUTH_CERT_MIN_SIZE - XFSBL_FSBL_SIG_SIZE),
+			XFSBL_HASH_TYPE_SHA3);
+	}
+#else
+	(void)HashType;
+#endif
+
+	XFsbl_ShaFinish(NULL, StreamHash, XFSBL_HASH_TYPE_SHA3);
+
+END:
+	return Status;
+}
+#endif
+
 #ifdef XFSBL_ENABLE_DDR_SR
 /*****************************************************************************/
 /**
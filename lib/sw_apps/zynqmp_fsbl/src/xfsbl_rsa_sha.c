@@ -23,6 +23,10 @@
  * 4.0   har  06/17/20  Removed references to unused algorithms
  * 5.0   bsv  03/11/21  Fixed build issues
  *       kpt  03/16/21  Updated function headers with appropriate description
+ * 6.0   ag   10/18/26  Added XFsbl_ShaUpdateCopy() to copy and hash the data
+ *                      in a single CSU DMA pass
+ *       ag   10/18/26  XFsbl_ShaUpdateCopy() is built only with
+ *                      XFSBL_SHA_STREAM_COPY
  *
  * </pre>
  *
@@ -32,6 +36,8 @@
 
 /***************************** Include Files *********************************/
 #include "xfsbl_authentication.h"
+#include "xfsbl_csu_dma.h"
+#include "xil_cache.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -131,6 +137,57 @@ void XFsbl_ShaUpdate(void * Ctx, u8 * Data, u32 Size, u32 HashLen)
 	}
 }
 
+#ifdef XFSBL_SHA_STREAM_COPY
+/*****************************************************************************
+ * This function copies the input data to the destination address and updates
+ * the SHA3 engine with the same data. XSecure_Sha3UpdateCopy streams the data
+ * through the secure stream switch to both SHA3 engine and CSU DMA
+ * destination channel, so the data is hashed while it is DMA'd into place
+ * and is read only once. If the data cannot be streamed it is hashed and
+ * copied separately.
+ *
+ * @param       Ctx        Pointer to a callback function
+ * @param       Data       Pointer to the word aligned input data
+ * @param       DstAddress Address to which the data is copied
+ * @param       Size       Size of the input data, multiple of word length
+ * @param       HashLen    Length of the hash that is used to determine sha3
+ *                         hashing
+ *
+ * @return      XFSBL_SUCCESS on success
+ *              XFSBL_FAILURE if SHA3 update or CSU DMA transfer failed
+ *
+ ******************************************************************************/
+u32 XFsbl_ShaUpdateCopy(void * Ctx, u8 * Data, PTRSIZE DstAddress, u32 Size,
+		u32 HashLen)
+{
+	u32 Status = XFSBL_FAILURE;
+
+	if (XFSBL_HASH_TYPE_SHA3 != HashLen) {
+		(void)XFsbl_MemCpy((void *)DstAddress, Data, Size);
+		Status = XFSBL_SUCCESS;
+		goto END;
+	}
+
+	/* The destination is written either by CSU DMA or by the processor,
+	 * so it is flushed rather than invalidated on both sides */
+	Xil_DCacheFlushRange((INTPTR)Data, Size);
+	Xil_DCacheFlushRange((INTPTR)DstAddress, Size);
+
+	Status = XSecure_Sha3UpdateCopy(&SecureSha3, Data, (u64)DstAddress,
+			Size);
+	if (Status != (u32)XST_SUCCESS) {
+		Status = XFSBL_FAILURE;
+		goto END;
+	}
+
+	Xil_DCacheFlushRange((INTPTR)DstAddress, Size);
+	Status = XFSBL_SUCCESS;
+
+END:
+	return Status;
+}
+#endif
+
 #ifdef XFSBL_SECURE
 /*****************************************************************************
  *
@@ -24,6 +24,7 @@
 *                         destination data
 * 4.0   bvikram  06/09/21 Added support for delayed enumeration of DFU devices
 * 6.1   ng       07/13/23 Added SDT support
+* 6.2   ag       10/18/26 Wait for DDR ECC initialization of the DFU buffer
 *
 * </pre>
 *
@@ -34,6 +35,7 @@
 #ifdef XFSBL_USB
 #include "xusbpsu.h"
 #include "xfsbl_dfu_util.h"
+#include "xfsbl_main.h"
 #include "xfsbl_misc.h"
 #include "xfsbl_usb.h"
 #include "sleep.h"
@@ -89,6 +91,14 @@ u32 XFsbl_UsbInit(u32 DeviceFlags)
 		goto END;
 	}
 
+	/* The DFU buffer is written by the USB controller as data arrives */
+	Status = XFsbl_DdrEccInitWaitRange(XFSBL_DDR_TEMP_BUFFER_ADDRESS,
+			((u64)XFSBL_PS_DDR_END_ADDRESS -
+			 XFSBL_DDR_TEMP_BUFFER_ADDRESS) + 1U);
+	if (XFSBL_SUCCESS != Status) {
+		goto END;
+	}
+
 	(void)memset(&UsbInstance, 0, sizeof(UsbInstance));
 	(void)memset(&UsbPrivateData, 0, sizeof(struct XUsbPsu));
 	(void)memset(&DfuObj, 0, sizeof(DfuObj));
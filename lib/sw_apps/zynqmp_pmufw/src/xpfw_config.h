@@ -124,6 +124,8 @@ extern "C" {
  *              OCM memory for other uses.
  *  - ENABLE_RPU_RUN_MODE: Enables RPU monitoring module
  *  - ENABLE_DDR_XMPU: Enable DDR XMPU settings
+ *  - ENABLE_DISPATCH_STATS: Enables per-module event/IPI dispatch counters
+ *              and handler latency reported by XPfw_CorePrintStats
  *
  * 	These macros are specific to ZCU100 design where it uses GPO1[2] as a
  * 	board power line and
@@ -309,6 +311,10 @@ extern "C" {
 #define ENABLE_SMMU_VAL					(0U)
 #endif
 
+#ifndef ENABLE_DISPATCH_STATS_VAL
+#define ENABLE_DISPATCH_STATS_VAL			(0U)
+#endif
+
 /*
  * XPFW_CFG_PMU_DEFAULT_WDT_TIMEOUT
  * 		Default watchdog timeout
@@ -617,6 +623,10 @@ extern "C" {
 #define ENABLE_SMMU
 #endif
 
+#if (ENABLE_DISPATCH_STATS_VAL) && (!defined(ENABLE_DISPATCH_STATS))
+#define ENABLE_DISPATCH_STATS
+#endif
+
 #ifdef __cplusplus
 }
 #endif
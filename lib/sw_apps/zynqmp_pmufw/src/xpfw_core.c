@@ -27,6 +27,128 @@ static XPfw_Core_t XPfwCore = { .IsReady = CORE_IS_DEAD };
 /* Declare the Core Pointer as constant, since we don't intend to change it */
 static XPfw_Core_t * const CorePtr = &XPfwCore;
 
+/**
+ * Rebuild the per-event list of owner modules from the event table.
+ * If the registrations do not fit into EvList, dispatch falls back to
+ * scanning the module masks.
+ */
+static void XPfw_CoreBuildEventList(void)
+{
+	u32 EventId;
+	u32 Idx;
+	u32 Mask;
+	u32 Pos = 0U;
+
+	CorePtr->EvListValid = (u8)FALSE;
+
+	for (EventId = 0U; EventId < XPFW_EV_MAX; EventId++) {
+		CorePtr->EvListStart[EventId] = (u8)Pos;
+		Mask = XPfw_EventGetModMask(EventId);
+		for (Idx = 0U; Idx < CorePtr->ModCount; Idx++) {
+			if ((Mask & ((u32)1U << Idx)) != 0U) {
+				if (Pos >= XPFW_CORE_EV_LIST_SIZE) {
+					goto Done;
+				}
+				CorePtr->EvList[Pos] = (u8)Idx;
+				Pos++;
+			}
+		}
+	}
+	CorePtr->EvListStart[XPFW_EV_MAX] = (u8)Pos;
+	CorePtr->EvListValid = (u8)TRUE;
+
+Done:
+	return;
+}
+
+/**
+ * Rebuild the IPI ID to module lookup. Modules sharing an IPI ID are
+ * chained through IpiNext in module order.
+ */
+static void XPfw_CoreBuildIpiTable(void)
+{
+	u32 Idx;
+	u32 IpiId;
+
+	for (IpiId = 0U; IpiId < XPFW_CORE_IPI_ID_COUNT; IpiId++) {
+		CorePtr->IpiHead[IpiId] = XPFW_CORE_NO_MOD;
+	}
+	CorePtr->IpiScanHigh = (u8)FALSE;
+
+	/* Walk backwards so that each chain ends up in module order */
+	for (Idx = CorePtr->ModCount; Idx > 0U; Idx--) {
+		if (CorePtr->ModList[Idx - 1U].IpiHandler != NULL) {
+			IpiId = CorePtr->ModList[Idx - 1U].IpiId;
+			if (IpiId < XPFW_CORE_IPI_ID_COUNT) {
+				CorePtr->IpiNext[Idx - 1U] = CorePtr->IpiHead[IpiId];
+				CorePtr->IpiHead[IpiId] = (u8)(Idx - 1U);
+			} else {
+				CorePtr->IpiScanHigh = (u8)TRUE;
+			}
+		}
+	}
+}
+
+#ifdef ENABLE_DISPATCH_STATS
+static u32 XPfw_CoreStatsStart(void)
+{
+	return XPfw_Read32(PMU_IOMODULE_PIT1_COUNTER);
+}
+
+/**
+ * Record a handler execution in the module statistics. PIT1 counts down
+ * and reloads every scheduler tick, so handlers running for longer than
+ * one tick are under-reported.
+ */
+static void XPfw_CoreStatsUpdate(u32 Idx, u32 Start, u32 *Counter)
+{
+	u32 Now = XPfw_Read32(PMU_IOMODULE_PIT1_COUNTER);
+	u32 Period = CorePtr->Scheduler.CountPerTick;
+	u32 Ticks;
+
+	(*Counter)++;
+
+	if (0U != Period) {
+		if (Start >= Now) {
+			Ticks = Start - Now;
+		} else {
+			Ticks = (Start + Period) - Now;
+		}
+		if (Ticks > CorePtr->Stats[Idx].MaxTicks) {
+			CorePtr->Stats[Idx].MaxTicks = Ticks;
+		}
+	}
+}
+#endif
+
+static void XPfw_CoreCallEventHandler(u32 Idx, u32 EventId)
+{
+#ifdef ENABLE_DISPATCH_STATS
+	u32 Start = XPfw_CoreStatsStart();
+#endif
+
+	CorePtr->ModList[Idx].EventHandler(&CorePtr->ModList[Idx], EventId);
+
+#ifdef ENABLE_DISPATCH_STATS
+	XPfw_CoreStatsUpdate(Idx, Start, &CorePtr->Stats[Idx].EventCount);
+#endif
+}
+
+static void XPfw_CoreCallIpiHandler(u32 Idx, u32 IpiNum, u32 SrcMask,
+		const u32 *Payload)
+{
+#ifdef ENABLE_DISPATCH_STATS
+	u32 Start = XPfw_CoreStatsStart();
+#endif
+
+	CorePtr->ModList[Idx].IpiHandler(&CorePtr->ModList[Idx], IpiNum,
+			SrcMask, Payload, XPFW_IPI_MAX_MSG_LEN);
+
+#ifdef ENABLE_DISPATCH_STATS
+	XPfw_CoreStatsUpdate(Idx, Start, &CorePtr->Stats[Idx].IpiCount);
+#endif
+}
+
 XStatus XPfw_CoreInit(u32 Options)
 {
 	u32 Index;
@@ -57,6 +179,9 @@ XStatus XPfw_CoreInit(u32 Options)
 		}
 	}
 
+	XPfw_CoreBuildEventList();
+	XPfw_CoreBuildIpiTable();
+
 	Status = XPfw_SchedulerInit(&CorePtr->Scheduler,
 		PMU_IOMODULE_PIT1_PRELOAD);
 
@@ -193,18 +318,30 @@ XStatus XPfw_CoreDispatchEvent(u32 EventId)
 {
 	XStatus Status;
 	u32 Idx;
+	u32 Pos;
 	u32 CallCount = 0U;
 	if ((CorePtr != NULL) && (EventId < XPFW_EV_MAX)) {
 
-		for (Idx = 0U; Idx < CorePtr->ModCount; Idx++) {
-			/**
-			 * Check if Mod[Idx] and event handler are registered for this event
-			 */
-			if (((XPfw_EventGetModMask(EventId) & ((u32) 1U << Idx))
-					== ((u32) 1U << Idx)) && (CorePtr->ModList[Idx].EventHandler != NULL)) {
-				CorePtr->ModList[Idx].EventHandler(&CorePtr->ModList[Idx],
-						EventId);
-				CallCount++;
+		if ((u8)TRUE == CorePtr->EvListValid) {
+			/* Only visit the modules registered for this event */
+			for (Pos = CorePtr->EvListStart[EventId];
+					Pos < CorePtr->EvListStart[EventId + 1U]; Pos++) {
+				Idx = CorePtr->EvList[Pos];
+				if (CorePtr->ModList[Idx].EventHandler != NULL) {
+					XPfw_CoreCallEventHandler(Idx, EventId);
+					CallCount++;
+				}
+			}
+		} else {
+			for (Idx = 0U; Idx < CorePtr->ModCount; Idx++) {
+				/**
+				 * Check if Mod[Idx] and event handler are registered for this event
+				 */
+				if (((XPfw_EventGetModMask(EventId) & ((u32) 1U << Idx))
+						== ((u32) 1U << Idx)) && (CorePtr->ModList[Idx].EventHandler != NULL)) {
+					XPfw_CoreCallEventHandler(Idx, EventId);
+					CallCount++;
+				}
 			}
 		}
 	}
@@ -223,6 +360,8 @@ XStatus XPfw_CoreDispatchIpi(u32 IpiNum, u32 SrcMask)
 	XStatus Status;
 	u32 Idx;
 	u32 MaskIndex;
+	u32 IpiId;
+	u32 SrcIpiMask;
 	u32 CallCount = 0U;
 	u32 Payload[XPFW_IPI_MAX_MSG_LEN] = {0U};
 
@@ -234,28 +373,37 @@ XStatus XPfw_CoreDispatchIpi(u32 IpiNum, u32 SrcMask)
 	/* For each of the IPI sources */
 	for (MaskIndex = 0U; MaskIndex < XPFW_IPI_MASK_COUNT; MaskIndex++) {
 		/* Check if the Mask is set */
-		if ((SrcMask &
-				Ipi0InstPtr->Config.TargetList[MaskIndex].Mask) != 0U) {
+		SrcIpiMask = Ipi0InstPtr->Config.TargetList[MaskIndex].Mask;
+		if ((SrcMask & SrcIpiMask) != 0U) {
 			/* If set, read the message into buffer */
-			Status = XPfw_IpiReadMessage(
-						Ipi0InstPtr->Config.TargetList[MaskIndex].Mask,
+			Status = XPfw_IpiReadMessage(SrcIpiMask,
 						&Payload[0], XPFW_IPI_MAX_MSG_LEN);
 			if (XST_SUCCESS != Status) {
 				XPfw_Printf(DEBUG_ERROR, "IPI payload read error\r\n");
 				goto Done;
 			}
 			/* Dispatch based on IPI ID (MSB 16 bits of Word-0) of the module */
-			for (Idx = 0U; Idx < CorePtr->ModCount; Idx++) {
-				/* If API ID matches and IpiHandler is set */
-				if ( (CorePtr->ModList[Idx].IpiId == (Payload[0] >> 16U)) &&
-					(CorePtr->ModList[Idx].IpiHandler != NULL)) {
-					/* Call the module's IPI handler */
-					CorePtr->ModList[Idx].IpiHandler(&CorePtr->ModList[Idx],
-							IpiNum,
-							Ipi0InstPtr->Config.TargetList[MaskIndex].Mask,
-							&Payload[0], XPFW_IPI_MAX_MSG_LEN);
+			IpiId = Payload[0] >> 16U;
+			if (IpiId < XPFW_CORE_IPI_ID_COUNT) {
+				Idx = CorePtr->IpiHead[IpiId];
+				while (Idx != XPFW_CORE_NO_MOD) {
+					XPfw_CoreCallIpiHandler(Idx, IpiNum, SrcIpiMask,
+							&Payload[0]);
 					CallCount++;
+					Idx = CorePtr->IpiNext[Idx];
 				}
+			} else if ((u8)TRUE == CorePtr->IpiScanHigh) {
+				for (Idx = 0U; Idx < CorePtr->ModCount; Idx++) {
+					/* If API ID matches and IpiHandler is set */
+					if ((CorePtr->ModList[Idx].IpiId == IpiId) &&
+						(CorePtr->ModList[Idx].IpiHandler != NULL)) {
+						XPfw_CoreCallIpiHandler(Idx, IpiNum, SrcIpiMask,
+								&Payload[0]);
+						CallCount++;
+					}
+				}
+			} else {
+				/* No module handles this IPI ID */
 			}
 		}
 	}
@@ -384,6 +532,10 @@ XStatus XPfw_CoreLoop(void)
 
 void XPfw_CorePrintStats(void)
 {
+#ifdef ENABLE_DISPATCH_STATS
+	u32 Idx;
+#endif
+
 	if(CorePtr != NULL) {
 	XPfw_Printf(DEBUG_DETAILED,
 			"######################################################\r\n");
@@ -393,6 +545,17 @@ void XPfw_CorePrintStats(void)
 			((CorePtr->Scheduler.Enabled == TRUE)?"ENABLED":"DISABLED"));
 	XPfw_Printf(DEBUG_DETAILED,"Scheduler Ticks: %lu\r\n",
 			CorePtr->Scheduler.Tick);
+	XPfw_Printf(DEBUG_DETAILED,"Event List: %s\r\n",
+			(((u8)TRUE == CorePtr->EvListValid)?"DIRECT":"SCAN"));
+#ifdef ENABLE_DISPATCH_STATS
+	for (Idx = 0U; Idx < CorePtr->ModCount; Idx++) {
+		XPfw_Printf(DEBUG_DETAILED,"Mod %lu: Events %lu IPIs %lu "
+				"Max Ticks %lu\r\n", Idx,
+				CorePtr->Stats[Idx].EventCount,
+				CorePtr->Stats[Idx].IpiCount,
+				CorePtr->Stats[Idx].MaxTicks);
+	}
+#endif
 	XPfw_Printf(DEBUG_DETAILED,
 			"######################################################\r\n");
 	}
@@ -407,6 +570,7 @@ XStatus XPfw_CoreRegisterEvent(const XPfw_Module_t *ModPtr, u32 EventId)
 		Status = XST_FAILURE;
 	} else {
 		Status = XPfw_EventAddOwner(ModPtr->ModId, EventId);
+		XPfw_CoreBuildEventList();
 	}
 	return Status;
 }
@@ -419,6 +583,7 @@ XStatus XPfw_CoreDeRegisterEvent(const XPfw_Module_t *ModPtr, u32 EventId)
 		Status = XST_FAILURE;
 	} else {
 		Status = XPfw_EventRemoveOwner(ModPtr->ModId, EventId);
+		XPfw_CoreBuildEventList();
 	}
 	return Status;
 }
@@ -478,6 +643,7 @@ XStatus XPfw_CoreSetIpiHandler(const XPfw_Module_t *ModPtr, XPfwModIpiHandler_t
 		if (ModPtr->ModId < CorePtr->ModCount) {
 			CorePtr->ModList[ModPtr->ModId].IpiHandler = IpiHandlerFn;
 			CorePtr->ModList[ModPtr->ModId].IpiId = IpiId;
+			XPfw_CoreBuildIpiTable();
 			Status = XST_SUCCESS;
 		} else {
 			Status = XST_FAILURE;
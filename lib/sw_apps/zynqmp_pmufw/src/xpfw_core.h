@@ -13,10 +13,27 @@ extern "C" {
 
 #include "xpfw_module.h"
 #include "xpfw_scheduler.h"
+#include "xpfw_events.h"
 
 #define XPFW_MAX_MOD_COUNT 32U
 
+/* Number of (event, module) registrations held in the event dispatch list */
+#define XPFW_CORE_EV_LIST_SIZE	64U
+/* IPI IDs below this value are dispatched through a direct lookup */
+#define XPFW_CORE_IPI_ID_COUNT	16U
+#define XPFW_CORE_NO_MOD	0xFFU
 
+/**
+ * Per-module dispatch statistics
+ *
+ * MaxTicks is measured in PMU PIT1 counts and is only updated while the
+ * scheduler is running.
+ */
+typedef struct {
+	u32 EventCount;	/**< Number of events dispatched to the module */
+	u32 IpiCount;	/**< Number of IPIs dispatched to the module */
+	u32 MaxTicks;	/**< Longest handler execution time */
+} XPfw_CoreModStats_t;
 
 typedef struct {
 	XPfw_Module_t ModList[XPFW_MAX_MOD_COUNT];
@@ -24,6 +41,15 @@ typedef struct {
 	u16 IsReady;
 	u8 ModCount;
 	u8 Mode;	/**< Mode - Safety Diagnostics Mode / Normal Mode */
+	u8 EvListStart[XPFW_EV_MAX + 1U]; /**< Offset of each event in EvList */
+	u8 EvList[XPFW_CORE_EV_LIST_SIZE]; /**< Owner modules grouped by event */
+	u8 IpiHead[XPFW_CORE_IPI_ID_COUNT]; /**< First module for an IPI ID */
+	u8 IpiNext[XPFW_MAX_MOD_COUNT]; /**< Next module with the same IPI ID */
+	u8 EvListValid;	/**< EvList holds all registrations */
+	u8 IpiScanHigh;	/**< A module uses an IPI ID outside of IpiHead */
+#ifdef ENABLE_DISPATCH_STATS
+	XPfw_CoreModStats_t Stats[XPFW_MAX_MOD_COUNT];
+#endif
 } XPfw_Core_t;
 
 XStatus XPfw_CoreInit(u32 Options);
@@ -77,6 +77,7 @@ XStatus XPfw_SchedulerInit(XPfw_Scheduler_t *SchedPtr, u32 PitBaseAddr)
 	SchedPtr->Enabled = (u32)FALSE;
 	SchedPtr->PitBaseAddr = PitBaseAddr;
 	SchedPtr->Tick = 0U;
+	SchedPtr->CountPerTick = 0U;
 	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET, 0U);
 
 	/* Successfully completed init */
@@ -102,12 +103,12 @@ XStatus XPfw_SchedulerStart(XPfw_Scheduler_t *SchedPtr)
 	SchedPtr->Enabled = (u32)TRUE;
 
 #ifndef SDT
-	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_PRELOAD_OFFSET,
-			COUNT_PER_TICK);
+	SchedPtr->CountPerTick = COUNT_PER_TICK;
 #else
-	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_PRELOAD_OFFSET,
-			CountPerTick);
+	SchedPtr->CountPerTick = CountPerTick;
 #endif
+	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_PRELOAD_OFFSET,
+			SchedPtr->CountPerTick);
 	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET, 3U);
 	Status = XST_SUCCESS;
 
@@ -118,6 +119,7 @@ done:
 XStatus XPfw_SchedulerStop(XPfw_Scheduler_t *SchedPtr)
 {
 	SchedPtr->Enabled = (u32)FALSE;
+	SchedPtr->CountPerTick = 0U;
 
 	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_PRELOAD_OFFSET, 0U );
 	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET, 0U );
@@ -33,6 +33,7 @@ typedef struct {
 	u32 PitBaseAddr;
 	u32 Tick;
 	u32 Enabled;
+	u32 CountPerTick; /**< PIT reload value while the scheduler runs */
 } XPfw_Scheduler_t ;
 
 void XPfw_SchedulerTickHandler(XPfw_Scheduler_t *SchedPtr);
@@ -70,6 +70,9 @@
 * 5.1   ro   06/12/23 Added support for system device-tree flow.
 * 5.2   ap   12/05/23 Add SDT check to fix bug in disk_initialize.
 *       ap   01/11/24 Fix Doxygen warnings.
+* 5.3   ag   10/18/26 Added disk_read_start and disk_read_status for
+*                     non-blocking reads.
+*       ag   10/18/26 Release the drive when a non-blocking read fails.
 *
 * </pre>
 *
@@ -123,6 +126,8 @@ static u32 CardDetect[XSDPS_NUM_INSTANCES];
 static u32 WriteProtect[XSDPS_NUM_INSTANCES];
 static u32 SlotType[XSDPS_NUM_INSTANCES];
 static u8 HostCntrlrVer[XSDPS_NUM_INSTANCES];
+static BYTE *AsyncBuff[XSDPS_NUM_INSTANCES];
+static UINT AsyncCount[XSDPS_NUM_INSTANCES];
 #endif
 
 /*-----------------------------------------------------------------------*/
@@ -413,6 +418,129 @@ DRESULT disk_read (
 	return RES_OK;
 }
 
+#ifdef FILE_SYSTEM_INTERFACE_SD
+/*****************************************************************************/
+/**
+*
+* Starts a read of the drive without waiting for it to complete.
+* In case of SD, it programs the ADMA2 transfer and returns immediately.
+* Completion must be checked with disk_read_status() before any other
+* access to the same drive. The SD reference clock stays enabled until
+* disk_read_status() reports completion or an error.
+*
+* @param	pdrv - Drive number
+* @param	buff - Pointer to the data buffer to store read data
+* @param	sector - Start sector in LBA
+* @param	count - Number of sectors to read
+*
+* @return
+*		RES_OK		Read started
+*		RES_NOTRDY	Drive not initialized
+*		RES_PARERR	Invalid sector count
+*		RES_ERROR	Read could not be started or a read is pending
+*
+* @note
+*
+******************************************************************************/
+DRESULT disk_read_start (
+	BYTE pdrv,		/* Physical drive nmuber to identify the drive */
+	BYTE *buff,		/* Data buffer to store read data */
+	LBA_t sector,	/* Start sector in LBA */
+	UINT count		/* Number of sectors to read */
+)
+{
+	DSTATUS s;
+	s32 Status = XST_FAILURE;
+	DWORD LocSector = sector;
+
+	s = disk_status(pdrv);
+
+	if ((s & STA_NOINIT) != 0U) {
+		return RES_NOTRDY;
+	}
+	if (count == 0U) {
+		return RES_PARERR;
+	}
+
+	if (SdInstance[pdrv].IsBusy == TRUE) {
+		return RES_ERROR;
+	}
+
+	/* Convert LBA to byte address if needed */
+	if ((SdInstance[pdrv].HCS) == 0U) {
+		LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
+	}
+
+#if defined  (XCLOCKING)
+	Xil_ClockEnable(SdInstance[pdrv].Config.RefClk);
+#endif
+
+	Status = XSdPs_StartReadTransfer(&SdInstance[pdrv], (u32)LocSector,
+					 count, buff);
+	if (Status != XST_SUCCESS) {
+		/* The driver leaves the busy flag set when the read fails */
+		SdInstance[pdrv].IsBusy = FALSE;
+#if defined  (XCLOCKING)
+		Xil_ClockDisable(SdInstance[pdrv].Config.RefClk);
+#endif
+		return RES_ERROR;
+	}
+
+	AsyncBuff[pdrv] = buff;
+	AsyncCount[pdrv] = count;
+
+	return RES_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* Checks the status of a read started with disk_read_start().
+*
+* @param	pdrv - Drive number
+*
+* @return
+*		RES_OK		Read completed successfully
+*		RES_NOTRDY	Read still in progress
+*		RES_ERROR	Read not successful or no read started
+*
+* @note
+*
+******************************************************************************/
+DRESULT disk_read_status (
+	BYTE pdrv		/* Physical drive nmuber to identify the drive */
+)
+{
+	s32 Status = XST_FAILURE;
+
+	if (SdInstance[pdrv].IsBusy == FALSE) {
+		return RES_ERROR;
+	}
+
+	Status = XSdPs_CheckReadTransfer(&SdInstance[pdrv]);
+	if (Status == XST_DEVICE_BUSY) {
+		return RES_NOTRDY;
+	}
+
+#if defined  (XCLOCKING)
+	Xil_ClockDisable(SdInstance[pdrv].Config.RefClk);
+#endif
+
+	if (Status != XST_SUCCESS) {
+		/* Release the drive so that later reads can be issued */
+		SdInstance[pdrv].IsBusy = FALSE;
+		return RES_ERROR;
+	}
+
+	if (SdInstance[pdrv].Config.IsCacheCoherent == 0U) {
+		Xil_DCacheInvalidateRange((INTPTR)AsyncBuff[pdrv],
+			((INTPTR)AsyncCount[pdrv] * (INTPTR)SdInstance[pdrv].BlkSize));
+	}
+
+	return RES_OK;
+}
+#endif
+
 /*-----------------------------------------------------------------------*/
 /* Miscellaneous Functions						*/
 /*-----------------------------------------------------------------------*/
@@ -37,6 +37,10 @@ DSTATUS disk_status (BYTE pdrv);
 DRESULT disk_read (BYTE pdrv, BYTE* buff, LBA_t sector, UINT count);
 DRESULT disk_write (BYTE pdrv, const BYTE* buff, LBA_t sector, UINT count);
 DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void* buff);
+#ifdef FILE_SYSTEM_INTERFACE_SD
+DRESULT disk_read_start (BYTE pdrv, BYTE* buff, LBA_t sector, UINT count);
+DRESULT disk_read_status (BYTE pdrv);
+#endif
 
 
 /* Disk Status Bits (DSTATUS) */
@@ -45,6 +45,7 @@
 #                       xilfpga version and supported feature list info.
 # 6.2  Nava   01/19/22  Added build time flag to skip eFUSE checks.
 # 6.4  Nava   01/23/22  Added Versalnet support.
+# 6.6  ag     10/18/26  Added secure_stream option.
 #
 ##############################################################################
 
@@ -166,6 +167,11 @@ proc generate {lib_handle} {
 	puts $conffile "#define XFPGA_SECURE_MODE"
     }
 
+    set value  [common::get_property CONFIG.secure_stream $lib_handle]
+    if {$value == true} {
+	puts $conffile "#define XFPGA_SECURE_STREAM_MODE"
+    }
+
     set value  [common::get_property CONFIG.secure_readback $lib_handle]
     if {$value == true} {
 	puts $conffile "#define XFPGA_SECURE_READBACK_MODE"
@@ -131,6 +131,11 @@
  *                     MISRA-C ciolations for Rule 10.3
  * 6.6 ml    17/01/24  Removed None parameters from description to fix doxygen
  *                     warnings.
+ * 6.6 ag    10/18/26  Added XFPGA_SECURE_STREAM_MODE, in which authenticated
+ *                     full bitstreams are read once into ping-pong OCM
+ *                     buffers, hashed and written to the PL in one pass.
+ * 6.6 ag    10/18/26  Send the partial chunk first in secure stream mode, so
+ *                     that a full chunk is held until authentication.
  * </pre>
  *
  * @note
@@ -161,6 +166,10 @@
 #define PL_PARTATION_SIZE		(0x800000U)
 #define PL_CHUNK_SIZE_BYTES		(1024U * 56U)
 #define NUM_OF_PL_CHUNKS(Size)	((Size) / PL_CHUNK_SIZE_BYTES)
+/* Size of the next streamed chunk, the partial chunk goes first */
+#define XFPGA_STREAM_CHUNK_SIZE(Remaining)				\
+	((((Remaining) % PL_CHUNK_SIZE_BYTES) != 0U) ?			\
+	 ((Remaining) % PL_CHUNK_SIZE_BYTES) : PL_CHUNK_SIZE_BYTES)
 #endif
 
 /**
@@ -212,6 +221,8 @@ typedef u32 (*XpbrServHndlr_t) (void);
 /************************** Function Prototypes ******************************/
 static u32 XFpga_PcapWaitForDone(void);
 static u32 XFpga_WriteToPcap(u32 Size, UINTPTR BitstreamAddr);
+static void XFpga_WriteToPcapStart(u32 Size, UINTPTR BitstreamAddr);
+static u32 XFpga_WriteToPcapWait(void);
 static u32 XFpga_PcapInit(u32 Flags);
 static u32 XFpga_PLWaitForDone(void);
 static u32 XFpga_PowerUpPl(void);
@@ -251,6 +262,15 @@ static u32 XFpga_ReAuthPlChunksWriteToPl(XFpgaPs_PlPartition *PlAesInfo,
 static u32 XFpga_DecrptPlChunks(XFpgaPs_PlPartition *PartitionParams,
 				UINTPTR ChunkAdrs, u32 ChunkSize);
 static u32 XFpga_DecrptSetUpNextBlk(XFpgaPs_PlPartition *PartitionParams);
+#ifdef XFPGA_SECURE_STREAM_MODE
+static u32 XFpga_StreamPlChunks(XFpgaPs_PlPartition *PlAesInfo,
+				UINTPTR BitstreamAddr, u32 Size,
+				UINTPTR AcAddr, u32 Flags);
+static u32 XFpga_StreamPlChunk(XFpgaPs_PlPartition *PlAesInfo,
+			       UINTPTR ChunkAddr, u32 ChunkSize,
+			       UINTPTR NextAddr, UINTPTR NextSrc,
+			       u32 NextSize, u32 Flags);
+#endif
 static void XFpga_DmaPlCopy(XCsuDma *InstancePtr, UINTPTR Src,
 			    u32 Size, u8 EnLast);
 static u32 XFpga_DecrptPl(XFpgaPs_PlPartition *PartitionParams,
@@ -739,8 +759,22 @@ static u32 XFpga_PcapWaitForDone(void)
  *****************************************************************************/
 static u32 XFpga_WriteToPcap(u32 Size, UINTPTR BitstreamAddr)
 {
-	volatile u32 Status = XFPGA_FAILURE;
+	XFpga_WriteToPcapStart(Size, BitstreamAddr);
+
+	return XFpga_WriteToPcapWait();
+}
 
+/*****************************************************************************/
+/**
+ * Starts the DMA transfer of data to the PCAP interface
+ *
+ * @param Size Number of words that the DMA should write to the
+ *        PCAP interface
+ * @param BitstreamAddr Linear Bitstream memory base address
+ *
+ *****************************************************************************/
+static void XFpga_WriteToPcapStart(u32 Size, UINTPTR BitstreamAddr)
+{
 	/*
 	 * Setup the  SSS, setup the PCAP to receive from DMA source
 	 */
@@ -749,6 +783,19 @@ static u32 XFpga_WriteToPcap(u32 Size, UINTPTR BitstreamAddr)
 
 	/* Setup the source DMA channel */
 	XCsuDma_Transfer(CsuDmaPtr, XCSUDMA_SRC_CHANNEL, BitstreamAddr, Size, 0U);
+}
+
+/*****************************************************************************/
+/**
+ * Waits for the DMA transfer started by XFpga_WriteToPcapStart() to complete
+ *
+ * @return Returns Status
+ *		- XFPGA_SUCCESS on success
+ *		- Error code on failure
+ *****************************************************************************/
+static u32 XFpga_WriteToPcapWait(void)
+{
+	volatile u32 Status = XFPGA_FAILURE;
 
 	/* wait for the SRC_DMA to complete and the pcap to be IDLE */
 	Status = XCsuDma_WaitForDoneTimeout(CsuDmaPtr, XCSUDMA_SRC_CHANNEL);
@@ -1071,7 +1118,25 @@ static u32 XFpga_AuthPlChunksDdrOcm(XFpga *InstancePtr, u32 Size)
 					 (u32)XFPGA_ERROR_DDR_AUTH_WRITE_PL, (u32)0U);
 			goto END;
 		}
-	} else {
+	}
+#ifdef XFPGA_SECURE_STREAM_MODE
+	/*
+	 * Partial bitstreams take effect while they are written, so they are
+	 * authenticated before they are written to the PL.
+	 */
+	else if ((InstancePtr->WriteInfo.Flags & XFPGA_PARTIAL_EN) == 0U) {
+		Status = XFpga_StreamPlChunks(PlAesInfoPtr,
+					      (UINTPTR)InstancePtr->PLInfo.BitAddr,
+					      Size, (UINTPTR)AcBuf,
+					      InstancePtr->WriteInfo.Flags);
+		if (Status != XFPGA_SUCCESS) {
+			Status = XFPGA_PCAP_UPDATE_ERR(
+					 XFPGA_ERROR_OCM_AUTH_PARTITION, Status);
+			goto END;
+		}
+	}
+#endif
+	else {
 		Status = XFpga_AuthPlChunks(
 				 (UINTPTR)InstancePtr->PLInfo.BitAddr,
 				 Size, (UINTPTR)AcBuf);
@@ -1323,6 +1388,232 @@ END:
 	return Status;
 }
 
+#ifdef XFPGA_SECURE_STREAM_MODE
+/*****************************************************************************/
+/**
+ * This function authenticates a PL partition while it is written to the PL.
+ * Each chunk is read once into one of two OCM buffers, hashed from there and
+ * sent to PCAP from the same buffer, via the AES engine if the partition is
+ * encrypted. While a chunk is sent, the next chunk is fetched into the other
+ * buffer.
+ *
+ * The last chunk is held in the OCM until the partition signature is
+ * verified. The startup sequence of a bitstream is at its end, so the PL
+ * does not start unless all partitions are authenticated, and on a failure
+ * the caller clears the PL. The partition is split so that the short chunk
+ * comes first and the held chunk is a full one. A first chunk must hold the
+ * secure header and GCM tag of an encrypted partition, so a remainder too
+ * short for that is sent together with half a chunk, and the other half
+ * follows it.
+ *
+ * @param PlAesInfo is a pointer to XFpgaPs_PlPartition
+ * @param BitstreamAddr Linear memory secure image base address
+ * @param Size Number of bytes of the partition.
+ * @param AcAddr authentication certificate base address.
+ * @param Flags It provides the information about Crypto operation needs
+ *        to be performed on the given Image (or) Data.
+ *
+ * @return Returns Status
+ *		- XFPGA_SUCCESS on success
+ *		- Error code on failure
+ *
+ * @note Both OCM buffers are PL_CHUNK_SIZE_BYTES long and start at
+ *       XFPGA_OCM_ADDRESS.
+ *
+ *****************************************************************************/
+static u32 XFpga_StreamPlChunks(XFpgaPs_PlPartition *PlAesInfo,
+				UINTPTR BitstreamAddr, u32 Size,
+				UINTPTR AcAddr, u32 Flags)
+{
+	volatile u32 Status = XFPGA_FAILURE;
+	XSecure_Sha3 Secure_Sha3 = {0U};
+	XSecure_RsaKey Key;
+	UINTPTR OcmBuf[2U] = {OCM_PL_ADDR, OCM_PL_ADDR + PL_CHUNK_SIZE_BYTES};
+	u8 *AcPtr = (u8 *)(UINTPTR)AcAddr;
+	u8 *Signature = (AcPtr + XSECURE_AUTH_CERT_PARTSIG_OFFSET);
+	u8 Sha3Hash[HASH_LEN] = {0U};
+	UINTPTR SrcAddr = BitstreamAddr;
+	u32 RemainingBytes = Size;
+	u32 ChunkSize;
+	u32 NextSize;
+	u32 Cur = 0U;
+
+	Status = (u32)XSecure_Sha3Initialize(&Secure_Sha3, CsuDmaPtr);
+	if (Status != (u32)XST_SUCCESS) {
+		goto END;
+	}
+
+	(void)XSecure_Sha3Start(&Secure_Sha3);
+
+	ChunkSize = XFPGA_STREAM_CHUNK_SIZE(RemainingBytes);
+	if ((ChunkSize <= (XSECURE_SECURE_HDR_SIZE +
+			   XSECURE_SECURE_GCM_TAG_SIZE)) &&
+	    (ChunkSize < RemainingBytes)) {
+		ChunkSize += PL_CHUNK_SIZE_BYTES / 2U;
+	}
+
+	Status = XFPGA_FAILURE;
+	Status = XSecure_MemCopy((u8 *)OcmBuf[Cur], (u8 *)SrcAddr,
+				 ChunkSize / WORD_LEN);
+	if (Status != XFPGA_SUCCESS) {
+		goto END;
+	}
+
+	while (RemainingBytes > 0U) {
+		/* Generating SHA3 hash */
+		Status = XFPGA_FAILURE;
+		Status = XSecure_Sha3Update(&Secure_Sha3,
+					    (u8 *)OcmBuf[Cur], ChunkSize);
+		if (Status != (u32)XST_SUCCESS) {
+			goto END;
+		}
+
+		SrcAddr = SrcAddr + ChunkSize;
+		RemainingBytes = RemainingBytes - ChunkSize;
+		if (RemainingBytes == 0U) {
+			/* Hold the last chunk until the signature is verified */
+			break;
+		}
+
+		NextSize = XFPGA_STREAM_CHUNK_SIZE(RemainingBytes);
+
+		Status = XFPGA_FAILURE;
+		Status = XFpga_StreamPlChunk(PlAesInfo, OcmBuf[Cur], ChunkSize,
+					     OcmBuf[Cur ^ 1U], SrcAddr,
+					     NextSize, Flags);
+		if (Status != XFPGA_SUCCESS) {
+			goto END;
+		}
+
+		Cur ^= 1U;
+		ChunkSize = NextSize;
+	}
+
+	/* Copy AC into the free OCM buffer */
+	Status = XFPGA_FAILURE;
+	Status = XSecure_MemCopy((u8 *)OcmBuf[Cur ^ 1U], (u8 *)(UINTPTR)AcAddr,
+				 AC_LEN / WORD_LEN);
+	if (Status != XFPGA_SUCCESS) {
+		goto END;
+	}
+
+	Status = XFPGA_FAILURE;
+	Status = XSecure_Sha3Update(&Secure_Sha3, (u8 *)OcmBuf[Cur ^ 1U],
+				    AC_LEN - XSECURE_PARTITION_SIG_SIZE);
+	if (Status != (u32)XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XFPGA_FAILURE;
+	Status = XSecure_Sha3Finish(&Secure_Sha3, Sha3Hash);
+	if (Status != (u32)XST_SUCCESS) {
+		goto END;
+	}
+
+	/* Calculate Hash on the given signature  and compare with Sha3Hash */
+	AcPtr += ((u32)XSECURE_RSA_AC_ALIGN + XSECURE_PPK_SIZE);
+	Key.Modulus = AcPtr;
+
+	AcPtr += XSECURE_SPK_MOD_SIZE;
+	Key.Exponentiation = AcPtr;
+
+	AcPtr += XSECURE_SPK_MOD_EXT_SIZE;
+	Key.Exponent = AcPtr;
+
+	Status = XFPGA_FAILURE;
+	Status = XSecure_DataAuth(Signature, &Key, Sha3Hash);
+	if (Status != (u32)XST_SUCCESS) {
+		goto END;
+	}
+
+	/* Partition is authenticated, send the last chunk */
+	Status = XFPGA_FAILURE;
+	Status = XFpga_StreamPlChunk(PlAesInfo, OcmBuf[Cur], ChunkSize,
+				     0U, 0U, 0U, Flags);
+END:
+	/* Set SHA under reset */
+	XSecure_SetReset(Secure_Sha3.BaseAddress,
+			 XSECURE_CSU_SHA3_RESET_OFFSET);
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function sends a chunk from the OCM to PCAP, via the AES engine if
+ * the partition is encrypted, and fetches the next chunk into the other OCM
+ * buffer. For a plain partition the next chunk is copied by the processor
+ * while the CSU DMA sends the current one.
+ *
+ * @param PlAesInfo is a pointer to XFpgaPs_PlPartition
+ * @param ChunkAddr OCM address of the chunk to be sent
+ * @param ChunkSize Number of bytes of the chunk to be sent
+ * @param NextAddr OCM address for the next chunk
+ * @param NextSrc Linear memory address of the next chunk
+ * @param NextSize Number of bytes of the next chunk, 0 if there is none
+ * @param Flags It provides the information about Crypto operation needs
+ *        to be performed on the given Image (or) Data.
+ *
+ * @return Returns Status
+ *		- XFPGA_SUCCESS on success
+ *		- Error code on failure
+ *
+ *****************************************************************************/
+static u32 XFpga_StreamPlChunk(XFpgaPs_PlPartition *PlAesInfo,
+			       UINTPTR ChunkAddr, u32 ChunkSize,
+			       UINTPTR NextAddr, UINTPTR NextSrc,
+			       u32 NextSize, u32 Flags)
+{
+	volatile u32 Status = XFPGA_FAILURE;
+
+	if (((Flags & XFPGA_ENCRYPTION_USERKEY_EN) != 0U)
+	    || ((Flags & XFPGA_ENCRYPTION_DEVKEY_EN) != 0U)) {
+		Status = XFpga_DecrptPlChunks(PlAesInfo, ChunkAddr, ChunkSize);
+		if (Status != XFPGA_SUCCESS) {
+			goto END;
+		}
+
+		if (NextSize != 0U) {
+			Status = XFPGA_FAILURE;
+			Status = XSecure_MemCopy((u8 *)NextAddr, (u8 *)NextSrc,
+						 NextSize / WORD_LEN);
+		}
+		goto END;
+	}
+
+	XFpga_WriteToPcapStart(ChunkSize / WORD_LEN, ChunkAddr);
+#ifndef __MICROBLAZE__
+	if (NextSize != 0U) {
+		/* Overlap the fetch of the next chunk with the transfer */
+		Status = (u32)Xil_SMemCpy((u8 *)NextAddr, PL_CHUNK_SIZE_BYTES,
+					  (u8 *)NextSrc, NextSize, NextSize);
+		Xil_DCacheFlushRange((INTPTR)NextAddr, NextSize);
+		if (Status != (u32)XST_SUCCESS) {
+			(void)XFpga_WriteToPcapWait();
+			goto END;
+		}
+	}
+#endif
+
+	Status = XFPGA_FAILURE;
+	Status = XFpga_WriteToPcapWait();
+	if (Status != XFPGA_SUCCESS) {
+		goto END;
+	}
+
+#ifdef __MICROBLAZE__
+	/* The CSU DMA copies faster than the PMU, fetch after the transfer */
+	if (NextSize != 0U) {
+		Status = XFPGA_FAILURE;
+		Status = XSecure_MemCopy((u8 *)NextAddr, (u8 *)NextSrc,
+					 NextSize / WORD_LEN);
+	}
+#endif
+
+END:
+	return Status;
+}
+#endif
+
 /*****************************************************************************/
 /**
  * This is the function to write Encrypted data into PCAP interface
@@ -5,6 +5,7 @@ cmake_minimum_required(VERSION 3.3)
 option(XILFPGA_secure_mode "Enable secure Bitstream loading support" ON)
 option(XILFPGA_secure_environment "Which is used to Enable the secure PL configuration" OFF)
 option(XILFPGA_secure_readback "Which is used to Enable the secure PL configuration Read-back support" OFF)
+option(XILFPGA_secure_stream "Which is used to Enable the single pass authenticated full bitstream loading through OCM" OFF)
 option(XILFPGA_debug_mode "Which is used to Enable the Debug messages in the library" OFF)
 SET(XILFPGA_ocm_address 0xfffc0000 CACHE STRING "OCM Address which is used for Bitstream Authentication")
 SET(XILFPGA_base_address 0x80000 CACHE STRING "Bitstream Image Base Address")
@@ -29,6 +30,9 @@ set(XFPGA_BASE_ADDRESS ${XILFPGA_base_address})
 if (${XILFPGA_secure_mode})
 	set(XFPGA_SECURE_MODE " ")
 endif()
+if (${XILFPGA_secure_stream})
+	set(XFPGA_SECURE_STREAM_MODE " ")
+endif()
 if (${XILFPGA_debug_mode})
 	set(XFPGA_DEBUG " ")
 endif()
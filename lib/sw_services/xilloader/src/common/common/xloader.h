@@ -118,6 +118,7 @@
 *       mss  03/06/2024 Added ClearAtfHandoff member in XilPdi structure and
 *                       ClearATFHandoffParams function prototype
 *       har  03/12/2024 Fixed doxygen warnings
+*       ag   10/18/2026 Added prototypes for background partition copy
 *
 * </pre>
 *
@@ -438,6 +439,9 @@ int XLoader_ClearATFHandoffParams(XilPdi* PdiPtr);
 int XLoader_LoadImagePrtns(XilPdi* PdiPtr);
 int XLoader_PrtnCopy(const XilPdi* PdiPtr, const XLoader_DeviceCopy* DeviceCopy,
 	void* SecureParamsPtr);
+int XLoader_SetPrtnCopyOverlap(u8 Enable);
+int XLoader_WaitForPrtnCopy(void);
+u8 XLoader_IsPrtnCopyPending(void);
 
 /* Functions defined in xloader_cmds.c */
 void XLoader_CmdsInit(void);
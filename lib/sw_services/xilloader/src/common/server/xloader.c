@@ -170,6 +170,12 @@
 *       bm   02/12/2024 Update XLoader_ReadAndValidateHdrs prototype
 *       ng   02/14/2024 removed int typecast for errors
 *       sk   02/18/2024 Added DDRMC Calib Check Status RTCA Register Init
+*       ag   10/18/2026 Start images from DDR once their ELF copies complete
+*                       and overlap the copies with the next image
+*       ag   10/18/2026 Made the overlap opt-in with PLM_PRTN_COPY_OVERLAP
+*                       and start PSM and parent images right away
+*       ag   10/18/2026 Complete the background ELF copy before starting
+*                       an image that is not deferred
 *
 * </pre>
 *
@@ -214,6 +220,8 @@
 /************************** Function Prototypes ******************************/
 static int XLoader_ReadAndValidateHdrs(XilPdi* PdiPtr, u32 RegValue, u64 PdiAddr);
 static int XLoader_LoadAndStartSubSystemImages(XilPdi *PdiPtr);
+static int XLoader_StartDelayedImage(XilPdi *PdiPtr, u8 ImageNum, u8 PrtnNum);
+static u8 XLoader_IsStartDeferrable(const XilPdi *PdiPtr);
 static int XLoader_LoadAndStartSubSystemPdi(XilPdi *PdiPtr);
 static int XLoader_LoadAndStartSecPdi(XilPdi* PdiPtr);
 static int XLoader_VerifyImgInfo(const XLoader_ImageInfo *ImageInfo);
@@ -812,9 +820,30 @@ static int XLoader_LoadAndStartSubSystemImages(XilPdi *PdiPtr)
 	u8 DelayHandoffImageNum[XLOADER_MAX_HANDOFF_CPUS];
 	u8 DelayHandoffPrtnNum[XLOADER_MAX_HANDOFF_CPUS];
 	u8 Index;
-	u8 ImageNum;
 	u8 PrtnNum;
-	u8 PrtnIndex;
+	u8 IsCopyOverlapEn = (u8)FALSE;
+	u8 IsStartDeferred = (u8)FALSE;
+	u8 DeferredImageNum = 0U;
+	u8 DeferredPrtnNum = 0U;
+	u8 DeferStart;
+	const XilPdi_ImgHdr *ImgHdr;
+
+	/**
+	 * With PLM_PRTN_COPY_OVERLAP, ELF partitions of a PDI in DDR are
+	 * copied in the background on PMC DMA1 while the next image is loaded.
+	 * Data measurement in VersalNet needs the copies of an image to
+	 * complete in order.
+	 */
+#if defined(PLM_PRTN_COPY_OVERLAP) && !defined(PLM_OCP)
+	if ((PdiPtr->PdiIndex == XLOADER_DDR_INDEX) &&
+		(PdiPtr->PdiType != XLOADER_PDI_TYPE_RESTORE)) {
+		IsCopyOverlapEn = (u8)TRUE;
+	}
+#endif
+	Status = XLoader_SetPrtnCopyOverlap(IsCopyOverlapEn);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
 
 	/**
 	 * From the meta header present in PDI pointer, read the subsystem
@@ -854,6 +883,37 @@ static int XLoader_LoadAndStartSubSystemImages(XilPdi *PdiPtr)
 			NoOfDelayedHandoffCpus += 1U;
 		}
 
+		/**
+		 * Start the image waiting for its copy before loading the next
+		 * image, unless the next image starts with a CDO partition that
+		 * can be processed meanwhile.
+		 */
+		ImgHdr = &PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum];
+		if ((IsStartDeferred == (u8)TRUE) && ((ImgHdr->NoOfPrtns == 0U) ||
+			(XilPdi_GetPrtnType(&PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum]) !=
+			XIH_PH_ATTRB_PRTN_TYPE_CDO))) {
+			IsStartDeferred = (u8)FALSE;
+			Status = XLoader_StartDelayedImage(PdiPtr, DeferredImageNum,
+				DeferredPrtnNum);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+		}
+
+		/**
+		 * Delay the handoff of images whose copies may run in the
+		 * background until the copies complete.
+		 */
+		DeferStart = (u8)FALSE;
+		if ((IsCopyOverlapEn == (u8)TRUE) &&
+			(PdiPtr->DelayLoad == (u8)FALSE) &&
+			(PdiPtr->DelayHandoff == (u8)FALSE) &&
+			(XLoader_IsStartDeferrable(PdiPtr) == (u8)TRUE)) {
+			DeferStart = (u8)TRUE;
+			PdiPtr->DelayHandoff = (u8)TRUE;
+		}
+		PrtnNum = PdiPtr->PrtnNum;
+
 		Status = XLoader_LoadImage(PdiPtr);
 		if (Status != XST_SUCCESS) {
 			/* Check for Cfi errors */
@@ -878,12 +938,41 @@ static int XLoader_LoadAndStartSubSystemImages(XilPdi *PdiPtr)
 		}
 #endif
 
-		if ((PdiPtr->DelayLoad == (u8)TRUE) ||
+		/** Start the previous image, its copy overlapped this image */
+		if (IsStartDeferred == (u8)TRUE) {
+			IsStartDeferred = (u8)FALSE;
+			Status = XLoader_StartDelayedImage(PdiPtr, DeferredImageNum,
+				DeferredPrtnNum);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+		}
+
+		if (DeferStart == (u8)TRUE) {
+			if (XLoader_IsPrtnCopyPending() == (u8)TRUE) {
+				DeferredImageNum = PdiPtr->ImageNum;
+				DeferredPrtnNum = PrtnNum;
+				IsStartDeferred = (u8)TRUE;
+				continue;
+			}
+			Status = XLoader_StartDelayedImage(PdiPtr, PdiPtr->ImageNum,
+				PrtnNum);
+		}
+		else if ((PdiPtr->DelayLoad == (u8)TRUE) ||
 			(PdiPtr->DelayHandoff == (u8)TRUE)) {
 			continue;
 		}
-
-		Status = XLoader_StartImage(PdiPtr);
+		else {
+			/**
+			 * The ELF copy of an earlier image may still be running
+			 * on DMA1, complete it before this image is started
+			 */
+			Status = XLoader_WaitForPrtnCopy();
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+			Status = XLoader_StartImage(PdiPtr);
+		}
 		if (Status != XST_SUCCESS) {
 			goto END;
 		}
@@ -891,22 +980,20 @@ static int XLoader_LoadAndStartSubSystemImages(XilPdi *PdiPtr)
 		(void)XPlmi_ErrorTaskHandler(NULL);
 	}
 
-	/** Execute Delay Handoff after all images are loaded. */
-	for (Index = 0U; Index < NoOfDelayedHandoffCpus; ++Index) {
-		ImageNum = DelayHandoffImageNum[Index];
-		PrtnNum = DelayHandoffPrtnNum[Index];
-		PdiPtr->PrtnNum = PrtnNum;
-		for (PrtnIndex = 0U;
-			PrtnIndex < (u8)PdiPtr->MetaHdr.ImgHdr[ImageNum].NoOfPrtns;
-			PrtnIndex++) {
-			Status = XLoader_UpdateHandoffParam(PdiPtr);
-			if (Status != XST_SUCCESS) {
-				goto END;
-			}
-			PdiPtr->PrtnNum++;
+	/** Start the last image once its copy completes */
+	if (IsStartDeferred == (u8)TRUE) {
+		IsStartDeferred = (u8)FALSE;
+		Status = XLoader_StartDelayedImage(PdiPtr, DeferredImageNum,
+			DeferredPrtnNum);
+		if (Status != XST_SUCCESS) {
+			goto END;
 		}
+	}
 
-		Status = XLoader_StartImage(PdiPtr);
+	/** Execute Delay Handoff after all images are loaded. */
+	for (Index = 0U; Index < NoOfDelayedHandoffCpus; ++Index) {
+		Status = XLoader_StartDelayedImage(PdiPtr,
+			DelayHandoffImageNum[Index], DelayHandoffPrtnNum[Index]);
 		if (Status != XST_SUCCESS) {
 			goto END;
 		}
@@ -915,6 +1002,19 @@ static int XLoader_LoadAndStartSubSystemImages(XilPdi *PdiPtr)
 	Status = XST_SUCCESS;
 
 END:
+	/**
+	 * On failure, still start the image loaded before the failing one as
+	 * it would have been started without the background copy.
+	 */
+	if (IsStartDeferred == (u8)TRUE) {
+		(void)XLoader_StartDelayedImage(PdiPtr, DeferredImageNum,
+			DeferredPrtnNum);
+	}
+	SStatus = XLoader_SetPrtnCopyOverlap((u8)FALSE);
+	if (Status == XST_SUCCESS) {
+		Status = SStatus;
+	}
+
 	if (DeviceOps[PdiPtr->PdiIndex].Release != NULL) {
 		SStatus = DeviceOps[PdiPtr->PdiIndex].Release();
 		if (Status == XST_SUCCESS) {
@@ -933,6 +1033,91 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function checks if the start of the image to be loaded can
+ * 			be deferred until its copy completes. Images with a partition
+ * 			for PSM are started right away, so are images that are the
+ * 			parent of a later image in the PDI.
+ *
+ * @param	PdiPtr is Pdi instance pointer
+ *
+ * @return
+ * 			- TRUE if the start can be deferred, FALSE otherwise
+ *
+ *****************************************************************************/
+static u8 XLoader_IsStartDeferrable(const XilPdi *PdiPtr)
+{
+	u8 IsDeferrable = (u8)FALSE;
+	const XilPdi_ImgHdr *ImgHdr = &PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum];
+	u32 PrtnIndex;
+	u32 ImgIndex;
+
+	for (PrtnIndex = 0U; PrtnIndex < ImgHdr->NoOfPrtns; PrtnIndex++) {
+		if (XilPdi_GetDstnCpu(&PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum +
+			PrtnIndex]) == XIH_PH_ATTRB_DSTN_CPU_PSM) {
+			goto END;
+		}
+	}
+
+	if (ImgHdr->UID != XLOADER_INVALID_UID) {
+		for (ImgIndex = (u32)PdiPtr->ImageNum + 1U;
+			ImgIndex < PdiPtr->MetaHdr.ImgHdrTbl.NoOfImgs; ImgIndex++) {
+			if (PdiPtr->MetaHdr.ImgHdr[ImgIndex].PUID == ImgHdr->UID) {
+				goto END;
+			}
+		}
+	}
+
+	IsDeferrable = (u8)TRUE;
+
+END:
+	return IsDeferrable;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function updates the handoff parameters of an image loaded
+ * 			with delayed handoff and starts the image. A copy of the image
+ * 			still running in the background is completed first.
+ *
+ * @param	PdiPtr is Pdi instance pointer
+ * @param	ImageNum is the image number in the PDI
+ * @param	PrtnNum is the first partition number of the image
+ *
+ * @return
+ * 			- XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_StartDelayedImage(XilPdi *PdiPtr, u8 ImageNum, u8 PrtnNum)
+{
+	int Status = XST_FAILURE;
+	u8 CurPrtnNum = PdiPtr->PrtnNum;
+	u8 PrtnIndex;
+
+	Status = XLoader_WaitForPrtnCopy();
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	PdiPtr->PrtnNum = PrtnNum;
+	for (PrtnIndex = 0U;
+		PrtnIndex < (u8)PdiPtr->MetaHdr.ImgHdr[ImageNum].NoOfPrtns;
+		PrtnIndex++) {
+		Status = XLoader_UpdateHandoffParam(PdiPtr);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		PdiPtr->PrtnNum++;
+	}
+
+	Status = XLoader_StartImage(PdiPtr);
+
+END:
+	PdiPtr->PrtnNum = CurPrtnNum;
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function is used to load the primary and secondary PDIs.
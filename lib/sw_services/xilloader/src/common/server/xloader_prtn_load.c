@@ -106,6 +106,9 @@
 *       mss  11/02/2023 Added VerifyAddr check for destination address of
 *                       Raw Partition Loading
 *       sk   02/18/2024 Added logic to print DDRMC Calib Check Status
+*       ag   10/18/2026 Overlap SD/eMMC FS chunk copy with CDO processing
+*       ag   10/18/2026 Copy ELF partitions from DDR in the background on
+*                       PMC DMA1
 * </pre>
 *
 * @note
@@ -135,6 +138,15 @@
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
+/**
+ * State of the ELF partition copy running in the background
+ */
+typedef struct {
+	int (*DeviceCopy) (u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags);
+		/**< Device copy function that started the copy */
+	u8 IsOverlapEn; /**< Background copies are allowed */
+	u8 IsPending; /**< Copy is running on PMC DMA1 */
+} XLoader_PrtnCopyState;
 
 /***************** Macros (Inline Functions) Definitions *********************/
 #define XLOADER_SUCCESS_NOT_PRTN_OWNER	(0x100U) /**< Indicates that PLM is not the partition owner */
@@ -143,8 +155,11 @@
 static int XLoader_PrtnHdrValidation(const XilPdi_PrtnHdr* PrtnHdr, u32 PrtnNum);
 static int XLoader_ProcessCdo (const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCopy,
 	XLoader_SecureParams* SecureParams);
+static u8 XLoader_IsPrtnCopyOverlapped(const XilPdi* PdiPtr,
+	const XLoader_DeviceCopy* DeviceCopy);
 
 /************************** Variable Definitions *****************************/
+static XLoader_PrtnCopyState PrtnCopyState;
 
 /*****************************************************************************/
 /**
@@ -365,6 +380,13 @@ int XLoader_PrtnCopy(const XilPdi* PdiPtr, const XLoader_DeviceCopy* DeviceCopy,
 	const XilPdi_PrtnHdr * PrtnHdr = &(PdiPtr->MetaHdr.PrtnHdr[PrtnNum]);
 	u32 PcrInfo = PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].PcrInfo;
 	XLoader_ImageMeasureInfo ImageMeasureInfo = {0U};
+	u32 Flags = XPLMI_DEVICE_COPY_STATE_BLK;
+
+	/** Complete the copy running in the background before starting another */
+	Status = XLoader_WaitForPrtnCopy();
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
 
 	/** Verify the destination address range before writing */
 	Status = XPlmi_VerifyAddrRange(DeviceCopy->DestAddr, DeviceCopy->DestAddr + (u64)DeviceCopy->Len - 1U);
@@ -380,8 +402,21 @@ int XLoader_PrtnCopy(const XilPdi* PdiPtr, const XLoader_DeviceCopy* DeviceCopy,
 	if ((SecureParams->SecureEn == (u8)FALSE) &&
 			(SecureTempParams->SecureEn == (u8)FALSE) &&
 			(SecureParams->IsCheckSumEnabled == (u8)FALSE)) {
+		/**
+		 * - ELF partitions from DDR are only started on PMC DMA1 and
+		 * completed by XLoader_WaitForPrtnCopy.
+		 */
+		if (XLoader_IsPrtnCopyOverlapped(PdiPtr, DeviceCopy) == (u8)TRUE) {
+			Flags = XPLMI_DEVICE_COPY_STATE_INITIATE;
+		}
 		Status = PdiPtr->MetaHdr.DeviceCopy(DeviceCopy->SrcAddr,
-			DeviceCopy->DestAddr,DeviceCopy->Len, DeviceCopy->Flags);
+			DeviceCopy->DestAddr,DeviceCopy->Len,
+			(DeviceCopy->Flags | Flags));
+		if ((Status == XST_SUCCESS) &&
+			(Flags == XPLMI_DEVICE_COPY_STATE_INITIATE)) {
+			PrtnCopyState.DeviceCopy = PdiPtr->MetaHdr.DeviceCopy;
+			PrtnCopyState.IsPending = (u8)TRUE;
+		}
 	}
 	else {
 		XSECURE_TEMPORAL_IMPL(Status, StatusTmp, XLoader_SecureCopy,
@@ -435,6 +470,7 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 	u32 ChunkAddrTemp;
 	u8 LastChunk = (u8)FALSE;
 	u8 Flags;
+	u8 IsPrefetchEn = (u8)TRUE;
 	XLoader_SecureTempParams *SecureTempParams = XLoader_GetTempParams();
 #ifdef PLM_PRINT_PERF_CDO_PROCESS
 	u64 CdoProcessTimeStart;
@@ -462,13 +498,35 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 	if ((SecureParams->SecureEn == (u8)FALSE) &&
 		(SecureTempParams->SecureEn == (u8)FALSE) &&
 		(SecureParams->IsCheckSumEnabled == (u8)FALSE)) {
-		if ((PdiPtr->PdiIndex == XLOADER_SD_INDEX) ||
-			(PdiPtr->PdiIndex == XLOADER_SD_RAW_INDEX)) {
+		if (PdiPtr->PdiIndex == XLOADER_SD_RAW_INDEX) {
 			ChunkLen = XLOADER_CHUNK_SIZE;
 		}
-		else {
+		else if (PrtnCopyState.IsPending == (u8)TRUE) {
+			/**
+			 * An ELF copy from DDR is running on PMC DMA1. Read the
+			 * chunks on PMC DMA0 without prefetch and resume commands
+			 * split across chunks. Commands using PMC DMA1 complete
+			 * the copy first.
+			 */
+			DeviceCopy->Flags = XPLMI_PMCDMA_0;
+			IsPrefetchEn = (u8)FALSE;
+			Cdo.Cmd.KeyHoleParams.Dma1WaitFunc = XLoader_WaitForPrtnCopy;
+		}
+		else if (PdiPtr->PdiIndex != XLOADER_SD_INDEX) {
 			Cdo.Cmd.KeyHoleParams.Func = PdiPtr->MetaHdr.DeviceCopy;
 		}
+		else {
+			/**
+			 * SD/eMMC FS boot overlaps the copy of next chunk with
+			 * CDO processing but does not copy directly to keyhole
+			 */
+		}
+	}
+	else {
+		Status = XLoader_WaitForPrtnCopy();
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
 	}
 
 	while (DeviceCopy->Len > 0U) {
@@ -503,7 +561,7 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 			/**
 			 * Start the copy of the next chunk for increasing performance
 			 */
-			if (LastChunk != (u8)TRUE) {
+			if ((LastChunk != (u8)TRUE) && (IsPrefetchEn == (u8)TRUE)) {
 				/** Update the next chunk address to other part */
 				ChunkAddr += ChunkLen;
 				if (ChunkAddr > XPLMI_PMCRAM_CHUNK_MEMORY_1) {
@@ -657,6 +715,20 @@ int XLoader_ProcessPrtn(XilPdi* PdiPtr, u32 PrtnIndex)
 	/** Read Partition Type */
 	PrtnType = XilPdi_GetPrtnType(PrtnHdr);
 
+	/**
+	 * Only non-secure CDO partitions are processed while an ELF copy runs
+	 * in the background. Complete the copy before any other partition.
+	 */
+	if ((PrtnType != XIH_PH_ATTRB_PRTN_TYPE_CDO) ||
+		(PrtnHdr->AuthCertificateOfst != 0U) ||
+		(PrtnHdr->EncStatus != 0U) ||
+		(XilPdi_GetChecksumType(PrtnHdr) != 0U)) {
+		Status = XLoader_WaitForPrtnCopy();
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+
 	PrtnParams.DeviceCopy.DestAddr = PrtnHdr->DstnLoadAddr;
 	PrtnParams.DeviceCopy.Len = (PrtnHdr->TotalDataWordLen <<
 		XPLMI_WORD_LEN_SHIFT);
@@ -755,3 +827,98 @@ int XLoader_ProcessPrtn(XilPdi* PdiPtr, u32 PrtnIndex)
 END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function allows ELF partitions to be copied in the
+ * 			background while the loader continues with the next partitions.
+ * 			A copy still running is completed first.
+ *
+ * @param	Enable is TRUE to allow background copies, FALSE otherwise
+ *
+ * @return
+ * 			- XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+int XLoader_SetPrtnCopyOverlap(u8 Enable)
+{
+	int Status = XLoader_WaitForPrtnCopy();
+
+	PrtnCopyState.IsOverlapEn = Enable;
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function waits for the ELF partition copy running in the
+ * 			background, if any, to complete.
+ *
+ * @return
+ * 			- XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+int XLoader_WaitForPrtnCopy(void)
+{
+	int Status = XST_SUCCESS;
+
+	if (PrtnCopyState.IsPending == (u8)TRUE) {
+		PrtnCopyState.IsPending = (u8)FALSE;
+		Status = PrtnCopyState.DeviceCopy(0U, 0U, 0U,
+			XPLMI_DEVICE_COPY_STATE_WAIT_DONE);
+		if (Status != XST_SUCCESS) {
+			XPlmi_Printf(DEBUG_GENERAL, "Device Copy Failed\n\r");
+		}
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks if an ELF partition copy is running in the
+ * 			background.
+ *
+ * @return
+ * 			- TRUE if a copy is running, FALSE otherwise
+ *
+ *****************************************************************************/
+u8 XLoader_IsPrtnCopyPending(void)
+{
+	return PrtnCopyState.IsPending;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks if a partition can be copied in the
+ * 			background. Only ELF partitions from DDR qualify, the copy runs
+ * 			on PMC DMA1 and DDR stays readable through PMC DMA0. Partitions
+ * 			loaded to PMC RAM are excluded as they may overlap the chunk
+ * 			buffers.
+ *
+ * @param	PdiPtr is pointer to XilPdi instance
+ * @param	DeviceCopy is pointer to the copy parameters of the partition
+ *
+ * @return
+ * 			- TRUE if the partition can be copied in the background
+ * 			- FALSE otherwise
+ *
+ *****************************************************************************/
+static u8 XLoader_IsPrtnCopyOverlapped(const XilPdi* PdiPtr,
+	const XLoader_DeviceCopy* DeviceCopy)
+{
+	u8 IsOverlapped = (u8)FALSE;
+	const XilPdi_PrtnHdr * PrtnHdr = &(PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum]);
+
+	if ((PrtnCopyState.IsOverlapEn == (u8)TRUE) &&
+		(PdiPtr->PdiIndex == XLOADER_DDR_INDEX) &&
+		(XilPdi_GetPrtnType(PrtnHdr) == XIH_PH_ATTRB_PRTN_TYPE_ELF) &&
+		((DeviceCopy->DestAddr >=
+		((u64)XPLMI_PMCRAM_BASEADDR + XPLMI_PMCRAM_LEN)) ||
+		((DeviceCopy->DestAddr + DeviceCopy->Len) <=
+		(u64)XPLMI_PMCRAM_BASEADDR))) {
+		IsOverlapped = (u8)TRUE;
+	}
+
+	return IsOverlapped;
+}
@@ -52,6 +52,7 @@
 *       bm   02/12/2024 Updated logical partition comments for SD/eMMC bootmodes
 *       ng   02/14/2024 removed int typecast for errors
 *       bm   03/02/2024 Make SD drive number logic order independent
+* 2.01  ag   10/18/2026 Added non-blocking copy support for SD/eMMC FS boot
 *
 * </pre>
 *
@@ -65,6 +66,7 @@
 #if defined(XLOADER_SD_0) || defined(XLOADER_SD_1)
 #include "xparameters.h"
 #include "ff.h"
+#include "diskio.h"
 #include "xplmi_generic.h"
 #include "xil_util.h"
 #include "xpm_api.h"
@@ -75,14 +77,32 @@
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
+/**
+ * Copy from the boot file started by XPLMI_DEVICE_COPY_STATE_INITIATE
+ */
+typedef struct {
+	u64 SrcAddr;	/**< Boot file offset of the pending copy */
+	u64 DestAddr;	/**< Destination address of the pending copy */
+	u32 Len;	/**< Length of the pending copy in bytes */
+	u32 DmaLen;	/**< Length being transferred by ADMA2 in bytes */
+	u8 State;	/**< Copy state */
+} XLoader_SdXfer;
 
 /***************** Macros (Inline Functions) Definitions *********************/
 #define XLOADER_SD_SRC_FILENAME_SIZE1		(9U)
 #define XLOADER_SD_SRC_FILENAME_SIZE2		(13U)
+#define XLOADER_SD_XFER_STATE_IDLE		(0U)
+#define XLOADER_SD_XFER_STATE_STARTED		(1U)
+#define XLOADER_SD_XFER_STATE_DEFERRED		(2U)
 
 /************************** Function Prototypes ******************************/
 static int XLoader_MakeSdFileName(u32 MultiBootOffsetVal);
 static u8 XLoader_GetDrvNumSD(u8 DeviceFlags);
+static int XLoader_SdRead(u64 SrcAddr, u64 DestAddr, u32 Len);
+static int XLoader_SdGetContigSectors(u64 SrcAddr, u32 Len, LBA_t *Sector,
+	u32 *ContigLen);
+static int XLoader_SdStartXfer(u64 SrcAddr, u64 DestAddr, u32 Len);
+static int XLoader_SdWaitForXfer(void);
 
 /************************** Variable Definitions *****************************/
 static FIL FFil;		/* File object */
@@ -91,6 +111,7 @@ static char BootFile[XLOADER_BASE_FILE_NAME_LEN_SD + 1U] = {'\0'};
 static u32 SdCdnVal = 0U;
 static u32 SdCdnReg = 0U;
 static u32 SdDeviceNode;
+static XLoader_SdXfer SdXfer;	/* Copy in progress */
 
 /*****************************************************************************/
 /**
@@ -221,6 +242,7 @@ int XLoader_SdInit(u32 DeviceFlagsVal)
 			XLOADER_ERR_MEMSET_SD_BOOT_FILE);
 		goto END;
 	}
+	SdXfer.State = XLOADER_SD_XFER_STATE_IDLE;
 
 	if ((XLoader_IsPdiSrcSD0(PdiSrc) == (u8)TRUE) ||
 		(PdiSrc == XLOADER_PDI_SRC_EMMC0)) {
@@ -302,16 +324,14 @@ END:
 
 /*****************************************************************************/
 /**
- * @brief	This function is used to copy the data from SD/eMMC to
- * destination address.
+ * @brief	This function is used to read the data from the boot file to
+ * destination address in blocking mode.
  *
- * @param	SrcAddr is the address of the SD flash where copy should
+ * @param	SrcAddr is the offset in the boot file where copy should
  *			start from
  * @param 	DestAddr is the address of the destination where it
  * 			should copy to
  * @param	Len of the bytes to be copied
- * @param	Flags are unused and only passed to maintain compatibility without
- *			the copy functions of other boot modes
  *
  * @return
  * 			- XST_SUCCESS on success.
@@ -320,7 +340,7 @@ END:
  * 			- XLOADER_ERR_DMA_XFER if DMA transfer fails.
  *
  *****************************************************************************/
-int XLoader_SdCopy(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
+static int XLoader_SdRead(u64 SrcAddr, u64 DestAddr, u32 Len)
 {
 	int Status = XST_FAILURE;
 	FRESULT Rc; /* Result code */
@@ -329,11 +349,6 @@ int XLoader_SdCopy(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
 	u64 DestOffset = 0U;
 	u32 Length = Len;
 
-	if (Flags == XPLMI_DEVICE_COPY_STATE_INITIATE) {
-		Status = XST_SUCCESS;
-		goto END;
-	}
-
 	/** - Verify whether you can access the source address. */
 	Rc = f_lseek(&FFil, (FSIZE_t)SrcAddr);
 	if (Rc != FR_OK) {
@@ -395,6 +410,279 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function finds the first sector of the boot file data at
+ * 			SrcAddr and the number of bytes from there that are stored in
+ * 			physically contiguous clusters.
+ *
+ * @param	SrcAddr is the sector aligned offset in the boot file
+ * @param	Len is the maximum number of bytes of interest
+ * @param	Sector is pointer to the variable where the first sector is
+ *			stored
+ * @param	ContigLen is pointer to the variable where the contiguous
+ *			length rounded down to whole sectors is stored
+ *
+ * @return
+ * 			- XST_SUCCESS on success.
+ * 			- XLOADER_ERR_SC_F_LSEEK on f_seek fail.
+ *
+ *****************************************************************************/
+static int XLoader_SdGetContigSectors(u64 SrcAddr, u32 Len, LBA_t *Sector,
+	u32 *ContigLen)
+{
+	int Status = XST_FAILURE;
+	FRESULT Rc;
+	const FATFS *Fs = FFil.obj.fs;
+	u32 ClusterSize = (u32)Fs->csize * XLOADER_SD_RAW_BLK_SIZE;
+	FSIZE_t FileSize = FFil.obj.objsize;
+	FSIZE_t Offset;
+	DWORD Cluster;
+	u32 RunLen;
+
+	/**
+	 * - Seek to the end of the cluster holding SrcAddr. After a seek to a
+	 * sector aligned offset FatFs points to the cluster holding the
+	 * previous byte without reading any data sector.
+	 */
+	Offset = (((FSIZE_t)SrcAddr / ClusterSize) + 1U) * ClusterSize;
+	if (Offset > FileSize) {
+		Offset = FileSize;
+	}
+	Rc = f_lseek(&FFil, Offset);
+	if (Rc != FR_OK) {
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_SD_F_LSEEK, (int)Rc);
+		goto END;
+	}
+	Cluster = FFil.clust;
+	*Sector = Fs->database + ((LBA_t)(Cluster - 2U) * Fs->csize) +
+		(LBA_t)(((u32)SrcAddr % ClusterSize) / XLOADER_SD_RAW_BLK_SIZE);
+	RunLen = ClusterSize - ((u32)SrcAddr % ClusterSize);
+
+	/**
+	 * - Follow the cluster chain while the clusters are consecutive.
+	 */
+	while ((RunLen < Len) && (Offset < FileSize)) {
+		Offset += ClusterSize;
+		if (Offset > FileSize) {
+			Offset = FileSize;
+		}
+		Rc = f_lseek(&FFil, Offset);
+		if (Rc != FR_OK) {
+			Status = XPlmi_UpdateStatus(XLOADER_ERR_SD_F_LSEEK, (int)Rc);
+			goto END;
+		}
+		if (FFil.clust != (Cluster + 1U)) {
+			break;
+		}
+		Cluster = FFil.clust;
+		RunLen += ClusterSize;
+	}
+
+	if (RunLen > Len) {
+		RunLen = Len;
+	}
+	*ContigLen = RunLen & ~(XLOADER_SD_RAW_BLK_SIZE - 1U);
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function starts the copy of the data from SD/eMMC to
+ * 			destination address and returns without waiting for it to
+ * 			complete. The leading part of the copy up to a sector boundary is
+ * 			read in blocking mode and the contiguous clusters following it
+ * 			are read by ADMA2 in the background. Whatever remains is read in
+ * 			XLoader_SdWaitForXfer.
+ *
+ * @param	SrcAddr is the offset in the boot file where copy should
+ *			start from
+ * @param 	DestAddr is the address of the destination where it
+ * 			should copy to
+ * @param	Len of the bytes to be copied
+ *
+ * @return
+ * 			- XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_SdStartXfer(u64 SrcAddr, u64 DestAddr, u32 Len)
+{
+	int Status = XST_FAILURE;
+	DRESULT Res;
+	u32 HeadLen;
+	LBA_t Sector = 0U;
+	u32 ContigLen = 0U;
+
+	SdXfer.SrcAddr = SrcAddr;
+	SdXfer.DestAddr = DestAddr;
+	SdXfer.Len = Len;
+	SdXfer.DmaLen = 0U;
+	SdXfer.State = XLOADER_SD_XFER_STATE_DEFERRED;
+
+	/**
+	 * - Defer the complete copy to XLoader_SdWaitForXfer if destination
+	 * cannot be written by ADMA2 directly.
+	 */
+	if (((DestAddr >> 32U) != 0U) ||
+		((DestAddr & (XPLMI_WORD_LEN - 1U)) != 0U)) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	/**
+	 * - Read the leading bytes up to the next sector boundary.
+	 */
+	HeadLen = (u32)(SrcAddr & (XLOADER_SD_RAW_BLK_SIZE - 1U));
+	if (HeadLen != 0U) {
+		HeadLen = XLOADER_SD_RAW_BLK_SIZE - HeadLen;
+		if (HeadLen > Len) {
+			HeadLen = Len;
+		}
+		Status = XLoader_SdRead(SrcAddr, DestAddr, HeadLen);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		SdXfer.SrcAddr += HeadLen;
+		SdXfer.DestAddr += HeadLen;
+		SdXfer.Len -= HeadLen;
+	}
+
+	if (SdXfer.Len >= XLOADER_SD_RAW_BLK_SIZE) {
+		Status = XLoader_SdGetContigSectors(SdXfer.SrcAddr, SdXfer.Len,
+			&Sector, &ContigLen);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+	if (ContigLen == 0U) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	/**
+	 * - Start ADMA2 transfer of the contiguous sectors.
+	 */
+	Res = disk_read_start(FFil.obj.fs->pdrv,
+		(BYTE *)(UINTPTR)SdXfer.DestAddr, Sector,
+		(UINT)(ContigLen / XLOADER_SD_RAW_BLK_SIZE));
+	if (Res != RES_OK) {
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_SD_F_READ, (int)Res);
+		goto END;
+	}
+	SdXfer.DmaLen = ContigLen;
+	SdXfer.State = XLOADER_SD_XFER_STATE_STARTED;
+	Status = XST_SUCCESS;
+
+END:
+	if (Status != XST_SUCCESS) {
+		SdXfer.State = XLOADER_SD_XFER_STATE_IDLE;
+	}
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function waits for the copy started by XLoader_SdStartXfer
+ * 			to complete and reads the remaining data in blocking mode.
+ *
+ * @return
+ * 			- XST_SUCCESS on success.
+ * 			- XLOADER_ERR_SD_F_READ if reading from SD card fails.
+ *
+ *****************************************************************************/
+static int XLoader_SdWaitForXfer(void)
+{
+	int Status = XST_FAILURE;
+	DRESULT Res;
+
+	if (SdXfer.State == XLOADER_SD_XFER_STATE_IDLE) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	if (SdXfer.State == XLOADER_SD_XFER_STATE_STARTED) {
+		do {
+			Res = disk_read_status(FFil.obj.fs->pdrv);
+		} while (Res == RES_NOTRDY);
+		if (Res != RES_OK) {
+			Status = XPlmi_UpdateStatus(XLOADER_ERR_SD_F_READ, (int)Res);
+			XLoader_Printf(DEBUG_INFO, "XLOADER_ERR_SD_F_READ\n\r");
+			goto END;
+		}
+		SdXfer.SrcAddr += SdXfer.DmaLen;
+		SdXfer.DestAddr += SdXfer.DmaLen;
+		SdXfer.Len -= SdXfer.DmaLen;
+	}
+
+	/**
+	 * - Read the data after a cluster discontinuity or the trailing
+	 * partial sector.
+	 */
+	if (SdXfer.Len != 0U) {
+		Status = XLoader_SdRead(SdXfer.SrcAddr, SdXfer.DestAddr,
+			SdXfer.Len);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+	Status = XST_SUCCESS;
+
+END:
+	SdXfer.State = XLOADER_SD_XFER_STATE_IDLE;
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function is used to copy the data from SD/eMMC to
+ * destination address.
+ *
+ * @param	SrcAddr is the address of the SD flash where copy should
+ *			start from
+ * @param 	DestAddr is the address of the destination where it
+ * 			should copy to
+ * @param	Len of the bytes to be copied
+ * @param	Flags denote the blocking / non-blocking nature of copy. With
+ *			XPLMI_DEVICE_COPY_STATE_INITIATE the copy is started and the
+ *			function returns, XPLMI_DEVICE_COPY_STATE_WAIT_DONE completes
+ *			the copy started earlier irrespective of the other arguments.
+ *
+ * @return
+ * 			- XST_SUCCESS on success.
+ * 			- XLOADER_ERR_SC_F_LSEEK on f_seek fail.
+ * 			- XLOADER_ERR_SD_F_READ if reading from SD card fails.
+ * 			- XLOADER_ERR_DMA_XFER if DMA transfer fails.
+ *
+ *****************************************************************************/
+int XLoader_SdCopy(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
+{
+	int Status = XST_FAILURE;
+	u32 CopyFlags = Flags & XPLMI_DEVICE_COPY_STATE_MASK;
+
+	/**
+	 * - Complete the copy in progress. FatFs and the SD controller cannot
+	 * be used for anything else until it is done.
+	 */
+	Status = XLoader_SdWaitForXfer();
+	if ((Status != XST_SUCCESS) ||
+		(CopyFlags == XPLMI_DEVICE_COPY_STATE_WAIT_DONE)) {
+		goto END;
+	}
+
+	if (CopyFlags == XPLMI_DEVICE_COPY_STATE_INITIATE) {
+		Status = XLoader_SdStartXfer(SrcAddr, DestAddr, Len);
+	}
+	else {
+		Status = XLoader_SdRead(SrcAddr, DestAddr, Len);
+	}
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function is used to close the boot file and unmount the
@@ -414,6 +702,9 @@ END:
 	int PmStatus = XST_FAILURE;
 	FRESULT Rc;
 
+	/** - Complete any copy in progress. */
+	(void)XLoader_SdWaitForXfer();
+
 	/** - Close PDI file. */
 	Rc = f_close(&FFil);
 	if (Rc != FR_OK) {
@@ -281,6 +281,13 @@ proc xgen_opts_file {libhandle} {
 		puts $file_handle "#define PLM_PRINT_NO_UART"
 	}
 
+	# Get plm_uart_buffered_en value set by user, by default it is FALSE
+	set value [common::get_property CONFIG.plm_uart_buffered_en $libhandle]
+	if {$value == true} {
+		puts $file_handle "\n/* Send debug prints to UART from the log buffer when idle */"
+		puts $file_handle "#define PLM_PRINT_BUFFERED"
+	}
+
 	# Get plm_dbg_lvl value set by user, by default it is general
 	set value [common::get_property CONFIG.plm_dbg_lvl $libhandle]
 	set sem_print_flag [common::get_property CONFIG.sem_override_dbg_lvl $libhandle]
@@ -0,0 +1,48 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file mb_interface.h
+*
+* Host replacement of the MicroBlaze processor interface. Extended address
+* loads and stores go to the mock register backend, processor control is a
+* no-op.
+*
+******************************************************************************/
+
+#ifndef _MICROBLAZE_INTERFACE_H_
+#define _MICROBLAZE_INTERFACE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+
+/************************** Function Prototypes ******************************/
+u32 XReplay_RegRead(UINTPTR Addr, u32 Size);
+void XReplay_RegWrite(UINTPTR Addr, u32 Value, u32 Size);
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define lwea(Addr)		XReplay_RegRead((UINTPTR)(Addr), 4U)
+#define lbuea(Addr)		XReplay_RegRead((UINTPTR)(Addr), 1U)
+#define swea(Addr, Value)	XReplay_RegWrite((UINTPTR)(Addr), (Value), 4U)
+#define sbea(Addr, Value)	XReplay_RegWrite((UINTPTR)(Addr), (Value), 1U)
+
+#define microblaze_enable_interrupts()
+#define microblaze_disable_interrupts()
+#define microblaze_enable_exceptions()
+#define microblaze_disable_exceptions()
+#define mfmsr()			(0U)
+#define mtmsr(Value)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MICROBLAZE_INTERFACE_H_ */
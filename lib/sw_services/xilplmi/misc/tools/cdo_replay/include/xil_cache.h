@@ -0,0 +1,42 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_cache.h
+*
+* Host replacement of the cache maintenance functions. The host is coherent,
+* so all operations are no-ops.
+*
+******************************************************************************/
+
+#ifndef XIL_CACHE_H
+#define XIL_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define Xil_DCacheEnable()
+#define Xil_DCacheDisable()
+#define Xil_DCacheInvalidate()
+#define Xil_DCacheInvalidateRange(Addr, Len)	((void)(Addr), (void)(Len))
+#define Xil_DCacheFlush()
+#define Xil_DCacheFlushRange(Addr, Len)		((void)(Addr), (void)(Len))
+#define Xil_ICacheEnable()
+#define Xil_ICacheDisable()
+#define Xil_ICacheInvalidate()
+#define Xil_ICacheInvalidateRange(Addr, Len)	((void)(Addr), (void)(Len))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_CACHE_H */
@@ -0,0 +1,123 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_io.h
+*
+* Host replacement of the standalone BSP register access functions. Every
+* access is routed to the mock register backend of the CDO replay harness.
+*
+******************************************************************************/
+
+#ifndef XIL_IO_H
+#define XIL_IO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+#include "xil_printf.h"
+#include "xstatus.h"
+#include "mb_interface.h"
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define INLINE inline
+
+static INLINE u8 Xil_In8(UINTPTR Addr)
+{
+	return (u8)XReplay_RegRead(Addr, 1U);
+}
+
+static INLINE u16 Xil_In16(UINTPTR Addr)
+{
+	return (u16)XReplay_RegRead(Addr, 2U);
+}
+
+static INLINE u32 Xil_In32(UINTPTR Addr)
+{
+	return XReplay_RegRead(Addr, 4U);
+}
+
+static INLINE u64 Xil_In64(UINTPTR Addr)
+{
+	return (u64)XReplay_RegRead(Addr, 4U) |
+		((u64)XReplay_RegRead(Addr + 4U, 4U) << 32U);
+}
+
+static INLINE void Xil_Out8(UINTPTR Addr, u8 Value)
+{
+	XReplay_RegWrite(Addr, Value, 1U);
+}
+
+static INLINE void Xil_Out16(UINTPTR Addr, u16 Value)
+{
+	XReplay_RegWrite(Addr, Value, 2U);
+}
+
+static INLINE void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	XReplay_RegWrite(Addr, Value, 4U);
+}
+
+static INLINE void Xil_Out64(UINTPTR Addr, u64 Value)
+{
+	XReplay_RegWrite(Addr, (u32)Value, 4U);
+	XReplay_RegWrite(Addr + 4U, (u32)(Value >> 32U), 4U);
+}
+
+static INLINE int Xil_SecureOut32(UINTPTR Addr, u32 Value)
+{
+	XReplay_RegWrite(Addr, Value, 4U);
+	return XST_SUCCESS;
+}
+
+static INLINE u16 Xil_EndianSwap16(u16 Data)
+{
+	return (u16)(((Data & 0xFF00U) >> 8U) | ((Data & 0x00FFU) << 8U));
+}
+
+static INLINE u32 Xil_EndianSwap32(u32 Data)
+{
+	return __builtin_bswap32(Data);
+}
+
+#define Xil_In16LE	Xil_In16
+#define Xil_In32LE	Xil_In32
+#define Xil_Out16LE	Xil_Out16
+#define Xil_Out32LE	Xil_Out32
+#define Xil_Htons	Xil_EndianSwap16
+#define Xil_Htonl	Xil_EndianSwap32
+#define Xil_Ntohs	Xil_EndianSwap16
+#define Xil_Ntohl	Xil_EndianSwap32
+
+static INLINE u16 Xil_In16BE(UINTPTR Addr)
+{
+	return Xil_EndianSwap16(Xil_In16(Addr));
+}
+
+static INLINE u32 Xil_In32BE(UINTPTR Addr)
+{
+	return Xil_EndianSwap32(Xil_In32(Addr));
+}
+
+static INLINE void Xil_Out16BE(UINTPTR Addr, u16 Value)
+{
+	Xil_Out16(Addr, Xil_EndianSwap16(Value));
+}
+
+static INLINE void Xil_Out32BE(UINTPTR Addr, u32 Value)
+{
+	Xil_Out32(Addr, Xil_EndianSwap32(Value));
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_IO_H */
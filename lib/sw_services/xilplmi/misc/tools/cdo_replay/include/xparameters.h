@@ -0,0 +1,19 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+* Host replacement of the generated xparameters.h for the CDO replay harness.
+* Only the parameters referenced by the replayed xilplmi sources are defined.
+*/
+
+#ifndef XPARAMETERS_H
+#define XPARAMETERS_H
+
+#define XPAR_MAX_USER_MODULES			(0U)
+#define XPAR_IOMODULE_INTC_MAX_INTR_SIZE	(32U)
+#define XPAR_XCSUDMA_NUM_INSTANCES		(2U)
+#define XPAR_XSYSMONPSV_0_NO_MEAS		(0U)
+
+#endif /* XPARAMETERS_H */
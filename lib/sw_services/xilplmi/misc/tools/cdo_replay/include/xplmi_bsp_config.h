@@ -0,0 +1,19 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+* Host replacement of the generated xplmi_bsp_config.h for the CDO replay
+* harness. Prints are enabled so that errors reported by the replayed sources
+* are visible.
+*/
+
+#ifndef XPLMI_BSP_CONFIG_H
+#define XPLMI_BSP_CONFIG_H
+
+#include "xparameters.h"
+
+#define PLM_PRINT
+
+#endif /* XPLMI_BSP_CONFIG_H */
@@ -0,0 +1,18 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+* Host replacement of the generated sysmon supply list, no supplies enabled.
+*/
+
+#ifndef XSYSMONPSV_SUPPLYLIST
+#define XSYSMONPSV_SUPPLYLIST
+
+typedef enum {
+	EndList,
+	NO_SUPPLIES_CONFIGURED = XPAR_XSYSMONPSV_0_NO_MEAS,
+} XSysMonPsv_Supply;
+
+#endif
@@ -0,0 +1,709 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xplmi_replay.c
+*
+* Host replay harness for CDO and PDI files. The harness runs the CDO parser
+* and the generic module of the PLM (xplmi_cdo.c, xplmi_cmd.c,
+* xplmi_generic.c and xplmi_modules.c) on the host, against the mock backend
+* in xplmi_replay_mock.c, and reports how the CDO is processed:
+* commands per module and API, chunks, resumes and copied commands at chunk
+* boundaries, register, DMA and boot device traffic and host time per
+* command. The counters do not depend on the host and can be compared
+* between two builds of the PLM sources, e.g. before and after a change to
+* the CDO parser.
+*
+* Usage: xplmi_replay [-b qspi|sdfs|sdraw] [-n iterations]
+*                     [-r addr=value]... [-v] <file.cdo|file.pdi|file.bin>
+*
+*  -b  Boot device whose chunk handling is replayed. qspi (default) uses
+*      32KB chunks and copies keyhole and DMA write payloads directly from
+*      the device, sdfs uses 32KB chunks without direct copies and sdraw
+*      64KB chunks.
+*  -n  Number of times the file is replayed, times are averaged.
+*  -r  Presets a register before each replay, e.g. a status register the
+*      CDO reads back.
+*  -v  Prints every processed partition.
+*
+* A raw CDO is processed as one partition. For a boot PDI the PMC CDO is
+* processed first, followed by the partitions of all images. A partial PDI
+* is processed starting from its first image. CDO partitions are split into
+* chunks as in XLoader_ProcessCdo for non-secure partitions; encrypted,
+* authenticated and checksummed partitions are skipped.
+*
+* Mask polls pass at once, delays are accumulated and commands of modules
+* other than the generic module are accepted without being executed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ag   10/18/2026 Initial release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include "xplmi_replay.h"
+#include "xplmi.h"
+#include "xplmi_hw.h"
+#include "xplmi_cdo.h"
+#include "xplmi_modules.h"
+#include "xilpdi.h"
+
+/************************** Constant Definitions *****************************/
+#define XREPLAY_PMCRAM_PAGE_LEN		(XPLMI_PMCRAM_LEN)
+#define XREPLAY_PSMRAM_BASEADDR		(0xFFC00000U)
+#define XREPLAY_PSMRAM_LEN		(0x40000U)
+#define XREPLAY_SUBSYS_PMC		(0x1C000001U) /**< PM_SUBSYS_PMC */
+#define XREPLAY_CHUNK_SIZE		(0x10000U) /**< XLOADER_CHUNK_SIZE */
+#define XREPLAY_SECURE_CHUNK_SIZE	(0x8000U) /**< XLOADER_SECURE_CHUNK_SIZE */
+#define XREPLAY_MAX_REG_PRESETS		(64U)
+#define XREPLAY_MAX_FILE_SIZE		(0x40000000U)
+
+/**************************** Type Definitions *******************************/
+typedef enum {
+	XREPLAY_DEV_QSPI = 0,	/**< Direct payload copies, 32KB chunks */
+	XREPLAY_DEV_SD_FS,	/**< No direct payload copies, 32KB chunks */
+	XREPLAY_DEV_SD_RAW,	/**< No direct payload copies, 64KB chunks */
+} XReplay_BootDev;
+
+typedef struct {
+	UINTPTR Addr;
+	u32 Value;
+} XReplay_RegPreset;
+
+typedef struct {
+	XReplay_BootDev BootDev;
+	u32 Iterations;
+	XReplay_RegPreset Presets[XREPLAY_MAX_REG_PRESETS];
+	u32 PresetCount;
+	const u8 *Image;
+	u32 ImageSize;
+	u32 Partitions;
+	u32 Skipped;
+	u8 Verbose;
+} XReplay_Ctx;
+
+typedef struct {
+	u32 ModuleId;
+	u32 ApiId;
+	const XReplay_ApiStats *Stats;
+} XReplay_ApiRow;
+
+/************************** Function Prototypes ******************************/
+static int XReplay_ProcessChunks(XReplay_Ctx *Ctx, u32 SubsystemId,
+	u32 PartitionOffset, u64 SrcAddr, u32 Len);
+static int XReplay_ProcessPmcCdo(XReplay_Ctx *Ctx);
+static int XReplay_ProcessPdi(XReplay_Ctx *Ctx, u64 FlashOfstAddr,
+	u32 MetaHdrOfst, u32 ImageNum, u32 PrtnNum);
+static int XReplay_Run(XReplay_Ctx *Ctx);
+static void XReplay_Report(const XReplay_Ctx *Ctx);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+ * @brief	This function reads a word of the replayed image.
+ *
+ * @param	Ctx is the harness context
+ * @param	Offset is the byte offset of the word
+ *
+ * @return	Word read, zero beyond the end of the image
+ *
+ *****************************************************************************/
+static u32 XReplay_ImageWord(const XReplay_Ctx *Ctx, u64 Offset)
+{
+	u32 Value = 0U;
+
+	if ((Offset + XPLMI_WORD_LEN) <= Ctx->ImageSize) {
+		(void)memcpy(&Value, &Ctx->Image[Offset], XPLMI_WORD_LEN);
+	}
+
+	return Value;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function processes a non-secure CDO partition chunk by
+ * 			chunk, the same way XLoader_ProcessCdo does: the next chunk is
+ * 			copied while the current one is processed and, depending on
+ * 			the boot device, command payloads are copied directly from
+ * 			the device, in which case the following chunk is adjusted by
+ * 			the words consumed by the command.
+ *
+ * @param	Ctx is the harness context
+ * @param	SubsystemId is the subsystem the commands belong to
+ * @param	PartitionOffset is the word offset of the partition in the PDI
+ * @param	SrcAddr is the byte offset of the partition in the image
+ * @param	Len is the length of the partition in bytes
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XReplay_ProcessChunks(XReplay_Ctx *Ctx, u32 SubsystemId,
+	u32 PartitionOffset, u64 SrcAddr, u32 Len)
+{
+	int Status = XST_FAILURE;
+	u32 ChunkLen = XREPLAY_SECURE_CHUNK_SIZE;
+	u32 ChunkAddr = XPLMI_PMCRAM_CHUNK_MEMORY;
+	u8 LastChunk = (u8)FALSE;
+	u32 Flags;
+	u64 StartNs;
+	XPlmiCdo Cdo;
+
+	Status = XPlmi_InitCdo(&Cdo);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Cdo.NextChunkAddr = XPLMI_PMCRAM_CHUNK_MEMORY;
+	Cdo.SubsystemId = SubsystemId;
+	Cdo.PartitionOffset = PartitionOffset;
+	if (Ctx->BootDev == XREPLAY_DEV_SD_RAW) {
+		ChunkLen = XREPLAY_CHUNK_SIZE;
+	}
+	else if (Ctx->BootDev == XREPLAY_DEV_QSPI) {
+		Cdo.Cmd.KeyHoleParams.Func = XReplay_DeviceCopy;
+	}
+	else {
+		/* SD FS boot overlaps the copy but does not copy directly */
+	}
+
+	while (Len > 0U) {
+		if (Len <= ChunkLen) {
+			LastChunk = (u8)TRUE;
+			ChunkLen = Len;
+		}
+
+		if (Cdo.Cmd.KeyHoleParams.IsNextChunkCopyStarted == (u8)TRUE) {
+			Cdo.Cmd.KeyHoleParams.IsNextChunkCopyStarted = (u8)FALSE;
+			Flags = XPLMI_DEVICE_COPY_STATE_WAIT_DONE;
+		}
+		else {
+			Flags = XPLMI_DEVICE_COPY_STATE_BLK;
+		}
+		Status = XReplay_DeviceCopy(SrcAddr, ChunkAddr, ChunkLen, Flags);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		Cdo.BufPtr = (u32 *)(UINTPTR)ChunkAddr;
+		Cdo.BufLen = ChunkLen >> XPLMI_WORD_LEN_SHIFT;
+		SrcAddr += ChunkLen;
+		Len -= ChunkLen;
+		Cdo.Cmd.KeyHoleParams.SrcAddr = SrcAddr;
+		if (LastChunk != (u8)TRUE) {
+			ChunkAddr += ChunkLen;
+			if (ChunkAddr > XPLMI_PMCRAM_CHUNK_MEMORY_1) {
+				ChunkAddr = XPLMI_PMCRAM_CHUNK_MEMORY;
+			}
+			else {
+				ChunkAddr = XPLMI_PMCRAM_CHUNK_MEMORY_1;
+			}
+			if (Len <= ChunkLen) {
+				LastChunk = (u8)TRUE;
+				ChunkLen = Len;
+			}
+			Cdo.Cmd.KeyHoleParams.IsNextChunkCopyStarted = (u8)TRUE;
+			Cdo.NextChunkAddr = ChunkAddr;
+			Status = XReplay_DeviceCopy(SrcAddr, ChunkAddr, ChunkLen,
+				XPLMI_DEVICE_COPY_STATE_INITIATE);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+		}
+
+		if (Cdo.CmdState == XPLMI_CMD_STATE_RESUME) {
+			XReplay_Stat.CmdResumes++;
+		}
+		XReplay_Stat.Chunks++;
+		StartNs = XReplay_TimeNs();
+		Status = XPlmi_ProcessCdo(&Cdo);
+		XReplay_Stat.CdoNs += XReplay_TimeNs() - StartNs;
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		if (Cdo.CopiedCmdLen != 0U) {
+			XReplay_Stat.CopiedCmds++;
+			XReplay_Stat.CopiedCmdBytes += (u64)Cdo.CopiedCmdLen *
+				XPLMI_WORD_LEN;
+		}
+
+		if (Cdo.Cmd.KeyHoleParams.ExtraWords == 0U) {
+			continue;
+		}
+		/* Payload was copied directly from the device */
+		Cdo.Cmd.KeyHoleParams.ExtraWords <<= XPLMI_WORD_LEN_SHIFT;
+		if ((Cdo.Cmd.KeyHoleParams.IsNextChunkCopyStarted == (u8)TRUE) &&
+			(Cdo.Cmd.KeyHoleParams.ExtraWords < ChunkLen)) {
+			Len -= ChunkLen;
+			SrcAddr += ChunkLen;
+			Cdo.BufPtr = (u32 *)(UINTPTR)(ChunkAddr +
+				Cdo.Cmd.KeyHoleParams.ExtraWords);
+			Cdo.BufLen = (ChunkLen - Cdo.Cmd.KeyHoleParams.ExtraWords) >>
+				XPLMI_WORD_LEN_SHIFT;
+			Cdo.Cmd.KeyHoleParams.ExtraWords = 0U;
+			Cdo.Cmd.KeyHoleParams.SrcAddr = SrcAddr;
+			Cdo.Cmd.KeyHoleParams.IsNextChunkCopyStarted = (u8)FALSE;
+			XReplay_Stat.Chunks++;
+			StartNs = XReplay_TimeNs();
+			Status = XPlmi_ProcessCdo(&Cdo);
+			XReplay_Stat.CdoNs += XReplay_TimeNs() - StartNs;
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+			if (Cdo.Cmd.KeyHoleParams.ExtraWords != 0U) {
+				Cdo.Cmd.KeyHoleParams.ExtraWords <<= XPLMI_WORD_LEN_SHIFT;
+				Len -= Cdo.Cmd.KeyHoleParams.ExtraWords;
+				SrcAddr += Cdo.Cmd.KeyHoleParams.ExtraWords;
+				Cdo.Cmd.KeyHoleParams.ExtraWords = 0U;
+			}
+		}
+		else {
+			Len -= Cdo.Cmd.KeyHoleParams.ExtraWords;
+			SrcAddr += Cdo.Cmd.KeyHoleParams.ExtraWords;
+			Cdo.Cmd.KeyHoleParams.ExtraWords = 0U;
+			Cdo.Cmd.KeyHoleParams.IsNextChunkCopyStarted = (u8)FALSE;
+		}
+	}
+
+	if (Cdo.DeferredError == (u8)TRUE) {
+		XReplay_Stat.CmdErrors++;
+		Status = XST_FAILURE;
+	}
+
+END:
+	/* Do not leave a started copy behind for the next partition */
+	(void)XReplay_DeviceCopy(0U, 0U, 0U, XPLMI_DEVICE_COPY_STATE_WAIT_DONE);
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function processes the PMC CDO of a boot PDI. As
+ * 			XPlm_ProcessPmcCdo does, the whole CDO is processed from PMC
+ * 			RAM in one call.
+ *
+ * @param	Ctx is the harness context
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XReplay_ProcessPmcCdo(XReplay_Ctx *Ctx)
+{
+	int Status = XST_FAILURE;
+	const XilPdi_BootHdr *BootHdr = (const XilPdi_BootHdr *)
+		(const void *)&Ctx->Image[XIH_BH_IMAGE_IDENT_OFFSET - 4U];
+	u64 Offset = (u64)BootHdr->DpiSrcOfst + BootHdr->TotalPlmLen;
+	u32 Len = BootHdr->DataPrtnLen;
+	u64 StartNs;
+	XPlmiCdo Cdo;
+
+	if ((BootHdr->EncStatus != 0U) || (Len == 0U) ||
+		(Len > XREPLAY_PMCRAM_PAGE_LEN) ||
+		((Offset + Len) > Ctx->ImageSize) ||
+		(XReplay_ImageWord(Ctx, Offset + XPLMI_WORD_LEN) !=
+		XPLMI_CDO_HDR_IDN_WRD)) {
+		if (Ctx->Verbose == (u8)TRUE) {
+			printf("PMC CDO: skipped\n");
+		}
+		Ctx->Skipped++;
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	(void)memcpy((void *)(UINTPTR)XPLMI_PMCRAM_BASEADDR, &Ctx->Image[Offset],
+		Len);
+	Status = XPlmi_InitCdo(&Cdo);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Cdo.BufPtr = (u32 *)(UINTPTR)XPLMI_PMCRAM_BASEADDR;
+	Cdo.BufLen = Len >> XPLMI_WORD_LEN_SHIFT;
+	Cdo.SubsystemId = XREPLAY_SUBSYS_PMC;
+	XReplay_Stat.Chunks++;
+	StartNs = XReplay_TimeNs();
+	Status = XPlmi_ProcessCdo(&Cdo);
+	XReplay_Stat.CdoNs += XReplay_TimeNs() - StartNs;
+	Ctx->Partitions++;
+	if (Ctx->Verbose == (u8)TRUE) {
+		printf("PMC CDO: 0x%x bytes, status 0x%x\n", Len, (u32)Status);
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function processes the CDO partitions of all images in a
+ * 			PDI, starting from the given image and partition.
+ *
+ * @param	Ctx is the harness context
+ * @param	FlashOfstAddr is the offset of the PDI in the image
+ * @param	MetaHdrOfst is the offset of the image header table in the PDI
+ * @param	ImageNum is the first image to process
+ * @param	PrtnNum is the first partition of that image
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XReplay_ProcessPdi(XReplay_Ctx *Ctx, u64 FlashOfstAddr,
+	u32 MetaHdrOfst, u32 ImageNum, u32 PrtnNum)
+{
+	int Status = XST_SUCCESS;
+	XilPdi_ImgHdrTbl Iht;
+	XilPdi_ImgHdr ImgHdr;
+	XilPdi_PrtnHdr PrtnHdr;
+	u64 Offset = FlashOfstAddr + MetaHdrOfst;
+	u32 Index;
+
+	if ((Offset + sizeof(Iht)) > Ctx->ImageSize) {
+		Status = XST_FAILURE;
+		goto END;
+	}
+	(void)memcpy(&Iht, &Ctx->Image[Offset], sizeof(Iht));
+
+	for (; ImageNum < Iht.NoOfImgs; ImageNum++) {
+		Offset = FlashOfstAddr + ((u64)Iht.ImgHdrAddr * XPLMI_WORD_LEN) +
+			((u64)ImageNum * XIH_IH_LEN);
+		if ((Offset + sizeof(ImgHdr)) > Ctx->ImageSize) {
+			Status = XST_FAILURE;
+			goto END;
+		}
+		(void)memcpy(&ImgHdr, &Ctx->Image[Offset], sizeof(ImgHdr));
+
+		for (Index = 0U; Index < ImgHdr.NoOfPrtns; Index++, PrtnNum++) {
+			Offset = FlashOfstAddr + ((u64)Iht.PrtnHdrAddr *
+				XPLMI_WORD_LEN) + ((u64)PrtnNum * XIH_PH_LEN);
+			if ((Offset + sizeof(PrtnHdr)) > Ctx->ImageSize) {
+				Status = XST_FAILURE;
+				goto END;
+			}
+			(void)memcpy(&PrtnHdr, &Ctx->Image[Offset], sizeof(PrtnHdr));
+
+			if ((PrtnHdr.PrtnAttrb & XIH_PH_ATTRB_PRTN_TYPE_MASK) !=
+				XIH_PH_ATTRB_PRTN_TYPE_CDO) {
+				continue;
+			}
+			if ((PrtnHdr.EncStatus != 0U) ||
+				(PrtnHdr.AuthCertificateOfst != 0U) ||
+				((PrtnHdr.PrtnAttrb & XIH_PH_ATTRB_CHECKSUM_MASK) != 0U)) {
+				if (Ctx->Verbose == (u8)TRUE) {
+					printf("Image 0x%08x partition %u: secure, "
+						"skipped\n", ImgHdr.ImgID, PrtnNum);
+				}
+				Ctx->Skipped++;
+				continue;
+			}
+
+			Offset = FlashOfstAddr + ((u64)PrtnHdr.DataWordOfst *
+				XPLMI_WORD_LEN);
+			Status = XReplay_ProcessChunks(Ctx, ImgHdr.ImgID,
+				PrtnHdr.DataWordOfst, Offset, PrtnHdr.TotalDataWordLen *
+				XPLMI_WORD_LEN);
+			Ctx->Partitions++;
+			if (Ctx->Verbose == (u8)TRUE) {
+				printf("Image 0x%08x partition %u: 0x%x bytes, "
+					"status 0x%x\n", ImgHdr.ImgID, PrtnNum,
+					PrtnHdr.TotalDataWordLen * XPLMI_WORD_LEN,
+					(u32)Status);
+			}
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+		}
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function replays the image once, from the same register
+ * 			state every time.
+ *
+ * @param	Ctx is the harness context
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XReplay_Run(XReplay_Ctx *Ctx)
+{
+	int Status = XST_FAILURE;
+	u32 Index;
+
+	XReplay_Reset();
+	for (Index = 0U; Index < Ctx->PresetCount; Index++) {
+		XReplay_SetReg(Ctx->Presets[Index].Addr, Ctx->Presets[Index].Value);
+	}
+	XReplay_SetDevice(Ctx->Image, Ctx->ImageSize);
+
+	if (XReplay_ImageWord(Ctx, XIH_BH_IMAGE_IDENT_OFFSET) ==
+		XIH_BH_IMAGE_IDENT) {
+		/* Boot PDI, image 0 holds the PLM and the PMC CDO */
+		Status = XReplay_ProcessPmcCdo(Ctx);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		Status = XReplay_ProcessPdi(Ctx, 0U,
+			XReplay_ImageWord(Ctx, XIH_BH_META_HDR_OFFSET), 1U, 1U);
+	}
+	else if (XReplay_ImageWord(Ctx, XPLMI_WORD_LEN) ==
+		XPLMI_CDO_HDR_IDN_WRD) {
+		Status = XReplay_ProcessChunks(Ctx, XREPLAY_SUBSYS_PMC, 0U, 0U,
+			Ctx->ImageSize & ~XPLMI_WORD_LEN_MASK);
+		Ctx->Partitions++;
+		if (Ctx->Verbose == (u8)TRUE) {
+			printf("CDO: 0x%x bytes, status 0x%x\n", Ctx->ImageSize,
+				(u32)Status);
+		}
+	}
+	else if ((XReplay_ImageWord(Ctx, XIH_IHT_IDENT_STRING_OFFSET) ==
+		XIH_IHT_PPDI_IDENT_VAL) || (XReplay_ImageWord(Ctx,
+		XIH_IHT_IDENT_STRING_OFFSET) == XIH_IHT_FPDI_IDENT_VAL)) {
+		Status = XReplay_ProcessPdi(Ctx, 0U, 0U, 0U, 0U);
+	}
+	else {
+		(void)fprintf(stderr, "Unknown file format\n");
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function orders the per API rows by total time.
+ *
+ * @param	A is the first row
+ * @param	B is the second row
+ *
+ * @return	Sort order as expected by qsort
+ *
+ *****************************************************************************/
+static int XReplay_CompareApi(const void *A, const void *B)
+{
+	const XReplay_ApiRow *RowA = (const XReplay_ApiRow *)A;
+	const XReplay_ApiRow *RowB = (const XReplay_ApiRow *)B;
+
+	if (RowA->Stats->TotalNs != RowB->Stats->TotalNs) {
+		return (RowA->Stats->TotalNs < RowB->Stats->TotalNs) ? 1 : -1;
+	}
+
+	return (int)((RowA->ModuleId << 8U) | RowA->ApiId) -
+		(int)((RowB->ModuleId << 8U) | RowB->ApiId);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function prints the replay statistics. Counters are per
+ * 			replay, times are averaged over all iterations.
+ *
+ * @param	Ctx is the harness context
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XReplay_Report(const XReplay_Ctx *Ctx)
+{
+	static XReplay_ApiRow Rows[XREPLAY_MAX_MODULES * XREPLAY_MAX_APIS];
+	const XReplay_Stats *Stat = &XReplay_Stat;
+	u64 Iter = Ctx->Iterations;
+	u32 RowCount = 0U;
+	u32 ModuleId;
+	u32 ApiId;
+	u32 Index;
+	const XReplay_ApiStats *Api;
+
+	printf("Partitions processed   : %u, skipped %u\n",
+		Ctx->Partitions / Ctx->Iterations, Ctx->Skipped / Ctx->Iterations);
+	printf("Commands               : %llu, %llu failed\n",
+		(unsigned long long)(Stat->Cmds / Iter),
+		(unsigned long long)(Stat->CmdErrors / Iter));
+	printf("Chunks                 : %llu, %llu commands resumed\n",
+		(unsigned long long)(Stat->Chunks / Iter),
+		(unsigned long long)(Stat->CmdResumes / Iter));
+	printf("Copied commands        : %llu, %llu bytes\n",
+		(unsigned long long)(Stat->CopiedCmds / Iter),
+		(unsigned long long)(Stat->CopiedCmdBytes / Iter));
+	printf("Register reads/writes  : %llu / %llu\n",
+		(unsigned long long)(Stat->RegReads / Iter),
+		(unsigned long long)(Stat->RegWrites / Iter));
+	printf("Mask polls             : %llu\n",
+		(unsigned long long)(Stat->Polls / Iter));
+	printf("Delays                 : %llu us\n",
+		(unsigned long long)(Stat->DelayUs / Iter));
+	printf("PMC DMA                : %llu transfers, %llu bytes\n",
+		(unsigned long long)(Stat->DmaXfers / Iter),
+		(unsigned long long)(Stat->DmaBytes / Iter));
+	printf("Boot device copies     : %llu, %llu bytes, %llu direct\n",
+		(unsigned long long)(Stat->DeviceCopies / Iter),
+		(unsigned long long)(Stat->DeviceBytes / Iter),
+		(unsigned long long)(Stat->DirectBytes / Iter));
+	printf("CDO processing         : %.3f ms", (double)Stat->CdoNs /
+		(double)Iter / 1e6);
+	if (Stat->CdoNs != 0U) {
+		printf(", %.0f commands/s", (double)Stat->Cmds * 1e9 /
+			(double)Stat->CdoNs);
+	}
+	printf("\n\n");
+
+	for (ModuleId = 0U; ModuleId < XREPLAY_MAX_MODULES; ModuleId++) {
+		for (ApiId = 0U; ApiId < XREPLAY_MAX_APIS; ApiId++) {
+			Api = &Stat->Api[ModuleId][ApiId];
+			if ((Api->Count == 0U) && (Api->Resumes == 0U)) {
+				continue;
+			}
+			Rows[RowCount].ModuleId = ModuleId;
+			Rows[RowCount].ApiId = ApiId;
+			Rows[RowCount].Stats = Api;
+			RowCount++;
+		}
+	}
+	qsort(Rows, RowCount, sizeof(Rows[0U]), XReplay_CompareApi);
+
+	printf("Module API      Count    Resumes   Total us     Avg ns     Max ns\n");
+	for (Index = 0U; Index < RowCount; Index++) {
+		Api = Rows[Index].Stats;
+		printf("%6u 0x%02x %10llu %10llu %10.1f %10llu %10llu\n",
+			Rows[Index].ModuleId, Rows[Index].ApiId,
+			(unsigned long long)(Api->Count / Iter),
+			(unsigned long long)(Api->Resumes / Iter),
+			(double)Api->TotalNs / (double)Iter / 1e3,
+			(unsigned long long)((Api->Count != 0U) ?
+			(Api->TotalNs / Api->Count) : 0U),
+			(unsigned long long)Api->MaxNs);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function loads the image below 4GB, maps PMC RAM and PSM
+ * 			RAM and replays the image.
+ *
+ * @return	0 on success and 1 on failure
+ *
+ *****************************************************************************/
+int main(int argc, char **argv)
+{
+	static XReplay_Ctx Ctx;
+	int Status = XST_FAILURE;
+	int Opt;
+	FILE *File;
+	long Size;
+	u8 *Image;
+	unsigned long Addr;
+	unsigned long Value;
+	char *End;
+	u32 Index;
+
+	Ctx.Iterations = 1U;
+	while ((Opt = getopt(argc, argv, "b:n:r:v")) != -1) {
+		switch (Opt) {
+		case 'b':
+			if (strcmp(optarg, "qspi") == 0) {
+				Ctx.BootDev = XREPLAY_DEV_QSPI;
+			}
+			else if (strcmp(optarg, "sdfs") == 0) {
+				Ctx.BootDev = XREPLAY_DEV_SD_FS;
+			}
+			else if (strcmp(optarg, "sdraw") == 0) {
+				Ctx.BootDev = XREPLAY_DEV_SD_RAW;
+			}
+			else {
+				goto USAGE;
+			}
+			break;
+		case 'n':
+			Ctx.Iterations = (u32)strtoul(optarg, NULL, 0);
+			if (Ctx.Iterations == 0U) {
+				goto USAGE;
+			}
+			break;
+		case 'r':
+			Addr = strtoul(optarg, &End, 0);
+			if ((*End != '=') ||
+				(Ctx.PresetCount >= XREPLAY_MAX_REG_PRESETS)) {
+				goto USAGE;
+			}
+			Value = strtoul(End + 1, NULL, 0);
+			Ctx.Presets[Ctx.PresetCount].Addr = (UINTPTR)Addr;
+			Ctx.Presets[Ctx.PresetCount].Value = (u32)Value;
+			Ctx.PresetCount++;
+			break;
+		case 'v':
+			Ctx.Verbose = (u8)TRUE;
+			break;
+		default:
+			goto USAGE;
+		}
+	}
+	if (optind != (argc - 1)) {
+		goto USAGE;
+	}
+
+	File = fopen(argv[optind], "rb");
+	if (File == NULL) {
+		perror(argv[optind]);
+		goto END;
+	}
+	(void)fseek(File, 0L, SEEK_END);
+	Size = ftell(File);
+	(void)fseek(File, 0L, SEEK_SET);
+	if ((Size <= 0L) || ((unsigned long)Size > XREPLAY_MAX_FILE_SIZE)) {
+		(void)fprintf(stderr, "%s: invalid size\n", argv[optind]);
+		(void)fclose(File);
+		goto END;
+	}
+	Image = (u8 *)XReplay_AllocLow((u32)Size);
+	if ((Image == NULL) ||
+		(fread(Image, 1U, (size_t)Size, File) != (size_t)Size)) {
+		(void)fprintf(stderr, "%s: read failed\n", argv[optind]);
+		(void)fclose(File);
+		goto END;
+	}
+	(void)fclose(File);
+	Ctx.Image = Image;
+	Ctx.ImageSize = (u32)Size;
+
+	if ((XReplay_MapRegion(XPLMI_PMCRAM_BASEADDR, XPLMI_PMCRAM_LEN) !=
+		XST_SUCCESS) || (XReplay_MapRegion(XREPLAY_PSMRAM_BASEADDR,
+		XREPLAY_PSMRAM_LEN) != XST_SUCCESS)) {
+		(void)fprintf(stderr, "Mapping PMC/PSM RAM failed\n");
+		goto END;
+	}
+	XReplay_InitModules();
+
+	for (Index = 0U; Index < Ctx.Iterations; Index++) {
+		Status = XReplay_Run(&Ctx);
+		if (Status != XST_SUCCESS) {
+			(void)fprintf(stderr, "Replay failed: 0x%x\n", (u32)Status);
+			break;
+		}
+		Ctx.Verbose = (u8)FALSE;
+	}
+	/* Report up to and including a failed replay */
+	if ((Status == XST_SUCCESS) || (Ctx.Partitions != 0U)) {
+		Ctx.Iterations = (Index < Ctx.Iterations) ? (Index + 1U) : Index;
+		XReplay_Report(&Ctx);
+	}
+	goto END;
+
+USAGE:
+	(void)fprintf(stderr, "Usage: %s [-b qspi|sdfs|sdraw] [-n iterations] "
+		"[-r addr=value]... [-v] <file>\n", argv[0]);
+END:
+	return (Status == XST_SUCCESS) ? 0 : 1;
+}
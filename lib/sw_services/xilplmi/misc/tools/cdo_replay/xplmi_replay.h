@@ -0,0 +1,95 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xplmi_replay.h
+*
+* Definitions shared by the CDO replay harness and its mock register/DMA
+* backend.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ag   10/18/2026 Initial release
+*
+* </pre>
+*
+******************************************************************************/
+
+#ifndef XPLMI_REPLAY_H
+#define XPLMI_REPLAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+#define XREPLAY_MAX_MODULES		(16U) /**< Module IDs tracked in stats */
+#define XREPLAY_MAX_APIS		(256U) /**< API IDs per module */
+#define XREPLAY_MAX_REGIONS		(4U) /**< Host backed memory regions */
+
+/**************************** Type Definitions *******************************/
+/**
+ * Statistics of one module/API ID pair. Times are host nanoseconds and
+ * include nested commands, e.g. the commands of a proc run by run_proc.
+ */
+typedef struct {
+	u64 Count;	/**< Commands started */
+	u64 Resumes;	/**< Resumes across chunk boundaries */
+	u64 TotalNs;	/**< Time spent in execute and resume handlers */
+	u64 MaxNs;	/**< Longest single execute or resume */
+} XReplay_ApiStats;
+
+/**
+ * Counters of one replay. Everything except the times is independent of
+ * the host and can be compared between runs on different machines.
+ */
+typedef struct {
+	u64 Cmds;		/**< Commands executed */
+	u64 CmdResumes;		/**< Commands resumed in the next chunk */
+	u64 CmdErrors;		/**< Failed or deferred commands */
+	u64 CopiedCmds;		/**< Commands copied in front of the next chunk */
+	u64 CopiedCmdBytes;	/**< Bytes copied for those commands */
+	u64 Chunks;		/**< Chunks given to XPlmi_ProcessCdo */
+	u64 RegReads;		/**< Register reads */
+	u64 RegWrites;		/**< Register writes */
+	u64 Polls;		/**< Mask polls, assumed to pass at once */
+	u64 DelayUs;		/**< Delays requested by the CDO */
+	u64 DmaXfers;		/**< PMC DMA transfers */
+	u64 DmaBytes;		/**< Bytes moved by PMC DMA */
+	u64 DeviceCopies;	/**< Boot device copies */
+	u64 DeviceBytes;	/**< Bytes read from the boot device */
+	u64 DirectBytes;	/**< Boot device bytes sent directly to the target */
+	u64 CdoNs;		/**< Time spent in XPlmi_ProcessCdo */
+	XReplay_ApiStats Api[XREPLAY_MAX_MODULES][XREPLAY_MAX_APIS];
+} XReplay_Stats;
+
+/************************** Function Prototypes ******************************/
+/* Functions defined in xplmi_replay_mock.c */
+int XReplay_MapRegion(UINTPTR Addr, u32 Size);
+void *XReplay_AllocLow(u32 Size);
+int XReplay_IsHostMem(u64 Addr, u32 Len);
+void XReplay_SetReg(UINTPTR Addr, u32 Value);
+void XReplay_Reset(void);
+void XReplay_SetDevice(const u8 *Image, u32 Size);
+int XReplay_DeviceCopy(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags);
+void XReplay_InitModules(void);
+u64 XReplay_TimeNs(void);
+
+/************************** Variable Definitions *****************************/
+extern XReplay_Stats XReplay_Stat;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XPLMI_REPLAY_H */
@@ -0,0 +1,819 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xplmi_replay_mock.c
+*
+* Mock register, DMA and platform backend for the CDO replay harness.
+*
+* Registers are kept in a sparse table and read back what was last written,
+* zero otherwise. PMC RAM, PSM RAM and the buffers allocated by the harness
+* are host memory mapped at addresses below 4GB, so the 32-bit address
+* arithmetic of the PLM works unchanged. DMA transfers between host memory
+* are real copies, transfers to or from register space are only counted.
+* Mask polls pass at once and delays are only accumulated.
+*
+* Per command timing is taken from the PLM hot path trace points, which the
+* harness builds with PLM_TRACE_HOT_PATH defined.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ag   10/18/2026 Initial release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+#include <sys/mman.h>
+#include "xplmi_replay.h"
+#include "xplmi.h"
+#include "xplmi_hw.h"
+#include "xplmi_dma.h"
+#include "xplmi_util.h"
+#include "xplmi_cdo.h"
+#include "xplmi_generic.h"
+#include "xplmi_modules.h"
+#include "xplmi_event_logging.h"
+#include "xplmi_ssit.h"
+#include "xplmi_sysmon.h"
+#include "xplmi_tamper.h"
+#include "xplmi_wdt.h"
+#include "xplmi_err_common.h"
+#include "xcfupmc.h"
+#include "xil_util.h"
+#include "sleep.h"
+
+/************************** Constant Definitions *****************************/
+#define XREPLAY_REG_TABLE_SIZE		(1U << 16U) /**< Register table entries */
+#define XREPLAY_TRACE_DEPTH		(8U) /**< Nesting of traced commands */
+#define XREPLAY_WORD_MASK		(~(u64)XPLMI_WORD_LEN_MASK)
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	u64 Addr;
+	u32 Value;
+	u8 Used;
+} XReplay_Reg;
+
+typedef struct {
+	UINTPTR Addr;
+	u32 Size;
+} XReplay_Region;
+
+typedef struct {
+	u32 CmdId;
+	u64 StartNs;
+} XReplay_TraceFrame;
+
+typedef struct {
+	u64 SrcAddr;
+	u64 DestAddr;
+	u32 Len;
+	u8 Pending;
+} XReplay_PendingCopy;
+
+/************************** Function Prototypes ******************************/
+static XReplay_Reg *XReplay_FindReg(u64 Addr, u8 Insert);
+static int XReplay_SinkHandler(XPlmi_Cmd *Cmd);
+static int XReplay_DoDeviceCopy(u64 SrcAddr, u64 DestAddr, u32 Len);
+
+/************************** Variable Definitions *****************************/
+XReplay_Stats XReplay_Stat;
+
+static XReplay_Reg Regs[XREPLAY_REG_TABLE_SIZE];
+static u32 RegCount;
+static XReplay_Region Regions[XREPLAY_MAX_REGIONS];
+static u32 RegionCount;
+static const u8 *DeviceImage;
+static u32 DeviceSize;
+static XReplay_PendingCopy PendingCopy;
+static XReplay_TraceFrame TraceStack[XREPLAY_TRACE_DEPTH];
+static u32 TraceTop;
+static XPlmi_BufferList PsmBufferList;
+static XPlmi_BufferData PsmBuffers[XPLMI_MAX_PSM_BUFFERS + 1U];
+static XPlmi_BufferList PmcBufferList;
+static XPlmi_BufferData PmcBuffers[XPLMI_MAX_PMC_BUFFERS + 1U];
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns a monotonic host time stamp.
+ *
+ * @return	Time in nanoseconds
+ *
+ *****************************************************************************/
+u64 XReplay_TimeNs(void)
+{
+	struct timespec Ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Ts);
+
+	return ((u64)Ts.tv_sec * 1000000000U) + (u64)Ts.tv_nsec;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function maps host memory at a fixed target address, e.g.
+ * 			PMC RAM, so the PLM can access it through its usual address.
+ *
+ * @param	Addr is the target address
+ * @param	Size is the size of the region in bytes
+ *
+ * @return	XST_SUCCESS on success and XST_FAILURE otherwise
+ *
+ *****************************************************************************/
+int XReplay_MapRegion(UINTPTR Addr, u32 Size)
+{
+	void *Ptr;
+
+	if (RegionCount >= XREPLAY_MAX_REGIONS) {
+		return XST_FAILURE;
+	}
+
+	Ptr = mmap((void *)Addr, Size, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+	if ((Ptr == MAP_FAILED) || (Ptr != (void *)Addr)) {
+		return XST_FAILURE;
+	}
+	Regions[RegionCount].Addr = Addr;
+	Regions[RegionCount].Size = Size;
+	RegionCount++;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function allocates host memory below 4GB. The PLM passes
+ * 			buffer addresses around as u32, so every buffer it may see has
+ * 			to be addressable with 32 bits.
+ *
+ * @param	Size is the size of the buffer in bytes
+ *
+ * @return	Pointer to the buffer or NULL on failure
+ *
+ *****************************************************************************/
+void *XReplay_AllocLow(u32 Size)
+{
+	void *Ptr;
+
+	if (RegionCount >= XREPLAY_MAX_REGIONS) {
+		return NULL;
+	}
+
+	Ptr = mmap(NULL, Size, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+	if (Ptr == MAP_FAILED) {
+		return NULL;
+	}
+	Regions[RegionCount].Addr = (UINTPTR)Ptr;
+	Regions[RegionCount].Size = Size;
+	RegionCount++;
+
+	return Ptr;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks if an address range is backed by host memory.
+ *
+ * @param	Addr is the start address
+ * @param	Len is the length in bytes
+ *
+ * @return	TRUE if the range is host memory and FALSE otherwise
+ *
+ *****************************************************************************/
+int XReplay_IsHostMem(u64 Addr, u32 Len)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < RegionCount; Index++) {
+		if ((Addr >= Regions[Index].Addr) &&
+			((Addr + Len) <= ((u64)Regions[Index].Addr + Regions[Index].Size))) {
+			return (int)TRUE;
+		}
+	}
+
+	return (int)FALSE;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function looks up a word aligned register in the sparse
+ * 			register table.
+ *
+ * @param	Addr is the register address
+ * @param	Insert creates the register if it does not exist
+ *
+ * @return	Pointer to the register or NULL
+ *
+ *****************************************************************************/
+static XReplay_Reg *XReplay_FindReg(u64 Addr, u8 Insert)
+{
+	u32 Index = (u32)(((Addr >> 2U) * 0x9E3779B1U) >> 16U) &
+		(XREPLAY_REG_TABLE_SIZE - 1U);
+
+	while (Regs[Index].Used == (u8)TRUE) {
+		if (Regs[Index].Addr == Addr) {
+			return &Regs[Index];
+		}
+		Index = (Index + 1U) & (XREPLAY_REG_TABLE_SIZE - 1U);
+	}
+
+	/* Keep one quarter free so the probe sequences stay short */
+	if ((Insert == (u8)FALSE) ||
+		(RegCount >= ((XREPLAY_REG_TABLE_SIZE / 4U) * 3U))) {
+		return NULL;
+	}
+	Regs[Index].Used = (u8)TRUE;
+	Regs[Index].Addr = Addr;
+	Regs[Index].Value = 0U;
+	RegCount++;
+
+	return &Regs[Index];
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function reads a register or host memory.
+ *
+ * @param	Addr is the address
+ * @param	Size is the access size in bytes, 1, 2 or 4
+ *
+ * @return	Value read
+ *
+ *****************************************************************************/
+u32 XReplay_RegRead(UINTPTR Addr, u32 Size)
+{
+	const XReplay_Reg *Reg;
+	u32 Value = 0U;
+
+	if (XReplay_IsHostMem(Addr, Size) == (int)TRUE) {
+		(void)memcpy(&Value, (const void *)Addr, Size);
+		return Value;
+	}
+
+	XReplay_Stat.RegReads++;
+	Reg = XReplay_FindReg(Addr & XREPLAY_WORD_MASK, (u8)FALSE);
+	if (Reg != NULL) {
+		Value = Reg->Value >> ((Addr & XPLMI_WORD_LEN_MASK) * 8U);
+	}
+	if (Size < XPLMI_WORD_LEN) {
+		Value &= (1U << (Size * 8U)) - 1U;
+	}
+
+	return Value;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function writes a register or host memory.
+ *
+ * @param	Addr is the address
+ * @param	Value is the value to be written
+ * @param	Size is the access size in bytes, 1, 2 or 4
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XReplay_RegWrite(UINTPTR Addr, u32 Value, u32 Size)
+{
+	XReplay_Reg *Reg;
+	u32 Shift = (u32)(Addr & XPLMI_WORD_LEN_MASK) * 8U;
+	u32 Mask = 0xFFFFFFFFU;
+
+	if (XReplay_IsHostMem(Addr, Size) == (int)TRUE) {
+		(void)memcpy((void *)Addr, &Value, Size);
+		return;
+	}
+
+	XReplay_Stat.RegWrites++;
+	Reg = XReplay_FindReg(Addr & XREPLAY_WORD_MASK, (u8)TRUE);
+	if (Reg == NULL) {
+		/* Table is full, the write is counted but not stored */
+		return;
+	}
+	if (Size < XPLMI_WORD_LEN) {
+		Mask = ((1U << (Size * 8U)) - 1U) << Shift;
+	}
+	Reg->Value = (Reg->Value & ~Mask) | ((Value << Shift) & Mask);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function presets a register without counting the access.
+ *
+ * @param	Addr is the register address
+ * @param	Value is the register value
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XReplay_SetReg(UINTPTR Addr, u32 Value)
+{
+	XReplay_Reg *Reg = XReplay_FindReg(Addr & XREPLAY_WORD_MASK, (u8)TRUE);
+
+	if (Reg != NULL) {
+		Reg->Value = Value;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function clears all registers and the stored procs, so
+ * 			every replay starts from the same state.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XReplay_Reset(void)
+{
+	(void)memset(Regs, 0, sizeof(Regs));
+	RegCount = 0U;
+	(void)memset(&PsmBufferList, 0, sizeof(PsmBufferList));
+	(void)memset(PsmBuffers, 0, sizeof(PsmBuffers));
+	(void)memset(&PmcBufferList, 0, sizeof(PmcBufferList));
+	(void)memset(PmcBuffers, 0, sizeof(PmcBuffers));
+	TraceTop = 0U;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function sets the image used as boot device.
+ *
+ * @param	Image is the image in host memory
+ * @param	Size is the size of the image in bytes
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XReplay_SetDevice(const u8 *Image, u32 Size)
+{
+	DeviceImage = Image;
+	DeviceSize = Size;
+	PendingCopy.Pending = (u8)FALSE;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function copies from the boot device. Destinations in host
+ * 			memory receive the data, other destinations are only counted.
+ * 			Copies to other destinations than PMC RAM bypass the chunk
+ * 			buffers and are counted as direct.
+ *
+ * @param	SrcAddr is the offset in the boot device
+ * @param	DestAddr is the destination address
+ * @param	Len is the length in bytes
+ *
+ * @return	XST_SUCCESS on success and XST_FAILURE otherwise
+ *
+ *****************************************************************************/
+static int XReplay_DoDeviceCopy(u64 SrcAddr, u64 DestAddr, u32 Len)
+{
+	if ((SrcAddr > DeviceSize) || (Len > (DeviceSize - SrcAddr))) {
+		return XST_FAILURE;
+	}
+
+	XReplay_Stat.DeviceCopies++;
+	XReplay_Stat.DeviceBytes += Len;
+	if ((DestAddr < XPLMI_PMCRAM_BASEADDR) ||
+		(DestAddr >= (XPLMI_PMCRAM_BASEADDR + XPLMI_PMCRAM_LEN))) {
+		XReplay_Stat.DirectBytes += Len;
+	}
+	if (XReplay_IsHostMem(DestAddr, Len) == (int)TRUE) {
+		(void)memmove((void *)(UINTPTR)DestAddr, &DeviceImage[SrcAddr], Len);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function is the device copy function of the replayed boot
+ * 			device. As on target, a copy started with
+ * 			XPLMI_DEVICE_COPY_STATE_INITIATE completes when the copy is
+ * 			waited for with XPLMI_DEVICE_COPY_STATE_WAIT_DONE, whose
+ * 			addresses are ignored.
+ *
+ * @param	SrcAddr is the offset in the boot device
+ * @param	DestAddr is the destination address
+ * @param	Len is the length in bytes
+ * @param	Flags is the device copy state and DMA flags
+ *
+ * @return	XST_SUCCESS on success and XST_FAILURE otherwise
+ *
+ *****************************************************************************/
+int XReplay_DeviceCopy(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
+{
+	int Status = XST_SUCCESS;
+	u32 State = Flags & XPLMI_DEVICE_COPY_STATE_MASK;
+
+	if (PendingCopy.Pending == (u8)TRUE) {
+		PendingCopy.Pending = (u8)FALSE;
+		Status = XReplay_DoDeviceCopy(PendingCopy.SrcAddr,
+			PendingCopy.DestAddr, PendingCopy.Len);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+
+	if (State == XPLMI_DEVICE_COPY_STATE_INITIATE) {
+		PendingCopy.SrcAddr = SrcAddr;
+		PendingCopy.DestAddr = DestAddr;
+		PendingCopy.Len = Len;
+		PendingCopy.Pending = (u8)TRUE;
+	}
+	else if (State != XPLMI_DEVICE_COPY_STATE_WAIT_DONE) {
+		Status = XReplay_DoDeviceCopy(SrcAddr, DestAddr, Len);
+	}
+	else {
+		/* Copy already completed above */
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function accepts every command of a module that is not
+ * 			part of the harness.
+ *
+ * @param	Cmd is pointer to the command structure
+ *
+ * @return	XST_SUCCESS
+ *
+ *****************************************************************************/
+static int XReplay_SinkHandler(XPlmi_Cmd *Cmd)
+{
+	(void)Cmd;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function registers the generic module and a sink module for
+ * 			every other module ID, so CDOs of PM, loader, error and other
+ * 			modules replay without their libraries.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XReplay_InitModules(void)
+{
+	static XPlmi_ModuleCmd SinkCmds[XREPLAY_MAX_APIS];
+	static XPlmi_Module SinkModules[XPLMI_MAX_MODULES];
+	u32 Index;
+
+	XPlmi_GenericInit();
+	for (Index = 0U; Index < XREPLAY_MAX_APIS; Index++) {
+		SinkCmds[Index].Handler = XReplay_SinkHandler;
+	}
+	for (Index = 0U; Index < XPLMI_MAX_MODULES; Index++) {
+		if (XPlmi_GetModule(Index) != NULL) {
+			continue;
+		}
+		SinkModules[Index].Id = Index;
+		SinkModules[Index].CmdAry = SinkCmds;
+		SinkModules[Index].CmdCnt = XREPLAY_MAX_APIS;
+		XPlmi_ModuleRegister(&SinkModules[Index]);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function receives the PLM trace records and accumulates
+ * 			the command statistics.
+ *
+ * @param	TraceData is the trace record
+ * @param	Len is the record length in words
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XPlmi_StoreTraceLog(u32 *TraceData, u32 Len)
+{
+	u32 Event = TraceData[0U] & 0xFFFFU;
+	u64 Now = XReplay_TimeNs();
+	u64 Ns;
+	u32 ModuleId;
+	u32 ApiId;
+	XReplay_ApiStats *Api;
+
+	(void)Len;
+	if ((Event == XPLMI_TRACE_LOG_CMD_START) ||
+		(Event == XPLMI_TRACE_LOG_CMD_RESUME_START)) {
+		if (Event == XPLMI_TRACE_LOG_CMD_START) {
+			XReplay_Stat.Cmds++;
+		}
+		if (TraceTop < XREPLAY_TRACE_DEPTH) {
+			TraceStack[TraceTop].CmdId = TraceData[3U];
+			TraceStack[TraceTop].StartNs = Now;
+		}
+		TraceTop++;
+	}
+	else if ((Event == XPLMI_TRACE_LOG_CMD_END) ||
+		(Event == XPLMI_TRACE_LOG_CMD_RESUME_END)) {
+		if (TraceData[4U] != (u32)XST_SUCCESS) {
+			XReplay_Stat.CmdErrors++;
+		}
+		if (TraceTop == 0U) {
+			return;
+		}
+		TraceTop--;
+		if (TraceTop >= XREPLAY_TRACE_DEPTH) {
+			return;
+		}
+		ModuleId = (TraceStack[TraceTop].CmdId & XPLMI_CMD_MODULE_ID_MASK) >>
+			XPLMI_CMD_MODULE_ID_SHIFT;
+		ApiId = TraceStack[TraceTop].CmdId & XPLMI_CMD_API_ID_MASK;
+		if (ModuleId >= XREPLAY_MAX_MODULES) {
+			return;
+		}
+		Api = &XReplay_Stat.Api[ModuleId][ApiId];
+		if (Event == XPLMI_TRACE_LOG_CMD_END) {
+			Api->Count++;
+		}
+		else {
+			Api->Resumes++;
+		}
+		Ns = Now - TraceStack[TraceTop].StartNs;
+		Api->TotalNs += Ns;
+		if (Ns > Api->MaxNs) {
+			Api->MaxNs = Ns;
+		}
+	}
+	else {
+		/* Other events are not used by the harness */
+	}
+}
+
+/*****************************************************************************/
+/*
+ * PLM services used by the replayed sources
+ */
+void XPlmi_Print(u16 DebugType, const char8 *Ctrl1, ...)
+{
+	va_list Args;
+
+	(void)DebugType;
+	va_start(Args, Ctrl1);
+	(void)vprintf(Ctrl1, Args);
+	va_end(Args);
+}
+
+void XPlmi_PrintArray(u16 DebugType, const u64 BufAddr, u32 Len,
+	const char *Str)
+{
+	(void)DebugType;
+	(void)BufAddr;
+	(void)Len;
+	(void)Str;
+}
+
+void XPlmi_LogPlmErr(int ErrStatusVal)
+{
+	XPlmi_Printf(DEBUG_GENERAL, "PLM Error Status: 0x%08x\n\r",
+		(u32)ErrStatusVal);
+}
+
+void XPlmi_SetPlmLiveStatus(void)
+{
+}
+
+u32 XPlmi_SldState(void)
+{
+	return XPLMI_SLD_NOT_TRIGGERED;
+}
+
+void XPlmi_TriggerTamperResponse(u32 Response, u32 Flag)
+{
+	(void)Response;
+	(void)Flag;
+}
+
+void XPlmi_SysMonOTDetect(u32 WaitInMSecVal)
+{
+	(void)WaitInMSecVal;
+}
+
+int XPlmi_EnableWdt(u32 NodeId, u32 Periodicity)
+{
+	(void)NodeId;
+	(void)Periodicity;
+
+	return XST_SUCCESS;
+}
+
+void XPlmi_SetMaxOutCmds(u8 Val)
+{
+	(void)Val;
+}
+
+u32 *XPlmi_GetLpdInitialized(void)
+{
+	static u32 LpdInitialized = LPD_INITIALIZED;
+
+	return &LpdInitialized;
+}
+
+XPlmi_BoardParams *XPlmi_GetBoardParams(void)
+{
+	static XPlmi_BoardParams BoardParams;
+
+	return &BoardParams;
+}
+
+XPlmi_BufferList *XPlmi_GetBufferList(u32 BufferListType)
+{
+	XPlmi_BufferList *BufferList = &PsmBufferList;
+
+	PsmBufferList.Data = PsmBuffers;
+	PsmBufferList.MaxBufferCount = XPLMI_MAX_PSM_BUFFERS;
+	PmcBufferList.Data = PmcBuffers;
+	PmcBufferList.MaxBufferCount = XPLMI_MAX_PMC_BUFFERS;
+	if (BufferListType == XPLMI_PMC_BUFFER_LIST) {
+		BufferList = &PmcBufferList;
+		PmcBufferList.Data[0U].Addr = XPLMI_PMCRAM_BUFFER_MEMORY;
+		PmcBufferList.BufferMemSize = XPLMI_PMCRAM_BUFFER_MEMORY_LENGTH;
+		PmcBufferList.IsBufferMemAvailable = (u8)TRUE;
+	}
+
+	return BufferList;
+}
+
+void XPlmi_GetReadbackSrcDest(u32 SlrType, u64 *SrcAddr, u64 *DestAddrRead)
+{
+	(void)SlrType;
+	*SrcAddr = (u64)CFU_FDRO_2_ADDR;
+	*DestAddrRead = (u64)CFU_STREAM_2_ADDR;
+}
+
+int XPlmi_VerifyAddrRange(u64 StartAddr, u64 EndAddr)
+{
+	return (EndAddr < StartAddr) ? (int)XPLMI_ERROR_INVALID_ADDRESS :
+		XST_SUCCESS;
+}
+
+int XPlmi_EventLogging(XPlmi_Cmd *Cmd)
+{
+	return XReplay_SinkHandler(Cmd);
+}
+
+int XPlmi_SsitSyncMaster(XPlmi_Cmd *Cmd)
+{
+	return XReplay_SinkHandler(Cmd);
+}
+
+int XPlmi_SsitSyncSlaves(XPlmi_Cmd *Cmd)
+{
+	return XReplay_SinkHandler(Cmd);
+}
+
+int XPlmi_SsitWaitSlaves(XPlmi_Cmd *Cmd)
+{
+	return XReplay_SinkHandler(Cmd);
+}
+
+/*****************************************************************************/
+/*
+ * Register utilities, polls pass at once
+ */
+void XPlmi_UtilRMW(u32 RegAddr, u32 Mask, u32 Value)
+{
+	XPlmi_Out32(RegAddr, (XPlmi_In32(RegAddr) & ~Mask) | (Value & Mask));
+}
+
+int XPlmi_UtilPoll(u32 RegAddr, u32 Mask, u32 ExpectedValue, u32 TimeOutInUs,
+		void (*ClearHandler)(void))
+{
+	(void)RegAddr;
+	(void)Mask;
+	(void)ExpectedValue;
+	(void)TimeOutInUs;
+	(void)ClearHandler;
+	XReplay_Stat.Polls++;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_UtilPoll64(u64 RegAddr, u32 Mask, u32 ExpectedValue, u32 TimeOutInUs)
+{
+	return XPlmi_UtilPoll((u32)RegAddr, Mask, ExpectedValue, TimeOutInUs,
+		NULL);
+}
+
+void usleep(ULONG useconds)
+{
+	XReplay_Stat.DelayUs += useconds;
+}
+
+/*****************************************************************************/
+/*
+ * PMC DMA
+ */
+int XPlmi_DmaXfr(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
+{
+	u32 Bytes = Len * XPLMI_WORD_LEN;
+
+	(void)Flags;
+	XReplay_Stat.DmaXfers++;
+	XReplay_Stat.DmaBytes += Bytes;
+	if ((XReplay_IsHostMem(SrcAddr, Bytes) == (int)TRUE) &&
+		(XReplay_IsHostMem(DestAddr, Bytes) == (int)TRUE)) {
+		(void)memmove((void *)(UINTPTR)DestAddr,
+			(const void *)(UINTPTR)SrcAddr, Bytes);
+	}
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_DmaSbiXfer(u64 SrcAddr, u32 Len, u32 Flags)
+{
+	return XPlmi_DmaXfr(SrcAddr, XPLMI_SBI_DEST_ADDR, Len, Flags);
+}
+
+int XPlmi_WaitForNonBlkDma(u32 DmaFlags)
+{
+	(void)DmaFlags;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_WaitForNonBlkSrcDma(u32 DmaFlags)
+{
+	(void)DmaFlags;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_MemSet(u64 DestAddress, u32 Val, u32 Len)
+{
+	u32 Bytes = Len * XPLMI_WORD_LEN;
+	u32 *Dest = (u32 *)(UINTPTR)DestAddress;
+	u32 Index;
+
+	XReplay_Stat.DmaXfers++;
+	XReplay_Stat.DmaBytes += Bytes;
+	if (XReplay_IsHostMem(DestAddress, Bytes) == (int)TRUE) {
+		for (Index = 0U; Index < Len; Index++) {
+			Dest[Index] = Val;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_MemSetBytes(void *const DestPtr, u32 DestLen, u8 Val, u32 Length)
+{
+	if ((DestPtr == NULL) || (Length > DestLen)) {
+		return XST_FAILURE;
+	}
+	(void)memset(DestPtr, Val, Length);
+
+	return XST_SUCCESS;
+}
+
+s32 Xil_SMemCpy(void *Dest, const u32 DestSize, const void *Src,
+	const u32 SrcSize, const u32 CopyLen)
+{
+	const u8 *Src8 = (const u8 *)Src;
+	const u8 *Dst8 = (const u8 *)Dest;
+
+	if ((Dest == NULL) || (Src == NULL) || (CopyLen == 0U) ||
+		(DestSize < CopyLen) || (SrcSize < CopyLen)) {
+		return XST_INVALID_PARAM;
+	}
+	if (((Src8 < Dst8) && (&Src8[CopyLen - 1U] >= Dst8)) ||
+		((Dst8 < Src8) && (&Dst8[CopyLen - 1U] >= Src8))) {
+		return XST_INVALID_PARAM;
+	}
+	(void)memcpy(Dest, Src, CopyLen);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/*
+ * Standalone BSP assertions
+ */
+u32 Xil_AssertStatus;
+s32 Xil_AssertWait = 0;
+
+void Xil_Assert(const char8 *File, s32 Line)
+{
+	(void)fprintf(stderr, "Assert %s:%d\n", File, (int)Line);
+	Xil_AssertStatus = XIL_ASSERT_OCCURRED;
+}
@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+###############################################################################
+# Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+# SPDX-License-Identifier: MIT
+###############################################################################
+"""
+Decodes a PLM trace log buffer into a Chrome trace / Perfetto JSON timeline.
+
+The buffer is retrieved from the target with the event logging command
+(sub command 6, retrieve trace log buffer) and the retrieved memory is
+saved as a little endian binary file.
+
+Each record is
+    word 0 - [15:0] event ID, [23:16] record length in words,
+             [31] raw time stamp
+    word 1 - time stamp in ms, or the PIT1 value (upper word of the down
+             counting PMC timer) for raw time stamps
+    word 2 - time stamp fraction in us, or the PIT2 value (lower word of
+             the down counting PMC timer) for raw time stamps
+    word 3.. - event arguments
+
+Raw time stamps are logged by PLM built with PLM_TRACE_HOT_PATH.
+
+Usage:
+    xplmi_trace_decode.py trace.bin -o trace.json [--iro-freq-mhz 320]
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+PIT1_CYCLE_VALUE = 0xFFFFFFFE
+PIT2_CYCLE_VALUE = 0xFFFFFFFF
+TRACE_LOG_LEN_SHIFT = 16
+TRACE_LOG_RAW_TIME_MASK = 0x80000000
+TRACE_HDR_WORDS = 3
+
+# Event ID: (name, category, phase)
+EVENTS = {
+    0x1: ("LoadImage", "loader", "i"),
+    0x2: ("Cmd", "cmd", "B"),
+    0x3: ("Cmd", "cmd", "E"),
+    0x4: ("Dma", "dma", "B"),
+    0x5: ("Dma", "dma", "E"),
+    0x6: ("Ipi", "ipi", "B"),
+    0x7: ("Ipi", "ipi", "E"),
+    0x8: ("Task", "task", "B"),
+    0x9: ("Task", "task", "E"),
+    0xA: ("CmdResume", "cmd", "B"),
+    0xB: ("CmdResume", "cmd", "E"),
+}
+
+# Named arguments of events, unnamed ones are reported as argN
+EVENT_ARGS = {
+    0x1: ("ImageId",),
+    0x2: ("CmdId",),
+    0x3: ("CmdId", "Status"),
+    0x4: ("LenWords", "Flags"),
+    0x5: ("LenWords", "Status"),
+    0x6: ("CmdId", "IpiMask"),
+    0x7: ("CmdId", "Status"),
+    0x8: ("Handler",),
+    0x9: ("Handler", "Status"),
+    0xA: ("CmdId",),
+    0xB: ("CmdId", "Status"),
+}
+
+
+def timer_to_us(pit1, pit2, iro_freq_mhz):
+    """Converts the raw down counting timer value to microseconds."""
+    start = (PIT1_CYCLE_VALUE << 32) | PIT2_CYCLE_VALUE
+    if pit1 == 0:
+        pit1 = PIT1_CYCLE_VALUE
+    return (start - ((pit1 << 32) | pit2)) / iro_freq_mhz
+
+
+def record_to_us(header, word1, word2, iro_freq_mhz):
+    """Returns the time stamp of a record in microseconds."""
+    if header & TRACE_LOG_RAW_TIME_MASK:
+        return timer_to_us(word1, word2, iro_freq_mhz)
+    return (word1 * 1000) + word2
+
+
+def decode(words, iro_freq_mhz):
+    """Yields Chrome trace events for the records in the word list."""
+    index = 0
+    while index + TRACE_HDR_WORDS <= len(words):
+        header = words[index]
+        length = (header >> TRACE_LOG_LEN_SHIFT) & 0xFF
+        event_id = header & 0xFFFF
+        if length < TRACE_HDR_WORDS or index + length > len(words):
+            # Unused or partially overwritten part of the buffer
+            index += 1
+            continue
+        args = words[index + TRACE_HDR_WORDS:index + length]
+        name, cat, phase = EVENTS.get(event_id,
+                                      ("Event0x%x" % event_id, "plm", "i"))
+        arg_names = EVENT_ARGS.get(event_id, ())
+        event = {
+            "name": name,
+            "cat": cat,
+            "ph": phase,
+            "ts": record_to_us(header, words[index + 1], words[index + 2],
+                               iro_freq_mhz),
+            "pid": 0,
+            "tid": cat,
+            "args": {},
+        }
+        if phase == "i":
+            event["s"] = "t"
+        for arg_index, value in enumerate(args):
+            if arg_index < len(arg_names):
+                key = arg_names[arg_index]
+            else:
+                key = "arg%d" % arg_index
+            event["args"][key] = "0x%08x" % value
+        yield event
+        index += length
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="binary trace buffer dump")
+    parser.add_argument("-o", "--output", help="output JSON file")
+    parser.add_argument("--iro-freq-mhz", type=float, default=320.0,
+                        help="PMC IRO frequency in MHz (default 320)")
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as infile:
+        data = infile.read()
+    data = data[:len(data) - (len(data) % 4)]
+    words = list(struct.unpack("<%dI" % (len(data) // 4), data))
+
+    events = sorted(decode(words, args.iro_freq_mhz), key=lambda e: e["ts"])
+    trace = {"traceEvents": events, "displayTimeUnit": "ns"}
+
+    if args.output:
+        with open(args.output, "w") as outfile:
+            json.dump(trace, outfile, indent=1)
+    else:
+        json.dump(trace, sys.stdout, indent=1)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -29,6 +29,7 @@
 * 1.05  bm   06/13/2023 Add API to just log PLM error
 * 2.0   ng   11/11/2023 Implemented user modules
 *       mss  03/13/2024 Fix MISRA-C violation 10.3
+* 2.1   ag   10/18/2026 Added hot path trace points to XPlmi_CmdResume
 * </pre>
 *
 * @note
@@ -103,7 +104,9 @@ int XPlmi_CmdExecute(XPlmi_Cmd *CmdPtr)
 			CmdPtr->CmdId, CmdPtr->Len, CmdPtr->PayloadLen);
 
 	/** - Execute the API. */
+	XPlmi_HotTraceLog3(XPLMI_TRACE_LOG_CMD_START, CmdPtr->CmdId);
 	Status = ModuleCmd->Handler(CmdPtr);
+	XPlmi_HotTraceLog4(XPLMI_TRACE_LOG_CMD_END, CmdPtr->CmdId, (u32)Status);
 	if (Status != XST_SUCCESS) {
 #if ( XPAR_MAX_USER_MODULES > 0U )
 		if ( ModuleId >= XPLMI_USER_MODULE_START_INDEX ) {
@@ -151,7 +154,10 @@ int XPlmi_CmdResume(XPlmi_Cmd * CmdPtr)
 
 	XPlmi_Printf(DEBUG_DETAILED, "CMD Resume \n\r");
 	Xil_AssertNonvoid(CmdPtr->ResumeHandler != NULL);
+	XPlmi_HotTraceLog3(XPLMI_TRACE_LOG_CMD_RESUME_START, CmdPtr->CmdId);
 	Status = CmdPtr->ResumeHandler(CmdPtr);
+	XPlmi_HotTraceLog4(XPLMI_TRACE_LOG_CMD_RESUME_END, CmdPtr->CmdId,
+		(u32)Status);
 	if (Status != XST_SUCCESS) {
 		Status = XPlmi_UpdateStatus(XPLMI_ERR_RESUME_HANDLER, Status);
 		goto END;
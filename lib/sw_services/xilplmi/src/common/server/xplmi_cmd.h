@@ -46,6 +46,7 @@
 *                       boundaries
 * 1.8   skg  10/04/2022 Added masks for SLR ID and Zeriozing the SLR ID
 * 1.9   bm   07/06/2023 Added XPlmi_ClearEndStack member to XPlmi_Cmd structure
+*       ag   10/18/2026 Added Dma1WaitFunc member to XPlmi_KeyHoleParams
 *
 * </pre>
 *
@@ -91,6 +92,7 @@ struct XPlmi_KeyHoleParams {
 	u64 SrcAddr; /**< Boot Source address */
 	u32 ExtraWords; /**< Words that are directly DMAed to CFI */
 	int (*Func) (u64 SrcAddr, u64 DestAddress, u32 Length, u32 Flags);
+	int (*Dma1WaitFunc) (void); /**< Completes loader copy running on PMC DMA1 */
 	u8 IsNextChunkCopyStarted; /**< Used to check if next chunk is copied or not */
 };
 
@@ -43,6 +43,8 @@
 *       ng   03/30/2023 Updated algorithm and return values in doxygen comments
 * 1.10  ng   07/06/2023 Added support for SDT flow
 *       pre  14/12/2023 Fixed compilation warnings
+* 2.00  ag   10/18/2026 Added buffered UART prints which are drained from
+*                       the debug log buffer when PLM is idle
 *
 * </pre>
 *
@@ -92,6 +94,10 @@
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
+#if defined(PLM_PRINT_BUFFERED) && (XPLMI_UART_NUM_INSTANCES > 0U)
+static u32 UartWritten = 0U; /**< Bytes logged by outbyte for the UART */
+static u32 UartSent = 0U; /**< Bytes sent to the UART from the log buffer */
+#endif
 
 /*****************************************************************************/
 /**
@@ -275,8 +281,20 @@ void outbyte(char c)
 	/** - If UART is enabled, send the byte to UART. */
 #if (XPLMI_UART_NUM_INSTANCES > 0U)
 	u32 *UartBaseAddr = XPlmi_GetUartBaseAddr();
+	u8 IsDeferred = (u8)FALSE;
 	if (XPlmi_IsUartPrintInitialized() == (u8)TRUE) {
-		XUartPsv_SendByte(*UartBaseAddr, (u8)c);
+#ifdef PLM_PRINT_BUFFERED
+		/**
+		 * - In buffered mode the debug log buffer is the UART buffer,
+		 * the byte is sent later by XPlmi_DrainUart.
+		 */
+		if (DebugLog->PrintToBuf == (u8)TRUE) {
+			IsDeferred = (u8)TRUE;
+		}
+#endif
+		if (IsDeferred == (u8)FALSE) {
+			XUartPsv_SendByte(*UartBaseAddr, (u8)c);
+		}
 	}
 #endif
 	/** - Store the byte onto log buffer. */
@@ -292,6 +310,89 @@ void outbyte(char c)
 
 		XPlmi_OutByte64(CurrentAddr, (u8)c);
 		++DebugLog->LogBuffer.Offset;
+#if defined(PLM_PRINT_BUFFERED) && (XPLMI_UART_NUM_INSTANCES > 0U)
+		if (IsDeferred == (u8)TRUE) {
+			++UartWritten;
+		}
+#endif
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function sends the logged bytes which are not yet sent to
+ * UART, without waiting for space in the UART TX FIFO. It is called when PLM
+ * is idle. If the log buffer wraps over bytes which are not yet sent, those
+ * bytes are skipped, as they are not available any more.
+ *
+ * @param	MaxBytes is the maximum number of bytes to be sent
+ *
+ * @return
+ * 			- Number of bytes still pending to be sent.
+ *
+ *****************************************************************************/
+u32 XPlmi_DrainUart(u32 MaxBytes)
+{
+	u32 Pending = 0U;
+#if defined(PLM_PRINT_BUFFERED) && (XPLMI_UART_NUM_INSTANCES > 0U)
+	u32 *UartBaseAddr = XPlmi_GetUartBaseAddr();
+	u32 Len = DebugLog->LogBuffer.Len;
+	u32 Count = 0U;
+	u32 Offset;
+	u8 Data;
+
+	/** - Discard the pending bytes if UART prints are disabled. */
+	if (XPlmi_IsUartPrintInitialized() != (u8)TRUE) {
+		UartSent = UartWritten;
+	}
+
+	while (Count < MaxBytes) {
+		Pending = UartWritten - UartSent;
+		/** - Skip the bytes which are overwritten in the log buffer. */
+		if (Pending > Len) {
+			UartSent = UartWritten - Len;
+			Pending = Len;
+		}
+		if (Pending == 0U) {
+			break;
+		}
+
+		/** - Oldest pending byte is Pending bytes behind the log offset. */
+		Offset = DebugLog->LogBuffer.Offset;
+		if (Offset >= Pending) {
+			Offset -= Pending;
+		} else {
+			Offset = Offset + Len - Pending;
+		}
+		Data = XPlmi_InByte64(DebugLog->LogBuffer.StartAddr + Offset);
+		if (XUartPsv_TrySendByte(*UartBaseAddr, Data) != (u32)TRUE) {
+			break;
+		}
+		++UartSent;
+		++Count;
+	}
+	Pending = UartWritten - UartSent;
+#else
+	(void)MaxBytes;
+#endif
+
+	return Pending;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function sends all the logged bytes which are not yet sent to
+ * UART and waits for them to be accepted by the UART TX FIFO. It is used in
+ * error paths and before the debug log buffer is reconfigured.
+ *
+ * @return
+ * 			- None
+ *
+ *****************************************************************************/
+void XPlmi_FlushUart(void)
+{
+	while (XPlmi_DrainUart(XPLMI_UART_DRAIN_ALL) != 0U) {
+		;
 	}
 }
 
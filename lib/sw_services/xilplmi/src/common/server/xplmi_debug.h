@@ -33,6 +33,7 @@
 *       bm   08/12/2021 Added support to configure uart during run-time
 *       bsv  09/05/2021 Disable prints in slave boot modes in case of error
 * 1.06  bm   07/06/2022 Refactor versal and versal_net code
+* 2.00  ag   10/18/2026 Added XPlmi_DrainUart and XPlmi_FlushUart
 *
 * </pre>
 *
@@ -68,6 +69,10 @@ extern "C" {
 
 #define XPLMI_INVALID_UART_BASE_ADDR	(0U) /**< Flag indicates invalid UART
                                               * base address */
+#define XPLMI_UART_DRAIN_ALL	(0xFFFFFFFFU) /**< Drain as many bytes as UART
+                                              * accepts */
+#define XPLMI_UART_DRAIN_IDLE	(64U) /**< Bytes drained per idle pass, UART
+                                      * TX FIFO depth */
 /**************************** Type Definitions *******************************/
 
 /************************** Function Prototypes ******************************/
@@ -75,6 +80,8 @@ extern "C" {
 int XPlmi_InitUart(void);
 void XPlmi_Print(u16 DebugType, const char8 *Ctrl1, ...);
 int XPlmi_ConfigUart(u8 UartSelect, u8 UartEnable);
+u32 XPlmi_DrainUart(u32 MaxBytes);
+void XPlmi_FlushUart(void);
 
 /***************** Macros (Inline Functions) Definitions *********************/
 #ifdef PLM_PRINT_PERF
@@ -707,6 +707,7 @@ int XPlmi_DmaXfr(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
 		goto END;
 	}
 
+	XPlmi_HotTraceLog4(XPLMI_TRACE_LOG_DMA_START, Len, Flags);
 	Status = XPlmi_StartDma(SrcAddr, DestAddr, Len, Flags, &DmaPtr);
 	if (Status != XST_SUCCESS) {
 		goto END;
@@ -752,6 +753,7 @@ int XPlmi_DmaXfr(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
 	}
 
 END:
+	XPlmi_HotTraceLog4(XPLMI_TRACE_LOG_DMA_END, Len, (u32)Status);
 #ifdef PLM_PRINT_PERF_DMA
 	XPlmi_MeasurePerfTime(XfrTime, &PerfTime);
 	XPlmi_Printf(DEBUG_PRINT_PERF,
@@ -142,6 +142,7 @@
 *                       in slave SLR if any error is encountered during boot
 *       ng   03/09/2024 Fixed format specifier for 32bit variables
 *       mss  03/13/2024 MISRA-C violatiom Rule 17.8 fixed
+*       ag   10/18/2026 Flush buffered UART prints after register dump
 *
 * </pre>
 *
@@ -1505,6 +1506,7 @@ static void XPlmi_DumpRegisters(void)
 		XPlmi_In32(PMC_GLOBAL_PLM_ERR));
 	XPlmi_DumpErrNGicStatus();
 	XPlmi_Printf(DEBUG_PRINT_ALWAYS, "============Register Dump============\n\r");
+	XPlmi_FlushUart();
 }
 
 /*****************************************************************************/
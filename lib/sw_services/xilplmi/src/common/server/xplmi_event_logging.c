@@ -53,6 +53,10 @@
 *       dd   09/12/2023 MISRA-C violation Rule 10.8 fixed
 *       ng   02/14/2024 removed int typecast for errors
 *       mss  03/13/2024 MISRA-C violatiom Rule 17.8 fixed
+* 2.00  ag   10/18/2026 Reserve the trace record space before writing it
+*                       and store raw PIT cycles with PLM_TRACE_HOT_PATH
+*       ag   10/18/2026 Flush buffered UART prints before the log memory
+*                       is reconfigured
 *
 * </pre>
 *
@@ -293,6 +297,8 @@ int XPlmi_EventLogging(XPlmi_Cmd * Cmd)
 			}
 			break;
 		case XPLMI_LOGGING_CMD_CONFIG_LOG_MEM:
+			/* Buffered UART prints are sent from the log memory */
+			XPlmi_FlushUart();
 			StartAddr = (Arg1 << 32U) | Arg2;
 			Status = XPlmi_ConfigureLogMem(&DebugLog->LogBuffer,
 					StartAddr, Arg3, XPLMI_DEBUG_LOG_BUFFER);
@@ -338,6 +344,8 @@ int XPlmi_EventLogging(XPlmi_Cmd * Cmd)
 /*****************************************************************************/
 /**
  * @brief	This function stores the trace events to the Trace Log buffer.
+ * 			The space for the record is reserved before it is written, and
+ * 			the record is written in at most two contiguous bursts.
  *
  * @param	TraceData to be stored to buffer
  * @param	Len is number of words in TraceData
@@ -349,9 +357,28 @@ int XPlmi_EventLogging(XPlmi_Cmd * Cmd)
 void XPlmi_StoreTraceLog(u32 *TraceData, u32 Len)
 {
 	u32 Index;
+	u32 Offset;
+	u32 NextOffset;
+	u32 ContigLen;
+	u32 ByteLen = Len << XPLMI_WORD_LEN_SHIFT;
+#ifdef PLM_TRACE_HOT_PATH
+	u64 TimerValue = XPlmi_GetTimerValue();
+#else
 	XPlmi_PerfTime PerfTime;
+#endif
 	XPlmi_CircularBuffer *TraceLog = XPlmi_GetTraceLogInst();
 
+	if (ByteLen > TraceLog->Len) {
+		goto END;
+	}
+
+#ifdef PLM_TRACE_HOT_PATH
+	/* Raw PIT cycles, the record is flagged for the host decoder */
+	TraceData[0U] = TraceData[0U] | (Len << XPLMI_TRACE_LOG_LEN_SHIFT) |
+		XPLMI_TRACE_LOG_RAW_TIME_MASK;
+	TraceData[1U] = (u32)(TimerValue >> 32U);
+	TraceData[2U] = (u32)TimerValue;
+#else
 	/* Get time stamp of PLM */
 	XPlmi_MeasurePerfTime((XPLMI_PIT1_CYCLE_VALUE << 32U) |
 		XPLMI_PIT2_CYCLE_VALUE, &PerfTime);
@@ -359,16 +386,37 @@ void XPlmi_StoreTraceLog(u32 *TraceData, u32 Len)
 	TraceData[0U] = TraceData[0U] | (Len << XPLMI_TRACE_LOG_LEN_SHIFT);
 	TraceData[1U] = (u32)PerfTime.TPerfMs;
 	TraceData[2U] = (u32)PerfTime.TPerfMsFrac;
+#endif
 
-	for (Index = 0U; Index < Len; Index++) {
-		if (TraceLog->Offset >= TraceLog->Len) {
-			TraceLog->Offset = 0x0U;
-			TraceLog->IsBufferFull = (u32)TRUE;
-		}
+	/* Reserve space for the record */
+	Offset = TraceLog->Offset;
+	if (Offset >= TraceLog->Len) {
+		Offset = 0x0U;
+	}
+	NextOffset = Offset + ByteLen;
+	if (NextOffset >= TraceLog->Len) {
+		NextOffset -= TraceLog->Len;
+		TraceLog->IsBufferFull = (u32)TRUE;
+	}
+	TraceLog->Offset = NextOffset;
 
-		XPlmi_Out64((TraceLog->StartAddr + TraceLog->Offset), TraceData[Index]);
-		TraceLog->Offset += XPLMI_WORD_LEN;
+	/* Write the record up to the end of buffer and the rest from start */
+	ContigLen = (TraceLog->Len - Offset) >> XPLMI_WORD_LEN_SHIFT;
+	if (ContigLen > Len) {
+		ContigLen = Len;
+	}
+	for (Index = 0U; Index < ContigLen; Index++) {
+		XPlmi_Out64((TraceLog->StartAddr + Offset), TraceData[Index]);
+		Offset += XPLMI_WORD_LEN;
+	}
+	Offset = 0x0U;
+	for (; Index < Len; Index++) {
+		XPlmi_Out64((TraceLog->StartAddr + Offset), TraceData[Index]);
+		Offset += XPLMI_WORD_LEN;
 	}
+
+END:
+	return;
 }
 
 /*****************************************************************************/
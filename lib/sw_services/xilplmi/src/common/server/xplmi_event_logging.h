@@ -30,6 +30,9 @@
 *       bsv  07/19/2021 Disable UART prints when invalid header is encountered
 *                       in slave boot modes
 *       bm   08/12/2021 Added support to configure uart during run-time
+* 2.00  ag   10/18/2026 Added hot path trace events with raw PIT cycle
+*                       time stamps
+*       ag   10/18/2026 Added command resume trace events
 *
 *
 * </pre>
@@ -48,6 +51,7 @@ extern "C" {
 /***************************** Include Files *********************************/
 #include "xplmi_cmd.h"
 #include "xplmi_util.h"
+#include "xplmi_config.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -91,19 +95,48 @@ void XPlmi_InitDebugLogBuffer(void);
 
 /* Trace log buffer length shift */
 #define XPLMI_TRACE_LOG_LEN_SHIFT		(16U)
+#define XPLMI_TRACE_LOG_RAW_TIME_MASK		(0x80000000U)
 
 /* Trace event IDs */
 #define XPLMI_TRACE_LOG_LOAD_IMAGE		(0x1U)
+#define XPLMI_TRACE_LOG_CMD_START		(0x2U)
+#define XPLMI_TRACE_LOG_CMD_END			(0x3U)
+#define XPLMI_TRACE_LOG_DMA_START		(0x4U)
+#define XPLMI_TRACE_LOG_DMA_END			(0x5U)
+#define XPLMI_TRACE_LOG_IPI_START		(0x6U)
+#define XPLMI_TRACE_LOG_IPI_END			(0x7U)
+#define XPLMI_TRACE_LOG_TASK_START		(0x8U)
+#define XPLMI_TRACE_LOG_TASK_END		(0x9U)
+#define XPLMI_TRACE_LOG_CMD_RESUME_START	(0xAU)
+#define XPLMI_TRACE_LOG_CMD_RESUME_END		(0xBU)
 
 /*
  * Trace log functions
  * TraceBuffer structure
- * 		0U - Header
+ * 		0U - Header, [15:0] event ID, [23:16] length in words,
+ * 		     [31] raw time stamp
  * 		1U - Time stamp in ms
  * 		2U - Time stamp fraction
  * 		3U - Payload
  * 		...
+ * With PLM_TRACE_HOT_PATH, header bit 31 is set and words 1 and 2 hold
+ * the PIT1 and PIT2 values returned by XPlmi_GetTimerValue instead. These
+ * raw down counting PMC IRO cycles are converted to time by the host.
  */
+
+/*
+ * Hot path trace points for CDO/IPI command execution, PMC DMA transfers,
+ * IPI handling and task dispatch. These are compiled in only when
+ * PLM_TRACE_HOT_PATH is defined in xplmi_config.h.
+ */
+#ifdef PLM_TRACE_HOT_PATH
+#define XPlmi_HotTraceLog3(Header, Arg1)	XPlmi_TraceLog3((Header), (Arg1))
+#define XPlmi_HotTraceLog4(Header, Arg1, Arg2) \
+		XPlmi_TraceLog4((Header), (Arg1), (Arg2))
+#else
+#define XPlmi_HotTraceLog3(Header, Arg1)
+#define XPlmi_HotTraceLog4(Header, Arg1, Arg2)
+#endif
 /*****************************************************************************/
 /**
  * @brief	This function writes to trace buffer
@@ -115,6 +115,10 @@
 *       mss  03/13/2024 MISRA-C violatiom Rule 17.8 fixed
 *       mss  03/13/2024 MISRA-C violation Rule 2.2 fixed
 *       am   04/04/2024 Fixed doxygen warnings
+*       ag   10/18/2026 Stream DMA write payloads split across chunks
+*                       directly from the boot device
+*       ag   10/18/2026 Complete loader copies running on PMC DMA1 before
+*                       readback and SBI DMA transfers
 *
 * </pre>
 *
@@ -199,6 +203,8 @@
 /************************** Function Prototypes ******************************/
 static int XPlmi_CfiWrite(u64 SrcAddr, u64 DestAddr, u32 Keyholesize, u32 Len,
         XPlmi_Cmd* Cmd);
+static int XPlmi_DirectXfr(XPlmi_Cmd* Cmd,
+	XPlmi_KeyHoleXfrParams* KeyHoleXfrParams, u32 Head);
 static XPlmi_ReadBackProps* XPlmi_GetReadBackPropsInstance(void);
 static int XPlmi_DmaUnalignedXfer(u64* SrcAddr, u64* DestAddr, u32* Len,
 	u8 Flag);
@@ -638,6 +644,7 @@ END:
  *  		Command payload parameters are
  *		- High Dest Addr
  *		- Low Dest Addr
+ *		- DATA
  *
  * @param	Cmd is pointer to the command structure
  *
@@ -652,6 +659,10 @@ static int XPlmi_DmaWrite(XPlmi_Cmd *Cmd)
 	u64 SrcAddr;
 	u32 Len = Cmd->PayloadLen;
 	u32 DestOffset = 0U;
+	u32 RemData;
+	u32 Head;
+	u8 Direct = (u8)FALSE;
+	XPlmi_KeyHoleXfrParams KeyHoleXfrParams;
 	XPLMI_EXPORT_CMD(XPLMI_DMA_WRITE_CMD_ID, XPLMI_MODULE_GENERIC_ID,
 		XPLMI_CMD_ARG_CNT_TWO, XPLMI_UNLIMITED_ARG_CNT);
 
@@ -673,9 +684,48 @@ static int XPlmi_DmaWrite(XPlmi_Cmd *Cmd)
 	DestAddr = ((u64)Cmd->ResumeData[1U] | (DestAddr << 32U));
 	DestAddr += (((u64)Cmd->ProcessedLen - DestOffset) * XPLMI_WORD_LEN);
 
+	/**
+	 * If the payload continues beyond this chunk and the boot device
+	 * supports it, the rest is transferred directly from the boot device
+	 * instead of resuming the command in the following chunks. As the
+	 * direct transfer bypasses XPlmi_DmaTransfer, it has to start and end
+	 * 16 byte aligned; the words of this chunk after the last aligned
+	 * destination address are held back and sent with the direct transfer.
+	 */
+	RemData = (Cmd->Len - Cmd->PayloadLen) * XPLMI_WORD_LEN;
+	Head = (u32)((DestAddr + ((u64)Len * XPLMI_WORD_LEN)) &
+		XPLMI_SIXTEEN_BYTE_MASK);
+	if ((Cmd->KeyHoleParams.Func != NULL) && (Cmd->ProcessedLen == 0U) &&
+		(RemData != 0U) && (Head <= (Len * XPLMI_WORD_LEN)) &&
+		(((RemData + Head) & XPLMI_SIXTEEN_BYTE_MASK) == 0U)) {
+		Len -= Head / XPLMI_WORD_LEN;
+		Direct = (u8)TRUE;
+	}
+
 	/* Call XPlmi_DmaTransfer with flags DMA0 and INCR */
-	Status = XPlmi_DmaTransfer(DestAddr, SrcAddr, Len, XPLMI_PMCDMA_0);
+	if (Len != 0U) {
+		Status = XPlmi_DmaTransfer(DestAddr, SrcAddr, Len, XPLMI_PMCDMA_0);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+	Status = XST_SUCCESS;
+	if (Direct == (u8)FALSE) {
+		goto END;
+	}
+
+	/* Linear destination, the keyhole covers the whole remaining payload */
+	DestAddr += (u64)Len * XPLMI_WORD_LEN;
+	KeyHoleXfrParams.SrcAddr = SrcAddr + ((u64)Len * XPLMI_WORD_LEN);
+	KeyHoleXfrParams.DestAddr = DestAddr;
+	KeyHoleXfrParams.BaseAddr = DestAddr;
+	KeyHoleXfrParams.Len = 0U;
+	KeyHoleXfrParams.Keyholesize = RemData + Head;
+	KeyHoleXfrParams.Flags = XPLMI_PMCDMA_0;
+	KeyHoleXfrParams.Func = NULL;
+	Status = XPlmi_DirectXfr(Cmd, &KeyHoleXfrParams, Head);
 
+END:
 	return Status;
 }
 
@@ -985,6 +1035,13 @@ static int XPlmi_DmaXfer(XPlmi_Cmd *Cmd)
 	Flags = Cmd->ResumeData[5U] | XPLMI_PMCDMA_0;
 
 	if (DestAddr == XPLMI_SBI_DEST_ADDR) {
+		/* Complete the partition copy the loader may run on PMC DMA1 */
+		if (Cmd->KeyHoleParams.Dma1WaitFunc != NULL) {
+			Status = Cmd->KeyHoleParams.Dma1WaitFunc();
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+		}
 		XPlmi_UtilRMW(SLAVE_BOOT_SBI_MODE,
 			SLAVE_BOOT_SBI_MODE_SELECT_MASK,
 			SLAVE_BOOT_SBI_MODE_SELECT_MASK);
@@ -1116,6 +1173,15 @@ static int XPlmi_CfiRead(XPlmi_Cmd *Cmd)
 	*/
 	XPlmi_GetReadbackSrcDest(SlrType, &SrcAddr, &DestAddrRead);
 	ReadLen = XPlmi_GetReadbackLen(Len);
+
+	/* Complete the partition copy the loader may run on PMC DMA1 */
+	if (Cmd->KeyHoleParams.Dma1WaitFunc != NULL) {
+		Status = Cmd->KeyHoleParams.Dma1WaitFunc();
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+
 	/** Set MaxOutCommands of PMC_DMA1 to 1 */
 	XPlmi_SetMaxOutCmds(XPLMI_MAXOUT_CMD_MIN_VAL);
 
@@ -2486,7 +2552,7 @@ int XPlmi_SetReadBackProps(const XPlmi_ReadBackProps *ReadBack)
  * @param	SrcAddr is the address to read cfi data from
  * @param	DestAddr is the address to write cfi data to
  * @param	Keyholesize is the size of the DMA key hole in bytes
- * @param	Len is number of words already transferred
+ * @param	Len is number of words in the current chunk
  * @param	Cmd is pointer to the command structure
  *
  * @return
@@ -2497,16 +2563,12 @@ static int XPlmi_CfiWrite(u64 SrcAddr, u64 DestAddr, u32 Keyholesize, u32 Len,
 	XPlmi_Cmd* Cmd)
 {
 	int Status = XST_FAILURE;
-	u64 BaseAddr = DestAddr;
-	u32 RemData;
-	u64 Src = SrcAddr;
-	u32 LenTmp = Len << XPLMI_WORD_LEN_SHIFT;
 	XPlmi_KeyHoleXfrParams KeyHoleXfrParams;
 
-	KeyHoleXfrParams.SrcAddr = Src;
+	KeyHoleXfrParams.SrcAddr = SrcAddr;
 	KeyHoleXfrParams.DestAddr = DestAddr;
-	KeyHoleXfrParams.BaseAddr = BaseAddr;
-	KeyHoleXfrParams.Len = LenTmp;
+	KeyHoleXfrParams.BaseAddr = DestAddr;
+	KeyHoleXfrParams.Len = Len << XPLMI_WORD_LEN_SHIFT;
 	KeyHoleXfrParams.Keyholesize = Keyholesize;
 	KeyHoleXfrParams.Flags = XPLMI_PMCDMA_0;
 	KeyHoleXfrParams.Func = NULL;
@@ -2515,38 +2577,85 @@ static int XPlmi_CfiWrite(u64 SrcAddr, u64 DestAddr, u32 Keyholesize, u32 Len,
 		goto END;
 	}
 
-	RemData = (Cmd->Len - Cmd->PayloadLen) * XPLMI_WORD_LEN;
-	if (RemData == 0U) {
+	if (Cmd->Len == Cmd->PayloadLen) {
 		goto END;
 	}
+	Status = XPlmi_DirectXfr(Cmd, &KeyHoleXfrParams, 0U);
+
+END:
+	if (Status != XST_SUCCESS) {
+		XPlmi_Printf(DEBUG_GENERAL, "DMA WRITE Key Hole Failed\n\r");
+	}
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function transfers the part of the command payload that is
+ * 			not in the current chunk. Data of the next chunk, if its copy
+ * 			is already started, is transferred from PMC RAM and the rest
+ * 			directly from the boot device. The words transferred beyond the
+ * 			current chunk are returned in ExtraWords, so the loader skips
+ * 			them.
+ *
+ * @param	Cmd is pointer to the command structure
+ * @param	KeyHoleXfrParams is the keyhole state after the transfer of the
+ * 			payload in the current chunk; SrcAddr, Len and Func are updated
+ * @param	Head is the number of bytes at the end of the current chunk,
+ * 			starting at KeyHoleXfrParams->SrcAddr, that are not transferred
+ * 			yet
+ *
+ * @return
+ * 			- XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XPlmi_DirectXfr(XPlmi_Cmd* Cmd,
+	XPlmi_KeyHoleXfrParams* KeyHoleXfrParams, u32 Head)
+{
+	int Status = XST_FAILURE;
+	u32 RemData = ((Cmd->Len - Cmd->PayloadLen) * XPLMI_WORD_LEN) + Head;
+	u32 LenTmp;
+	u64 Src;
 
 	if (Cmd->KeyHoleParams.IsNextChunkCopyStarted == (u8)FALSE) {
 		LenTmp = 0U;
 		goto END2;
 	}
 
-	if (Src < XPLMI_PMCRAM_CHUNK_MEMORY_1) {
+	if (KeyHoleXfrParams->SrcAddr < XPLMI_PMCRAM_CHUNK_MEMORY_1) {
 		Src = XPLMI_PMCRAM_CHUNK_MEMORY_1;
 	}
 	else {
 		Src = XPLMI_PMCRAM_CHUNK_MEMORY;
 	}
 
-	Status = Cmd->KeyHoleParams.Func(Src, DestAddr, RemData,
+	Status = Cmd->KeyHoleParams.Func(Src, KeyHoleXfrParams->DestAddr, RemData,
 			XPLMI_DEVICE_COPY_STATE_WAIT_DONE);
 	if (Status != XST_SUCCESS) {
 		goto END;
 	}
-	if (RemData > (XPLMI_CHUNK_SIZE / 2U)) {
-		LenTmp = (XPLMI_CHUNK_SIZE / 2U);
+
+	/**
+	 * Place the held back bytes in front of the next chunk, in the space
+	 * reserved for commands split across chunks, so both are transferred
+	 * together
+	 */
+	if (Head != 0U) {
+		Src -= Head;
+		Status = Xil_SMemCpy((void *)(UINTPTR)Src, Head,
+			(void *)(UINTPTR)KeyHoleXfrParams->SrcAddr, Head, Head);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
 	}
-	else {
+	LenTmp = ((XPLMI_CHUNK_SIZE / 2U) + Head) & ~XPLMI_SIXTEEN_BYTE_MASK;
+	if (RemData < LenTmp) {
 		LenTmp = RemData;
 	}
 	XPlmi_SetPlmLiveStatus();
-	KeyHoleXfrParams.SrcAddr = Src;
-	KeyHoleXfrParams.Len = LenTmp;
-	Status = XPlmi_KeyHoleXfr(&KeyHoleXfrParams);
+	KeyHoleXfrParams->SrcAddr = Src;
+	KeyHoleXfrParams->Len = LenTmp;
+	Status = XPlmi_KeyHoleXfr(KeyHoleXfrParams);
 	if (Status != XST_SUCCESS) {
 		goto END;
 	}
@@ -2557,11 +2666,11 @@ static int XPlmi_CfiWrite(u64 SrcAddr, u64 DestAddr, u32 Keyholesize, u32 Len,
 	}
 
 END2:
-	KeyHoleXfrParams.SrcAddr = Cmd->KeyHoleParams.SrcAddr + LenTmp;
-	KeyHoleXfrParams.Len = RemData;
-	KeyHoleXfrParams.Flags = 0U;
-	KeyHoleXfrParams.Func = Cmd->KeyHoleParams.Func;
-	Status = XPlmi_KeyHoleXfr(&KeyHoleXfrParams);
+	KeyHoleXfrParams->SrcAddr = Cmd->KeyHoleParams.SrcAddr + LenTmp - Head;
+	KeyHoleXfrParams->Len = RemData;
+	KeyHoleXfrParams->Flags = 0U;
+	KeyHoleXfrParams->Func = Cmd->KeyHoleParams.Func;
+	Status = XPlmi_KeyHoleXfr(KeyHoleXfrParams);
 	if (Status != XST_SUCCESS) {
 		goto END;
 	}
@@ -2570,9 +2679,6 @@ END1:
 	Cmd->PayloadLen = Cmd->Len + 1U;
 	Cmd->ProcessedLen = Cmd->Len;
 END:
-	if (Status != XST_SUCCESS) {
-		XPlmi_Printf(DEBUG_GENERAL, "DMA WRITE Key Hole Failed\n\r");
-	}
 	return Status;
 }
 
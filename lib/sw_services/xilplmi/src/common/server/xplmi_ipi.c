@@ -322,6 +322,7 @@ static int XPlmi_IpiDispatchHandler(void *Data)
 		 * Get IPI request type
 		 */
 		Cmd.CmdId = Payload[0U];
+		XPlmi_HotTraceLog4(XPLMI_TRACE_LOG_IPI_START, Cmd.CmdId, Cmd.IpiMask);
 		Cmd.IpiReqType = XPlmi_GetIpiReqType(Cmd.CmdId,
 				IpiInst.Config.TargetList[MaskIndex].BufferIndex);
 
@@ -368,6 +369,7 @@ static int XPlmi_IpiDispatchHandler(void *Data)
 		Status = XPlmi_IpiCmdExecute(&Cmd, Payload);
 
 END:
+		XPlmi_HotTraceLog4(XPLMI_TRACE_LOG_IPI_END, Cmd.CmdId, (u32)Status);
 		/**
 		 *  Skip providing ack if it is handled in the command handler.
 		 */
@@ -45,6 +45,7 @@
 * 1.08  ng   11/11/2022 Updated doxygen comments
 * 2.00  ng   12/27/2023 Reduced log level for less frequent prints
 *       ng   01/28/2024 optimized u8 variables
+*       ag   10/18/2026 Drain buffered UART prints before going to sleep
 *
 * </pre>
 *
@@ -254,7 +255,11 @@ void XPlmi_TaskDispatchLoop(void)
 			Xil_AssertVoid(Task->Handler != NULL);
 			metal_list_del(&Task->TaskNode);
 			microblaze_enable_interrupts();
+			XPlmi_HotTraceLog3(XPLMI_TRACE_LOG_TASK_START,
+				(u32)(UINTPTR)Task->Handler);
 			Status = Task->Handler(Task->PrivData);
+			XPlmi_HotTraceLog4(XPLMI_TRACE_LOG_TASK_END,
+				(u32)(UINTPTR)Task->Handler, (u32)Status);
 #ifdef PLM_DEBUG_DETAILED
 			XPlmi_MeasurePerfTime(TaskStartTime, &PerfTime);
 			XPlmi_Printf(DEBUG_PRINT_PERF, "%u.%03u ms: Task Time\n\r",
@@ -271,6 +276,14 @@ void XPlmi_TaskDispatchLoop(void)
 		 */
 		XPlmi_Printf(DEBUG_DETAILED,
 			"No pending tasks..Going to sleep\n\r");
+#ifdef PLM_PRINT_BUFFERED
+		/**
+		 * Send up to a UART TX FIFO of buffered prints before going to
+		 * sleep. The remaining prints are sent on the next wakeup, at
+		 * the latest on the next scheduler tick.
+		 */
+		(void)XPlmi_DrainUart(XPLMI_UART_DRAIN_IDLE);
+#endif
 		mb_sleep();
 		microblaze_enable_interrupts();
 	}
@@ -48,6 +48,7 @@
 * 1.09  ng   11/11/2022 Fixed doxygen file name error
 * 1.10  ng   06/21/2023 Added support for system device-tree flow
 *       ng   03/20/2024 Added CDO debug prints
+*       ag   10/18/2026 Added PLM_PRTN_COPY_OVERLAP macro
 * </pre>
 *
 * @note
@@ -113,6 +114,15 @@ extern "C" {
  */
 //#define PLM_PRINT_NO_UART
 
+/**
+ * Enable the below define to send prints to UART from the debug log buffer
+ * when PLM is idle, instead of waiting for UART while printing.
+ * Please note that below is defined in xparameters.h based on the
+ * xilplmi library configuration, hence commented out here.
+ * This definition is disabled by default (i.e. not defined).
+ */
+//#define PLM_PRINT_BUFFERED
+
 /**
  * Enabling the PLM_PRINT_PERF prints the time taken for loading partitions,
  * images and tasks. This define can be enabled with any of the above
@@ -200,6 +210,7 @@ extern "C" {
  * KEYHOLE will print the time taken to process keyhole command.
  * Keyhole command is used for Cframe and slave slr image loading.
  * PL prints the PL Power status and House clean status.
+ * PM prints the time taken to apply scheduled requirements of a subsystem.
  * Make sure to enable PLM_PRINT_PERF to see prints.
  */
 //#define PLM_PRINT_PERF_POLL
@@ -207,6 +218,25 @@ extern "C" {
 //#define PLM_PRINT_PERF_CDO_PROCESS
 //#define PLM_PRINT_PERF_KEYHOLE
 //#define PLM_PRINT_PERF_PL
+//#define PLM_PRINT_PERF_PM
+
+/**
+ * Enable the below define to log CDO/IPI command execution, PMC DMA
+ * transfers, IPI handling and task dispatch to the trace log buffer.
+ * Trace records then carry raw PIT cycles instead of ms time stamps and
+ * are decoded on the host.
+ */
+//#define PLM_TRACE_HOT_PATH
+
+/**
+ * Enable the below define to copy ELF partitions of a PDI in DDR on PMC
+ * DMA1 in the background while the next image is loaded. The handoff of
+ * such an image is delayed until its copy completes. Images with a PSM
+ * partition and images that are the parent of a later image are started
+ * right away. Not used when PLM_OCP is enabled.
+ * This definition is disabled by default (i.e. not defined).
+ */
+//#define PLM_PRTN_COPY_OVERLAP
 
 #define XPLMI_MJTAG_WA_GASKET_TOGGLE_CNT 10U /**< Number of clock cyles required
 					to change tap state to RESET */
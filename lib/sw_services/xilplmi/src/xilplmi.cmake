@@ -20,6 +20,11 @@ if(NOT XILPLMI_plm_uart_dbg_en)
   set(PLM_PRINT_NO_UART " ")
 endif()
 
+option(XILPLMI_plm_uart_buffered_en "Enables or Disables buffered UART prints which are sent from the debug log buffer when PLM is idle" OFF)
+if(XILPLMI_plm_uart_buffered_en)
+  set(PLM_PRINT_BUFFERED " ")
+endif()
+
 set(XILPLMI_plm_dbg_lvl "level1" CACHE STRING "Selects the debug logs level")
 set_property(CACHE XILPLMI_plm_dbg_lvl PROPERTY STRINGS "level0" "level1" "level2" "level3")
 
@@ -0,0 +1,181 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*
+ *
+ * CONTENT
+ * Compares the latency of bringing up and tearing down a group of devices
+ * with one IPI request per operation against a single PM_BATCH request.
+ * 1) PROCESSOR requests and releases the TTC devices with XPm_RequestNode()
+ *    and XPm_ReleaseNode(), one round trip to the PLM per call.
+ * 2) PROCESSOR issues the same operations through XPm_Batch(). The release
+ *    operations are listed first and XPM_BATCH_ORDERED lets the PLM run the
+ *    requests before them.
+ * 3) The average time of both methods is printed together with the status
+ *    of every batched operation.
+ */
+
+#include <xil_printf.h>
+#include <xil_cache.h>
+#include <xstatus.h>
+#include <xtime_l.h>
+#include "pm_api_sys.h"
+#include "pm_client.h"
+#include "pm_defs.h"
+
+#ifdef SDT
+ #define TEST_CHANNEL_ID	XPAR_XIPIPSU_0_BASEADDR
+#else
+ #define TEST_CHANNEL_ID	XPAR_XIPIPSU_0_DEVICE_ID
+#endif
+
+#define BATCH_ITERATIONS	(16U)
+#define BATCH_NUM_DEVICES	(4U)
+
+static XIpiPsu IpiInst;
+
+static const u32 BatchDevices[BATCH_NUM_DEVICES] = {
+	PM_DEV_TTC_0,
+	PM_DEV_TTC_1,
+	PM_DEV_TTC_2,
+	PM_DEV_TTC_3,
+};
+
+static XPm_BatchOp BatchOps[2U * BATCH_NUM_DEVICES] __attribute__ ((aligned(64)));
+
+static XStatus IpiConfigure(XIpiPsu *const IpiInstPtr)
+{
+	XStatus Status;
+	XIpiPsu_Config *IpiCfgPtr;
+
+	/* Look Up the config data */
+	IpiCfgPtr = XIpiPsu_LookupConfig(TEST_CHANNEL_ID);
+	if (NULL == IpiCfgPtr) {
+		Status = XST_FAILURE;
+		pm_dbg("%s ERROR in getting CfgPtr\n", __func__);
+		return Status;
+	}
+
+	/* Init with the Cfg Data */
+	Status = XIpiPsu_CfgInitialize(IpiInstPtr, IpiCfgPtr, IpiCfgPtr->BaseAddress);
+	if (XST_SUCCESS != Status) {
+		pm_dbg("%s ERROR #%d in configuring IPI\n", __func__, Status);
+		return Status;
+	}
+	return Status;
+}
+
+/**
+ * SingleCalls() - request and release the devices with one IPI per operation
+ */
+static XStatus SingleCalls(void)
+{
+	XStatus Status = XST_FAILURE;
+	u32 i;
+
+	for (i = 0U; i < BATCH_NUM_DEVICES; i++) {
+		Status = XPm_RequestNode(BatchDevices[i], PM_CAP_ACCESS,
+					 MAX_QOS, REQUEST_ACK_BLOCKING);
+		if (XST_SUCCESS != Status) {
+			return Status;
+		}
+	}
+	for (i = 0U; i < BATCH_NUM_DEVICES; i++) {
+		Status = XPm_ReleaseNode(BatchDevices[i]);
+		if (XST_SUCCESS != Status) {
+			return Status;
+		}
+	}
+
+	return Status;
+}
+
+/**
+ * BatchCall() - request and release the devices with a single PM_BATCH
+ */
+static XStatus BatchCall(u32 *const FailIdx)
+{
+	u32 i;
+
+	/* Releases first; XPM_BATCH_ORDERED moves them after the requests */
+	for (i = 0U; i < BATCH_NUM_DEVICES; i++) {
+		BatchOps[i].ApiId = PM_RELEASE_NODE;
+		BatchOps[i].Args[0] = BatchDevices[i];
+
+		BatchOps[BATCH_NUM_DEVICES + i].ApiId = PM_REQUEST_NODE;
+		BatchOps[BATCH_NUM_DEVICES + i].Args[0] = BatchDevices[i];
+		BatchOps[BATCH_NUM_DEVICES + i].Args[1] = PM_CAP_ACCESS;
+		BatchOps[BATCH_NUM_DEVICES + i].Args[2] = MAX_QOS;
+		BatchOps[BATCH_NUM_DEVICES + i].Args[3] = REQUEST_ACK_BLOCKING;
+	}
+
+	return XPm_Batch(BatchOps, 2U * BATCH_NUM_DEVICES,
+			 XPM_BATCH_ORDERED | XPM_BATCH_STOP_ON_ERR, FailIdx);
+}
+
+int main(void)
+{
+	XStatus Status = XST_FAILURE;
+	XTime Start, End;
+	u64 SingleTicks, BatchTicks;
+	u32 FailIdx = XPM_BATCH_NO_FAILURE;
+	u32 i;
+
+	Status = IpiConfigure(&IpiInst);
+	if (XST_SUCCESS != Status) {
+		goto done;
+	}
+
+	Status = XPm_InitXilpm(&IpiInst);
+	if (XST_SUCCESS != Status) {
+		goto done;
+	}
+
+	XTime_GetTime(&Start);
+	for (i = 0U; i < BATCH_ITERATIONS; i++) {
+		Status = SingleCalls();
+		if (XST_SUCCESS != Status) {
+			xil_printf("Single calls failed 0x%x\r\n", Status);
+			goto done;
+		}
+	}
+	XTime_GetTime(&End);
+	SingleTicks = (End - Start) / BATCH_ITERATIONS;
+
+	XTime_GetTime(&Start);
+	for (i = 0U; i < BATCH_ITERATIONS; i++) {
+		Status = BatchCall(&FailIdx);
+		if (XST_SUCCESS != Status) {
+			xil_printf("Batch failed 0x%x at operation %d\r\n",
+				   Status, FailIdx);
+			break;
+		}
+	}
+	XTime_GetTime(&End);
+	BatchTicks = (End - Start) / BATCH_ITERATIONS;
+
+	for (i = 0U; i < (2U * BATCH_NUM_DEVICES); i++) {
+		xil_printf("Op %d API 0x%x node 0x%x status 0x%x\r\n", i,
+			   BatchOps[i].ApiId, BatchOps[i].Args[0],
+			   BatchOps[i].Status);
+	}
+	if (XST_SUCCESS != Status) {
+		goto done;
+	}
+
+	xil_printf("Bring-up/tear-down of %d devices: single %d us, batch %d us\r\n",
+		   BATCH_NUM_DEVICES,
+		   (u32)((SingleTicks * 1000000U) / COUNTS_PER_SECOND),
+		   (u32)((BatchTicks * 1000000U) / COUNTS_PER_SECOND));
+
+done:
+	if (XST_SUCCESS == Status) {
+		xil_printf("Successfully ran xilpm batch example\r\n");
+	} else {
+		xil_printf("xilpm batch example failed\r\n");
+	}
+
+	return Status;
+}
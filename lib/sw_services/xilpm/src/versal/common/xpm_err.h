@@ -19,6 +19,7 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  Amit   05/08/2019 Initial release
 * 2.00  Ravi   04/22/2020 Use decimal values to align with ZU+
+* 3.00  ag     10/18/2026 Add PM_BATCH error codes
 *
 * </pre>
 *
@@ -151,6 +152,11 @@ extern "C" {
 #define XPM_ERR_AIE_OPS_ENB_AXI_MM_ERR_EVENT	(2125L) /**< Error while Enabling of AXI-MM error events */
 #define XPM_ERR_AIE_OPS_SET_L2_CTRL_NPI_INTR	(2126L) /**< Error while Setting of L2 controller NPI INTR */
 
+/***************************** BATCH ERRORS ******************************/
+/************************** (2130L) - (2139L) ****************************/
+#define XPM_ERR_BATCH_OP_SKIPPED                 (2130L) /**< Batch operation skipped after earlier failure */
+#define XPM_ERR_BATCH_OP_UNSUPPORTED             (2131L) /**< API not supported in a batch request */
+
 /************************** Variable Definitions *****************************/
 
 #ifdef __cplusplus
@@ -14,6 +14,7 @@
 #include "pm_api_sys.h"
 #include "pm_callbacks.h"
 #include "pm_client.h"
+#include "xil_cache.h"
 #if defined  (XPM_SUPPORT) && (__aarch64__) && (EL1_NONSECURE == 1)
 #include "xil_smc.h"
 #endif
@@ -2209,3 +2210,70 @@ XStatus XPm_FeatureCheck(const u32 FeatureId, u32 *Version)
 done:
 	return Status;
 }
+
+/****************************************************************************/
+/**
+ * @brief  This function executes a list of PM operations with a single
+ * request to the PLM. Use it to bring up or tear down a peripheral whose
+ * device, clocks, resets and pins would otherwise need one IPI round trip
+ * each.
+ *
+ * @param  Ops		Array of operations. Each entry holds the API ID and
+ *			the arguments of the corresponding single API. The
+ *			array must be accessible by the PLM.
+ * @param  NumOps	Number of operations, at most XPM_BATCH_MAX_OPS
+ * @param  Flags	Combination of
+ *			- XPM_BATCH_ORDERED : run the operations in dependency
+ *			  order (request, clocks, resets, release) instead of
+ *			  array order
+ *			- XPM_BATCH_STOP_ON_ERR : skip the operations following
+ *			  the first failure
+ * @param  FailIdx	Returns the array index of the first failing operation
+ *			or XPM_BATCH_NO_FAILURE. Can be NULL.
+ *
+ * @return XST_SUCCESS if all operations succeeded else the status of the
+ * first failing operation or an error code
+ *
+ * @note   The status of every operation is returned in its Status field.
+ * Operations that were not executed report XPM_ERR_BATCH_OP_SKIPPED.
+ *
+ ****************************************************************************/
+XStatus XPm_Batch(XPm_BatchOp *const Ops, const u32 NumOps, const u32 Flags,
+		  u32 *const FailIdx)
+{
+	XStatus Status = (s32)XST_FAILURE;
+	u32 Payload[PAYLOAD_ARG_CNT];
+	u64 OpsAddr = (u64)(UINTPTR)Ops;
+	u32 Size = NumOps * (u32)sizeof(XPm_BatchOp);
+	u32 NumExec = 0U;
+	u32 Idx = XPM_BATCH_NO_FAILURE;
+
+	if ((NULL == Ops) || (0U == NumOps) || (NumOps > XPM_BATCH_MAX_OPS)) {
+		XPm_Err("Invalid argument to %s\r\n", __func__);
+		goto done;
+	}
+
+	/* The PLM reads and updates the list in memory */
+	Xil_DCacheFlushRange((UINTPTR)Ops, Size);
+
+	PACK_PAYLOAD4(Payload, PM_BATCH, (u32)OpsAddr, (u32)(OpsAddr >> 32U),
+		      NumOps, Flags);
+
+	/* Send request to the target module */
+	Status = XPm_IpiSend(PrimaryProc, Payload);
+	if (XST_SUCCESS != Status) {
+		goto done;
+	}
+
+	/* Return result from IPI return buffer */
+	Status = Xpm_IpiReadBuff32(PrimaryProc, &NumExec, &Idx, NULL);
+	Xil_DCacheInvalidateRange((UINTPTR)Ops, Size);
+	XPm_Dbg("Batch executed %u of %u operations\r\n", NumExec, NumOps);
+
+	if (NULL != FailIdx) {
+		*FailIdx = Idx;
+	}
+
+done:
+	return Status;
+}
@@ -157,6 +157,8 @@ void XPm_InitSuspendCb(const enum XPmSuspendReason Reason,
 		       const u32 Latency, const u32 State, const u32 Timeout);
 void XPm_AcknowledgeCb(const u32 Node, const XStatus Status, const u32 Oppoint);
 XStatus XPm_FeatureCheck(const u32 FeatureId, u32 *Version);
+XStatus XPm_Batch(XPm_BatchOp *const Ops, const u32 NumOps, const u32 Flags,
+		  u32 *const FailIdx);
 
 /** @cond INTERNAL */
 XStatus XPm_SetConfiguration(const u32 Address);
@@ -145,6 +145,7 @@ static XPlmi_AccessPerm_t XPlmi_PmAccessPermBuff[PM_API_MAX] =
 	XPLMI_ALL_IPI_NO_ACCESS(PM_NOC_CLOCK_ENABLE),
 	XPLMI_ALL_IPI_NO_ACCESS(PM_IF_NOC_CLOCK_ENABLE),
 	XPLMI_ALL_IPI_NO_ACCESS(PM_FORCE_HOUSECLEAN),
+	XPLMI_ALL_IPI_FULL_ACCESS(PM_BATCH),
 };
 
 static XPlmi_Module XPlmi_Pm =
@@ -498,6 +499,242 @@ done:
 	return Status;
 }
 
+/****************************************************************************/
+/**
+ * @brief  This function returns the execution rank of a batched operation.
+ * Operations with a lower rank run first when XPM_BATCH_ORDERED is set, so
+ * that devices are requested before their pins, clocks and resets are
+ * configured and released only after them.
+ *
+ * @param ApiId		PM API ID of the operation
+ *
+ * @return Execution rank of the operation
+ *
+ ****************************************************************************/
+static u32 XPm_BatchRank(const u32 ApiId)
+{
+	u32 Rank;
+
+	switch (ApiId) {
+	case PM_API(PM_REQUEST_NODE):
+		Rank = 0U;
+		break;
+	case PM_API(PM_SET_REQUIREMENT):
+		Rank = 1U;
+		break;
+	case PM_API(PM_PINCTRL_REQUEST):
+		Rank = 2U;
+		break;
+	case PM_API(PM_PINCTRL_SET_FUNCTION):
+	case PM_API(PM_PINCTRL_CONFIG_PARAM_SET):
+		Rank = 3U;
+		break;
+	case PM_API(PM_CLOCK_SETPARENT):
+	case PM_API(PM_CLOCK_SETDIVIDER):
+		Rank = 4U;
+		break;
+	case PM_API(PM_CLOCK_ENABLE):
+		Rank = 5U;
+		break;
+	case PM_API(PM_RESET_ASSERT):
+		Rank = 6U;
+		break;
+	case PM_API(PM_CLOCK_DISABLE):
+		Rank = 7U;
+		break;
+	case PM_API(PM_PINCTRL_RELEASE):
+		Rank = 8U;
+		break;
+	case PM_API(PM_RELEASE_NODE):
+		Rank = 9U;
+		break;
+	default:
+		Rank = 10U;
+		break;
+	}
+
+	return Rank;
+}
+
+/****************************************************************************/
+/**
+ * @brief  This function executes a single operation of a batch request
+ *
+ * @param SubsystemId	Subsystem ID of the caller
+ * @param Op		Operation to execute
+ * @param IpiReqType	IPI request type of the batch command
+ *
+ * @return XST_SUCCESS if successful else XPM_ERR_BATCH_OP_UNSUPPORTED or
+ * the error code returned by the underlying API
+ *
+ ****************************************************************************/
+static XStatus XPm_BatchExecOp(const u32 SubsystemId, const XPm_BatchOp *Op,
+			       const u32 IpiReqType)
+{
+	XStatus Status = XST_FAILURE;
+	const u32 *Args = Op->Args;
+
+	switch (Op->ApiId & 0xFFU) {
+	case PM_API(PM_REQUEST_NODE):
+		Status = XPm_RequestDevice(SubsystemId, Args[0], Args[1],
+					   Args[2], Args[3], IpiReqType);
+		break;
+	case PM_API(PM_RELEASE_NODE):
+		Status = XPm_ReleaseDevice(SubsystemId, Args[0], IpiReqType);
+		break;
+	case PM_API(PM_SET_REQUIREMENT):
+		Status = XPm_SetRequirement(SubsystemId, Args[0], Args[1],
+					    Args[2], Args[3]);
+		break;
+	case PM_API(PM_RESET_ASSERT):
+		Status = XPm_SetResetState(SubsystemId, Args[0], Args[1],
+					   IpiReqType);
+		break;
+	case PM_API(PM_CLOCK_ENABLE):
+		Status = XPm_SetClockState(SubsystemId, Args[0], 1);
+		break;
+	case PM_API(PM_CLOCK_DISABLE):
+		Status = XPm_SetClockState(SubsystemId, Args[0], 0);
+		break;
+	case PM_API(PM_CLOCK_SETPARENT):
+		Status = XPm_SetClockParent(SubsystemId, Args[0], Args[1]);
+		break;
+	case PM_API(PM_CLOCK_SETDIVIDER):
+		Status = XPm_SetClockDivider(SubsystemId, Args[0], Args[1]);
+		break;
+	case PM_API(PM_PINCTRL_REQUEST):
+		Status = XPm_PinCtrlRequest(SubsystemId, Args[0]);
+		break;
+	case PM_API(PM_PINCTRL_RELEASE):
+		Status = XPm_PinCtrlRelease(SubsystemId, Args[0]);
+		break;
+	case PM_API(PM_PINCTRL_SET_FUNCTION):
+		Status = XPm_SetPinFunction(SubsystemId, Args[0], Args[1]);
+		break;
+	case PM_API(PM_PINCTRL_CONFIG_PARAM_SET):
+		Status = XPm_SetPinParameter(SubsystemId, Args[0], Args[1],
+					     Args[2]);
+		break;
+	default:
+		Status = XPM_ERR_BATCH_OP_UNSUPPORTED;
+		break;
+	}
+
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief  This function executes a list of PM operations placed in shared
+ * memory by the caller, in a single pass of the PM command handler. The
+ * completion status of every operation is written back to its entry.
+ *
+ * @param SubsystemId	Subsystem ID of the caller
+ * @param AddrLow	Lower 32 bits of the operation list address
+ * @param AddrHigh	Upper 32 bits of the operation list address
+ * @param NumOps	Number of operations in the list
+ * @param Flags		XPM_BATCH_ORDERED to run the operations in dependency
+ *			order, XPM_BATCH_STOP_ON_ERR to skip the operations
+ *			following a failure
+ * @param IpiReqType	IPI request type of the batch command
+ * @param Response	Response[0] returns the number of operations executed
+ *			and Response[1] the list index of the first failing
+ *			operation or XPM_BATCH_NO_FAILURE
+ *
+ * @return XST_SUCCESS if all operations succeeded, else the status of the
+ * first failing operation or an error code
+ *
+ * @note   Operations that were not executed report XPM_ERR_BATCH_OP_SKIPPED.
+ * Only the device, requirement, reset, clock and pin control APIs listed in
+ * XPm_BatchExecOp() are accepted in a batch.
+ *
+ ****************************************************************************/
+static XStatus XPm_Batch(const u32 SubsystemId, const u32 AddrLow,
+			 const u32 AddrHigh, const u32 NumOps, const u32 Flags,
+			 const u32 IpiReqType, u32 *const Response)
+{
+	XStatus Status = XST_FAILURE;
+	XStatus OpStatus;
+	static XPm_BatchOp BatchOps[XPM_BATCH_MAX_OPS];
+	u8 Order[XPM_BATCH_MAX_OPS];
+	u64 Addr = ((u64)AddrHigh << 32U) | (u64)AddrLow;
+	u32 Size = NumOps * (u32)sizeof(XPm_BatchOp);
+	u32 NumExec = 0U;
+	u32 FailIdx = XPM_BATCH_NO_FAILURE;
+	u32 Rank;
+	u32 i, j;
+	u8 Idx;
+
+	if ((0U == NumOps) || (NumOps > XPM_BATCH_MAX_OPS) ||
+	    (0U != (Addr & 0x3U))) {
+		Status = XST_INVALID_PARAM;
+		goto done;
+	}
+
+	Status = XPlmi_VerifyAddrRange(Addr, Addr + Size - 1U);
+	if (XST_SUCCESS != Status) {
+		Status = XPM_PM_NO_ACCESS;
+		goto done;
+	}
+
+	/* Fetch the whole list in one transfer */
+	Status = XPlmi_DmaXfr(Addr, (u64)(UINTPTR)BatchOps, Size >> 2U,
+			      XPLMI_PMCDMA_0);
+	if (XST_SUCCESS != Status) {
+		goto done;
+	}
+
+	/*
+	 * Stable insertion sort of the list indices by execution rank, so
+	 * operations of the same rank keep the order given by the caller.
+	 */
+	for (i = 0U; i < NumOps; i++) {
+		BatchOps[i].Status = (u32)XPM_ERR_BATCH_OP_SKIPPED;
+		Idx = (u8)i;
+		j = i;
+		if (0U != (Flags & XPM_BATCH_ORDERED)) {
+			Rank = XPm_BatchRank(BatchOps[i].ApiId & 0xFFU);
+			while ((j > 0U) &&
+			       (XPm_BatchRank(BatchOps[Order[j - 1U]].ApiId & 0xFFU) > Rank)) {
+				Order[j] = Order[j - 1U];
+				j--;
+			}
+		}
+		Order[j] = Idx;
+	}
+
+	Status = XST_SUCCESS;
+	for (i = 0U; i < NumOps; i++) {
+		if ((XST_SUCCESS != Status) &&
+		    (0U != (Flags & XPM_BATCH_STOP_ON_ERR))) {
+			break;
+		}
+		Idx = Order[i];
+		OpStatus = XPm_BatchExecOp(SubsystemId, &BatchOps[Idx],
+					   IpiReqType);
+		BatchOps[Idx].Status = (u32)OpStatus;
+		++NumExec;
+		if ((XST_SUCCESS != OpStatus) && (XST_SUCCESS == Status)) {
+			PmErr("Batch op %u (API 0x%x) failed 0x%x\r\n", Idx,
+			      BatchOps[Idx].ApiId, OpStatus);
+			FailIdx = Idx;
+			Status = OpStatus;
+		}
+	}
+
+	/* Write the status vector back to the caller's list */
+	if (XST_SUCCESS != XPlmi_DmaXfr((u64)(UINTPTR)BatchOps, Addr,
+					Size >> 2U, XPLMI_PMCDMA_0)) {
+		Status = XPM_PM_INTERNAL;
+	}
+
+	Response[0] = NumExec;
+	Response[1] = FailIdx;
+
+done:
+	return Status;
+}
+
 static int XPm_ProcessCmd(XPlmi_Cmd * Cmd)
 {
 	int Status = XST_FAILURE;
@@ -655,6 +892,10 @@ static int XPm_ProcessCmd(XPlmi_Cmd * Cmd)
 		Status = XPm_SetMaxLatency(SubsystemId, Pload[0],
 				Pload[1]);
 		break;
+	case PM_API(PM_BATCH):
+		Status = XPm_Batch(SubsystemId, Pload[0], Pload[1], Pload[2],
+				   Pload[3], Cmd->IpiReqType, ApiResponse);
+		break;
 	case PM_API(PM_GET_NODE_STATUS):
 		Status = XPm_GetDeviceStatus(SubsystemId, Pload[0], (XPm_DeviceStatus *)ApiResponse);
 		break;
@@ -3539,6 +3780,7 @@ XStatus XPm_FeatureCheck(const u32 ApiId, u32 *const Version)
 	case PM_API(PM_PINCTRL_SET_FUNCTION):
 	case PM_API(PM_PINCTRL_CONFIG_PARAM_GET):
 	case PM_API(PM_PINCTRL_CONFIG_PARAM_SET):
+	case PM_API(PM_BATCH):
 		*Version = XST_API_BASE_VERSION;
 		Status = XST_SUCCESS;
 		break;
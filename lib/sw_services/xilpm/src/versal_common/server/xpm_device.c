@@ -183,17 +183,7 @@ static XStatus SetAieDeviceNode(u32 Id, XPm_Device *Device)
 
 static XPm_Requirement *FindReqm(const XPm_Device *Device, const XPm_Subsystem *Subsystem)
 {
-	XPm_Requirement *Reqm = NULL;
-
-	Reqm = Device->Requirements;
-	while (NULL != Reqm) {
-		if (Reqm->Subsystem == Subsystem) {
-			break;
-		}
-		Reqm = Reqm->NextSubsystem;
-	}
-
-	return Reqm;
+	return XPmRequirement_Find(Device, Subsystem);
 }
 
 struct XPm_Reqm *XPmDevice_FindRequirement(const u32 DeviceId, const u32 SubsystemId)
@@ -246,27 +236,23 @@ static XStatus SetDeviceNode(u32 Id, XPm_Device *Device)
  ****************************************************************************/
 u32 XPmDevice_GetSubsystemIdOfCore(const XPm_Device *Device)
 {
-	const XPm_Requirement *Reqm;
-	const XPm_Subsystem *Subsystem = NULL;
-	u32 Idx, SubSystemId;
-	u32 SubsysIdx = XPmSubsystem_GetMaxSubsysIdx();
+	const XPm_Requirement *Reqm = NULL;
+	u32 SubSystemId = INVALID_SUBSYSID;
 
-	for (Idx = 0; Idx <= SubsysIdx; Idx++) {
-		Subsystem = XPmSubsystem_GetByIndex(Idx);
-		if (NULL != Subsystem) {
-			Reqm = FindReqm(Device, Subsystem);
-			if ((NULL != Reqm) && (1U == Reqm->Allocated)) {
-				break;
-			}
-		}
+	if (0U == Device->AllocCnt) {
+		goto done;
 	}
 
-	if (SubsysIdx < Idx) {
-		SubSystemId = INVALID_SUBSYSID;
-	} else {
-		SubSystemId = Subsystem->Id;
+	Reqm = Device->Requirements;
+	while (NULL != Reqm) {
+		if (1U == Reqm->Allocated) {
+			SubSystemId = Reqm->Subsystem->Id;
+			break;
+		}
+		Reqm = Reqm->NextSubsystem;
 	}
 
+done:
 	return SubSystemId;
 }
 
@@ -283,12 +269,13 @@ u32 XPmDevice_GetSubsystemIdOfCore(const XPm_Device *Device)
  ****************************************************************************/
 static u32 GetMaxCapabilities(const XPm_Device* const Device)
 {
-	const XPm_Requirement* Reqm = Device->Requirements;
 	u32 MaxCaps = 0U;
+	u32 Bit;
 
-	while (NULL != Reqm) {
-		MaxCaps |= Reqm->Curr.Capabilities;
-		Reqm = Reqm->NextSubsystem;
+	for (Bit = 0U; Bit < (u32)REQ_INFO_CAPS_BIT_FIELD_SIZE; Bit++) {
+		if (0U != Device->CapsCnt[Bit]) {
+			MaxCaps |= BIT32(Bit);
+		}
 	}
 
 	return MaxCaps;
@@ -333,16 +320,9 @@ done:
 static u32 IsRunning(const XPm_Device *Device)
 {
 	u32 Running = 0;
-	const XPm_Requirement *Reqm = Device->Requirements;
 
-	while (NULL != Reqm) {
-		if (Reqm->Allocated > 0U) {
-			if (Reqm->Curr.Capabilities > 0U) {
-				Running = 1;
-				break;
-			}
-		}
-		Reqm = Reqm->NextSubsystem;
+	if (0U != Device->ActiveCnt) {
+		Running = 1;
 	}
 
 	return Running;
@@ -613,7 +593,7 @@ static XStatus HandleDeviceEvent(XPm_Node *Node, u32 Event)
 				Device->Node.Flags &= (u8)(~NODE_IDLE_DONE);
 				if (Device->WfPwrUseCnt == Device->Power->UseCount) {
 					if (1U == Device->WfDealloc) {
-						Device->PendingReqm->Allocated = 0;
+						XPmRequirement_SetAllocated(Device->PendingReqm, 0U);
 						Device->WfDealloc = 0;
 					}
 					if(Device->PendingReqm != NULL) {
@@ -1031,19 +1011,19 @@ static XStatus DevRequest(XPm_Device *Device, XPm_Subsystem *Subsystem,
 	/* Check whether this device is shareable */
 	UsagePolicy = USAGE_POLICY(Reqm->Flags);
 	if ((UsagePolicy == (u16)REQ_TIME_SHARED) || (UsagePolicy == (u16)REQ_NONSHARED)) {
-			//Check if it already requested by other subsystem. If yes, return
-			const XPm_Requirement *NextReqm = Reqm->NextSubsystem;
-			while (NULL != NextReqm) {
-				if (1U == NextReqm->Allocated) {
-					Status = XPM_PM_NODE_USED;
-					goto done;
-				}
-				NextReqm = NextReqm->NextSubsystem;
+			/*
+			 * Check if it is already requested by any other subsystem.
+			 * Reqm is not allocated here, so AllocCnt only counts the
+			 * other subsystems. If yes, return.
+			 */
+			if (0U != Device->AllocCnt) {
+				Status = XPM_PM_NODE_USED;
+				goto done;
 			}
 	}
 
 	/* Allocated device for the subsystem */
-	Reqm->Allocated = 1U;
+	XPmRequirement_SetAllocated(Reqm, 1U);
 
 	Status = Device->DeviceOps->SetRequirement(Device, Subsystem,
 						   Capabilities, QoS);
@@ -1102,15 +1082,14 @@ static XStatus SetDevRequirement(XPm_Device *Device, const XPm_Subsystem *Subsys
 		TempReqm.Capabilities = Device->PendingReqm->Curr.Capabilities;
 		TempReqm.QoS = Device->PendingReqm->Curr.QoS;
 
-		Device->PendingReqm->Curr.Capabilities =
-			(Capabilities & BITMASK(REQ_INFO_CAPS_BIT_FIELD_SIZE));
+		XPmRequirement_SetCurrCaps(Device->PendingReqm, Capabilities);
 		Device->PendingReqm->Curr.QoS = QoS;
 	}
 
 	Status = XPmDevice_UpdateStatus(Device);
 
 	if (XST_SUCCESS != Status) {
-		Device->PendingReqm->Curr.Capabilities = TempReqm.Capabilities;
+		XPmRequirement_SetCurrCaps(Device->PendingReqm, TempReqm.Capabilities);
 		Device->PendingReqm->Curr.QoS = TempReqm.QoS;
 	} else if ((u32)PM_CAP_UNUSABLE == Capabilities) {
 		/* Schedule next requirement to 0 */
@@ -1987,12 +1966,9 @@ XStatus XPmDevice_GetPermissions(const XPm_Device *Device, u32 *PermissionMask)
 
 	Reqm = Device->Requirements;
 	while (NULL != Reqm) {
-		if (1U == Reqm->Allocated) {
-			for (Idx = 0; Idx <= SubsysIdx; Idx++) {
-				if (Reqm->Subsystem == XPmSubsystem_GetByIndex(Idx)) {
-					*PermissionMask |= ((u32)1U << Idx);
-				}
-			}
+		Idx = NODEINDEX(Reqm->Subsystem->Id);
+		if ((1U == Reqm->Allocated) && (Idx <= SubsysIdx)) {
+			*PermissionMask |= ((u32)1U << Idx);
 		}
 		Reqm = Reqm->NextSubsystem;
 	}
@@ -2359,18 +2335,20 @@ done:
 u32 XPmDevice_GetUsageStatus(const XPm_Subsystem *Subsystem, const XPm_Device *Device)
 {
 	u32 UsageStatus = 0;
-	const XPm_Requirement *Reqm = Device->Requirements;
+	u32 OwnCnt = 0U;
+	const XPm_Requirement *Reqm = NULL;
 
-	while (NULL != Reqm) {
-		if (1U == Reqm->Allocated) {
-			/* This subsystem is currently using this device */
-			if (Subsystem == Reqm->Subsystem) {
-				UsageStatus |= (u32)PM_USAGE_CURRENT_SUBSYSTEM;
-			} else {
-				UsageStatus |= (u32)PM_USAGE_OTHER_SUBSYSTEM;
-			}
-		}
-		Reqm = Reqm->NextSubsystem;
+	if (NULL != Subsystem) {
+		Reqm = FindReqm(Device, Subsystem);
+	}
+
+	/* This subsystem is currently using this device */
+	if ((NULL != Reqm) && (1U == Reqm->Allocated)) {
+		UsageStatus |= (u32)PM_USAGE_CURRENT_SUBSYSTEM;
+		OwnCnt = 1U;
+	}
+	if (Device->AllocCnt > OwnCnt) {
+		UsageStatus |= (u32)PM_USAGE_OTHER_SUBSYSTEM;
 	}
 
 	return UsageStatus;
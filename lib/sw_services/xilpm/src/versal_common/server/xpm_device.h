@@ -12,6 +12,7 @@
 #include "xpm_power.h"
 #include "xpm_clock.h"
 #include "xpm_reset.h"
+#include "xpm_requirement_info.h"
 #include "xpm_device_plat.h"
 
 #ifdef __cplusplus
@@ -116,6 +117,10 @@ struct XPm_DeviceNode {
 	const XPm_DeviceFsm* DeviceFsm; /**< Device finite state machine */
 	XStatus (* HandleEvent)(XPm_Node *Node, u32 Event);
 		/**< HandleEvent: Pointer to event handler */
+	u8 AllocCnt; /**< Number of subsystems which have allocated the device */
+	u8 ActiveCnt; /**< Allocated requirements with non-zero capabilities */
+	u8 CapsCnt[REQ_INFO_CAPS_BIT_FIELD_SIZE];
+		/**< Number of requirements holding each capability bit */
 };
 
 struct XPm_RegAttr {
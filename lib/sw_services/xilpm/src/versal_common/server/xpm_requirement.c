@@ -9,6 +9,66 @@
 #include "xpm_power.h"
 #include "xpm_api.h"
 
+/* Number of entries in the requirement index, must be a power of 2 */
+#define XPM_REQM_INDEX_SIZE		(256U)
+#define XPM_REQM_INDEX_SHIFT		(24U)
+
+/*
+ * Direct mapped (device, subsystem) requirement index. Requirements are
+ * never freed, so a hit only needs to be checked against the key; a miss
+ * falls back to the device requirement list and refills the entry.
+ */
+static XPm_Requirement *ReqmIndex[XPM_REQM_INDEX_SIZE];
+
+static u32 ReqmIndexSlot(const XPm_Device *Device, const XPm_Subsystem *Subsystem)
+{
+	u32 Key = Device->Node.Id ^ (NODEINDEX(Subsystem->Id) * 0x85EBCA6BU);
+
+	return (Key * 0x9E3779B1U) >> XPM_REQM_INDEX_SHIFT;
+}
+
+/****************************************************************************/
+/**
+ * @brief  Add or remove the contribution of a requirement to the aggregate
+ * usage counters of its device
+ *
+ * @param Reqm		Requirement
+ * @param Add		1 to add the contribution, 0 to remove it
+ *
+ ****************************************************************************/
+static void ReqmStatsUpdate(const XPm_Requirement *Reqm, u32 Add)
+{
+	XPm_Device *Device = Reqm->Device;
+	u32 Caps = Reqm->Curr.Capabilities;
+	u32 Bit;
+
+	if (1U == Add) {
+		if (1U == Reqm->Allocated) {
+			Device->AllocCnt++;
+			if (0U != Caps) {
+				Device->ActiveCnt++;
+			}
+		}
+		for (Bit = 0U; Bit < (u32)REQ_INFO_CAPS_BIT_FIELD_SIZE; Bit++) {
+			if (0U != (Caps & BIT32(Bit))) {
+				Device->CapsCnt[Bit]++;
+			}
+		}
+	} else {
+		if (1U == Reqm->Allocated) {
+			Device->AllocCnt--;
+			if (0U != Caps) {
+				Device->ActiveCnt--;
+			}
+		}
+		for (Bit = 0U; Bit < (u32)REQ_INFO_CAPS_BIT_FIELD_SIZE; Bit++) {
+			if (0U != (Caps & BIT32(Bit))) {
+				Device->CapsCnt[Bit]--;
+			}
+		}
+	}
+}
+
 static void XPmRequirement_Init(XPm_Requirement *Reqm, XPm_Subsystem *Subsystem,
 				XPm_Device *Device, u32 Flags,
 				u32 PreallocCaps, u32 PreallocQoS)
@@ -35,6 +95,9 @@ static void XPmRequirement_Init(XPm_Requirement *Reqm, XPm_Subsystem *Subsystem,
 	Reqm->Next.Capabilities = XPM_MIN_CAPABILITY;
 	Reqm->Next.Latency = XPM_MAX_LATENCY;
 	Reqm->Next.QoS = XPM_MAX_QOS;
+
+	ReqmStatsUpdate(Reqm, 1U);
+	ReqmIndex[ReqmIndexSlot(Device, Subsystem)] = Reqm;
 }
 
 XStatus XPmRequirement_Add(XPm_Subsystem *Subsystem, XPm_Device *Device,
@@ -69,6 +132,7 @@ void XPm_RequiremntUpdate(XPm_Requirement *Reqm)
 void XPmRequirement_Clear(XPm_Requirement* Reqm)
 {
 	if(NULL != Reqm) {
+		ReqmStatsUpdate(Reqm, 0U);
 		/* Clear flag - master is not using slave anymore */
 		Reqm->Allocated = 0;
 		/* Release current and next requirements */
@@ -78,7 +142,106 @@ void XPmRequirement_Clear(XPm_Requirement* Reqm)
 		Reqm->Next.Capabilities = XPM_MIN_CAPABILITY;
 		Reqm->Next.Latency = XPM_MAX_LATENCY;
 		Reqm->Next.QoS = XPM_MAX_QOS;
+		ReqmStatsUpdate(Reqm, 1U);
+	}
+}
+
+/****************************************************************************/
+/**
+ * @brief  Set the allocation flag of a requirement
+ *
+ * @param Reqm		Requirement
+ * @param Allocated	1 if the device is allocated to the subsystem, else 0
+ *
+ * @note   Allocated must only be changed through this function so that the
+ * usage counters of the device stay in sync.
+ *
+ ****************************************************************************/
+void XPmRequirement_SetAllocated(XPm_Requirement *Reqm, u8 Allocated)
+{
+	ReqmStatsUpdate(Reqm, 0U);
+	Reqm->Allocated = Allocated;
+	ReqmStatsUpdate(Reqm, 1U);
+}
+
+/****************************************************************************/
+/**
+ * @brief  Set the current capabilities of a requirement
+ *
+ * @param Reqm		Requirement
+ * @param Caps		Current capabilities
+ *
+ * @note   Curr.Capabilities must only be changed through this function so
+ * that the usage counters of the device stay in sync.
+ *
+ ****************************************************************************/
+void XPmRequirement_SetCurrCaps(XPm_Requirement *Reqm, u32 Caps)
+{
+	ReqmStatsUpdate(Reqm, 0U);
+	Reqm->Curr.Capabilities = (Caps & BITMASK(REQ_INFO_CAPS_BIT_FIELD_SIZE));
+	ReqmStatsUpdate(Reqm, 1U);
+}
+
+/****************************************************************************/
+/**
+ * @brief  Recompute the usage counters of a device from its requirements
+ *
+ * @param Device	Device whose counters are rebuilt
+ *
+ * @note   Used after the requirements were restored wholesale, e.g. on PLM
+ * update.
+ *
+ ****************************************************************************/
+void XPmRequirement_RebuildStats(XPm_Device *Device)
+{
+	const XPm_Requirement *Reqm = Device->Requirements;
+	u32 Bit;
+
+	Device->AllocCnt = 0U;
+	Device->ActiveCnt = 0U;
+	for (Bit = 0U; Bit < (u32)REQ_INFO_CAPS_BIT_FIELD_SIZE; Bit++) {
+		Device->CapsCnt[Bit] = 0U;
+	}
+
+	while (NULL != Reqm) {
+		ReqmStatsUpdate(Reqm, 1U);
+		Reqm = Reqm->NextSubsystem;
+	}
+}
+
+/****************************************************************************/
+/**
+ * @brief  Find the requirement of a subsystem on a device
+ *
+ * @param Device	Device
+ * @param Subsystem	Subsystem
+ *
+ * @return Pointer to the requirement or NULL if the subsystem has none on
+ * the device
+ *
+ ****************************************************************************/
+XPm_Requirement *XPmRequirement_Find(const XPm_Device *Device,
+				     const XPm_Subsystem *Subsystem)
+{
+	u32 Slot = ReqmIndexSlot(Device, Subsystem);
+	XPm_Requirement *Reqm = ReqmIndex[Slot];
+
+	if ((NULL != Reqm) && (Reqm->Device == Device) &&
+	    (Reqm->Subsystem == Subsystem)) {
+		goto done;
+	}
+
+	Reqm = Device->Requirements;
+	while (NULL != Reqm) {
+		if (Reqm->Subsystem == Subsystem) {
+			ReqmIndex[Slot] = Reqm;
+			break;
+		}
+		Reqm = Reqm->NextSubsystem;
 	}
+
+done:
+	return Reqm;
 }
 
 XStatus XPmRequirement_Release(XPm_Requirement *Reqm, XPm_ReleaseScope Scope)
@@ -149,6 +312,10 @@ XStatus XPmRequirement_UpdateScheduled(const XPm_Subsystem *Subsystem, u32 Swap)
 	XStatus Status = XST_FAILURE;
 	XPm_Requirement *Reqm = Subsystem->Requirements;
 	XPm_ReqmInfo TempReq;
+#ifdef PLM_PRINT_PERF_PM
+	u64 StartTime = XPlmi_GetTimerValue();
+	XPlmi_PerfTime PerfTime = {0U};
+#endif
 
 	if (NULL == Reqm) {
 		Status = XST_SUCCESS;
@@ -167,7 +334,7 @@ XStatus XPmRequirement_UpdateScheduled(const XPm_Subsystem *Subsystem, u32 Swap)
 				Reqm->Next.QoS = Reqm->Curr.QoS;
 			}
 
-			Reqm->Curr.Capabilities = TempReq.Capabilities;
+			XPmRequirement_SetCurrCaps(Reqm, TempReq.Capabilities);
 			Reqm->Curr.Latency = TempReq.Latency;
 			Reqm->Curr.QoS = TempReq.QoS;
 
@@ -182,30 +349,32 @@ XStatus XPmRequirement_UpdateScheduled(const XPm_Subsystem *Subsystem, u32 Swap)
 	Status = XST_SUCCESS;
 
 done:
+#ifdef PLM_PRINT_PERF_PM
+	XPlmi_MeasurePerfTime(StartTime, &PerfTime);
+	XPlmi_Printf(DEBUG_PRINT_PERF,
+		"%u.%03u ms: Scheduled requirements of subsystem 0x%x\n\r",
+		(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac, Subsystem->Id);
+#endif
 	return Status;
 }
 
 XStatus XPmRequirement_IsExclusive(const XPm_Requirement *Reqm)
 {
 	XStatus Status = XST_FAILURE;
-	const XPm_Requirement *Next_Reqm;
 
 	if (NULL == Reqm) {
 		goto done;
 	}
 
-	if (1U != Reqm->Allocated) {
+	/*
+	 * Only this subsystem has the device allocated. AllocCnt counts the
+	 * allocations of every subsystem, not only those after Reqm in the
+	 * device requirement list.
+	 */
+	if ((1U != Reqm->Allocated) || (1U != Reqm->Device->AllocCnt)) {
 		goto done;
 	}
 
-	Next_Reqm = Reqm->NextSubsystem;
-	while (NULL != Next_Reqm) {
-		if (1U == Next_Reqm->Allocated) {
-			goto done;
-		}
-		Next_Reqm = Next_Reqm->NextSubsystem;
-	}
-
 	Status = XST_SUCCESS;
 done:
 	return Status;
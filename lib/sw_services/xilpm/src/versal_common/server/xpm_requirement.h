@@ -78,6 +78,11 @@ XStatus XPmRequirement_Release(XPm_Requirement *Reqm, XPm_ReleaseScope Scope);
 void XPmRequirement_Clear(XPm_Requirement* Reqm);
 XStatus XPmRequirement_UpdateScheduled(const XPm_Subsystem *Subsystem, u32 Swap);
 XStatus XPmRequirement_IsExclusive(const XPm_Requirement *Reqm);
+void XPmRequirement_SetAllocated(XPm_Requirement *Reqm, u8 Allocated);
+void XPmRequirement_SetCurrCaps(XPm_Requirement *Reqm, u32 Caps);
+void XPmRequirement_RebuildStats(XPm_Device *Device);
+XPm_Requirement *XPmRequirement_Find(const XPm_Device *Device,
+				     const XPm_Subsystem *Subsystem);
 
 #ifdef __cplusplus
 }
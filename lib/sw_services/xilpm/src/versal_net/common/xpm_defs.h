@@ -681,6 +681,30 @@ enum XPmNotifyEvent {
 	XPM_DSTN_CORE_0:XPM_DSTN_CORE_1)
 /** @} */
 
+/**
+ * @name PM batch request
+ * @{
+ */
+/**
+ * PM batch request limits and flags
+ */
+#define XPM_BATCH_MAX_OPS		(64U)
+#define XPM_BATCH_ARG_CNT		(4U)
+#define XPM_BATCH_NO_FAILURE		(0xFFFFFFFFU)
+#define XPM_BATCH_ORDERED		(0x1U)
+#define XPM_BATCH_STOP_ON_ERR		(0x2U)
+/** @} */
+
+/**
+ * One operation of a PM_BATCH request. The array of operations lives in
+ * memory shared with the PLM; Status is written back by the PLM.
+ */
+typedef struct XPm_BatchOp {
+	u32 ApiId;				/**< PM API ID of the operation */
+	u32 Status;				/**< Completion status of the operation */
+	u32 Args[XPM_BATCH_ARG_CNT];		/**< Arguments as in the single API */
+} XPm_BatchOp;
+
 #ifdef __cplusplus
 }
 #endif
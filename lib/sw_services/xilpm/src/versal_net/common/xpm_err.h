@@ -19,6 +19,7 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  Amit   05/08/2019 Initial release
 * 2.00  Ravi   04/22/2020 Use decimal values to align with ZU+
+* 3.00  ag     10/18/2026 Add PM_BATCH error codes
 *
 * </pre>
 *
@@ -142,6 +143,11 @@ extern "C" {
 #define XPM_ERR_NEW_DATA_FLAG_TIMEOUT            (2111L) /**< Sysmon new data flag timeout */
 #define XPM_ERR_RAIL_VOLTAGE                     (2112L) /**< Power rail not ramped up */
 
+/***************************** BATCH ERRORS ******************************/
+/************************** (2130L) - (2139L) ****************************/
+#define XPM_ERR_BATCH_OP_SKIPPED                 (2130L) /**< Batch operation skipped after earlier failure */
+#define XPM_ERR_BATCH_OP_UNSUPPORTED             (2131L) /**< API not supported in a batch request */
+
 /************************** Variable Definitions *****************************/
 
 #ifdef __cplusplus
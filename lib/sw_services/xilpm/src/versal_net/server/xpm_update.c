@@ -402,6 +402,9 @@ static XStatus RestoreRequirements(XPm_Device *SavedNode, XPm_Device *Node)
 		}
 		SavedReq = GET_SAVED_PTR_MEMBER_FROM_TYPE(XPm_Requirement, SavedReq, SavedReq->NextSubsystem);
 	}
+	/* Usage counters are not saved, recompute them from restored requirements */
+	XPmRequirement_RebuildStats(Node);
+
 	/* Restore Pending Requirement*/
 	if (NULL != SavedPendingReq){
 		XPm_Requirement *Req = GetCurReqFromSavedReq(SavedPendingReq);
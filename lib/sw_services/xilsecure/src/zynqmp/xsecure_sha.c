@@ -54,6 +54,7 @@
 * 4.7   am   11/26/21 Resolved doxygen warnings
 * 5.2   ng   07/05/23 add SDT support
 *	ss   04/05/24 Fixed doxygen warnings
+* 5.3   ag   10/18/26 Added XSecure_Sha3UpdateCopy API
 *
 * @note
 *
@@ -366,6 +367,93 @@ END:
 }
 
 
+/*****************************************************************************/
+/**
+ * @brief
+ * This function updates the SHA3 engine with the input data and copies the
+ * data to the destination address. When the data can be streamed, the
+ * secure stream switch feeds the CSU DMA source channel to both the SHA3
+ * engine and the CSU DMA destination channel, so the data is hashed while it
+ * is copied and is read only once. Otherwise the data is hashed with
+ * XSecure_Sha3Update and copied by the processor.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ * @param	Data 		Pointer to the input data for hashing.
+ * @param	DstAddr 	Address to which the data is copied.
+ * @param	Size 		Size of the input data in bytes.
+ *
+ * @return	XST_SUCCESS if the update is successful
+ * 		XST_FAILURE if there is a failure in SSS config or DMA transfer
+ *
+ * @note	The data is streamed if no partial block is buffered, the data is
+ *		word aligned and Size is a multiple of the SHA3 block length.
+ *		Cache maintenance of Data and the destination range is left to
+ *		the caller, which must allow for either way of copying.
+ *
+ ******************************************************************************/
+u32 XSecure_Sha3UpdateCopy(XSecure_Sha3 *InstancePtr, const u8 *Data,
+		u64 DstAddr, const u32 Size)
+{
+	u32 Status = (u32)XST_FAILURE;
+
+	/* Asserts validate the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->Sha3State == XSECURE_SHA3_ENGINE_STARTED);
+
+	if ((InstancePtr->PartialLen != 0U) ||
+		(InstancePtr->IsLastUpdate == TRUE) ||
+		(((UINTPTR)Data & XCSUDMA_ADDR_LSB_MASK) != 0U) ||
+		(Size == 0U) || (Size > XSECURE_CSU_DMA_MAX_TRANSFER) ||
+		((Size % XSECURE_SHA3_BLOCK_LEN) != 0U)) {
+		Status = XSecure_Sha3Update(InstancePtr, Data, Size);
+		if (Status == (u32)XST_SUCCESS) {
+			XSecure_MemCpy64(DstAddr, (u64)(UINTPTR)Data, Size);
+		}
+		goto END;
+	}
+
+	/* Configure the SSS for SHA3 hashing and DMA loop back */
+	Status = XSecure_SssShaDmaLoopBack(&(InstancePtr->SssInstance),
+			InstancePtr->CsuDmaPtr->Config.DmaType);
+	if (Status != (u32)XST_SUCCESS) {
+		goto RESET;
+	}
+
+	XCsuDma_Transfer(InstancePtr->CsuDmaPtr, XCSUDMA_DST_CHANNEL,
+			DstAddr, Size / 4U, 0U);
+	XCsuDma_Transfer(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
+			(UINTPTR)Data, Size / 4U, 0U);
+
+	Status = XCsuDma_WaitForDoneTimeout(InstancePtr->CsuDmaPtr,
+			XCSUDMA_SRC_CHANNEL);
+	if (Status != (u32)XST_SUCCESS) {
+		goto RESET;
+	}
+	Status = XCsuDma_WaitForDoneTimeout(InstancePtr->CsuDmaPtr,
+			XCSUDMA_DST_CHANNEL);
+	if (Status != (u32)XST_SUCCESS) {
+		goto RESET;
+	}
+
+	/* Acknowledge the transfer has completed */
+	XCsuDma_IntrClear(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
+			XCSUDMA_IXR_DONE_MASK);
+	XCsuDma_IntrClear(InstancePtr->CsuDmaPtr, XCSUDMA_DST_CHANNEL,
+			XCSUDMA_IXR_DONE_MASK);
+
+	/* Account the data for the final padding */
+	InstancePtr->Sha3Len += Size;
+	goto END;
+
+RESET:
+	/* Set SHA under reset on failure condition */
+	XSecure_SetReset(InstancePtr->BaseAddress,
+			XSECURE_CSU_SHA3_RESET_OFFSET);
+	InstancePtr->Sha3State = XSECURE_SHA3_INITIALIZED;
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief
@@ -52,6 +52,7 @@
 *       ana  10/15/20 Updated doxygen tags
 * 5.2	mmd  07/09/23 Included header file for crypto algorithm information
 *	ss   04/05/24 Fixed doxygen warnings
+* 5.3   ag   10/18/26 Added XSecure_Sha3UpdateCopy API
 *
 * </pre>
 *
@@ -141,6 +142,10 @@ void XSecure_Sha3Start(XSecure_Sha3 *InstancePtr);
 u32 XSecure_Sha3Update(XSecure_Sha3 *InstancePtr, const u8 *Data,
 						const u32 Size);
 
+/** SHA3 Data Transfer and Copy Function */
+u32 XSecure_Sha3UpdateCopy(XSecure_Sha3 *InstancePtr, const u8 *Data,
+		u64 DstAddr, const u32 Size);
+
 /** SHA3 Finish Function*/
 u32 XSecure_Sha3Finish(XSecure_Sha3 *InstancePtr, u8 *Hash);
 
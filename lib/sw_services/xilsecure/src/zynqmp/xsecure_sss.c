@@ -19,6 +19,7 @@
 * 4.5   bsv     04/01/21 Added API to set SSS CFG register to PCAP
 * 4.6   am      09/17/21 Resolved compiler warnings
 * 4.7   am      11/26/21 Resolved doxygen warning
+* 5.3   ag      10/18/26 Added XSecure_SssShaDmaLoopBack API
 *
 * </pre>
 *
@@ -198,6 +199,60 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief
+ * This function configures the secure stream switch to feed DMA data to both
+ * the SHA engine and the DMA destination channel, so that data is hashed while
+ * it is copied by DMA in loop back mode.
+ *
+ * @param	InstancePtr	Instance pointer to the XSecure_Sss
+ * @param	DmaId		Device ID of DMA.
+ *
+ * @return	- XST_SUCCESS - on successful configuration of the switch.
+ *			- XST_FAILURE - on failure to configure switch
+ *
+ *****************************************************************************/
+u32 XSecure_SssShaDmaLoopBack(XSecure_Sss *InstancePtr, u16 DmaId)
+{
+	XSecure_SssSrc Resource = XSECURE_SSS_INVALID;
+	u32 ShaCfg;
+	u32 DmaCfg;
+	volatile u32 ShaCfgRedundant;
+	volatile u32 DmaCfgRedundant;
+	u32 Status = (u32)XST_FAILURE;
+
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(DmaId == 0U);
+
+	Status = XSecure_SssDmaSrc(DmaId, &Resource);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = (u32)XST_FAILURE;
+
+	/* DMA as input to SHA and to itself */
+	ShaCfg = (u32)XSecure_SssLookupTable[XSECURE_SSS_SHA][Resource] <<
+		(XSECURE_SSS_CFG_LEN_IN_BITS * (u32)XSECURE_SSS_SHA);
+	DmaCfg = (u32)XSecure_SssLookupTable[Resource][Resource] <<
+		(XSECURE_SSS_CFG_LEN_IN_BITS * (u32)Resource);
+
+	/* Recalculating to verify values */
+	ShaCfgRedundant = (u32)XSecure_SssLookupTable[XSECURE_SSS_SHA][Resource] <<
+		(XSECURE_SSS_CFG_LEN_IN_BITS * (u32)XSECURE_SSS_SHA);
+	DmaCfgRedundant = (u32)XSecure_SssLookupTable[Resource][Resource] <<
+		(XSECURE_SSS_CFG_LEN_IN_BITS * (u32)Resource);
+
+	if (((ShaCfg | DmaCfg) ^ (ShaCfgRedundant | DmaCfgRedundant)) == 0U) {
+		Status = (u32)XSecure_SecureOut32(InstancePtr->Address,
+				ShaCfg | DmaCfg);
+	}
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief
@@ -22,6 +22,7 @@
 * 4.5   bsv     04/01/21 Added API to set SSS CFG register to PCAP
 * 4.6   am      09/17/21 Resolved compiler warnings
 * 5.2   ng      07/05/23 Added support for system device tree flow
+* 5.3   ag      10/18/26 Added XSecure_SssShaDmaLoopBack API
 *
 * </pre>
 * @endcond
@@ -81,6 +82,7 @@ u32 XSecure_SssAes(XSecure_Sss *InstancePtr, XSecure_SssSrc InputSrc,
 		XSecure_SssSrc OutputSrc);
 u32 XSecure_SssSha(XSecure_Sss *InstancePtr, u16 DmaId);
 u32 XSecure_SssDmaLoopBack(XSecure_Sss *InstancePtr, u16 DmaId);
+u32 XSecure_SssShaDmaLoopBack(XSecure_Sss *InstancePtr, u16 DmaId);
 #ifdef XSECURE_TPM_ENABLE
 u32 XSecure_SssPcap(XSecure_Sss *InstancePtr, u16 DmaId);
 #endif